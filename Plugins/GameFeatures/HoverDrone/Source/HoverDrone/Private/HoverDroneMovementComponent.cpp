@@ -76,8 +76,7 @@ bool UHoverDroneMovementComponent::ResolvePenetrationImpl(const FVector& Adjustm
 	return true;
 }
 
-// note: only dealing with yaw for now, since that's what we care about
-void UHoverDroneMovementComponent::ApplyControlInputToRotation(float DeltaTime)
+bool UHoverDroneMovementComponent::GetRotationStepParams(FRotationStepParams& OutParams) const
 {
 	static auto GetVFOV = [](float ViewportAspectRatio, float HFOVDegrees)
 	{
@@ -96,26 +95,34 @@ void UHoverDroneMovementComponent::ApplyControlInputToRotation(float DeltaTime)
 
 	if (PC == nullptr)
 	{
-		return;
+		return false;
 	}
 
 	int ViewportWidth, ViewportHeight;
 	PC->GetViewportSize(ViewportWidth, ViewportHeight);
-	const float AspectRatio = (float)ViewportWidth / (float)ViewportHeight;
+	const float AspectRatio = ViewportHeight > 0 ? (float)ViewportWidth / (float)ViewportHeight : 16.0f / 9.0f;
 
-	const float CurrentHFOV = (PC && PC->PlayerCameraManager) ? PC->PlayerCameraManager->GetFOVAngle() : AssumedDefaultHFOV;
+	const float CurrentHFOV = PC->PlayerCameraManager ? PC->PlayerCameraManager->GetFOVAngle() : AssumedDefaultHFOV;
 	const float CurrentVFOV = GetVFOV(AspectRatio, CurrentHFOV);
 
 	const FVector FOV = FRotator(CurrentVFOV, CurrentHFOV, 0.0f).Euler();
 	const FVector AdjScalar = FOV / AssumedDefaultFOV;
-	FVector RotVelocityVec(RotVelocity.Euler());
+
+	OutParams.MaxRotSpeed = GetMaxRotationSpeed().Euler() * AdjScalar;
+	OutParams.RotAcceleration = AdjScalar * (bTurbo ? TurboRotAcceleration : RotAcceleration);
+	OutParams.RotDeceleration = AdjScalar * (bTurbo ? TurboRotDeceleration : RotDeceleration);
+	return true;
+}
+
+// note: only dealing with yaw for now, since that's what we care about
+void UHoverDroneMovementComponent::ApplyControlInputToRotation(const FRotationStepParams& Params, const FRotator& RotInput, FRotator& InOutRotVelocity, float DeltaTime)
+{
+	FVector RotVelocityVec(InOutRotVelocity.Euler());
 	
-	if (RotationInput.IsZero())
+	if (RotInput.IsZero())
 	{
 		// Decelerate towards zero!
-		const float CurrentRotDeacceleration = bTurbo ? TurboRotDeceleration : RotDeceleration;
-		const FVector AdjustedRotDecel = AdjScalar * CurrentRotDeacceleration;
-		const FVector VelocityDeltaVec = AdjustedRotDecel * -RotVelocityVec.GetSignVector() * DeltaTime;
+		const FVector VelocityDeltaVec = Params.RotDeceleration * -RotVelocityVec.GetSignVector() * DeltaTime;
 		const FVector VelocityMin = FVector::Min(FVector::ZeroVector, RotVelocityVec);
 		const FVector VelocityMax = FVector::Max(FVector::ZeroVector, RotVelocityVec);
 		RotVelocityVec = ClampVector(RotVelocityVec + VelocityDeltaVec, VelocityMin, VelocityMax);
@@ -125,91 +132,90 @@ void UHoverDroneMovementComponent::ApplyControlInputToRotation(float DeltaTime)
 		// updating rotation to avoid overshooting badly on long frames!
 		// don't let the delta take us out of bounds.
 		// note that if we're already out of bounds, we'll stay there
-		const FVector InputVec(RotationInput.Euler());
-		const FRotator RotSpeed = GetMaxRotationSpeed();
-		const FVector AdjustedMaxRotSpeed = RotSpeed.Euler() * AdjScalar;
-		const float CurrentRotAcceleration = bTurbo ? TurboRotAcceleration : RotAcceleration;
-		const FVector AdjustedRotAccel = AdjScalar * CurrentRotAcceleration;
+		const FVector InputVec(RotInput.Euler());
 
-		const FVector MaxVelMag = FVector::Min(FVector::OneVector, InputVec.GetAbs()) * AdjustedMaxRotSpeed;
+		const FVector MaxVelMag = FVector::Min(FVector::OneVector, InputVec.GetAbs()) * Params.MaxRotSpeed;
 		const FVector MaxDeltaVel = FVector::Max(FVector::ZeroVector, MaxVelMag - RotVelocityVec);
 		const FVector MinDeltaVel = FVector::Min(FVector::ZeroVector, -(RotVelocityVec + MaxVelMag));
-		const FVector DeltaVel = InputVec * AdjustedRotAccel * DeltaTime;
+		const FVector DeltaVel = InputVec * Params.RotAcceleration * DeltaTime;
 		RotVelocityVec += ClampVector(DeltaVel, MinDeltaVel, MaxDeltaVel);
 	}
 
-	RotVelocity = FRotator::MakeFromEuler(RotVelocityVec);
+	InOutRotVelocity = FRotator::MakeFromEuler(RotVelocityVec);
 }
 
-void UHoverDroneMovementComponent::AddRotationInput(FRotator NewRotInput)
+FRotator UHoverDroneMovementComponent::IntegrateRotation(FRotator Rotation, FRotator& InOutRotVelocity, const FRotationStepParams* Params, const FRotator& RotInput,
+	float DeltaTime, float MaxTimestep, float PitchMin, float PitchMax)
 {
-	RotationInput += NewRotInput;
-}
-
-void UHoverDroneMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	AController* Controller = PawnOwner->GetController();
-
-	if (PawnOwner == nullptr || UpdatedComponent == nullptr || Controller == nullptr || ShouldSkipUpdate(DeltaTime))
-	{
-		return;
-	}
-
 	float UnsimulatedTime = DeltaTime;
-	float StepTime = MaxSimulationTimestep > 0.f ? MaxSimulationTimestep : DeltaTime;
+	float StepTime = MaxTimestep > 0.f ? MaxTimestep : DeltaTime;
 
 	while (UnsimulatedTime > KINDA_SMALL_NUMBER)
 	{
 		// simulate!
 		float SimTime = FMath::Min(UnsimulatedTime, StepTime);
 
-		if (Controller->IsLocalPlayerController())
+		if (Params)
 		{
-			ApplyControlInputToRotation(SimTime);
+			ApplyControlInputToRotation(*Params, RotInput, InOutRotVelocity, SimTime);
 		}
 
-		FRotator RotDelta = RotVelocity * SimTime;
+		FRotator RotDelta = InOutRotVelocity * SimTime;
 
 		// enforce pitch limits
-		
-		FRotator::FReal const CurrentPitch = UpdatedComponent->GetComponentRotation().Pitch;
-		FRotator::FReal const MinDeltaPitch = MinPitch - CurrentPitch;
-		FRotator::FReal const MaxDeltaPitch = MaxPitch - CurrentPitch;
+		FRotator::FReal const MinDeltaPitch = PitchMin - Rotation.Pitch;
+		FRotator::FReal const MaxDeltaPitch = PitchMax - Rotation.Pitch;
 		FRotator::FReal const OldPitch = RotDelta.Pitch;
 		RotDelta.Pitch = FMath::Clamp(RotDelta.Pitch, MinDeltaPitch, MaxDeltaPitch);
 		if (OldPitch != RotDelta.Pitch)
 		{
 			// if we got clamped, zero the pitch velocity
-			RotVelocity.Pitch = FRotator::FReal(0.f);
+			InOutRotVelocity.Pitch = FRotator::FReal(0.f);
 		}
 
-		if (!RotDelta.IsNearlyZero())
-		{
-			FRotator const NewRot = UpdatedComponent->GetComponentRotation() + RotDelta;
+		Rotation += RotDelta;
+		UnsimulatedTime -= SimTime;
+	}
 
-			FHitResult Hit(1.f);
-			SafeMoveUpdatedComponent(FVector::ZeroVector, NewRot, false, Hit);
-		}
+	return Rotation;
+}
 
-		UnsimulatedTime -= SimTime;
+void UHoverDroneMovementComponent::AddRotationInput(FRotator NewRotInput)
+{
+	RotationInput += NewRotInput;
+}
+
+void UHoverDroneMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	AController* Controller = PawnOwner ? PawnOwner->GetController() : nullptr;
+
+	if (PawnOwner == nullptr || UpdatedComponent == nullptr || Controller == nullptr || ShouldSkipUpdate(DeltaTime))
+	{
+		return;
 	}
 
-	if (Controller && Controller->IsLocalPlayerController())
+	FRotationStepParams StepParams;
+	const bool bApplyRotationInput = Controller->IsLocalPlayerController() && GetRotationStepParams(StepParams);
+
+	// Substeps only integrate, the component moves once for the whole frame
+	const FRotator OldRot = UpdatedComponent->GetComponentRotation();
+	const FRotator NewRot = IntegrateRotation(OldRot, RotVelocity, bApplyRotationInput ? &StepParams : nullptr, RotationInput, DeltaTime, MaxSimulationTimestep, MinPitch, MaxPitch);
+
+	if (!(NewRot - OldRot).IsNearlyZero())
 	{
-		Controller->SetControlRotation(UpdatedComponent->GetComponentRotation());
+		FHitResult Hit(1.f);
+		SafeMoveUpdatedComponent(FVector::ZeroVector, NewRot, false, Hit);
 	}
 
-	// cache altitude
-	CurrentAltitude = MeasureAltitude(PawnOwner->GetActorLocation(), AltitudeTraceLength, bHasGround, LastGroundPosition);
-	if (!bHasGround)
+	if (Controller && Controller->IsLocalPlayerController())
 	{
-		// Test upwards as well if the ground was not found
-		CurrentAltitude = MeasureAltitude(PawnOwner->GetActorLocation() + FVector(0.0f, 0.0f, MaxAltitude), AltitudeTraceLength, bHasGround, LastGroundPosition) - MaxAltitude;
+		Controller->SetControlRotation(UpdatedComponent->GetComponentRotation());
 	}
 
-	bLastGroundPositionValid = bLastGroundPositionValid || bHasGround;
+	// cache altitude
+	UpdateAltitude();
 
 	// clear out any input, we've handled it (or ignored it)
 	RotationInput = FRotator::ZeroRotator;
@@ -221,11 +227,73 @@ void UHoverDroneMovementComponent::OnTeleported()
 
 	if (PawnOwner)
 	{
+		// Anything in flight was probing from where we used to be
+		AltitudeTraceHandle = FTraceHandle();
+
 		CurrentAltitude = MeasureAltitude(PawnOwner->GetActorLocation(), AltitudeTraceLength, bHasGround, LastGroundPosition);
 		bLastGroundPositionValid = bHasGround;
 	}
 }
 
+void UHoverDroneMovementComponent::UpdateAltitude()
+{
+	UWorld* World = GetWorld();
+	const FVector Location = PawnOwner->GetActorLocation();
+	bool bProbeUpwards = false;
+
+	if (AltitudeTraceHandle.IsValid())
+	{
+		FTraceDatum TraceData;
+		if (!World->QueryTraceData(AltitudeTraceHandle, TraceData))
+		{
+			if (World->IsTraceHandleValid(AltitudeTraceHandle, false))
+			{
+				// Still in flight
+				return;
+			}
+
+			// Lost, start over
+			AltitudeTraceHandle = FTraceHandle();
+		}
+		else
+		{
+			AltitudeTraceHandle = FTraceHandle();
+
+			// Measured against where we are now rather than where the probe started, so vertical movement since is accounted for
+			if (const FHitResult* Hit = FHitResult::GetFirstBlockingHit(TraceData.OutHits))
+			{
+				bHasGround = true;
+				LastGroundPosition = Hit->ImpactPoint;
+				CurrentAltitude = Location.Z - Hit->ImpactPoint.Z;
+			}
+			else if (!bAltitudeTraceUpwards)
+			{
+				// Test upwards as well if the ground was not found
+				bProbeUpwards = true;
+			}
+			else
+			{
+				bHasGround = false;
+				CurrentAltitude = Location.Z;
+			}
+
+			bLastGroundPositionValid = bLastGroundPositionValid || bHasGround;
+		}
+	}
+
+	IssueAltitudeTrace(Location, bProbeUpwards);
+}
+
+void UHoverDroneMovementComponent::IssueAltitudeTrace(const FVector& Location, bool bUpwards)
+{
+	FCollisionQueryParams TraceParams(NAME_None, FCollisionQueryParams::GetUnknownStatId(), true, PawnOwner);
+
+	FVector const TraceStart = bUpwards ? Location + FVector(0.0f, 0.0f, MaxAltitude) : Location;
+	FVector const TraceEnd = TraceStart - FVector::UpVector * AltitudeTraceLength;
+	AltitudeTraceHandle = GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd, ECC_WorldStatic, TraceParams);
+	bAltitudeTraceUpwards = bUpwards;
+}
+
 float UHoverDroneMovementComponent::MeasureAltitude(FVector Location, float TestHeight, bool& bHitFoundOut, FVector& HitPositionOut) const
 {
 	FCollisionQueryParams TraceParams(NAME_None, FCollisionQueryParams::GetUnknownStatId(), true, PawnOwner);
@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HoverDroneMovementComponent.h"
+
+namespace HoverDroneMovementTests
+{
+	static const float MaxSimulationTimestep = 1.f / 60.f;
+	static const float MinPitch = -88.f;
+	static const float MaxPitch = 88.f;
+
+	static const FRotator MaxRotationSpeed(70.f, 110.f, 0.f);
+	static const float RotAcceleration = 150.f;
+	static const float RotDeceleration = 150.f;
+
+	/**
+	 * One tick of the rotation as the component used to do it: the FOV adjusted rates applied and the component moved every
+	 * substep, with the pitch limits taken from the component's rotation. ComponentRotation stands in for the component,
+	 * round tripping through a quaternion on each move the way the scene component stores it.
+	 */
+	static void LegacyTick(FRotator& ComponentRotation, FRotator& RotVelocity, const FRotator& RotationInput, const FVector& AdjScalar, float DeltaTime)
+	{
+		float UnsimulatedTime = DeltaTime;
+		float StepTime = MaxSimulationTimestep > 0.f ? MaxSimulationTimestep : DeltaTime;
+
+		while (UnsimulatedTime > KINDA_SMALL_NUMBER)
+		{
+			// simulate!
+			float SimTime = FMath::Min(UnsimulatedTime, StepTime);
+
+			FVector RotVelocityVec(RotVelocity.Euler());
+
+			if (RotationInput.IsZero())
+			{
+				// Decelerate towards zero!
+				const FVector AdjustedRotDecel = AdjScalar * RotDeceleration;
+				const FVector VelocityDeltaVec = AdjustedRotDecel * -RotVelocityVec.GetSignVector() * SimTime;
+				const FVector VelocityMin = FVector::Min(FVector::ZeroVector, RotVelocityVec);
+				const FVector VelocityMax = FVector::Max(FVector::ZeroVector, RotVelocityVec);
+				RotVelocityVec = ClampVector(RotVelocityVec + VelocityDeltaVec, VelocityMin, VelocityMax);
+			}
+			else
+			{
+				const FVector InputVec(RotationInput.Euler());
+				const FVector AdjustedMaxRotSpeed = MaxRotationSpeed.Euler() * AdjScalar;
+				const FVector AdjustedRotAccel = AdjScalar * RotAcceleration;
+
+				const FVector MaxVelMag = FVector::Min(FVector::OneVector, InputVec.GetAbs()) * AdjustedMaxRotSpeed;
+				const FVector MaxDeltaVel = FVector::Max(FVector::ZeroVector, MaxVelMag - RotVelocityVec);
+				const FVector MinDeltaVel = FVector::Min(FVector::ZeroVector, -(RotVelocityVec + MaxVelMag));
+				const FVector DeltaVel = InputVec * AdjustedRotAccel * SimTime;
+				RotVelocityVec += ClampVector(DeltaVel, MinDeltaVel, MaxDeltaVel);
+			}
+
+			RotVelocity = FRotator::MakeFromEuler(RotVelocityVec);
+
+			FRotator RotDelta = RotVelocity * SimTime;
+
+			// enforce pitch limits
+			FRotator::FReal const CurrentPitch = ComponentRotation.Pitch;
+			FRotator::FReal const MinDeltaPitch = MinPitch - CurrentPitch;
+			FRotator::FReal const MaxDeltaPitch = MaxPitch - CurrentPitch;
+			FRotator::FReal const OldPitch = RotDelta.Pitch;
+			RotDelta.Pitch = FMath::Clamp(RotDelta.Pitch, MinDeltaPitch, MaxDeltaPitch);
+			if (OldPitch != RotDelta.Pitch)
+			{
+				// if we got clamped, zero the pitch velocity
+				RotVelocity.Pitch = FRotator::FReal(0.f);
+			}
+
+			if (!RotDelta.IsNearlyZero())
+			{
+				ComponentRotation = (ComponentRotation + RotDelta).Quaternion().Rotator();
+			}
+
+			UnsimulatedTime -= SimTime;
+		}
+	}
+
+	/** One tick of the rotation as the component does it now: integrate every substep, then move once */
+	static void Tick(FRotator& ComponentRotation, FRotator& RotVelocity, const FRotator& RotationInput, const FVector& AdjScalar, float DeltaTime)
+	{
+		UHoverDroneMovementComponent::FRotationStepParams Params;
+		Params.MaxRotSpeed = MaxRotationSpeed.Euler() * AdjScalar;
+		Params.RotAcceleration = AdjScalar * RotAcceleration;
+		Params.RotDeceleration = AdjScalar * RotDeceleration;
+
+		const FRotator NewRotation = UHoverDroneMovementComponent::IntegrateRotation(ComponentRotation, RotVelocity, &Params, RotationInput, DeltaTime, MaxSimulationTimestep, MinPitch, MaxPitch);
+		if (!(NewRotation - ComponentRotation).IsNearlyZero())
+		{
+			ComponentRotation = NewRotation.Quaternion().Rotator();
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHoverDroneRotationDeterminismTest, "HoverDrone.Movement.RotationDeterminism", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Scripted rotation input and long frames end up in the same place moving once per tick as they did moving every substep */
+bool FHoverDroneRotationDeterminismTest::RunTest(const FString& Parameters)
+{
+	using namespace HoverDroneMovementTests;
+
+	static const int NumUpdates = 12;
+	static const float dtarray[NumUpdates] = { 0.016f, 0.016f, 0.1f, 0.033f, 0.25f, 0.008f, 0.016f, 0.5f, 0.016f, 0.05f, 0.016f, 0.3f };
+	static const FRotator InputArray[NumUpdates] =
+	{
+		FRotator(0.f, 1.f, 0.f), FRotator(0.5f, 1.f, 0.f), FRotator(1.f, 0.f, 0.f), FRotator(1.f, -0.5f, 0.f),
+		FRotator::ZeroRotator, FRotator::ZeroRotator, FRotator(-1.f, -1.f, 0.f), FRotator(-1.f, 0.2f, 0.f),
+		FRotator(0.f, 2.f, 0.f), FRotator::ZeroRotator, FRotator(1.f, 1.f, 0.f), FRotator::ZeroRotator,
+	};
+
+	// Scales for the default FOV and a zoomed in one, as GetRotationStepParams works them out (roll always comes out as 0)
+	const FVector AdjScalars[] = { FVector(0.f, 1.f, 1.f), FVector(0.f, 0.4f, 0.4f) };
+
+	for (const FVector& AdjScalar : AdjScalars)
+	{
+		// Starting close to the pitch limit so it gets hit
+		FRotator Rotation(80.f, 170.f, 0.f);
+		FRotator RotVelocity = FRotator::ZeroRotator;
+		FRotator LegacyRotation = Rotation;
+		FRotator LegacyRotVelocity = RotVelocity;
+
+		double MaxAngleError = 0.0;
+		double MaxVelocityError = 0.0;
+		for (int i = 0; i < NumUpdates; ++i)
+		{
+			Tick(Rotation, RotVelocity, InputArray[i], AdjScalar, dtarray[i]);
+			LegacyTick(LegacyRotation, LegacyRotVelocity, InputArray[i], AdjScalar, dtarray[i]);
+
+			MaxAngleError = FMath::Max(MaxAngleError, Rotation.Quaternion().AngularDistance(LegacyRotation.Quaternion()));
+			MaxVelocityError = FMath::Max(MaxVelocityError, (RotVelocity.Euler() - LegacyRotVelocity.Euler()).GetAbsMax());
+		}
+
+		AddInfo(FString::Printf(TEXT("FOV scale %.2f: rotation %s, previously %s"), AdjScalar.Z, *Rotation.ToString(), *LegacyRotation.ToString()));
+		TestTrue(FString::Printf(TEXT("Rotation matches at FOV scale %.2f (max error %g rad)"), AdjScalar.Z, MaxAngleError), MaxAngleError <= UE_KINDA_SMALL_NUMBER);
+		TestTrue(FString::Printf(TEXT("Rotation velocity matches at FOV scale %.2f (max error %g)"), AdjScalar.Z, MaxVelocityError), MaxVelocityError <= UE_KINDA_SMALL_NUMBER);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/EngineBaseTypes.h"
+#include "Engine/EngineTypes.h"
 #include "GameFramework/FloatingPawnMovement.h"
 #include "Math/MathFwd.h"
 #include "Math/Quat.h"
@@ -10,6 +11,7 @@
 #include "Math/Vector.h"
 #include "Math/Vector2D.h"
 #include "UObject/UObjectGlobals.h"
+#include "WorldCollision.h"
 
 #include "HoverDroneMovementComponent.generated.h"
 
@@ -43,6 +45,23 @@ public:
 
 	const FVector& GetLastControlAcceleration() const {return LastControlAcceleration;}
 
+	/** Rotation rates for one frame, already scaled for the current FOV so substeps don't query the viewport or camera */
+	struct FRotationStepParams
+	{
+		FVector MaxRotSpeed = FVector::ZeroVector;
+		FVector RotAcceleration = FVector::ZeroVector;
+		FVector RotDeceleration = FVector::ZeroVector;
+	};
+
+	static void ApplyControlInputToRotation(const FRotationStepParams& Params, const FRotator& RotInput, FRotator& InOutRotVelocity, float DeltaTime);
+
+	/**
+	 * Substeps RotVelocity over DeltaTime and returns where Rotation ends up, with the pitch limits applied per substep.
+	 * Params is null when rotation input isn't being applied.
+	 */
+	static FRotator IntegrateRotation(FRotator Rotation, FRotator& InOutRotVelocity, const FRotationStepParams* Params, const FRotator& RotInput,
+		float DeltaTime, float MaxTimestep, float PitchMin, float PitchMax);
+
 protected:
 
 	//~ Begin UFloatingPawnMovement interface
@@ -108,9 +127,15 @@ protected:
 	FRotator RotVelocity;
 	
 private:
+	/** Returns false when there is no player controller to take the view from */
+	bool GetRotationStepParams(FRotationStepParams& OutParams) const;
 
-	void ApplyControlInputToRotation(float DeltaTime);
 	float MeasureAltitude(FVector Location, float TestHeight, bool& bHitFoundOut, FVector& HitPositionOut) const;
+
+	/** Picks up the last altitude probe if it has landed and starts the next one; the previous altitude stands in the meantime */
+	void UpdateAltitude();
+	void IssueAltitudeTrace(const FVector& Location, bool bUpwards);
+
 	FRotator GetMaxRotationSpeed() const;
 	void RestrictDroneInput();
 
@@ -137,7 +162,8 @@ private:
 	FVector LastGroundPosition;
 	bool bHasGround = true;
 	bool bLastGroundPositionValid = false;
-};
-
-
 
+	/** Altitude probe in flight. Probes downwards first, then from MaxAltitude above if nothing was found below. */
+	FTraceHandle AltitudeTraceHandle;
+	bool bAltitudeTraceUpwards = false;
+};
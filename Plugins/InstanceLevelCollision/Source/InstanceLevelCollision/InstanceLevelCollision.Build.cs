@@ -62,6 +62,8 @@ public class InstanceLevelCollision : ModuleRules
 				"MeshDescription",
 				"StaticMeshDescription",
 				"MeshReductionInterface",
+				"DerivedDataCache",
+				"Json",
 				"UMG",
 				"UMGEditor",
 				"Blutility",
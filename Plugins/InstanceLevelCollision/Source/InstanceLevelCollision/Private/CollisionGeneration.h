@@ -0,0 +1,32 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "InstanceLevelCollisionBPLibrary.h"
+#include "PreSimplifiedMeshCache.h"
+
+class ALevelInstance;
+class AStaticMeshActor;
+class UStaticMesh;
+
+/** What the game thread gathers for FCollisionMeshPipeline */
+struct FCollisionGenerationInput
+{
+	FString LevelName;
+	FString SavePath;
+	FTransform OriginalTransform;
+
+	/** The merged, pre-simplified meshes with everything under the cap removed */
+	UE::Geometry::FDynamicMesh3 MergedMesh;
+
+	/** Only used as an occluder while jacketing */
+	UE::Geometry::FDynamicMesh3 Cap;
+
+	FPreSimplificationReport PreSimplificationReport;
+};
+
+/** GenerateCollision's game thread halves, shared with UGenerateInstanceLevelCollisionCommandlet */
+void PrepareCollisionInput(ALevelInstance* LevelInstance, const TArray<AStaticMeshActor*>& SelectedMeshActor, float ZOffset, ECollisionMaxSlice CollisionType, int PreSimplificationPercentage, FCollisionGenerationInput& OutInput);
+UStaticMesh* CreateCollisionMesh(ALevelInstance* LevelInstance, const UE::Geometry::FDynamicMesh3& FinalMesh, FString LevelName, FString SavePath, FTransform OriginalTransform, bool bSaveAsset);
@@ -0,0 +1,157 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CollisionMeshImport.h"
+
+#include "DynamicMesh/Operations/MergeCoincidentMeshEdges.h"
+#include "HAL/PlatformTime.h"
+#include "IndexTypes.h"
+#include "Interfaces/Interface_CollisionDataProvider.h"
+#include "Math/IntVector.h"
+
+using namespace UE::Geometry;
+
+//////////////////////////////////////////////////////////////////////
+// FCollisionMeshImportStats
+
+FString FCollisionMeshImportStats::ToString() const
+{
+	return FString::Printf(TEXT("%d vertices, %d triangles in: %d welded, %d duplicate and %d degenerate triangles dropped, %d vertices split, %.3fs"),
+		NumInputVertices, NumInputTriangles, NumWeldedVertices, NumDuplicateTriangles, NumDegenerateTriangles, NumSplitVertices, Seconds);
+}
+
+//////////////////////////////////////////////////////////////////////
+// FCollisionMeshImporter
+
+void FCollisionMeshImporter::Import(const FTriMeshCollisionData& CollisionData, FDynamicMesh3& OutMesh, const FCollisionMeshImportSettings& Settings, FCollisionMeshImportStats* OutStats)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FCollisionMeshImportStats Stats;
+	Stats.NumInputVertices = CollisionData.Vertices.Num();
+	Stats.NumInputTriangles = CollisionData.Indices.Num();
+
+	OutMesh.Clear();
+
+	// Each cell keeps the first vertex that lands in it, so the result only depends on the input order
+	const double InvCellSize = 1.0 / FMath::Max(Settings.WeldTolerance, UE_DOUBLE_SMALL_NUMBER);
+	TMap<FInt64Vector3, int32> CellToVertex;
+	CellToVertex.Reserve(Stats.NumInputVertices);
+	TArray<int32> InputToVertex;
+	InputToVertex.SetNumUninitialized(Stats.NumInputVertices);
+
+	for (int32 InputIndex = 0; InputIndex < Stats.NumInputVertices; ++InputIndex)
+	{
+		const FVector3d Position = (FVector3d)CollisionData.Vertices[InputIndex];
+		const FInt64Vector3 Cell(
+			(int64)FMath::RoundToDouble(Position.X * InvCellSize),
+			(int64)FMath::RoundToDouble(Position.Y * InvCellSize),
+			(int64)FMath::RoundToDouble(Position.Z * InvCellSize));
+
+		if (const int32* Existing = CellToVertex.Find(Cell))
+		{
+			InputToVertex[InputIndex] = *Existing;
+			++Stats.NumWeldedVertices;
+		}
+		else
+		{
+			const int32 VertexID = OutMesh.AppendVertex(Position);
+			CellToVertex.Add(Cell, VertexID);
+			InputToVertex[InputIndex] = VertexID;
+		}
+	}
+
+	// Sorted so that the same three vertices match in any winding, as FindTriangle did
+	TSet<FIndex3i> SeenTriangles;
+	SeenTriangles.Reserve(Stats.NumInputTriangles);
+
+	for (const FTriIndices& T : CollisionData.Indices)
+	{
+		FIndex3i Triangle(InputToVertex[T.v0], InputToVertex[T.v1], InputToVertex[T.v2]);
+		if (Triangle.A == Triangle.B || Triangle.B == Triangle.C || Triangle.C == Triangle.A)
+		{
+			++Stats.NumDegenerateTriangles;
+			continue;
+		}
+
+		FIndex3i SortedTriangle = Triangle;
+		if (SortedTriangle.A > SortedTriangle.B) Swap(SortedTriangle.A, SortedTriangle.B);
+		if (SortedTriangle.B > SortedTriangle.C) Swap(SortedTriangle.B, SortedTriangle.C);
+		if (SortedTriangle.A > SortedTriangle.B) Swap(SortedTriangle.A, SortedTriangle.B);
+
+		bool bAlreadySeen = false;
+		SeenTriangles.Add(SortedTriangle, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			++Stats.NumDuplicateTriangles;
+			continue;
+		}
+
+		// An edge that already has two triangles can't take a third, so this triangle gets its own copy of that edge
+		bool bSplitVertex[3] = { false, false, false };
+		for (int32 EdgeIndex = 0; EdgeIndex < 3; ++EdgeIndex)
+		{
+			const int32 EdgeID = OutMesh.FindEdge(Triangle[EdgeIndex], Triangle[(EdgeIndex + 1) % 3]);
+			if (EdgeID != FDynamicMesh3::InvalidID && !OutMesh.IsBoundaryEdge(EdgeID))
+			{
+				bSplitVertex[EdgeIndex] = true;
+				bSplitVertex[(EdgeIndex + 1) % 3] = true;
+			}
+		}
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			if (bSplitVertex[Corner])
+			{
+				Triangle[Corner] = OutMesh.AppendVertex(OutMesh, Triangle[Corner]);
+				++Stats.NumSplitVertices;
+			}
+		}
+
+		if (OutMesh.AppendTriangle(Triangle) == FDynamicMesh3::NonManifoldID)
+		{
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				if (!bSplitVertex[Corner])
+				{
+					Triangle[Corner] = OutMesh.AppendVertex(OutMesh, Triangle[Corner]);
+					++Stats.NumSplitVertices;
+				}
+			}
+			OutMesh.AppendTriangle(Triangle);
+		}
+	}
+
+	Stats.Seconds = FPlatformTime::Seconds() - StartTime;
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+}
+
+void FCollisionMeshImporter::ImportReference(const FTriMeshCollisionData& CollisionData, FDynamicMesh3& OutMesh)
+{
+	OutMesh.Clear();
+	for (const FVector3f& V : CollisionData.Vertices)
+	{
+		OutMesh.AppendVertex((FVector3d)V);
+	}
+	for (const FTriIndices& T : CollisionData.Indices)
+	{
+		if (OutMesh.FindTriangle(T.v0, T.v1, T.v2) != FDynamicMesh3::InvalidID)
+		{
+			continue; // skip duplicate triangles in mesh
+		}
+		if (FDynamicMesh3::NonManifoldID == OutMesh.AppendTriangle(T.v0, T.v1, T.v2))
+		{
+			int New0 = OutMesh.AppendVertex(OutMesh, T.v0);
+			int New1 = OutMesh.AppendVertex(OutMesh, T.v1);
+			int New2 = OutMesh.AppendVertex(OutMesh, T.v2);
+			OutMesh.AppendTriangle(New0, New1, New2);
+		}
+	}
+
+	if (OutMesh.TriangleCount() > 0)
+	{
+		FMergeCoincidentMeshEdges Merger(&OutMesh);
+		Merger.Apply();
+	}
+}
@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+
+struct FTriMeshCollisionData;
+
+struct FCollisionMeshImportSettings
+{
+	/** Vertices that quantize to the same cell of this size are welded */
+	double WeldTolerance = 0.001;
+};
+
+struct FCollisionMeshImportStats
+{
+	int32 NumInputVertices = 0;
+	int32 NumInputTriangles = 0;
+	int32 NumWeldedVertices = 0;
+	int32 NumDuplicateTriangles = 0;
+	int32 NumDegenerateTriangles = 0;
+
+	/** Vertices added to keep triangles beyond the second on an edge from making it non-manifold */
+	int32 NumSplitVertices = 0;
+
+	double Seconds = 0.0;
+
+	FString ToString() const;
+};
+
+/**
+ * Turns physics collision triangles into an FDynamicMesh3 in one linear pass: coincident vertices are welded through a
+ * quantized spatial hash, repeated triangles are dropped through a hash of their sorted indices, and the edges of a
+ * triangle that would make the mesh non-manifold get their own copies of their vertices, in input order.
+ */
+class FCollisionMeshImporter
+{
+public:
+	static void Import(const FTriMeshCollisionData& CollisionData, UE::Geometry::FDynamicMesh3& OutMesh, const FCollisionMeshImportSettings& Settings = FCollisionMeshImportSettings(), FCollisionMeshImportStats* OutStats = nullptr);
+
+	/** The per-triangle FindTriangle import this replaces, followed by FMergeCoincidentMeshEdges; kept as the reference for tests */
+	static void ImportReference(const FTriMeshCollisionData& CollisionData, UE::Geometry::FDynamicMesh3& OutMesh);
+};
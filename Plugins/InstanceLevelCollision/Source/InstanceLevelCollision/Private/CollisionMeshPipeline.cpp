@@ -0,0 +1,512 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CollisionMeshPipeline.h"
+
+#include "Async/ParallelFor.h"
+#include "CleaningOps/RemeshMeshOp.h"
+#include "CleaningOps/RemoveOccludedTrianglesOp.h"
+#include "CleaningOps/SimplifyMeshOp.h"
+#include "CompositionOps/VoxelMorphologyMeshesOp.h"
+#include "CompositionOps/VoxelSolidifyMeshesOp.h"
+#include "ConstrainedDelaunay2.h"
+#include "DynamicMesh/DynamicMeshAABBTree3.h"
+#include "DynamicMeshEditor.h"
+#include "DynamicMeshToMeshDescription.h"
+#include "MeshDescription.h"
+#include "Operations/MeshPlaneCut.h"
+#include "Operations/MeshSelfUnion.h"
+#include "Selections/MeshConnectedComponents.h"
+#include "StaticMeshAttributes.h"
+
+using namespace UE::Geometry;
+
+namespace CollisionMeshPipeline
+{
+	/** Share of the total progress each stage takes, in ECollisionPipelineStage order */
+	static const float StageWeights[] = { 0.2f, 0.15f, 0.5f, 0.05f, 0.1f };
+
+	static const int32 MaxTilesPerAxis = 16;
+
+	struct FTile
+	{
+		/** What the tile owns; its output is trimmed to this, plus a voxel of overlap, on the sides with a neighbour */
+		FAxisAlignedBox3d CoreBox;
+
+		/** Input gathered for the tile, the core box plus the margin */
+		FAxisAlignedBox3d InputBox;
+
+		/** The input box grown out to whole voxels of the untiled grid, so every tile samples the same points */
+		FAxisAlignedBox3d GridBox;
+
+		bool bHasNeighbour[4] = { false, false, false, false }; // -X, +X, -Y, +Y
+
+		TUniquePtr<FDynamicMesh3> Result;
+	};
+
+	static double CalculateTargetEdgeLength(int TargetTriCount, TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> OriginalMesh)
+	{
+		double InitialMeshArea = 0;
+		for (int tid : OriginalMesh->TriangleIndicesItr())
+		{
+			InitialMeshArea += OriginalMesh->GetTriArea(tid);
+		}
+
+		double TargetTriArea = InitialMeshArea / (double)TargetTriCount;
+		double EdgeLen = TriangleUtil::EquilateralEdgeLengthForArea(TargetTriArea);
+		return (double)FMath::RoundToInt(EdgeLen * 100.0) / 100.0;
+	}
+
+	/** Box grown out to the nearest voxel boundaries of the grid with its origin at GridOrigin */
+	static FAxisAlignedBox3d SnapToVoxels(const FAxisAlignedBox3d& Box, const FVector3d& GridOrigin, double VoxelSize)
+	{
+		FAxisAlignedBox3d Snapped;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Snapped.Min[Axis] = GridOrigin[Axis] + FMath::FloorToDouble((Box.Min[Axis] - GridOrigin[Axis]) / VoxelSize) * VoxelSize;
+			Snapped.Max[Axis] = GridOrigin[Axis] + FMath::CeilToDouble((Box.Max[Axis] - GridOrigin[Axis]) / VoxelSize) * VoxelSize;
+		}
+		return Snapped;
+	}
+
+	/** Adds a degenerate triangle at either corner of Box. They carry no winding, but the voxel ops size their grids from the input bounds. */
+	static void AnchorToBox(FDynamicMesh3& Mesh, const FAxisAlignedBox3d& Box)
+	{
+		for (const FVector3d& Corner : { Box.Min, Box.Max })
+		{
+			Mesh.AppendTriangle(Mesh.AppendVertex(Corner), Mesh.AppendVertex(Corner), Mesh.AppendVertex(Corner));
+		}
+	}
+
+	/** Removes the connected pieces of Mesh that lie entirely outside Box, such as what the close makes of the anchors */
+	static void RemoveComponentsOutside(FDynamicMesh3& Mesh, const FAxisAlignedBox3d& Box)
+	{
+		FMeshConnectedComponents Components(&Mesh);
+		Components.FindConnectedTriangles();
+
+		FDynamicMeshEditor Editor(&Mesh);
+		for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ++ComponentIndex)
+		{
+			const FMeshConnectedComponents::FComponent& Component = Components.GetComponent(ComponentIndex);
+			FAxisAlignedBox3d ComponentBox = FAxisAlignedBox3d::Empty();
+			for (int32 TriangleID : Component.Indices)
+			{
+				ComponentBox.Contain(Mesh.GetTriBounds(TriangleID));
+			}
+
+			if (!Box.Intersects(ComponentBox))
+			{
+				Editor.RemoveTriangles(Component.Indices, true);
+			}
+		}
+	}
+
+	/** Copies the triangles of Mesh that touch Box */
+	static void ExtractTriangles(const FDynamicMesh3& Mesh, const FAxisAlignedBox3d& Box, FDynamicMesh3& OutMesh)
+	{
+		TArray<int32> VertexMap;
+		VertexMap.Init(IndexConstants::InvalidID, Mesh.MaxVertexID());
+
+		for (int32 TriangleID : Mesh.TriangleIndicesItr())
+		{
+			if (!Box.Intersects(Mesh.GetTriBounds(TriangleID)))
+			{
+				continue;
+			}
+
+			const FIndex3i Triangle = Mesh.GetTriangle(TriangleID);
+			FIndex3i NewTriangle;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				int32& NewVertex = VertexMap[Triangle[Corner]];
+				if (NewVertex == IndexConstants::InvalidID)
+				{
+					NewVertex = OutMesh.AppendVertex(Mesh.GetVertex(Triangle[Corner]));
+				}
+				NewTriangle[Corner] = NewVertex;
+			}
+			OutMesh.AppendTriangle(NewTriangle);
+		}
+	}
+
+	/** Cuts away what lies outside Box on the sides of Tile that have a neighbour, capping the openings so the mesh stays closed */
+	static void CutToBox(FDynamicMesh3& Mesh, const FTile& Tile, const FAxisAlignedBox3d& Box)
+	{
+		const FVector3d Origins[4] = { Box.Min, Box.Max, Box.Min, Box.Max };
+		const FVector3d Normals[4] = { -FVector3d::UnitX(), FVector3d::UnitX(), -FVector3d::UnitY(), FVector3d::UnitY() };
+
+		for (int32 Side = 0; Side < 4; ++Side)
+		{
+			if (Tile.bHasNeighbour[Side])
+			{
+				// Removes the triangles on the positive side of the plane
+				FMeshPlaneCut Cut(&Mesh, Origins[Side], Normals[Side]);
+				Cut.Cut();
+				Cut.HoleFill(ConstrainedDelaunayTriangulate<double>, true);
+			}
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////
+// FCollisionPipelineProgress
+
+FCollisionPipelineProgress::FCollisionPipelineProgress()
+{
+	ProgressCancel.CancelF = [this]()
+	{
+		return IsCancelled();
+	};
+}
+
+FText FCollisionPipelineProgress::GetStageText(ECollisionPipelineStage Stage)
+{
+	switch (Stage)
+	{
+	case ECollisionPipelineStage::Remesh:
+		return NSLOCTEXT("Remeshing", "Remeshing", "Remeshing ...");
+	case ECollisionPipelineStage::Jacketing:
+		return NSLOCTEXT("Jacketing", "Jacketing", "Jacketing ...");
+	case ECollisionPipelineStage::Voxelize:
+		return NSLOCTEXT("VoxWrap", "VoxWrap", "Vox Wrap ...");
+	case ECollisionPipelineStage::Stitch:
+		return NSLOCTEXT("Stitching", "Stitching", "Stitching tiles ...");
+	case ECollisionPipelineStage::Simplify:
+		return NSLOCTEXT("Simplifying", "Simplifying", "Simplifying ...");
+	default:
+		return FText::GetEmpty();
+	}
+}
+
+void FCollisionPipelineProgress::EnterStage(ECollisionPipelineStage NewStage)
+{
+	float StageStart = 0.f;
+	for (int32 StageIndex = 0; StageIndex < (int32)NewStage && StageIndex < UE_ARRAY_COUNT(CollisionMeshPipeline::StageWeights); ++StageIndex)
+	{
+		StageStart += CollisionMeshPipeline::StageWeights[StageIndex];
+	}
+
+	Stage = NewStage;
+	Progress = NewStage == ECollisionPipelineStage::Done ? 1.f : StageStart;
+}
+
+void FCollisionPipelineProgress::SetStageFraction(float Fraction)
+{
+	const ECollisionPipelineStage CurrentStage = Stage;
+	if (CurrentStage == ECollisionPipelineStage::Done)
+	{
+		return;
+	}
+
+	float StageStart = 0.f;
+	for (int32 StageIndex = 0; StageIndex < (int32)CurrentStage; ++StageIndex)
+	{
+		StageStart += CollisionMeshPipeline::StageWeights[StageIndex];
+	}
+
+	Progress = StageStart + CollisionMeshPipeline::StageWeights[(int32)CurrentStage] * FMath::Clamp(Fraction, 0.f, 1.f);
+}
+
+//////////////////////////////////////////////////////////////////////
+// FCollisionMeshPipeline
+
+TUniquePtr<FDynamicMesh3> FCollisionMeshPipeline::Run(FDynamicMesh3&& MergedMesh, const FDynamicMesh3& Cap, const FCollisionPipelineSettings& Settings, IMeshReduction* MeshReduction, FCollisionPipelineProgress& Progress)
+{
+	FProgressCancel* ProgressCancel = Progress.GetProgressCancel();
+
+	TUniquePtr<FDynamicMesh3> Mesh;
+	if (Settings.bRemesh)
+	{
+		Progress.EnterStage(ECollisionPipelineStage::Remesh);
+		Mesh = Remesh(MergedMesh, ProgressCancel);
+		MergedMesh.Clear();
+	}
+	else
+	{
+		Mesh = MakeUnique<FDynamicMesh3>(MoveTemp(MergedMesh));
+	}
+	if (Progress.IsCancelled())
+	{
+		return nullptr;
+	}
+
+	Progress.EnterStage(ECollisionPipelineStage::Jacketing);
+	Mesh = Jacket(MoveTemp(Mesh), Cap, ProgressCancel);
+	if (Progress.IsCancelled())
+	{
+		return nullptr;
+	}
+
+	Mesh = SolidifyTiled(*Mesh, Settings, Progress);
+	if (!Mesh.IsValid() || Progress.IsCancelled())
+	{
+		return nullptr;
+	}
+
+	Progress.EnterStage(ECollisionPipelineStage::Simplify);
+	Mesh = Simplify(*Mesh, Settings.TargetTriangleCount, MeshReduction, ProgressCancel);
+	if (Progress.IsCancelled())
+	{
+		return nullptr;
+	}
+
+	Progress.EnterStage(ECollisionPipelineStage::Done);
+	return Mesh;
+}
+
+int64 FCollisionMeshPipeline::EstimatePeakMemory(const FDynamicMesh3& MergedMesh, const FCollisionPipelineSettings& Settings)
+{
+	// A handful of mesh copies and AABB trees are alive at once, then the voxel grids of the wrap and close
+	const int64 BytesPerTriangle = 750;
+	const int64 BytesPerVoxel = 16;
+	const int64 VoxelDensity = FMath::Max(Settings.VoxelDensity, 1);
+	return MergedMesh.TriangleCount() * BytesPerTriangle + VoxelDensity * VoxelDensity * VoxelDensity * BytesPerVoxel;
+}
+
+TUniquePtr<FDynamicMesh3> FCollisionMeshPipeline::SolidifyTiled(const FDynamicMesh3& Mesh, const FCollisionPipelineSettings& Settings, FCollisionPipelineProgress& Progress)
+{
+	using namespace CollisionMeshPipeline;
+
+	Progress.EnterStage(ECollisionPipelineStage::Voxelize);
+
+	const FAxisAlignedBox3d Bounds = Mesh.GetBounds();
+	const int32 VoxelDensity = FMath::Max(Settings.VoxelDensity, 1);
+	const double VoxelSize = Bounds.MaxDim() / VoxelDensity;
+	const int32 MaxVoxelsPerTile = FMath::Max(Settings.MaxVoxelsPerTile, 8);
+
+	int32 NumTilesX = 1;
+	int32 NumTilesY = 1;
+	if (VoxelSize > 0.0)
+	{
+		NumTilesX = FMath::Clamp(FMath::CeilToInt32(Bounds.Width() / VoxelSize / MaxVoxelsPerTile - UE_KINDA_SMALL_NUMBER), 1, MaxTilesPerAxis);
+		NumTilesY = FMath::Clamp(FMath::CeilToInt32(Bounds.Height() / VoxelSize / MaxVoxelsPerTile - UE_KINDA_SMALL_NUMBER), 1, MaxTilesPerAxis);
+	}
+
+	if (NumTilesX * NumTilesY == 1)
+	{
+		TUniquePtr<FDynamicMesh3> Result = VoxelSize > 0.0
+			? SolidifyAndClose(Mesh, VoxelSize, FAxisAlignedBox3d::Empty(), Settings.Winding, Progress.GetProgressCancel())
+			: MakeUnique<FDynamicMesh3>();
+		return Progress.IsCancelled() ? nullptr : MoveTemp(Result);
+	}
+
+	// The anchors SolidifyAndClose leaves at the grid corners must stay clear of the mesh to be told apart from it
+	const double Margin = FMath::Max(Settings.TileMarginVoxels, 3) * VoxelSize;
+	const double TileWidth = Bounds.Width() / NumTilesX;
+	const double TileHeight = Bounds.Height() / NumTilesY;
+
+	TArray<FTile> Tiles;
+	Tiles.SetNum(NumTilesX * NumTilesY);
+	for (int32 TileY = 0; TileY < NumTilesY; ++TileY)
+	{
+		for (int32 TileX = 0; TileX < NumTilesX; ++TileX)
+		{
+			FTile& Tile = Tiles[TileY * NumTilesX + TileX];
+			const FVector3d CoreMin(Bounds.Min.X + TileX * TileWidth, Bounds.Min.Y + TileY * TileHeight, Bounds.Min.Z);
+			const FVector3d CoreMax(CoreMin.X + TileWidth, CoreMin.Y + TileHeight, Bounds.Max.Z);
+			Tile.CoreBox = FAxisAlignedBox3d(CoreMin, CoreMax);
+			Tile.InputBox = FAxisAlignedBox3d(CoreMin - FVector3d(Margin, Margin, Margin), CoreMax + FVector3d(Margin, Margin, Margin));
+			Tile.GridBox = SnapToVoxels(Tile.InputBox, Bounds.Min, VoxelSize);
+			Tile.bHasNeighbour[0] = TileX > 0;
+			Tile.bHasNeighbour[1] = TileX < NumTilesX - 1;
+			Tile.bHasNeighbour[2] = TileY > 0;
+			Tile.bHasNeighbour[3] = TileY < NumTilesY - 1;
+		}
+	}
+
+	std::atomic<int32> NumTilesDone{ 0 };
+	ParallelFor(Tiles.Num(), [&Tiles, &Mesh, &Bounds, &Settings, &Progress, &NumTilesDone, VoxelSize](int32 TileIndex)
+	{
+		if (Progress.IsCancelled())
+		{
+			return;
+		}
+
+		FTile& Tile = Tiles[TileIndex];
+		// Triangles that reach past the input box, like a ground slab under every tile, are cut back to it
+		FDynamicMesh3 TileMesh;
+		ExtractTriangles(Mesh, Tile.InputBox, TileMesh);
+		CutToBox(TileMesh, Tile, Tile.InputBox);
+		if (TileMesh.TriangleCount() > 0)
+		{
+			// The ops poll their progress object from this thread only, so each tile gets its own
+			FProgressCancel TileProgressCancel;
+			TileProgressCancel.CancelF = [&Progress]()
+			{
+				return Progress.IsCancelled();
+			};
+
+			Tile.Result = SolidifyAndClose(TileMesh, VoxelSize, Tile.GridBox, Settings.Winding, &TileProgressCancel);
+
+			if (Tile.Result.IsValid() && !Progress.IsCancelled())
+			{
+				FAxisAlignedBox3d KeepBox = Bounds;
+				KeepBox.Expand(VoxelSize);
+				RemoveComponentsOutside(*Tile.Result, KeepBox);
+
+				FAxisAlignedBox3d TrimBox = Tile.CoreBox;
+				TrimBox.Expand(VoxelSize);
+				CutToBox(*Tile.Result, Tile, TrimBox);
+			}
+		}
+
+		Progress.SetStageFraction(float(++NumTilesDone) / Tiles.Num());
+	});
+
+	if (Progress.IsCancelled())
+	{
+		return nullptr;
+	}
+
+	// Neighbouring tiles overlap by a voxel; the union removes the caps that end up inside a neighbour
+	Progress.EnterStage(ECollisionPipelineStage::Stitch);
+
+	TUniquePtr<FDynamicMesh3> Stitched = MakeUnique<FDynamicMesh3>();
+	FDynamicMeshEditor Editor(Stitched.Get());
+	for (FTile& Tile : Tiles)
+	{
+		if (Tile.Result.IsValid())
+		{
+			if (Stitched->TriangleCount() == 0)
+			{
+				Stitched->EnableMatchingAttributes(*Tile.Result);
+			}
+
+			FMeshIndexMappings Mappings;
+			Editor.AppendMesh(Tile.Result.Get(), Mappings);
+			Tile.Result.Reset();
+		}
+	}
+
+	FMeshSelfUnion Union(Stitched.Get());
+	if (!Union.Compute())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Collision pipeline: stitching %d tiles left open edges"), Tiles.Num());
+	}
+
+	return Stitched;
+}
+
+TUniquePtr<FDynamicMesh3> FCollisionMeshPipeline::Remesh(const FDynamicMesh3& Mesh, FProgressCancel* ProgressCancel)
+{
+	TUniquePtr<FRemeshMeshOp> RemeshOp = MakeUnique<FRemeshMeshOp>();
+	RemeshOp->RemeshType = ERemeshType::Standard;
+	RemeshOp->bCollapses = true;
+	RemeshOp->bDiscardAttributes = false;
+	RemeshOp->bFlips = true;
+	RemeshOp->bPreserveSharpEdges = true;
+	RemeshOp->SmoothingType = ERemeshSmoothingType::MeanValue;
+	RemeshOp->MaxRemeshIterations = 20;
+	RemeshOp->RemeshIterations = 20;
+	RemeshOp->bReproject = true;
+	RemeshOp->ProjectionTarget = &Mesh;
+	RemeshOp->MeshBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
+	RemeshOp->GroupBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
+	RemeshOp->MaterialBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
+	FDynamicMeshAABBTree3 ProjectionTargetSpatial(&Mesh, true);
+	RemeshOp->ProjectionTargetSpatial = &ProjectionTargetSpatial;
+	RemeshOp->OriginalMesh = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(Mesh);
+	RemeshOp->OriginalMeshSpatial = MakeShared<FDynamicMeshAABBTree3, ESPMode::ThreadSafe>(RemeshOp->OriginalMesh.Get(), true);
+
+	RemeshOp->TargetEdgeLength = CollisionMeshPipeline::CalculateTargetEdgeLength(Mesh.TriangleCount(), RemeshOp->OriginalMesh);
+
+	RemeshOp->CalculateResult(ProgressCancel);
+	return RemeshOp->ExtractResult();
+}
+
+TUniquePtr<FDynamicMesh3> FCollisionMeshPipeline::Jacket(TUniquePtr<FDynamicMesh3> Mesh, const FDynamicMesh3& Cap, FProgressCancel* ProgressCancel)
+{
+	TUniquePtr<FRemoveOccludedTrianglesOp> JacketingOp = MakeUnique<FRemoveOccludedTrianglesOp>();
+	JacketingOp->InsideMode = EOcclusionCalculationMode::SimpleOcclusionTest;
+	JacketingOp->AddTriangleSamples = 4;
+	JacketingOp->AddRandomRays = 4;
+	JacketingOp->MeshTransforms.SetNum(1);
+	JacketingOp->OriginalMesh = MakeShareable<FDynamicMesh3>(Mesh.Release());
+	JacketingOp->OccluderTrees.Add(MakeShared<FDynamicMeshAABBTree3, ESPMode::ThreadSafe>(JacketingOp->OriginalMesh.Get()));
+	JacketingOp->OccluderWindings.Emplace(); // empty winding tree, because simple occlusion test doesn't need it
+	JacketingOp->OccluderTransforms.Emplace(); // default constructor is identity
+	JacketingOp->OccluderTrees.Emplace(MakeShared<FDynamicMeshAABBTree3, ESPMode::ThreadSafe>(&Cap));
+	JacketingOp->OccluderWindings.Emplace(); // empty winding tree, because simple occlusion test doesn't need it
+	JacketingOp->OccluderTransforms.Emplace(); // default constructor is identity
+	JacketingOp->CalculateResult(ProgressCancel);
+	return JacketingOp->ExtractResult();
+}
+
+TUniquePtr<FDynamicMesh3> FCollisionMeshPipeline::SolidifyAndClose(const FDynamicMesh3& Mesh, double VoxelSize, const FAxisAlignedBox3d& GridBox, float Winding, FProgressCancel* ProgressCancel)
+{
+	using namespace CollisionMeshPipeline;
+
+	TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> Input = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(Mesh);
+	if (!GridBox.IsEmpty())
+	{
+		AnchorToBox(*Input, GridBox);
+	}
+
+	// The wrap extends its grid by a voxel either side and fits the count across that, which leaves voxels of exactly VoxelSize
+	const int32 VoxelCount = FMath::Max(FMath::RoundToInt32(Input->GetBounds().MaxDim() / VoxelSize), 1) + 2;
+
+	// Vox Wrap
+	TUniquePtr<FVoxelSolidifyMeshesOp> Op = MakeUnique<FVoxelSolidifyMeshesOp>();
+	Op->Transforms.SetNum(1);
+	Op->Transforms[0] = FTransform::Identity;
+	Op->Meshes.Add(Input);
+	Op->OutputVoxelCount = VoxelCount;
+	Op->InputVoxelCount = VoxelCount;
+	Op->ExtendBounds = VoxelSize;
+	Op->bAutoSimplify = false;
+	Op->WindingThreshold = Winding;
+	Op->CalculateResult(ProgressCancel);
+	TUniquePtr<FDynamicMesh3> Newmesh = Op->ExtractResult();
+	Op = nullptr;
+	Input.Reset();
+
+	if (!Newmesh.IsValid() || (ProgressCancel && ProgressCancel->Cancelled()))
+	{
+		return nullptr;
+	}
+
+	if (!GridBox.IsEmpty())
+	{
+		AnchorToBox(*Newmesh, GridBox);
+	}
+
+	// Vox Morph
+	TUniquePtr<FVoxelMorphologyMeshesOp> MorphOp = MakeUnique<FVoxelMorphologyMeshesOp>();
+	MorphOp->Transforms.SetNum(1);
+	MorphOp->Transforms[0] = FTransform::Identity;
+	MorphOp->Meshes.Add(MakeShareable<FDynamicMesh3>(Newmesh.Release()));
+	MorphOp->OutputVoxelCount = VoxelCount;
+	MorphOp->InputVoxelCount = VoxelCount;
+	MorphOp->bAutoSimplify = false;
+	MorphOp->Operation = EMorphologyOperation::Close;
+	MorphOp->CalculateResult(ProgressCancel);
+	return MorphOp->ExtractResult();
+}
+
+TUniquePtr<FDynamicMesh3> FCollisionMeshPipeline::Simplify(const FDynamicMesh3& Mesh, int32 TargetTriangleCount, IMeshReduction* MeshReduction, FProgressCancel* ProgressCancel)
+{
+	// The asset's mesh description is only made once the result is back on the game thread, so build a standalone one
+	FMeshDescription MeshDescription;
+	FStaticMeshAttributes(MeshDescription).Register();
+	FDynamicMeshToMeshDescription Converter;
+	Converter.Convert(&Mesh, MeshDescription);
+
+	TUniquePtr<FSimplifyMeshOp> FinalOp = MakeUnique<FSimplifyMeshOp>();
+	FinalOp->bDiscardAttributes = false;
+	FinalOp->bPreventNormalFlips = true;
+	FinalOp->bPreserveSharpEdges = true;
+	FinalOp->bAllowSeamCollapse = false;
+	FinalOp->bReproject = false;
+	FinalOp->TargetEdgeLength = 5.0;
+	FinalOp->SimplifierType = ESimplifyType::UEStandard;
+	FinalOp->TargetMode = ESimplifyTargetType::TriangleCount;
+	FinalOp->TargetCount = TargetTriangleCount;
+	FinalOp->MeshBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
+	FinalOp->GroupBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
+	FinalOp->MaterialBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
+	FinalOp->OriginalMesh = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(Mesh);
+	FinalOp->OriginalMeshSpatial = MakeShared<FDynamicMeshAABBTree3, ESPMode::ThreadSafe>(FinalOp->OriginalMesh.Get());
+	FinalOp->OriginalMeshDescription = MakeShared<FMeshDescription, ESPMode::ThreadSafe>(MoveTemp(MeshDescription));
+	FinalOp->MeshReduction = MeshReduction;
+	FinalOp->CalculateResult(ProgressCancel);
+	return FinalOp->ExtractResult();
+}
@@ -0,0 +1,103 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "Util/ProgressCancel.h"
+
+#include <atomic>
+
+class IMeshReduction;
+
+/** Settings for the geometry stages GenerateCollision runs once the meshes are merged and capped */
+struct FCollisionPipelineSettings
+{
+	bool bRemesh = false;
+
+	/** Voxel count along the longest side of the whole merged mesh */
+	int32 VoxelDensity = 64;
+
+	float Winding = 0.5f;
+
+	/** Triangle count the final simplification aims for */
+	int32 TargetTriangleCount = 50;
+
+	/** Tiles are sized to about this many voxels along X and Y; a mesh that fits gets a single tile, as before tiling */
+	int32 MaxVoxelsPerTile = 64;
+
+	/** Extra input each tile sees past its own bounds, so the wrap near the seams matches the untiled result. At least 3. */
+	int32 TileMarginVoxels = 4;
+};
+
+enum class ECollisionPipelineStage : uint8
+{
+	Remesh,
+	Jacketing,
+	Voxelize,
+	Stitch,
+	Simplify,
+	Done,
+};
+
+/** Written by the pipeline from its worker threads and polled by whoever waits on it */
+class FCollisionPipelineProgress
+{
+public:
+	FCollisionPipelineProgress();
+
+	FCollisionPipelineProgress(const FCollisionPipelineProgress&) = delete;
+	FCollisionPipelineProgress& operator=(const FCollisionPipelineProgress&) = delete;
+
+	void Cancel() { bCancelRequested = true; }
+	bool IsCancelled() const { return bCancelRequested; }
+
+	/** 0 to 1 over every stage */
+	float GetProgress() const { return Progress; }
+	ECollisionPipelineStage GetStage() const { return Stage; }
+
+	static FText GetStageText(ECollisionPipelineStage Stage);
+
+	/** For the mesh ops, which poll it between steps */
+	FProgressCancel* GetProgressCancel() { return &ProgressCancel; }
+
+private:
+	friend class FCollisionMeshPipeline;
+
+	void EnterStage(ECollisionPipelineStage NewStage);
+	void SetStageFraction(float Fraction);
+
+	FProgressCancel ProgressCancel;
+	std::atomic<bool> bCancelRequested{ false };
+	std::atomic<float> Progress{ 0.f };
+	std::atomic<ECollisionPipelineStage> Stage{ ECollisionPipelineStage::Remesh };
+};
+
+/**
+ * The remesh, jacketing, voxel wrap and close and final simplification stages of GenerateCollision. Touches no UObjects,
+ * so it can run off the game thread; the voxel stages are split into overlapping tiles that are processed in parallel.
+ */
+class FCollisionMeshPipeline
+{
+public:
+	/** The finished collision mesh, or null if cancelled. MeshReduction has to be fetched on the game thread. */
+	static TUniquePtr<UE::Geometry::FDynamicMesh3> Run(UE::Geometry::FDynamicMesh3&& MergedMesh, const UE::Geometry::FDynamicMesh3& Cap, const FCollisionPipelineSettings& Settings, IMeshReduction* MeshReduction, FCollisionPipelineProgress& Progress);
+
+	/** Rough peak memory of Run for MergedMesh, for callers that run several pipelines at once */
+	static int64 EstimatePeakMemory(const UE::Geometry::FDynamicMesh3& MergedMesh, const FCollisionPipelineSettings& Settings);
+
+	/** Voxel wrap and close of Mesh, tiled when it is larger than MaxVoxelsPerTile; null if cancelled */
+	static TUniquePtr<UE::Geometry::FDynamicMesh3> SolidifyTiled(const UE::Geometry::FDynamicMesh3& Mesh, const FCollisionPipelineSettings& Settings, FCollisionPipelineProgress& Progress);
+
+private:
+	static TUniquePtr<UE::Geometry::FDynamicMesh3> Remesh(const UE::Geometry::FDynamicMesh3& Mesh, FProgressCancel* ProgressCancel);
+	static TUniquePtr<UE::Geometry::FDynamicMesh3> Jacket(TUniquePtr<UE::Geometry::FDynamicMesh3> Mesh, const UE::Geometry::FDynamicMesh3& Cap, FProgressCancel* ProgressCancel);
+
+	/**
+	 * Voxel wrap and close of Mesh with voxels of VoxelSize, the grid starting a voxel before the input's bounds. A non-empty
+	 * GridBox is added to the bounds of both stages, so that the grids cover it whatever part of it Mesh fills.
+	 */
+	static TUniquePtr<UE::Geometry::FDynamicMesh3> SolidifyAndClose(const UE::Geometry::FDynamicMesh3& Mesh, double VoxelSize, const UE::Geometry::FAxisAlignedBox3d& GridBox, float Winding, FProgressCancel* ProgressCancel);
+
+	static TUniquePtr<UE::Geometry::FDynamicMesh3> Simplify(const UE::Geometry::FDynamicMesh3& Mesh, int32 TargetTriangleCount, IMeshReduction* MeshReduction, FProgressCancel* ProgressCancel);
+};
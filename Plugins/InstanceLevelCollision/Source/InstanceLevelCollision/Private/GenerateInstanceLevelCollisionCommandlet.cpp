@@ -0,0 +1,418 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GenerateInstanceLevelCollisionCommandlet.h"
+
+#include "CollisionGeneration.h"
+#include "CollisionMeshPipeline.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/StaticMesh.h"
+#include "EngineUtils.h"
+#include "FileHelpers.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "IMeshReductionInterfaces.h"
+#include "IMeshReductionManagerModule.h"
+#include "LevelInstance/LevelInstanceActor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Modules/ModuleManager.h"
+#include "PreSimplifiedMeshCache.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Tasks/Task.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogInstanceLevelCollisionCommandlet, Log, All);
+
+using namespace UE::Geometry;
+
+// Change this to regenerate every instance on the next run, e.g. when the pipeline's output changes
+#define INSTANCELEVELCOLLISION_INPUTHASH_VER TEXT("0B7F3C58A2E64D19851C4E6FA3D7B290")
+
+namespace GenerateInstanceLevelCollision
+{
+	enum class EInstanceStatus : uint8
+	{
+		Skipped,
+		Generated,
+		Failed,
+	};
+
+	struct FInstanceReport
+	{
+		FString MapName;
+		FString InstanceName;
+		EInstanceStatus Status = EInstanceStatus::Failed;
+		int32 NumMergedTriangles = 0;
+		int32 NumCachedMeshes = 0;
+		int32 NumUniqueMeshes = 0;
+		double PrepareSeconds = 0.0;
+		double PipelineSeconds = 0.0;
+		double CreateSeconds = 0.0;
+	};
+
+	struct FCollisionJob
+	{
+		TWeakObjectPtr<ALevelInstance> LevelInstance;
+		FString Key;
+		FString InputHash;
+		int32 ReportIndex = INDEX_NONE;
+
+		TUniquePtr<FCollisionGenerationInput> Input;
+		int64 MemoryEstimate = 0;
+
+		FCollisionPipelineProgress Progress;
+		TUniquePtr<FDynamicMesh3> Result;
+		UE::Tasks::FTask Task;
+		double StartTime = 0.0;
+	};
+
+	static const TCHAR* LexToString(EInstanceStatus Status)
+	{
+		switch (Status)
+		{
+		case EInstanceStatus::Skipped:
+			return TEXT("Skipped");
+		case EInstanceStatus::Generated:
+			return TEXT("Generated");
+		default:
+			return TEXT("Failed");
+		}
+	}
+
+	static void UpdateWithString(FSHA1& Sha, const FString& String)
+	{
+		Sha.UpdateWithString(*String, String.Len());
+	}
+
+	static void UpdateWithTransform(FSHA1& Sha, const FTransform& Transform)
+	{
+		const FVector Location = Transform.GetLocation();
+		const FQuat Rotation = Transform.GetRotation();
+		const FVector Scale = Transform.GetScale3D();
+		const double Values[] = { Location.X, Location.Y, Location.Z, Rotation.X, Rotation.Y, Rotation.Z, Rotation.W, Scale.X, Scale.Y, Scale.Z };
+		Sha.Update(reinterpret_cast<const uint8*>(Values), sizeof(Values));
+	}
+
+	static TMap<FString, FString> LoadInputHashes(const FString& HashFile)
+	{
+		TMap<FString, FString> Hashes;
+
+		FString Json;
+		if (FFileHelper::LoadFileToString(Json, *HashFile))
+		{
+			TSharedPtr<FJsonObject> Root;
+			if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) && Root.IsValid())
+			{
+				for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Root->Values)
+				{
+					Hashes.Add(Field.Key, Field.Value->AsString());
+				}
+			}
+		}
+
+		return Hashes;
+	}
+
+	static bool SaveInputHashes(const FString& HashFile, const TMap<FString, FString>& Hashes)
+	{
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		for (const TPair<FString, FString>& Hash : Hashes)
+		{
+			Root->SetStringField(Hash.Key, Hash.Value);
+		}
+
+		FString Json;
+		return FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json)) && FFileHelper::SaveStringToFile(Json, *HashFile);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////
+// UGenerateInstanceLevelCollisionCommandlet
+
+UGenerateInstanceLevelCollisionCommandlet::UGenerateInstanceLevelCollisionCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+FString UGenerateInstanceLevelCollisionCommandlet::FGenerationParameters::ToString() const
+{
+	return FString::Printf(TEXT("ZOffset=%g CollisionType=%d Remesh=%d PreSimplification=%d VoxelDensity=%d TargetTriangles=%d Winding=%g"),
+		ZOffset, (int32)CollisionType, bRemesh, PreSimplificationPercentage, VoxelDensity, TargetTriangleCount, Winding);
+}
+
+FString UGenerateInstanceLevelCollisionCommandlet::ComputeInputHash(ALevelInstance* LevelInstance, const FGenerationParameters& Parameters)
+{
+	using namespace GenerateInstanceLevelCollision;
+
+	FSHA1 Sha;
+	UpdateWithString(Sha, INSTANCELEVELCOLLISION_INPUTHASH_VER);
+	UpdateWithString(Sha, Parameters.ToString());
+	UpdateWithString(Sha, LevelInstance->GetWorldAssetPackage());
+	UpdateWithTransform(Sha, LevelInstance->GetActorTransform());
+
+	// The same components MergeInstancesMeshes reads, in a stable order
+	TArray<UInstancedStaticMeshComponent*> Components;
+	LevelInstance->GetComponents<UInstancedStaticMeshComponent>(Components);
+	Components.Sort([](const UInstancedStaticMeshComponent& A, const UInstancedStaticMeshComponent& B)
+	{
+		return A.GetName() < B.GetName();
+	});
+
+	for (UInstancedStaticMeshComponent* Component : Components)
+	{
+		UStaticMesh* StaticMesh = Component->GetStaticMesh();
+		UpdateWithString(Sha, StaticMesh ? StaticMesh->GetPathName() : FString());
+		UpdateWithString(Sha, StaticMesh ? FPreSimplifiedMeshCache::GetMeshHash(StaticMesh) : FString());
+
+		for (int32 InstanceIndex = 0; InstanceIndex < Component->GetInstanceCount(); ++InstanceIndex)
+		{
+			FTransform InstanceTransform;
+			if (Component->IsValidInstance(InstanceIndex) && Component->GetInstanceTransform(InstanceIndex, InstanceTransform, true))
+			{
+				UpdateWithTransform(Sha, InstanceTransform);
+			}
+		}
+	}
+
+	return Sha.Finalize().ToString();
+}
+
+int32 UGenerateInstanceLevelCollisionCommandlet::Main(const FString& Params)
+{
+	using namespace GenerateInstanceLevelCollision;
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	TArray<FString> MapNames;
+	if (const FString* Maps = ParamVals.Find(TEXT("Maps")))
+	{
+		Maps->ParseIntoArray(MapNames, TEXT("+"));
+	}
+	if (MapNames.Num() == 0)
+	{
+		UE_LOG(LogInstanceLevelCollisionCommandlet, Error, TEXT("Usage: -run=GenerateInstanceLevelCollision -Maps=/Game/MapA+/Game/MapB [options]"));
+		return 1;
+	}
+
+	auto GetParam = [&ParamVals](const TCHAR* Name, const FString& Default)
+	{
+		const FString* Value = ParamVals.Find(Name);
+		return Value ? *Value : Default;
+	};
+
+	FGenerationParameters Parameters;
+	Parameters.ZOffset = FCString::Atof(*GetParam(TEXT("ZOffset"), TEXT("0")));
+	Parameters.bRemesh = Switches.Contains(TEXT("Remesh"));
+	Parameters.PreSimplificationPercentage = FCString::Atoi(*GetParam(TEXT("PreSimplification"), TEXT("50")));
+	Parameters.VoxelDensity = FCString::Atoi(*GetParam(TEXT("VoxelDensity"), TEXT("64")));
+	Parameters.TargetTriangleCount = FCString::Atoi(*GetParam(TEXT("TargetTriangles"), TEXT("50")));
+	Parameters.Winding = FCString::Atof(*GetParam(TEXT("Winding"), TEXT("0.5")));
+
+	const FString CollisionTypeName = GetParam(TEXT("CollisionType"), TEXT("MinZ"));
+	const int64 CollisionTypeValue = StaticEnum<ECollisionMaxSlice>()->GetValueByNameString(CollisionTypeName);
+	if (CollisionTypeValue == INDEX_NONE)
+	{
+		UE_LOG(LogInstanceLevelCollisionCommandlet, Error, TEXT("Unknown CollisionType %s"), *CollisionTypeName);
+		return 1;
+	}
+	Parameters.CollisionType = (ECollisionMaxSlice)CollisionTypeValue;
+
+	const int32 MaxWorkers = FMath::Max(FCString::Atoi(*GetParam(TEXT("MaxWorkers"), FString::FromInt(FMath::Clamp(FPlatformMisc::NumberOfCores() / 4, 1, 4)))), 1);
+	const int64 DefaultMemoryBudgetMB = (int64)(FPlatformMemory::GetStats().AvailablePhysical / 2 / (1024 * 1024));
+	const int64 MemoryBudget = FMath::Max(FCString::Atoi64(*GetParam(TEXT("MemoryBudgetMB"), FString::Printf(TEXT("%lld"), DefaultMemoryBudgetMB))), (int64)1) * 1024 * 1024;
+	const FString Filter = GetParam(TEXT("Filter"), FString());
+	const bool bForce = Switches.Contains(TEXT("Force"));
+	const bool bNoSave = Switches.Contains(TEXT("NoSave"));
+	const FString HashFile = GetParam(TEXT("HashFile"), FPaths::ProjectSavedDir() / TEXT("InstanceLevelCollision/InputHashes.json"));
+
+	UE_LOG(LogInstanceLevelCollisionCommandlet, Display, TEXT("%s, %d workers, %lld MB budget"), *Parameters.ToString(), MaxWorkers, MemoryBudget / (1024 * 1024));
+
+	FCollisionPipelineSettings PipelineSettings;
+	PipelineSettings.bRemesh = Parameters.bRemesh;
+	PipelineSettings.VoxelDensity = Parameters.VoxelDensity;
+	PipelineSettings.Winding = Parameters.Winding;
+	PipelineSettings.TargetTriangleCount = Parameters.TargetTriangleCount;
+	IMeshReductionManagerModule& MeshReductionModule = FModuleManager::Get().LoadModuleChecked<IMeshReductionManagerModule>("MeshReductionInterface");
+	IMeshReduction* MeshReduction = MeshReductionModule.GetStaticMeshReductionInterface();
+
+	// Instances this run doesn't visit or regenerate keep their stored hash, -Force only skips the up-to-date check
+	const TMap<FString, FString> StoredHashes = LoadInputHashes(HashFile);
+	TMap<FString, FString> NewHashes = StoredHashes;
+	TArray<FInstanceReport> Reports;
+	TArray<UPackage*> PackagesToSave;
+	const double StartTime = FPlatformTime::Seconds();
+
+	for (const FString& MapName : MapNames)
+	{
+		UWorld* World = UEditorLoadingAndSavingUtils::LoadMap(MapName);
+		if (World == nullptr)
+		{
+			UE_LOG(LogInstanceLevelCollisionCommandlet, Error, TEXT("Failed to load %s"), *MapName);
+			continue;
+		}
+
+		// Only loaded actors are found; World Partition cells that are not loaded by default are not visited
+		TArray<TUniquePtr<FCollisionJob>> Jobs;
+		for (TActorIterator<ALevelInstance> It(World); It; ++It)
+		{
+			ALevelInstance* LevelInstance = *It;
+			if (!Filter.IsEmpty() && !LevelInstance->GetActorLabel().Contains(Filter))
+			{
+				continue;
+			}
+
+			FInstanceReport& Report = Reports.AddDefaulted_GetRef();
+			Report.MapName = MapName;
+			Report.InstanceName = LevelInstance->GetActorLabel();
+
+			const FString Key = MapName + TEXT(":") + LevelInstance->GetPathName(World);
+			const FString InputHash = ComputeInputHash(LevelInstance, Parameters);
+			const FString* StoredHash = bForce ? nullptr : StoredHashes.Find(Key);
+			if (StoredHash && *StoredHash == InputHash)
+			{
+				Report.Status = EInstanceStatus::Skipped;
+				continue;
+			}
+
+			TUniquePtr<FCollisionJob>& Job = Jobs.Add_GetRef(MakeUnique<FCollisionJob>());
+			Job->LevelInstance = LevelInstance;
+			Job->Key = Key;
+			Job->InputHash = InputHash;
+			Job->ReportIndex = Reports.Num() - 1;
+		}
+
+		UE_LOG(LogInstanceLevelCollisionCommandlet, Display, TEXT("%s: %d level instances to generate"), *MapName, Jobs.Num());
+
+		// Merging and asset creation touch UObjects and stay here; the pipelines run on workers within the budgets
+		int32 NextJob = 0;
+		TArray<FCollisionJob*> Running;
+		int64 RunningMemory = 0;
+		while (NextJob < Jobs.Num() || Running.Num() > 0)
+		{
+			for (int32 RunningIndex = Running.Num() - 1; RunningIndex >= 0; --RunningIndex)
+			{
+				FCollisionJob& Job = *Running[RunningIndex];
+				if (!Job.Task.IsCompleted())
+				{
+					continue;
+				}
+
+				FInstanceReport& Report = Reports[Job.ReportIndex];
+				Report.PipelineSeconds = FPlatformTime::Seconds() - Job.StartTime;
+
+				ALevelInstance* LevelInstance = Job.LevelInstance.Get();
+				if (LevelInstance && Job.Result.IsValid())
+				{
+					const double CreateStartTime = FPlatformTime::Seconds();
+					if (UStaticMesh* CollisionMesh = CreateCollisionMesh(LevelInstance, *Job.Result, Job.Input->LevelName, Job.Input->SavePath, Job.Input->OriginalTransform, false))
+					{
+						PackagesToSave.Add(CollisionMesh->GetOutermost());
+						NewHashes.Add(Job.Key, Job.InputHash);
+						Report.Status = EInstanceStatus::Generated;
+					}
+					Report.CreateSeconds = FPlatformTime::Seconds() - CreateStartTime;
+				}
+
+				RunningMemory -= Job.MemoryEstimate;
+				Job.Input.Reset();
+				Job.Result.Reset();
+				Running.RemoveAtSwap(RunningIndex);
+			}
+
+			while (NextJob < Jobs.Num() && Running.Num() < MaxWorkers)
+			{
+				FCollisionJob& Job = *Jobs[NextJob];
+				ALevelInstance* LevelInstance = Job.LevelInstance.Get();
+				if (LevelInstance == nullptr)
+				{
+					++NextJob;
+					continue;
+				}
+
+				// The estimate needs the merged mesh, so a job waiting on the budget has already been merged
+				if (!Job.Input.IsValid())
+				{
+					FInstanceReport& Report = Reports[Job.ReportIndex];
+					const double PrepareStartTime = FPlatformTime::Seconds();
+					Job.Input = MakeUnique<FCollisionGenerationInput>();
+					PrepareCollisionInput(LevelInstance, TArray<AStaticMeshActor*>(), Parameters.ZOffset, Parameters.CollisionType, Parameters.PreSimplificationPercentage, *Job.Input);
+					Job.MemoryEstimate = FCollisionMeshPipeline::EstimatePeakMemory(Job.Input->MergedMesh, PipelineSettings);
+					Report.PrepareSeconds = FPlatformTime::Seconds() - PrepareStartTime;
+					Report.NumMergedTriangles = Job.Input->MergedMesh.TriangleCount();
+					Report.NumCachedMeshes = Job.Input->PreSimplificationReport.GetNumHits();
+					Report.NumUniqueMeshes = Job.Input->PreSimplificationReport.NumUniqueMeshes;
+				}
+
+				// A job larger than the whole budget still runs, on its own
+				if (Running.Num() > 0 && RunningMemory + Job.MemoryEstimate > MemoryBudget)
+				{
+					break;
+				}
+
+				FCollisionJob* JobPtr = &Job;
+				Job.StartTime = FPlatformTime::Seconds();
+				Job.Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [JobPtr, &PipelineSettings, MeshReduction]()
+				{
+					JobPtr->Result = FCollisionMeshPipeline::Run(MoveTemp(JobPtr->Input->MergedMesh), JobPtr->Input->Cap, PipelineSettings, MeshReduction, JobPtr->Progress);
+				});
+
+				RunningMemory += Job.MemoryEstimate;
+				Running.Add(&Job);
+				++NextJob;
+			}
+
+			if (Running.Num() > 0)
+			{
+				Running[0]->Task.Wait(FTimespan::FromMilliseconds(50.0));
+			}
+		}
+	}
+
+	int32 NumGenerated = 0;
+	int32 NumSkipped = 0;
+	int32 NumFailed = 0;
+	for (const FInstanceReport& Report : Reports)
+	{
+		NumGenerated += Report.Status == EInstanceStatus::Generated;
+		NumSkipped += Report.Status == EInstanceStatus::Skipped;
+		NumFailed += Report.Status == EInstanceStatus::Failed;
+	}
+
+	if (!bNoSave)
+	{
+		if (PackagesToSave.Num() > 0 && !UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, false))
+		{
+			UE_LOG(LogInstanceLevelCollisionCommandlet, Error, TEXT("Failed to save %d collision assets"), PackagesToSave.Num());
+			return 1;
+		}
+
+		if (!SaveInputHashes(HashFile, NewHashes))
+		{
+			UE_LOG(LogInstanceLevelCollisionCommandlet, Warning, TEXT("Failed to write %s"), *HashFile);
+		}
+	}
+
+	UE_LOG(LogInstanceLevelCollisionCommandlet, Display, TEXT("%-24s %-32s %-10s %10s %8s %9s %9s %9s"),
+		TEXT("Map"), TEXT("Instance"), TEXT("Status"), TEXT("Triangles"), TEXT("Cached"), TEXT("Merge(s)"), TEXT("Voxel(s)"), TEXT("Save(s)"));
+	for (const FInstanceReport& Report : Reports)
+	{
+		UE_LOG(LogInstanceLevelCollisionCommandlet, Display, TEXT("%-24s %-32s %-10s %10d %4d/%-3d %9.2f %9.2f %9.2f"),
+			*FPaths::GetBaseFilename(Report.MapName), *Report.InstanceName, LexToString(Report.Status), Report.NumMergedTriangles,
+			Report.NumCachedMeshes, Report.NumUniqueMeshes, Report.PrepareSeconds, Report.PipelineSeconds, Report.CreateSeconds);
+	}
+	UE_LOG(LogInstanceLevelCollisionCommandlet, Display, TEXT("%d generated, %d skipped, %d failed in %.1fs"),
+		NumGenerated, NumSkipped, NumFailed, FPlatformTime::Seconds() - StartTime);
+
+	return NumFailed > 0 ? 1 : 0;
+}
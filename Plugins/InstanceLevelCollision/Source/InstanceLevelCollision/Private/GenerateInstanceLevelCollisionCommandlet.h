@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "InstanceLevelCollisionBPLibrary.h"
+
+#include "GenerateInstanceLevelCollisionCommandlet.generated.h"
+
+class ALevelInstance;
+
+/**
+ * Regenerates collision for every level instance in the given maps without the editor UI. Instances whose inputs
+ * hash the same as on the last run are skipped; the rest run through FCollisionMeshPipeline concurrently within a
+ * worker and memory budget, and the new collision assets are saved together at the end.
+ *
+ * UnrealEditor-Cmd <Project> -run=GenerateInstanceLevelCollision -Maps=/Game/A+/Game/B [-nullrhi]
+ *     [-ZOffset=0] [-CollisionType=MinZ] [-Remesh] [-PreSimplification=50] [-VoxelDensity=64] [-TargetTriangles=50]
+ *     [-Winding=0.5] [-MaxWorkers=N] [-MemoryBudgetMB=N] [-Filter=Substring] [-Force] [-NoSave] [-HashFile=Path]
+ */
+UCLASS()
+class UGenerateInstanceLevelCollisionCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGenerateInstanceLevelCollisionCommandlet();
+
+	//~ Begin UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet interface
+
+	/** The GenerateCollision parameters applied to every instance */
+	struct FGenerationParameters
+	{
+		float ZOffset = 0.f;
+		ECollisionMaxSlice CollisionType = ECollisionMaxSlice::MinZ;
+		bool bRemesh = false;
+		int32 PreSimplificationPercentage = 50;
+		int32 VoxelDensity = 64;
+		int32 TargetTriangleCount = 50;
+		float Winding = 0.5f;
+
+		FString ToString() const;
+	};
+
+	/** Hash of everything that affects the collision generated for LevelInstance */
+	static FString ComputeInputHash(ALevelInstance* LevelInstance, const FGenerationParameters& Parameters);
+};
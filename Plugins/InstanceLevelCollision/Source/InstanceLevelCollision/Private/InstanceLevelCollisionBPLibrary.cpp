@@ -43,11 +43,16 @@
 #include "CleaningOps/RemoveOccludedTrianglesOp.h"
 #include "CompositionOps/VoxelMorphologyMeshesOp.h"
 #include "CompositionOps/VoxelSolidifyMeshesOp.h"
+#include "CollisionGeneration.h"
+#include "CollisionMeshImport.h"
+#include "CollisionMeshPipeline.h"
+#include "PreSimplifiedMeshCache.h"
 
 #include "Widgets/Notifications/SNotificationList.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
 #include "GenericPlatform/GenericPlatformProcess.h"
+#include "Tasks/Task.h"
 #if WITH_EDITOR
 #include "Misc/ScopedSlowTask.h"
 #include "Editor.h"
@@ -174,19 +179,6 @@ bool CapBottom(FDynamicMesh3* Mesh, FDynamicMesh3& Projected, float& ZValue, flo
 	return true;
 }
 
-double CalculateTargetEdgeLength(int TargetTriCount, TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> OriginalMesh)
-{
-	double InitialMeshArea = 0;
-	for (int tid : OriginalMesh->TriangleIndicesItr())
-	{
-		InitialMeshArea += OriginalMesh->GetTriArea(tid);
-	}
-
-	double TargetTriArea = InitialMeshArea / (double)TargetTriCount;
-	double EdgeLen = TriangleUtil::EquilateralEdgeLengthForArea(TargetTriArea);
-	return (double)FMath::RoundToInt(EdgeLen * 100.0) / 100.0;
-}
-
 void GetMergeMesh(ALevelInstance* LevelInstance, FDynamicMesh3& MergedMesh, TArray<AStaticMeshActor*>& MeshActor)
 {
 	if (LevelInstance)
@@ -219,26 +211,9 @@ void GetMergeMesh(ALevelInstance* LevelInstance, FDynamicMesh3& MergedMesh, TArr
 				if (ISMComponent->GetStaticMesh())
 				{
 					ISMComponent->GetStaticMesh()->GetPhysicsTriMeshData(&CollisionData, true);
-					for (const FVector3f& V : CollisionData.Vertices)
-					{
-						Mesh.AppendVertex((FVector3d)V);
-					}
-					for (FTriIndices T : CollisionData.Indices)
-					{
-						if (Mesh.FindTriangle(T.v0, T.v1, T.v2) != FDynamicMesh3::InvalidID)
-						{
-							bMeshIsRealBad = true;
-							continue; // skip duplicate triangles in mesh
-						}
-						if (FDynamicMesh3::NonManifoldID == Mesh.AppendTriangle(T.v0, T.v1, T.v2))
-						{
-							int New0 = Mesh.AppendVertex(Mesh, T.v0);
-							int New1 = Mesh.AppendVertex(Mesh, T.v1);
-							int New2 = Mesh.AppendVertex(Mesh, T.v2);
-							Mesh.AppendTriangle(New0, New1, New2);
-							bMeshIsRealBad = true;
-						}
-					}
+					FCollisionMeshImportStats ImportStats;
+					FCollisionMeshImporter::Import(CollisionData, Mesh, FCollisionMeshImportSettings(), &ImportStats);
+					bMeshIsRealBad = ImportStats.NumDuplicateTriangles > 0 || ImportStats.NumSplitVertices > 0;
 					//MeshActor.Add(BreakMesh);
 				}
 
@@ -380,7 +355,24 @@ void UInstanceLevelCollisionBPLibrary::GetCollisionSliceInfo(ALevelInstance* Lev
 	}
 }
 
-void MergeInstancesMeshes(ALevelInstance* LevelInstance, FDynamicMesh3 &MergedMesh, TMap<UStaticMesh*, TArray<FTransform>>&InstancesInfo, int PreSimplificationPercentage)
+/** Appends one placed copy of a pre-simplified mesh, flipping it if the transform mirrors */
+static void AppendInstanceMesh(FDynamicMeshEditor& MergeEditor, FMeshIndexMappings& Mappings, const FDynamicMesh3& SimplifiedMesh, const FTransformSRT3d& Transform)
+{
+	auto TransformPosition = [&Transform](int, const FVector3d& P) {return Transform.TransformPosition(P); };
+	auto TransformNormal = [&Transform](int, const FVector3d& N) {return Transform.TransformVector(N); };
+	if (Transform.GetDeterminant() < 0)
+	{
+		FDynamicMesh3 SubMesh = SimplifiedMesh;
+		SubMesh.ReverseOrientation(false);
+		MergeEditor.AppendMesh(&SubMesh, Mappings, TransformPosition, TransformNormal);
+	}
+	else
+	{
+		MergeEditor.AppendMesh(&SimplifiedMesh, Mappings, TransformPosition, TransformNormal);
+	}
+}
+
+void MergeInstancesMeshes(ALevelInstance* LevelInstance, FDynamicMesh3 &MergedMesh, TMap<UStaticMesh*, TArray<FTransform>>&InstancesInfo, int PreSimplificationPercentage, FPreSimplificationReport& Report)
 {
 	if (LevelInstance)
 	{
@@ -389,6 +381,20 @@ void MergeInstancesMeshes(ALevelInstance* LevelInstance, FDynamicMesh3 &MergedMe
 		//LevelInstance->GetLevelInstanceSubsystem()->BreakLevelInstance(LevelInstance, 1U, &BreakActors);
 		TArray<UStaticMeshComponent*> StaticMeshComponents;
 		LevelInstance->GetComponents<UStaticMeshComponent>(StaticMeshComponents);
+
+		//Pre-simplify each unique mesh once
+		TArray<UStaticMesh*> StaticMeshes;
+		for (UStaticMeshComponent* StaticMeshComponent : StaticMeshComponents)
+		{
+			if (UInstancedStaticMeshComponent* ISMComponent = Cast<UInstancedStaticMeshComponent>(StaticMeshComponent))
+			{
+				StaticMeshes.Add(ISMComponent->GetStaticMesh());
+			}
+		}
+		FPreSimplificationSettings Settings;
+		Settings.TargetPercentage = PreSimplificationPercentage;
+		TMap<UStaticMesh*, FPreSimplifiedMeshCache::FMeshPtr> SimplifiedMeshes = FPreSimplifiedMeshCache::Get().FindOrBuild(StaticMeshes, Settings, Report);
+
 		// Create progress indicator dialog
 		FText TaskLength = FText::FromString("Reading Staticmesh : 0 / " + FString::FromInt(StaticMeshComponents.Num()));
 		FScopedSlowTask SlowTask(StaticMeshComponents.Num(), TaskLength);
@@ -404,57 +410,7 @@ void MergeInstancesMeshes(ALevelInstance* LevelInstance, FDynamicMesh3 &MergedMe
 			{
 				SlowTask.EnterProgressFrame(1.0, FText::FromString("Reading Staticmesh : " + FString::FromInt(j) + " / " + FString::FromInt(StaticMeshComponents.Num())));
 
-				FDynamicMesh3 Mesh;
-				bool bMeshIsRealBad = false;
-				FTriMeshCollisionData CollisionData;
-				if (ISMComponent->GetStaticMesh())
-				{
-					ISMComponent->GetStaticMesh()->GetPhysicsTriMeshData(&CollisionData, true);
-					for (const FVector3f& V : CollisionData.Vertices)
-					{
-						Mesh.AppendVertex((FVector3d)V);
-					}
-					for (FTriIndices T : CollisionData.Indices)
-					{
-						if (Mesh.FindTriangle(T.v0, T.v1, T.v2) != FDynamicMesh3::InvalidID)
-						{
-							bMeshIsRealBad = true;
-							continue; // skip duplicate triangles in mesh
-						}
-						if (FDynamicMesh3::NonManifoldID == Mesh.AppendTriangle(T.v0, T.v1, T.v2))
-						{
-							int New0 = Mesh.AppendVertex(Mesh, T.v0);
-							int New1 = Mesh.AppendVertex(Mesh, T.v1);
-							int New2 = Mesh.AppendVertex(Mesh, T.v2);
-							Mesh.AppendTriangle(New0, New1, New2);
-							bMeshIsRealBad = true;
-						}
-					}
-					FMergeCoincidentMeshEdges Merger(&Mesh);
-					Merger.Apply();
-					//MeshActor.Add(BreakMesh);
-				}
-
-				FProgressCancel Progress;
-				//Init Simply Mesh tool
-
-				TUniquePtr<FSimplifyMeshOp> SimplifyOp = MakeUnique<FSimplifyMeshOp>();
-				SimplifyOp->bDiscardAttributes = false;
-				SimplifyOp->bPreventNormalFlips = true;
-				SimplifyOp->bPreserveSharpEdges = true;
-				SimplifyOp->bAllowSeamCollapse = false;
-				SimplifyOp->bReproject = false;
-				SimplifyOp->SimplifierType = ESimplifyType::QEM;
-				SimplifyOp->TargetEdgeLength = 5.0;
-				SimplifyOp->TargetMode = ESimplifyTargetType::Percentage;
-				SimplifyOp->TargetPercentage = PreSimplificationPercentage;
-				SimplifyOp->MeshBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
-				SimplifyOp->GroupBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
-				SimplifyOp->MaterialBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
-				SimplifyOp->OriginalMesh = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(Mesh);
-				SimplifyOp->OriginalMeshSpatial = MakeShared<FDynamicMeshAABBTree3, ESPMode::ThreadSafe>(SimplifyOp->OriginalMesh.Get());
-				SimplifyOp->CalculateResult(&Progress);
-				TUniquePtr<FDynamicMesh3> SimplifyNewMesh = SimplifyOp->ExtractResult();
+				const FPreSimplifiedMeshCache::FMeshPtr* SimplifyNewMesh = SimplifiedMeshes.Find(ISMComponent->GetStaticMesh());
 
 				TArray<FTransform> TransformList;
 				for (int32 InstanceIndex = 0; InstanceIndex < ISMComponent->GetInstanceCount(); ++InstanceIndex)
@@ -465,14 +421,10 @@ void MergeInstancesMeshes(ALevelInstance* LevelInstance, FDynamicMesh3 &MergedMe
 						if (ensure(ISMComponent->GetInstanceTransform(InstanceIndex, InstanceTransform, true)))
 						{
 							FTransform LocalTransform = InstanceTransform.GetRelativeTransform(ActorTransform);
-							FDynamicMesh3 SubMesh = *SimplifyNewMesh.Get();
-							FTransformSRT3d Transform = FTransformSRT3d(LocalTransform);
-							if (Transform.GetDeterminant() < 0)
+							if (SimplifyNewMesh)
 							{
-								SubMesh.ReverseOrientation(false);
+								AppendInstanceMesh(MergeEditor, Mappings, **SimplifyNewMesh, FTransformSRT3d(LocalTransform));
 							}
-							MergeEditor.AppendMesh(&SubMesh, Mappings, [&Transform, &ActorTransform](int, const FVector3d& P) {return Transform.TransformPosition(P); }, [&Transform](int, const FVector3d& N) {return Transform.TransformVector(N); });
-
 
 							//MeshTransforms::ApplyTransform(SubMesh, FTransformSRT3d(LocalTransform));
 							TransformList.Add(InstanceTransform);
@@ -480,14 +432,13 @@ void MergeInstancesMeshes(ALevelInstance* LevelInstance, FDynamicMesh3 &MergedMe
 					}
 				}
 				InstancesInfo.Add(ISMComponent->GetStaticMesh(), TransformList);
-				SimplifyNewMesh->Clear();
 			}
 		}
 	}
 }
 
 
-void MergeActorMeshes(TArray<AStaticMeshActor*> MeshActor, FDynamicMesh3& MergedMesh, TMap<UStaticMesh*, TArray<FTransform>>& InstancesInfo, int PreSimplificationPercentage)
+void MergeActorMeshes(TArray<AStaticMeshActor*> MeshActor, FDynamicMesh3& MergedMesh, TMap<UStaticMesh*, TArray<FTransform>>& InstancesInfo, int PreSimplificationPercentage, FPreSimplificationReport& Report)
 {
 	{
 		if (MeshActor.Num() > 0)
@@ -515,6 +466,13 @@ void MergeActorMeshes(TArray<AStaticMeshActor*> MeshActor, FDynamicMesh3& Merged
 				}
 			}
 
+			//Pre-simplify each unique mesh once
+			TArray<UStaticMesh*> StaticMeshes;
+			ActorMap.GetKeys(StaticMeshes);
+			FPreSimplificationSettings Settings;
+			Settings.TargetPercentage = PreSimplificationPercentage;
+			TMap<UStaticMesh*, FPreSimplifiedMeshCache::FMeshPtr> SimplifiedMeshes = FPreSimplifiedMeshCache::Get().FindOrBuild(StaticMeshes, Settings, Report);
+
 			FText TaskLength = FText::FromString("Reading Staticmesh : 0 / " + FString::FromInt(ActorMap.Num()));
 			FScopedSlowTask SlowTask(ActorMap.Num(), TaskLength);
 			SlowTask.MakeDialog();
@@ -526,57 +484,7 @@ void MergeActorMeshes(TArray<AStaticMeshActor*> MeshActor, FDynamicMesh3& Merged
 			{
 				SlowTask.EnterProgressFrame(1.0, FText::FromString("Reading Staticmesh : " + FString::FromInt(j) + " / " + FString::FromInt(ActorMap.Num())));
 
-				FDynamicMesh3 Mesh;
-				bool bMeshIsRealBad = false;
-				FTriMeshCollisionData CollisionData;
-				if (Elem.Key)
-				{
-					Elem.Key->GetPhysicsTriMeshData(&CollisionData, true);
-					for (const FVector3f& V : CollisionData.Vertices)
-					{
-						Mesh.AppendVertex((FVector3d)V);
-					}
-					for (FTriIndices T : CollisionData.Indices)
-					{
-						if (Mesh.FindTriangle(T.v0, T.v1, T.v2) != FDynamicMesh3::InvalidID)
-						{
-							bMeshIsRealBad = true;
-							continue; // skip duplicate triangles in mesh
-						}
-						if (FDynamicMesh3::NonManifoldID == Mesh.AppendTriangle(T.v0, T.v1, T.v2))
-						{
-							int New0 = Mesh.AppendVertex(Mesh, T.v0);
-							int New1 = Mesh.AppendVertex(Mesh, T.v1);
-							int New2 = Mesh.AppendVertex(Mesh, T.v2);
-							Mesh.AppendTriangle(New0, New1, New2);
-							bMeshIsRealBad = true;
-						}
-					}
-					FMergeCoincidentMeshEdges Merger(&Mesh);
-					Merger.Apply();
-					//MeshActor.Add(BreakMesh);
-				}
-
-				FProgressCancel Progress;
-				//Init Simply Mesh tool
-
-				TUniquePtr<FSimplifyMeshOp> SimplifyOp = MakeUnique<FSimplifyMeshOp>();
-				SimplifyOp->bDiscardAttributes = false;
-				SimplifyOp->bPreventNormalFlips = true;
-				SimplifyOp->bPreserveSharpEdges = true;
-				SimplifyOp->bAllowSeamCollapse = false;
-				SimplifyOp->bReproject = false;
-				SimplifyOp->SimplifierType = ESimplifyType::QEM;
-				SimplifyOp->TargetEdgeLength = 5.0;
-				SimplifyOp->TargetMode = ESimplifyTargetType::Percentage;
-				SimplifyOp->TargetPercentage = PreSimplificationPercentage;
-				SimplifyOp->MeshBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
-				SimplifyOp->GroupBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
-				SimplifyOp->MaterialBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
-				SimplifyOp->OriginalMesh = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(Mesh);
-				SimplifyOp->OriginalMeshSpatial = MakeShared<FDynamicMeshAABBTree3, ESPMode::ThreadSafe>(SimplifyOp->OriginalMesh.Get());
-				SimplifyOp->CalculateResult(&Progress);
-				TUniquePtr<FDynamicMesh3> SimplifyNewMesh = SimplifyOp->ExtractResult();
+				const FPreSimplifiedMeshCache::FMeshPtr* SimplifyNewMesh = SimplifiedMeshes.Find(Elem.Key);
 
 				TArray<FTransform> TransformList;
 				for (int32 InstanceIndex = 0; InstanceIndex < Elem.Value.Num(); ++InstanceIndex)
@@ -586,21 +494,16 @@ void MergeActorMeshes(TArray<AStaticMeshActor*> MeshActor, FDynamicMesh3& Merged
 					{
 
 						FTransform LocalTransform = Elem.Value[InstanceIndex].GetRelativeTransform(FTransform(FRotator(0, 0, 0),ActorTransform.GetLocation(), FVector(1, 1, 1)));
-						FDynamicMesh3 SubMesh = *SimplifyNewMesh.Get();
-						FTransformSRT3d Transform = FTransformSRT3d(LocalTransform);
-						if (Transform.GetDeterminant() < 0)
+						if (SimplifyNewMesh)
 						{
-							SubMesh.ReverseOrientation(false);
+							AppendInstanceMesh(MergeEditor, Mappings, **SimplifyNewMesh, FTransformSRT3d(LocalTransform));
 						}
-						MergeEditor.AppendMesh(&SubMesh, Mappings, [&Transform, &ActorTransform](int, const FVector3d& P) {return Transform.TransformPosition(P); }, [&Transform](int, const FVector3d& N) {return Transform.TransformVector(N); });
-
 
 						//MeshTransforms::ApplyTransform(SubMesh, FTransformSRT3d(LocalTransform));
 						TransformList.Add(InstanceTransform);
 					}
 				}
 				InstancesInfo.Add(Elem.Key, TransformList);
-				SimplifyNewMesh->Clear();
 
 				j++;
 			}
@@ -609,7 +512,7 @@ void MergeActorMeshes(TArray<AStaticMeshActor*> MeshActor, FDynamicMesh3& Merged
 }
 
 
-void CreateCollisionMesh(ALevelInstance* LevelInstance,  TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe>TargetMesh, FString LevelName, FString SavePath, FTransform OriginalTransform, int TargetPercentage, bool bSaveAsset)
+UStaticMesh* CreateCollisionMesh(ALevelInstance* LevelInstance, const FDynamicMesh3& FinalMesh, FString LevelName, FString SavePath, FTransform OriginalTransform, bool bSaveAsset)
 {
 
 	//Init Asset Name and Mesh
@@ -628,32 +531,7 @@ void CreateCollisionMesh(ALevelInstance* LevelInstance,  TSharedPtr<FDynamicMesh
 	FMeshBuildSettings buildsetting;
 	FMeshDescription* MeshDescription = myStaticMesh->CreateMeshDescription(0);
 	FDynamicMeshToMeshDescription Converters;
-	Converters.Convert(TargetMesh.Get(), *MeshDescription);
-
-	//Simplify Final Mesh
-	TUniquePtr<FSimplifyMeshOp> FinalOp = MakeUnique<FSimplifyMeshOp>();
-	FinalOp->bDiscardAttributes = false;
-	FinalOp->bPreventNormalFlips = true;
-	FinalOp->bPreserveSharpEdges = true;
-	FinalOp->bAllowSeamCollapse = false;
-	FinalOp->bReproject = false;
-	FinalOp->TargetEdgeLength = 5.0;
-	FinalOp->SimplifierType = ESimplifyType::UEStandard;
-	FinalOp->TargetMode = ESimplifyTargetType::TriangleCount;
-	FinalOp->TargetCount = TargetPercentage;
-	FinalOp->MeshBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
-	FinalOp->GroupBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
-	FinalOp->MaterialBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
-	FinalOp->OriginalMesh = TargetMesh;
-	FinalOp->OriginalMeshSpatial = MakeShared<FDynamicMeshAABBTree3, ESPMode::ThreadSafe>(FinalOp->OriginalMesh.Get());
-	FinalOp->OriginalMeshDescription = MakeShared<FMeshDescription, ESPMode::ThreadSafe>(*MeshDescription);
-	IMeshReductionManagerModule& MeshReductionModule = FModuleManager::Get().LoadModuleChecked<IMeshReductionManagerModule>("MeshReductionInterface");
-	FinalOp->MeshReduction = MeshReductionModule.GetStaticMeshReductionInterface();
-	FProgressCancel Progress;
-	FinalOp->CalculateResult(&Progress);
-	TUniquePtr<FDynamicMesh3> FinalMesh = FinalOp->ExtractResult();
-
-	Converters.Convert(FinalMesh.Get(), *MeshDescription);
+	Converters.Convert(&FinalMesh, *MeshDescription);
 
 	TArray<const FMeshDescription*> MeshDescriptionPointers;
 	MeshDescriptionPointers.Add(MeshDescription);
@@ -699,62 +577,38 @@ void CreateCollisionMesh(ALevelInstance* LevelInstance,  TSharedPtr<FDynamicMesh
 		Collider->GetStaticMeshComponent()->SetStaticMesh(myStaticMesh);
 		Collider->MarkComponentsRenderStateDirty();
 	}
+
+	return myStaticMesh;
 }
 
-void UInstanceLevelCollisionBPLibrary::GenerateCollision(ALevelInstance* LevelInstance, TArray<AStaticMeshActor*> SelectedMeshActor, float ZOffset, ECollisionMaxSlice CollisionType, bool bRemesh, int PreSimplificationPercentage, bool bSaveAsset, int VoxelDensity, float TargetPercentage, float Winding)
+void PrepareCollisionInput(ALevelInstance* LevelInstance, const TArray<AStaticMeshActor*>& SelectedMeshActor, float ZOffset, ECollisionMaxSlice CollisionType, int PreSimplificationPercentage, FCollisionGenerationInput& OutInput)
 {
-	float NumTask = 5.0;
-	FText SlowTaskText = NSLOCTEXT("ReadAllMeshes", "ReadAllMeshes", "Reading all meshes ...");
-	const int32 UnitProgressOutOfLoop = 1;  // One progress frame is equivalent to a minimum of 2% of the loop progress
-
-	FScopedSlowTask SlowTask(NumTask, SlowTaskText);
-	SlowTask.MakeDialog();
-
-	// Declare progress shortcut lambdas
-	auto EnterProgressFrame = [&SlowTask](float Progress, const FText& Text = FText())
-	{
-		SlowTask.EnterProgressFrame(Progress, Text);
-	};
-
-	UWorld* World = GEditor->GetEditorWorldContext().World();
-	FString LevelName;
-	FString SavePath;
-	TArray<TSharedPtr<FDynamicMesh3>> MeshList;
-	TArray<UStaticMesh*> StaticMeshList;
-	FTransform OriginalTransform;
 	TMap<UStaticMesh*, TArray<FTransform>>InstancesInfo;
-	TArray<FTransform> ListTransforms;
-	TArray<AStaticMeshActor*> InstanceMeshes;
-	TArray<AStaticMeshActor*> MeshActor;
-	FDynamicMesh3 MergedMesh;
+	FDynamicMesh3& MergedMesh = OutInput.MergedMesh;
 
 	//If Collision is generated for a Level Instance
 	if (LevelInstance)
 	{
-		LevelName = LevelInstance->GetActorLabel();
-		OriginalTransform = LevelInstance->GetTransform();
-		SavePath = FPaths::GetPath(LevelInstance->GetWorldAssetPackage());
-		FTransform SavedTransform = LevelInstance->GetTransform();
-		World = LevelInstance->GetWorld();
+		OutInput.LevelName = LevelInstance->GetActorLabel();
+		OutInput.OriginalTransform = LevelInstance->GetTransform();
+		OutInput.SavePath = FPaths::GetPath(LevelInstance->GetWorldAssetPackage());
 
-		MergeInstancesMeshes(LevelInstance, MergedMesh, InstancesInfo, PreSimplificationPercentage);
-		InstanceMeshes = MeshActor;
+		MergeInstancesMeshes(LevelInstance, MergedMesh, InstancesInfo, PreSimplificationPercentage, OutInput.PreSimplificationReport);
 	}
 	//If Collision is generated for a StaticMesh
 	if (SelectedMeshActor.Num() > 0)
 	{
-		World = SelectedMeshActor[0]->GetWorld();
-		OriginalTransform = SelectedMeshActor[0]->GetTransform();
-		LevelName = SelectedMeshActor[0]->GetActorLabel();
-		SavePath = FPaths::GetPath(SelectedMeshActor[0]->GetStaticMeshComponent()->GetStaticMesh()->GetOutermost()->GetPathName());
-		MergeActorMeshes(SelectedMeshActor, MergedMesh, InstancesInfo, PreSimplificationPercentage);
-		MeshActor.Append(SelectedMeshActor);
+		OutInput.OriginalTransform = SelectedMeshActor[0]->GetTransform();
+		OutInput.LevelName = SelectedMeshActor[0]->GetActorLabel();
+		OutInput.SavePath = FPaths::GetPath(SelectedMeshActor[0]->GetStaticMeshComponent()->GetStaticMesh()->GetOutermost()->GetPathName());
+		MergeActorMeshes(SelectedMeshActor, MergedMesh, InstancesInfo, PreSimplificationPercentage, OutInput.PreSimplificationReport);
 	}
 
+	UE_LOG(LogTemp, Log, TEXT("%s pre-simplification: %s"), *OutInput.LevelName, *OutInput.PreSimplificationReport.ToString());
+
 	// Cap the bottom of the mesh
-	FDynamicMesh3 Projected;
 	float ZValue = 0;
-	CapBottom(&MergedMesh, Projected, ZValue, ZOffset, OriginalTransform, CollisionType);
+	CapBottom(&MergedMesh, OutInput.Cap, ZValue, ZOffset, OutInput.OriginalTransform, CollisionType);
 	TArray<int> RemoveTris;
 	for (int tid : MergedMesh.TriangleIndicesItr())
 	{
@@ -769,113 +623,74 @@ void UInstanceLevelCollisionBPLibrary::GenerateCollision(ALevelInstance* LevelIn
 
 	//Add the Cap to the merge mesh - Useful to preview the Cap mesh
 	/*FMeshIndexMappings IndexMaps;
-	Editor.AppendMesh(&Projected, IndexMaps);*/
+	Editor.AppendMesh(&OutInput.Cap, IndexMaps);*/
+}
 
-	SlowTaskText = NSLOCTEXT("Remeshing", "Remeshing", "Remeshing ...");
-	EnterProgressFrame(1.0, SlowTaskText);
+void UInstanceLevelCollisionBPLibrary::GenerateCollision(ALevelInstance* LevelInstance, TArray<AStaticMeshActor*> SelectedMeshActor, float ZOffset, ECollisionMaxSlice CollisionType, bool bRemesh, int PreSimplificationPercentage, bool bSaveAsset, int VoxelDensity, float TargetPercentage, float Winding)
+{
+	float NumTask = 5.0;
+	FText SlowTaskText = NSLOCTEXT("ReadAllMeshes", "ReadAllMeshes", "Reading all meshes ...");
 
-	FProgressCancel Progress;
-	TUniquePtr<FDynamicMesh3> Remesh;
+	FScopedSlowTask SlowTask(NumTask, SlowTaskText);
+	SlowTask.MakeDialog(true);
 
+	// Declare progress shortcut lambdas
+	auto EnterProgressFrame = [&SlowTask](float Progress, const FText& Text = FText())
+	{
+		SlowTask.EnterProgressFrame(Progress, Text);
+	};
+
+	FCollisionGenerationInput Input;
+	PrepareCollisionInput(LevelInstance, SelectedMeshActor, ZOffset, CollisionType, PreSimplificationPercentage, Input);
 
-	//Remesh
-	if (bRemesh)
+	const FPreSimplificationReport& PreSimplificationReport = Input.PreSimplificationReport;
+	if (PreSimplificationReport.NumUniqueMeshes > 0)
 	{
-		TUniquePtr<FRemeshMeshOp> RemeshOp = MakeUnique<FRemeshMeshOp>();
-		RemeshOp->RemeshType = ERemeshType::Standard;
-		RemeshOp->bCollapses = true;
-		RemeshOp->bDiscardAttributes = false;
-		RemeshOp->bFlips = true;
-		RemeshOp->bPreserveSharpEdges = true;
-		RemeshOp->SmoothingType = ERemeshSmoothingType::MeanValue;
-		RemeshOp->MaxRemeshIterations = 20;
-		RemeshOp->RemeshIterations = 20;
-		RemeshOp->bReproject = true;
-		RemeshOp->ProjectionTarget = &MergedMesh;
-		RemeshOp->MeshBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
-		RemeshOp->GroupBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
-		RemeshOp->MaterialBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
-		TUniquePtr<FDynamicMesh3> ProjectionTarget = MakeUnique<FDynamicMesh3>(MergedMesh);
-		TUniquePtr<FDynamicMeshAABBTree3> ProjectionTargetSpatial = MakeUnique<FDynamicMeshAABBTree3>(ProjectionTarget.Get(), true);
-		RemeshOp->ProjectionTargetSpatial = ProjectionTargetSpatial.Get();
-		RemeshOp->OriginalMesh = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(MergedMesh);
-		RemeshOp->OriginalMeshSpatial = MakeShared<FDynamicMeshAABBTree3, ESPMode::ThreadSafe>(RemeshOp->OriginalMesh.Get(), true);
-		RemeshOp->TargetEdgeLength = CalculateTargetEdgeLength(MergedMesh.TriangleCount(), RemeshOp->OriginalMesh);
-		RemeshOp->CalculateResult(&Progress);
-		Remesh = RemeshOp->ExtractResult();
-		RemeshOp = nullptr;
-		MergedMesh.Clear();
+		FNotificationInfo Info(FText::FromString(FString::Printf(TEXT("Pre-simplification: %d / %d meshes cached, ~%.1fs saved"),
+			PreSimplificationReport.GetNumHits(), PreSimplificationReport.NumUniqueMeshes, PreSimplificationReport.SavedSeconds)));
+		Info.ExpireDuration = 5.0f;
+		FSlateNotificationManager::Get().AddNotification(Info);
 	}
-	else
+
+	// Everything past here is geometry only; run it off the game thread so the dialog stays live and can cancel it
+	FCollisionPipelineSettings PipelineSettings;
+	PipelineSettings.bRemesh = bRemesh;
+	PipelineSettings.VoxelDensity = VoxelDensity;
+	PipelineSettings.Winding = Winding;
+	PipelineSettings.TargetTriangleCount = TargetPercentage;
+	IMeshReductionManagerModule& MeshReductionModule = FModuleManager::Get().LoadModuleChecked<IMeshReductionManagerModule>("MeshReductionInterface");
+	IMeshReduction* MeshReduction = MeshReductionModule.GetStaticMeshReductionInterface();
+
+	FCollisionPipelineProgress PipelineProgress;
+	TUniquePtr<FDynamicMesh3> CollisionMesh;
+	UE::Tasks::FTask PipelineTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [&]()
 	{
-		Remesh = MakeUnique<FDynamicMesh3>(MergedMesh);
-		MergedMesh.Clear();
+		CollisionMesh = FCollisionMeshPipeline::Run(MoveTemp(Input.MergedMesh), Input.Cap, PipelineSettings, MeshReduction, PipelineProgress);
+	});
+
+	float ReportedProgress = 0.f;
+	while (!PipelineTask.Wait(FTimespan::FromMilliseconds(50.0)))
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			PipelineProgress.Cancel();
+		}
+
+		const float PipelineFraction = PipelineProgress.GetProgress();
+		EnterProgressFrame((PipelineFraction - ReportedProgress) * NumTask, FCollisionPipelineProgress::GetStageText(PipelineProgress.GetStage()));
+		ReportedProgress = PipelineFraction;
 	}
 
+	if (!CollisionMesh.IsValid())
+	{
+		UE_LOG(LogTemp, Log, TEXT("%s collision generation %s"), *Input.LevelName, PipelineProgress.IsCancelled() ? TEXT("cancelled") : TEXT("produced no mesh"));
+		return;
+	}
 
-	//Jacketing Mesh 
-	SlowTaskText = NSLOCTEXT("Jacketing", "Jacketing", "Jacketing ...");
-	EnterProgressFrame(1.0, SlowTaskText);
-
-	TUniquePtr<FRemoveOccludedTrianglesOp> JacketingOp = MakeUnique<FRemoveOccludedTrianglesOp>();
-	JacketingOp->InsideMode = EOcclusionCalculationMode::SimpleOcclusionTest;
-	JacketingOp->AddTriangleSamples = 4;
-	JacketingOp->AddRandomRays = 4;
-	JacketingOp->MeshTransforms.SetNum(1);
-	JacketingOp->OriginalMesh = MakeShareable<FDynamicMesh3>(Remesh.Release());
-	JacketingOp->OccluderTrees.Add(MakeShared<FDynamicMeshAABBTree3, ESPMode::ThreadSafe>(JacketingOp->OriginalMesh.Get()));
-	JacketingOp->OccluderWindings.Emplace(); // empty winding tree, because simple occlusion test doesn't need it
-	JacketingOp->OccluderTransforms.Emplace(); // default constructor is identity
-	JacketingOp->OccluderTrees.Emplace(MakeShared<FDynamicMeshAABBTree3, ESPMode::ThreadSafe>(&Projected));
-	JacketingOp->OccluderWindings.Emplace(); // empty winding tree, because simple occlusion test doesn't need it
-	JacketingOp->OccluderTransforms.Emplace(); // default constructor is identity
-	JacketingOp->CalculateResult(&Progress);
-	TUniquePtr<FDynamicMesh3> jacketMesh = JacketingOp->ExtractResult();
-	JacketingOp = nullptr;
-
-
-	// Init Vox Wrap tool
-	SlowTaskText = NSLOCTEXT("VoxWrap", "VoxWrap", "Vox Wrap ...");
-	EnterProgressFrame(1.0, SlowTaskText);
-
-	TUniquePtr<FVoxelSolidifyMeshesOp> Op = MakeUnique<FVoxelSolidifyMeshesOp>();
-	Op->Transforms.SetNum(1);
-	Op->Meshes.SetNum(1);
-	TArray<TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe>> OriginalDynamicMeshes;
-	OriginalDynamicMeshes.Add(MakeShareable<FDynamicMesh3>(jacketMesh.Release()));
-	Op->Meshes = OriginalDynamicMeshes;
-	Op->Transforms[0] = FTransform::Identity;
-	Op->OutputVoxelCount = VoxelDensity;
-	Op->InputVoxelCount = VoxelDensity;
-	Op->bAutoSimplify = false;
-	Op->WindingThreshold = Winding;
-	Op->CalculateResult(&Progress);
-	TUniquePtr<FDynamicMesh3> Newmesh = Op->ExtractResult();
-	Op = nullptr;
-
-	// Init Vox Morph tool
-	SlowTaskText = NSLOCTEXT("VoxMorph", "VoxMorph", "Vox Morph ...");
-	EnterProgressFrame(1.0, SlowTaskText);
-
-	TUniquePtr<FVoxelMorphologyMeshesOp> MorphOp = MakeUnique<FVoxelMorphologyMeshesOp>();
-	MorphOp->Transforms.SetNum(1);
-	MorphOp->Meshes.SetNum(1);
-	TArray<TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe>> OriginalDynamicMeshesMorph;
-	OriginalDynamicMeshesMorph.Add(MakeShareable<FDynamicMesh3>(Newmesh.Release()));
-	MorphOp->Meshes = OriginalDynamicMeshesMorph;
-	MorphOp->Transforms[0] = FTransform::Identity;
-	MorphOp->OutputVoxelCount = VoxelDensity;
-	MorphOp->InputVoxelCount = VoxelDensity;
-	MorphOp->bAutoSimplify = false;
-	MorphOp->Operation = EMorphologyOperation::Close;
-	MorphOp->CalculateResult(&Progress);
-	TUniquePtr<FDynamicMesh3> Morphmesh = MorphOp->ExtractResult();
-	MorphOp = nullptr;
-
-	// Simplification and Save
-	SlowTaskText = NSLOCTEXT("Simplifying", "Simplifying", "Simplifying ...");
-	EnterProgressFrame(1.0, SlowTaskText);
-	CreateCollisionMesh(LevelInstance, MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(*Morphmesh), LevelName, SavePath, OriginalTransform, TargetPercentage, bSaveAsset);
+	// Save
+	SlowTaskText = NSLOCTEXT("Saving", "Saving", "Saving ...");
+	EnterProgressFrame((1.f - ReportedProgress) * NumTask, SlowTaskText);
+	CreateCollisionMesh(LevelInstance, *CollisionMesh, Input.LevelName, Input.SavePath, Input.OriginalTransform, bSaveAsset);
 
 
 }
\ No newline at end of file
@@ -0,0 +1,323 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "PreSimplifiedMeshCache.h"
+
+#include "Async/ParallelFor.h"
+#include "CleaningOps/SimplifyMeshOp.h"
+#include "CollisionMeshImport.h"
+#include "DerivedDataCacheInterface.h"
+#include "DynamicMesh/DynamicMeshAABBTree3.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/Interface_CollisionDataProvider.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/CustomVersion.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "StaticMeshResources.h"
+#include "Util/ProgressCancel.h"
+
+using namespace UE::Geometry;
+
+// Change this to invalidate every pre-simplified mesh in the derived data cache, e.g. when BuildSimplifiedMesh changes
+#define PRESIMPLIFIEDMESH_DERIVEDDATA_VER TEXT("A84E2D17C95B4F60B3D1E7286C0F5A9E")
+
+//////////////////////////////////////////////////////////////////////
+// FPreSimplificationSettings
+
+FString FPreSimplificationSettings::GetKeySuffix() const
+{
+	// TargetPercentage is the only variable; the rest mirrors the fixed op settings in BuildSimplifiedMesh
+	return FString::Printf(TEXT("QEM_P%d_E5_NF1_SE1_SC0_RP0"), TargetPercentage);
+}
+
+//////////////////////////////////////////////////////////////////////
+// FPreSimplificationReport
+
+FString FPreSimplificationReport::ToString() const
+{
+	return FString::Printf(TEXT("%d unique meshes, %d cache hits (%d memory, %d disk), %d built in %.2fs, ~%.2fs saved, %.2fs wall"),
+		NumUniqueMeshes, GetNumHits(), NumMemoryHits, NumDiskHits, NumBuilt, BuildSeconds, SavedSeconds, WallSeconds);
+}
+
+//////////////////////////////////////////////////////////////////////
+// FPreSimplifiedMeshCache
+
+FPreSimplifiedMeshCache& FPreSimplifiedMeshCache::Get()
+{
+	static FPreSimplifiedMeshCache Cache;
+	return Cache;
+}
+
+TMap<UStaticMesh*, FPreSimplifiedMeshCache::FMeshPtr> FPreSimplifiedMeshCache::FindOrBuild(const TArray<UStaticMesh*>& StaticMeshes, const FPreSimplificationSettings& Settings, FPreSimplificationReport& OutReport)
+{
+	check(IsInGameThread());
+
+	const double StartTime = FPlatformTime::Seconds();
+	const uint64 Use = ++NumFindOrBuildCalls;
+
+	struct FPendingMesh
+	{
+		UStaticMesh* StaticMesh = nullptr;
+		FString DerivedDataKey;
+		FTriMeshCollisionData CollisionData;
+		TUniquePtr<FDynamicMesh3> Mesh;
+		double BuildSeconds = 0.0;
+		bool bFromDerivedData = false;
+	};
+
+	TMap<UStaticMesh*, FMeshPtr> Result;
+	TArray<FPendingMesh> Pending;
+	TSet<UStaticMesh*> Seen;
+
+	for (UStaticMesh* StaticMesh : StaticMeshes)
+	{
+		bool bAlreadySeen = false;
+		Seen.Add(StaticMesh, &bAlreadySeen);
+		if (StaticMesh == nullptr || bAlreadySeen)
+		{
+			continue;
+		}
+
+		++OutReport.NumUniqueMeshes;
+
+		const FString MeshHash = GetMeshHash(StaticMesh);
+		FString DerivedDataKey = MeshHash.IsEmpty() ? FString() : GetDerivedDataKey(MeshHash, Settings);
+		if (!DerivedDataKey.IsEmpty())
+		{
+			if (FEntry* Entry = Entries.Find(FEntryKey(StaticMesh, DerivedDataKey)))
+			{
+				Entry->LastUse = Use;
+				Result.Add(StaticMesh, Entry->Mesh);
+				++OutReport.NumMemoryHits;
+				OutReport.SavedSeconds += Entry->BuildSeconds;
+				continue;
+			}
+		}
+
+		FPendingMesh& PendingMesh = Pending.AddDefaulted_GetRef();
+		PendingMesh.StaticMesh = StaticMesh;
+		PendingMesh.DerivedDataKey = MoveTemp(DerivedDataKey);
+	}
+
+	ParallelFor(Pending.Num(), [&Pending](int32 Index)
+	{
+		FPendingMesh& PendingMesh = Pending[Index];
+		if (!PendingMesh.DerivedDataKey.IsEmpty())
+		{
+			PendingMesh.bFromDerivedData = LoadFromDerivedData(PendingMesh.DerivedDataKey, PendingMesh.Mesh, PendingMesh.BuildSeconds);
+		}
+	});
+
+	// Reading the collision triangles touches the mesh, so it stays on the game thread; only the geometry work is farmed out
+	for (FPendingMesh& PendingMesh : Pending)
+	{
+		if (!PendingMesh.bFromDerivedData)
+		{
+			PendingMesh.StaticMesh->GetPhysicsTriMeshData(&PendingMesh.CollisionData, true);
+		}
+	}
+
+	ParallelFor(Pending.Num(), [&Pending, &Settings](int32 Index)
+	{
+		FPendingMesh& PendingMesh = Pending[Index];
+		if (!PendingMesh.bFromDerivedData)
+		{
+			const double BuildStartTime = FPlatformTime::Seconds();
+			PendingMesh.Mesh = BuildSimplifiedMesh(PendingMesh.CollisionData, Settings);
+			PendingMesh.BuildSeconds = FPlatformTime::Seconds() - BuildStartTime;
+			PendingMesh.CollisionData = FTriMeshCollisionData();
+		}
+	});
+
+	for (FPendingMesh& PendingMesh : Pending)
+	{
+		if (PendingMesh.bFromDerivedData)
+		{
+			++OutReport.NumDiskHits;
+			OutReport.SavedSeconds += PendingMesh.BuildSeconds;
+		}
+		else
+		{
+			++OutReport.NumBuilt;
+			OutReport.BuildSeconds += PendingMesh.BuildSeconds;
+
+			if (!PendingMesh.DerivedDataKey.IsEmpty())
+			{
+				SaveToDerivedData(PendingMesh.DerivedDataKey, *PendingMesh.Mesh, PendingMesh.BuildSeconds);
+			}
+		}
+
+		FMeshPtr Mesh = MakeShareable(PendingMesh.Mesh.Release());
+		if (!PendingMesh.DerivedDataKey.IsEmpty())
+		{
+			Entries.Add(FEntryKey(PendingMesh.StaticMesh, PendingMesh.DerivedDataKey), { Mesh, PendingMesh.BuildSeconds, Use });
+		}
+		Result.Add(PendingMesh.StaticMesh, Mesh);
+	}
+
+	TrimEntries();
+
+	OutReport.WallSeconds += FPlatformTime::Seconds() - StartTime;
+
+	return Result;
+}
+
+void FPreSimplifiedMeshCache::SetMaxMemoryEntries(int32 InMaxMemoryEntries)
+{
+	MaxMemoryEntries = FMath::Max(InMaxMemoryEntries, 0);
+	TrimEntries();
+}
+
+void FPreSimplifiedMeshCache::TrimEntries()
+{
+	const int32 NumToEvict = Entries.Num() - MaxMemoryEntries;
+	if (NumToEvict <= 0)
+	{
+		return;
+	}
+
+	// Callers keep whatever they were given alive; only the cache lets go of the meshes
+	TArray<TPair<uint64, FEntryKey>> EntriesByUse;
+	EntriesByUse.Reserve(Entries.Num());
+	for (const TPair<FEntryKey, FEntry>& Entry : Entries)
+	{
+		EntriesByUse.Emplace(Entry.Value.LastUse, Entry.Key);
+	}
+	EntriesByUse.Sort([](const TPair<uint64, FEntryKey>& A, const TPair<uint64, FEntryKey>& B) { return A.Key < B.Key; });
+
+	for (int32 Index = 0; Index < NumToEvict; ++Index)
+	{
+		Entries.Remove(EntriesByUse[Index].Value);
+	}
+}
+
+TUniquePtr<FDynamicMesh3> FPreSimplifiedMeshCache::BuildSimplifiedMesh(const FTriMeshCollisionData& CollisionData, const FPreSimplificationSettings& Settings)
+{
+	FDynamicMesh3 Mesh;
+	FCollisionMeshImporter::Import(CollisionData, Mesh);
+
+	if (Mesh.TriangleCount() == 0)
+	{
+		return MakeUnique<FDynamicMesh3>(MoveTemp(Mesh));
+	}
+
+	FProgressCancel Progress;
+	TUniquePtr<FSimplifyMeshOp> SimplifyOp = MakeUnique<FSimplifyMeshOp>();
+	SimplifyOp->bDiscardAttributes = false;
+	SimplifyOp->bPreventNormalFlips = true;
+	SimplifyOp->bPreserveSharpEdges = true;
+	SimplifyOp->bAllowSeamCollapse = false;
+	SimplifyOp->bReproject = false;
+	SimplifyOp->SimplifierType = ESimplifyType::QEM;
+	SimplifyOp->TargetEdgeLength = 5.0;
+	SimplifyOp->TargetMode = ESimplifyTargetType::Percentage;
+	SimplifyOp->TargetPercentage = Settings.TargetPercentage;
+	SimplifyOp->MeshBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
+	SimplifyOp->GroupBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
+	SimplifyOp->MaterialBoundaryConstraint = EEdgeRefineFlags::NoConstraint;
+	SimplifyOp->OriginalMesh = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(MoveTemp(Mesh));
+	SimplifyOp->OriginalMeshSpatial = MakeShared<FDynamicMeshAABBTree3, ESPMode::ThreadSafe>(SimplifyOp->OriginalMesh.Get());
+	SimplifyOp->CalculateResult(&Progress);
+	return SimplifyOp->ExtractResult();
+}
+
+FString FPreSimplifiedMeshCache::GetMeshHash(UStaticMesh* StaticMesh)
+{
+#if WITH_EDITORONLY_DATA
+	const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+	if (RenderData == nullptr || RenderData->DerivedDataKey.IsEmpty())
+	{
+		return FString();
+	}
+
+	// The render data key covers the source geometry and build settings; add what picks the collision triangles out of it
+	FSHA1 Sha;
+	Sha.UpdateWithString(*RenderData->DerivedDataKey, RenderData->DerivedDataKey.Len());
+
+	const int32 LODForCollision = StaticMesh->LODForCollision;
+	Sha.Update(reinterpret_cast<const uint8*>(&LODForCollision), sizeof(LODForCollision));
+
+	for (const FStaticMeshLODResources& LODResources : RenderData->LODResources)
+	{
+		for (const FStaticMeshSection& Section : LODResources.Sections)
+		{
+			const uint8 bEnableCollision = Section.bEnableCollision ? 1 : 0;
+			Sha.Update(&bEnableCollision, sizeof(bEnableCollision));
+		}
+	}
+
+	UStaticMesh* ComplexCollisionMesh = StaticMesh->ComplexCollisionMesh;
+	if (ComplexCollisionMesh && ComplexCollisionMesh != StaticMesh)
+	{
+		const FString ComplexMeshHash = GetMeshHash(ComplexCollisionMesh);
+		if (ComplexMeshHash.IsEmpty())
+		{
+			return FString();
+		}
+		Sha.UpdateWithString(*ComplexMeshHash, ComplexMeshHash.Len());
+	}
+
+	return Sha.Finalize().ToString();
+#else
+	return FString();
+#endif
+}
+
+FString FPreSimplifiedMeshCache::GetDerivedDataKey(const FString& MeshHash, const FPreSimplificationSettings& Settings)
+{
+	return FDerivedDataCacheInterface::BuildCacheKey(TEXT("ILC_PRESIMPLIFIED"), PRESIMPLIFIEDMESH_DERIVEDDATA_VER,
+		*FString::Printf(TEXT("%s_%s"), *MeshHash, *Settings.GetKeySuffix()));
+}
+
+bool FPreSimplifiedMeshCache::LoadFromDerivedData(const FString& DerivedDataKey, TUniquePtr<FDynamicMesh3>& OutMesh, double& OutBuildSeconds)
+{
+	TArray<uint8> Data;
+	if (!GetDerivedDataCacheRef().GetSynchronous(*DerivedDataKey, Data, DerivedDataKey))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Data, true);
+	FCustomVersionContainer CustomVersions;
+	CustomVersions.Serialize(Reader);
+
+	double BuildSeconds = 0.0;
+	TArray<uint8> MeshData;
+	Reader << BuildSeconds;
+	Reader << MeshData;
+	if (Reader.IsError())
+	{
+		return false;
+	}
+
+	FMemoryReader MeshReader(MeshData, true);
+	MeshReader.SetCustomVersions(CustomVersions);
+	TUniquePtr<FDynamicMesh3> Mesh = MakeUnique<FDynamicMesh3>();
+	MeshReader << *Mesh;
+	if (MeshReader.IsError())
+	{
+		return false;
+	}
+
+	OutMesh = MoveTemp(Mesh);
+	OutBuildSeconds = BuildSeconds;
+	return true;
+}
+
+void FPreSimplifiedMeshCache::SaveToDerivedData(const FString& DerivedDataKey, FDynamicMesh3& Mesh, double BuildSeconds)
+{
+	// The mesh is written on its own so the custom versions it used can be stored ahead of it
+	TArray<uint8> MeshData;
+	FMemoryWriter MeshWriter(MeshData, true);
+	MeshWriter << Mesh;
+	FCustomVersionContainer CustomVersions = MeshWriter.GetCustomVersions();
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data, true);
+	CustomVersions.Serialize(Writer);
+	Writer << BuildSeconds;
+	Writer << MeshData;
+
+	GetDerivedDataCacheRef().Put(*DerivedDataKey, Data, DerivedDataKey);
+}
@@ -0,0 +1,95 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "Templates/Tuple.h"
+#include "UObject/ObjectKey.h"
+
+class UStaticMesh;
+struct FTriMeshCollisionData;
+
+/** The parameters of the per-mesh QEM pass run before instances are merged */
+struct FPreSimplificationSettings
+{
+	int32 TargetPercentage = 100;
+
+	/** Everything that affects the simplified result, for cache keys. Bump the cache version when the fixed op settings change. */
+	FString GetKeySuffix() const;
+};
+
+/** What a merge got out of FPreSimplifiedMeshCache */
+struct FPreSimplificationReport
+{
+	int32 NumUniqueMeshes = 0;
+	int32 NumMemoryHits = 0;
+	int32 NumDiskHits = 0;
+	int32 NumBuilt = 0;
+
+	/** Wall time spent in FindOrBuild, lookups included */
+	double WallSeconds = 0.0;
+
+	/** Summed per-mesh build time of the meshes that were built */
+	double BuildSeconds = 0.0;
+
+	/** Summed recorded build time of the meshes that came from the cache */
+	double SavedSeconds = 0.0;
+
+	int32 GetNumHits() const { return NumMemoryHits + NumDiskHits; }
+
+	FString ToString() const;
+};
+
+/**
+ * Pre-simplified collision meshes per unique (static mesh, mesh derived data, simplification settings). The most recently
+ * used results are kept in memory and every result in the derived data cache across sessions; misses are built in parallel.
+ */
+class FPreSimplifiedMeshCache
+{
+public:
+	typedef TSharedPtr<const UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe> FMeshPtr;
+
+	static FPreSimplifiedMeshCache& Get();
+
+	/** Simplified mesh for each of StaticMeshes; null meshes are skipped */
+	TMap<UStaticMesh*, FMeshPtr> FindOrBuild(const TArray<UStaticMesh*>& StaticMeshes, const FPreSimplificationSettings& Settings, FPreSimplificationReport& OutReport);
+
+	/** Drops the in-memory entries; the derived data cache is left alone */
+	void Reset() { Entries.Reset(); }
+
+	/** How many results to keep in memory; past that the least recently used are dropped after each FindOrBuild */
+	void SetMaxMemoryEntries(int32 InMaxMemoryEntries);
+	int32 GetMaxMemoryEntries() const { return MaxMemoryEntries; }
+	int32 GetNumMemoryEntries() const { return Entries.Num(); }
+
+	/** The uncached path: imports the collision triangles through FCollisionMeshImporter and simplifies */
+	static TUniquePtr<UE::Geometry::FDynamicMesh3> BuildSimplifiedMesh(const FTriMeshCollisionData& CollisionData, const FPreSimplificationSettings& Settings);
+
+	/** Hash of what GetPhysicsTriMeshData reads, empty if the mesh has no derived data to key on */
+	static FString GetMeshHash(UStaticMesh* StaticMesh);
+
+private:
+	static FString GetDerivedDataKey(const FString& MeshHash, const FPreSimplificationSettings& Settings);
+
+	static bool LoadFromDerivedData(const FString& DerivedDataKey, TUniquePtr<UE::Geometry::FDynamicMesh3>& OutMesh, double& OutBuildSeconds);
+	static void SaveToDerivedData(const FString& DerivedDataKey, UE::Geometry::FDynamicMesh3& Mesh, double BuildSeconds);
+
+	void TrimEntries();
+
+	struct FEntry
+	{
+		FMeshPtr Mesh;
+		double BuildSeconds = 0.0;
+
+		/** The FindOrBuild call that last returned it */
+		uint64 LastUse = 0;
+	};
+
+	/** Keyed by the mesh and its derived data key, which covers the mesh hash and the settings */
+	typedef TTuple<FObjectKey, FString> FEntryKey;
+	TMap<FEntryKey, FEntry> Entries;
+
+	uint64 NumFindOrBuildCalls = 0;
+	int32 MaxMemoryEntries = 256;
+};
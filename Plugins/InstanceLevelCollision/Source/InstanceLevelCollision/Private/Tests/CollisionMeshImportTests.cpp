@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CollisionMeshImport.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/Interface_CollisionDataProvider.h"
+
+using namespace UE::Geometry;
+
+namespace CollisionMeshImportTests
+{
+	/** A flat grid where every triangle has its own corners, as render data split at UV seams comes out of GetPhysicsTriMeshData */
+	static void MakeSplitGrid(int32 QuadsPerSide, bool bAddDefects, FTriMeshCollisionData& OutCollisionData)
+	{
+		const float Spacing = 10.f;
+		OutCollisionData.Vertices.Reserve(QuadsPerSide * QuadsPerSide * 6 + 3);
+		OutCollisionData.Indices.Reserve(QuadsPerSide * QuadsPerSide * 2 + 2);
+
+		auto AddTriangle = [&OutCollisionData](const FVector3f& A, const FVector3f& B, const FVector3f& C)
+		{
+			FTriIndices& Triangle = OutCollisionData.Indices.AddDefaulted_GetRef();
+			Triangle.v0 = OutCollisionData.Vertices.Add(A);
+			Triangle.v1 = OutCollisionData.Vertices.Add(B);
+			Triangle.v2 = OutCollisionData.Vertices.Add(C);
+		};
+
+		for (int32 Y = 0; Y < QuadsPerSide; ++Y)
+		{
+			for (int32 X = 0; X < QuadsPerSide; ++X)
+			{
+				const FVector3f P00(X * Spacing, Y * Spacing, 0.f);
+				const FVector3f P10((X + 1) * Spacing, Y * Spacing, 0.f);
+				const FVector3f P01(X * Spacing, (Y + 1) * Spacing, 0.f);
+				const FVector3f P11((X + 1) * Spacing, (Y + 1) * Spacing, 0.f);
+				AddTriangle(P00, P10, P11);
+				AddTriangle(P00, P11, P01);
+			}
+		}
+
+		if (bAddDefects && QuadsPerSide >= 2)
+		{
+			// The first triangle again, reversed, through the same vertices
+			FTriIndices Duplicate = OutCollisionData.Indices[0];
+			Swap(Duplicate.v1, Duplicate.v2);
+			OutCollisionData.Indices.Add(Duplicate);
+
+			// A fin standing on the diagonal of quad (1, 1), which is an interior edge
+			const FVector3f Base0(Spacing, Spacing, 0.f);
+			const FVector3f Base1(2.f * Spacing, 2.f * Spacing, 0.f);
+			AddTriangle(Base0, Base1, FVector3f(1.5f * Spacing, 1.5f * Spacing, Spacing));
+		}
+	}
+
+	static int32 CountBoundaryEdges(const FDynamicMesh3& Mesh)
+	{
+		int32 Count = 0;
+		for (int32 EdgeID : Mesh.EdgeIndicesItr())
+		{
+			Count += Mesh.IsBoundaryEdge(EdgeID) ? 1 : 0;
+		}
+		return Count;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCollisionMeshImportEquivalenceTest, "InstanceLevelCollision.CollisionMeshImport.MatchesReference", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Imports a seam-split grid with duplicate and non-manifold triangles both ways and compares the topology */
+bool FCollisionMeshImportEquivalenceTest::RunTest(const FString& Parameters)
+{
+	using namespace CollisionMeshImportTests;
+
+	const int32 QuadsPerSide = 8;
+	FTriMeshCollisionData CollisionData;
+	MakeSplitGrid(QuadsPerSide, true, CollisionData);
+
+	FDynamicMesh3 Reference;
+	FCollisionMeshImporter::ImportReference(CollisionData, Reference);
+
+	FDynamicMesh3 Imported;
+	FCollisionMeshImportStats Stats;
+	FCollisionMeshImporter::Import(CollisionData, Imported, FCollisionMeshImportSettings(), &Stats);
+
+	AddInfo(FString::Printf(TEXT("Reference %d vertices / %d triangles, single pass %d / %d [%s]"),
+		Reference.VertexCount(), Reference.TriangleCount(), Imported.VertexCount(), Imported.TriangleCount(), *Stats.ToString()));
+
+	// The grid welds to one sheet; the fin keeps its own three vertices and all three of its edges stay open
+	TestEqual(TEXT("Vertices"), Imported.VertexCount(), (QuadsPerSide + 1) * (QuadsPerSide + 1) + 3);
+	TestEqual(TEXT("Triangles"), Imported.TriangleCount(), QuadsPerSide * QuadsPerSide * 2 + 1);
+	TestEqual(TEXT("Boundary edges"), CountBoundaryEdges(Imported), QuadsPerSide * 4 + 3);
+	TestEqual(TEXT("Duplicate triangles"), Stats.NumDuplicateTriangles, 1);
+	TestEqual(TEXT("Split vertices"), Stats.NumSplitVertices, 2);
+
+	TestEqual(TEXT("Vertices match the reference"), Imported.VertexCount(), Reference.VertexCount());
+	TestEqual(TEXT("Triangles match the reference"), Imported.TriangleCount(), Reference.TriangleCount());
+	TestEqual(TEXT("Boundary edges match the reference"), CountBoundaryEdges(Imported), CountBoundaryEdges(Reference));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCollisionMeshImportBenchmark, "InstanceLevelCollision.CollisionMeshImport.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+/** Logs import time for a seam-split grid of about a million triangles, reference vs single pass */
+bool FCollisionMeshImportBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace CollisionMeshImportTests;
+
+	constexpr int32 NumTriangles = 1000000;
+
+	const int32 QuadsPerSide = FMath::Max(2, FMath::RoundToInt(FMath::Sqrt(NumTriangles * 0.5)));
+	FTriMeshCollisionData CollisionData;
+	MakeSplitGrid(QuadsPerSide, true, CollisionData);
+
+	const double StartTime = FPlatformTime::Seconds();
+	FDynamicMesh3 Reference;
+	FCollisionMeshImporter::ImportReference(CollisionData, Reference);
+	const double ReferenceSeconds = FPlatformTime::Seconds() - StartTime;
+
+	FDynamicMesh3 Imported;
+	FCollisionMeshImportStats Stats;
+	FCollisionMeshImporter::Import(CollisionData, Imported, FCollisionMeshImportSettings(), &Stats);
+
+	AddInfo(FString::Printf(TEXT("%d triangles: reference %.3fs (%d vertices), single pass %.3fs (%d vertices), %.1fx [%s]"),
+		CollisionData.Indices.Num(), ReferenceSeconds, Reference.VertexCount(), Stats.Seconds, Imported.VertexCount(),
+		ReferenceSeconds / FMath::Max(Stats.Seconds, UE_DOUBLE_SMALL_NUMBER), *Stats.ToString()));
+	TestEqual(TEXT("Same vertex count as the reference"), Imported.VertexCount(), Reference.VertexCount());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CollisionMeshPipeline.h"
+#include "DynamicMeshEditor.h"
+#include "Generators/MinimalBoxMeshGenerator.h"
+#include "HAL/PlatformTime.h"
+#include "MeshQueries.h"
+
+using namespace UE::Geometry;
+
+namespace CollisionMeshPipelineTests
+{
+	static void AddBox(FDynamicMeshEditor& Editor, const FVector3d& Center, const FVector3d& Extents)
+	{
+		FMinimalBoxMeshGenerator Generator;
+		Generator.Box = FOrientedBox3d(Center, Extents);
+		FDynamicMesh3 BoxMesh(&Generator.Generate());
+		FMeshIndexMappings Mappings;
+		Editor.AppendMesh(&BoxMesh, Mappings);
+	}
+
+	/** A ground slab reaching under every tile, with a grid of pillars, some of them straddling the tile seams */
+	static FDynamicMesh3 MakeSlabScene()
+	{
+		FDynamicMesh3 Scene;
+		FDynamicMeshEditor Editor(&Scene);
+		AddBox(Editor, FVector3d(0.0, 0.0, -50.0), FVector3d(1200.0, 1200.0, 50.0));
+		for (int32 PillarX = -2; PillarX <= 2; ++PillarX)
+		{
+			for (int32 PillarY = -2; PillarY <= 2; ++PillarY)
+			{
+				AddBox(Editor, FVector3d(PillarX * 450.0, PillarY * 450.0, 150.0), FVector3d(100.0, 100.0, 150.0));
+			}
+		}
+		return Scene;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCollisionMeshPipelineTiledVoxelTest, "InstanceLevelCollision.CollisionMeshPipeline.TiledVoxelWrap", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Wraps the slab scene with 3 x 3 tiles and with one, checking both are closed and agree on volume and bounds */
+bool FCollisionMeshPipelineTiledVoxelTest::RunTest(const FString& Parameters)
+{
+	using namespace CollisionMeshPipelineTests;
+
+	const FDynamicMesh3 Scene = MakeSlabScene();
+
+	FCollisionPipelineSettings Settings;
+	Settings.VoxelDensity = 128;
+
+	Settings.MaxVoxelsPerTile = 128;
+	FCollisionPipelineProgress SingleProgress;
+	double StartTime = FPlatformTime::Seconds();
+	TUniquePtr<FDynamicMesh3> Single = FCollisionMeshPipeline::SolidifyTiled(Scene, Settings, SingleProgress);
+	const double SingleTime = FPlatformTime::Seconds() - StartTime;
+
+	Settings.MaxVoxelsPerTile = 48;
+	FCollisionPipelineProgress TiledProgress;
+	StartTime = FPlatformTime::Seconds();
+	TUniquePtr<FDynamicMesh3> Tiled = FCollisionMeshPipeline::SolidifyTiled(Scene, Settings, TiledProgress);
+	const double TiledTime = FPlatformTime::Seconds() - StartTime;
+
+	if (!TestTrue(TEXT("Single tile wrap"), Single.IsValid()) || !TestTrue(TEXT("Tiled wrap"), Tiled.IsValid()))
+	{
+		return false;
+	}
+
+	const double SingleVolume = TMeshQueries<FDynamicMesh3>::GetVolumeArea(*Single).X;
+	const double TiledVolume = TMeshQueries<FDynamicMesh3>::GetVolumeArea(*Tiled).X;
+	const double VolumeError = SingleVolume > 0.0 ? FMath::Abs(TiledVolume - SingleVolume) / SingleVolume : 1.0;
+
+	AddInfo(FString::Printf(TEXT("Volume error %.2f%%, single %.3fs, tiled %.3fs"), VolumeError * 100.0, SingleTime, TiledTime));
+	TestTrue(TEXT("Single tile wrap is closed"), Single->IsClosed());
+	TestTrue(TEXT("Tiled wrap is closed"), Tiled->IsClosed());
+	TestTrue(FString::Printf(TEXT("Volumes agree (error %.2f%%)"), VolumeError * 100.0), VolumeError <= 0.03);
+
+	// Nothing of the clipped input or the grid anchors survives past the scene
+	const double VoxelSize = Scene.GetBounds().MaxDim() / Settings.VoxelDensity;
+	const FAxisAlignedBox3d SingleBounds = Single->GetBounds();
+	const FAxisAlignedBox3d TiledBounds = Tiled->GetBounds();
+	TestTrue(TEXT("Bounds agree to a voxel"), SingleBounds.Min.Equals(TiledBounds.Min, VoxelSize) && SingleBounds.Max.Equals(TiledBounds.Max, VoxelSize));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,116 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/StaticMesh.h"
+#include "Interface_CollisionDataProvider.h"
+#include "PreSimplifiedMeshCache.h"
+
+namespace PreSimplifiedMeshCacheTests
+{
+	static UStaticMesh* LoadBasicShape(const TCHAR* ObjectPath)
+	{
+		return LoadObject<UStaticMesh>(nullptr, ObjectPath);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPreSimplifiedMeshCacheMatchTest, "InstanceLevelCollision.PreSimplifiedMeshCache.MatchesUncached", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** A mesh asked for twice in one request is looked up once, and the cached result is the one building it directly gives */
+bool FPreSimplifiedMeshCacheMatchTest::RunTest(const FString& Parameters)
+{
+	using namespace PreSimplifiedMeshCacheTests;
+
+	UStaticMesh* StaticMesh = LoadBasicShape(TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	if (!TestNotNull(TEXT("Sphere mesh"), StaticMesh))
+	{
+		return false;
+	}
+
+	FPreSimplificationSettings Settings;
+	Settings.TargetPercentage = 50;
+
+	FTriMeshCollisionData CollisionData;
+	StaticMesh->GetPhysicsTriMeshData(&CollisionData, true);
+	TUniquePtr<UE::Geometry::FDynamicMesh3> Uncached = FPreSimplifiedMeshCache::BuildSimplifiedMesh(CollisionData, Settings);
+
+	FPreSimplifiedMeshCache& Cache = FPreSimplifiedMeshCache::Get();
+	Cache.Reset();
+
+	const TArray<UStaticMesh*> StaticMeshes = { StaticMesh, StaticMesh };
+	FPreSimplificationReport FirstReport;
+	Cache.FindOrBuild(StaticMeshes, Settings, FirstReport);
+	FPreSimplificationReport SecondReport;
+	TMap<UStaticMesh*, FPreSimplifiedMeshCache::FMeshPtr> Result = Cache.FindOrBuild(StaticMeshes, Settings, SecondReport);
+
+	AddInfo(FString::Printf(TEXT("%s at %d%%: first [%s], second [%s]"), *StaticMesh->GetName(), Settings.TargetPercentage, *FirstReport.ToString(), *SecondReport.ToString()));
+	TestEqual(TEXT("Looked up once"), FirstReport.NumUniqueMeshes, 1);
+	TestEqual(TEXT("Second request hits memory"), SecondReport.NumMemoryHits, 1);
+
+	const FPreSimplifiedMeshCache::FMeshPtr* Cached = Result.Find(StaticMesh);
+	if (TestTrue(TEXT("Cached mesh returned"), Cached && Cached->IsValid()) && TestNotNull(TEXT("Uncached mesh"), Uncached.Get()))
+	{
+		TestEqual(TEXT("Same vertex count"), (*Cached)->VertexCount(), Uncached->VertexCount());
+		TestEqual(TEXT("Same triangle count"), (*Cached)->TriangleCount(), Uncached->TriangleCount());
+	}
+
+	Cache.Reset();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPreSimplifiedMeshCacheEvictionTest, "InstanceLevelCollision.PreSimplifiedMeshCache.Eviction", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** The memory tier stays within its cap by dropping the least recently used meshes, which callers keep alive */
+bool FPreSimplifiedMeshCacheEvictionTest::RunTest(const FString& Parameters)
+{
+	using namespace PreSimplifiedMeshCacheTests;
+
+	UStaticMesh* Cube = LoadBasicShape(TEXT("/Engine/BasicShapes/Cube.Cube"));
+	UStaticMesh* Sphere = LoadBasicShape(TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	UStaticMesh* Cylinder = LoadBasicShape(TEXT("/Engine/BasicShapes/Cylinder.Cylinder"));
+	if (!TestNotNull(TEXT("Cube mesh"), Cube) || !TestNotNull(TEXT("Sphere mesh"), Sphere) || !TestNotNull(TEXT("Cylinder mesh"), Cylinder))
+	{
+		return false;
+	}
+
+	FPreSimplificationSettings Settings;
+	Settings.TargetPercentage = 50;
+
+	FPreSimplifiedMeshCache& Cache = FPreSimplifiedMeshCache::Get();
+	const int32 MaxMemoryEntriesBefore = Cache.GetMaxMemoryEntries();
+	Cache.Reset();
+	Cache.SetMaxMemoryEntries(2);
+
+	FPreSimplificationReport Report;
+	TMap<UStaticMesh*, FPreSimplifiedMeshCache::FMeshPtr> CubeResult = Cache.FindOrBuild({ Cube }, Settings, Report);
+	Cache.FindOrBuild({ Sphere }, Settings, Report);
+
+	// Touching the cube leaves the sphere as the least recently used
+	Report = FPreSimplificationReport();
+	Cache.FindOrBuild({ Cube }, Settings, Report);
+	TestEqual(TEXT("Cube still in memory"), Report.NumMemoryHits, 1);
+
+	Cache.FindOrBuild({ Cylinder }, Settings, Report);
+	TestEqual(TEXT("Capped"), Cache.GetNumMemoryEntries(), 2);
+
+	Report = FPreSimplificationReport();
+	Cache.FindOrBuild({ Cube, Cylinder }, Settings, Report);
+	TestEqual(TEXT("Recently used meshes kept"), Report.NumMemoryHits, 2);
+
+	Report = FPreSimplificationReport();
+	Cache.FindOrBuild({ Sphere }, Settings, Report);
+	TestEqual(TEXT("Least recently used mesh dropped"), Report.NumMemoryHits, 0);
+
+	const FPreSimplifiedMeshCache::FMeshPtr* CubeMesh = CubeResult.Find(Cube);
+	TestTrue(TEXT("Evicted meshes live on with their callers"), CubeMesh && CubeMesh->IsValid());
+
+	Cache.SetMaxMemoryEntries(0);
+	TestEqual(TEXT("Shrinking the cap trims straight away"), Cache.GetNumMemoryEntries(), 0);
+
+	Cache.SetMaxMemoryEntries(MaxMemoryEntriesBefore);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Templates/UniquePtr.h"
+#include "UnderscorePriming.h"
+#include "UnderscoreTestUtils.h"
+#include "UnderscoreTransportSimulator.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnderscorePrimingSharedWaveTest, "Underscore.Priming.SharedWave", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FUnderscorePrimingSharedWaveTest::RunTest(const FString& Parameters)
+{
+	using namespace UnderscoreTests;
+
+	USoundWave* SharedWave = MakeWave(BarsToSeconds(2));
+
+	// Two Cues looping a section on the same wave, each priming it a bar ahead
+	UUnderscoreCue* FirstCue = MakeCue();
+	FirstCue->PrimeLookAheadBars = 1;
+	FirstCue->Sections.Add(MakeSection(2, { SharedWave }), FGameplayTagQuery());
+
+	UUnderscoreCue* SecondCue = MakeCue();
+	SecondCue->PrimeLookAheadBars = 1;
+	SecondCue->Sections.Add(MakeSection(2, { SharedWave }), FGameplayTagQuery());
+
+	TUniquePtr<FUnderscoreTransportSimulator> FirstSimulator = MakeUnique<FUnderscoreTransportSimulator>(FirstCue);
+	TUniquePtr<FUnderscoreTransportSimulator> SecondSimulator = MakeUnique<FUnderscoreTransportSimulator>(SecondCue);
+
+	int32 MaxNumRetains = 0;
+	for (int32 Beat = 0; Beat < 32; ++Beat)
+	{
+		FirstSimulator->AdvanceBeats(1);
+		SecondSimulator->AdvanceBeats(1);
+
+		MaxNumRetains = FMath::Max(MaxNumRetains, UnderscorePriming::GetNumRetains(SharedWave));
+	}
+
+	TestEqual(TEXT("Both Cues retain the wave at once"), MaxNumRetains, 2);
+	TestTrue(TEXT("Sounds primed"), FirstSimulator->GetBehavior()->GetSchedulingStats().NumPrimedSounds > 0);
+	TestEqual(TEXT("No late starts"), FirstSimulator->GetBehavior()->GetSchedulingStats().NumLateStarts, 0);
+
+	// The Cues run in lockstep, so they hold the same number of primes each
+	const int32 NumRetainsBeforeStop = UnderscorePriming::GetNumRetains(SharedWave);
+	FirstSimulator.Reset();
+	TestEqual(TEXT("Stopping one Cue only drops its own retains"), UnderscorePriming::GetNumRetains(SharedWave), NumRetainsBeforeStop / 2);
+
+	SecondSimulator.Reset();
+	TestEqual(TEXT("Wave released with the last prime"), UnderscorePriming::GetNumRetains(SharedWave), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnderscorePrimingDisabledTest, "Underscore.Priming.DisabledByDefault", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FUnderscorePrimingDisabledTest::RunTest(const FString& Parameters)
+{
+	using namespace UnderscoreTests;
+
+	USoundWave* Wave = MakeWave(BarsToSeconds(1));
+
+	UUnderscoreCue* Cue = NewObject<UUnderscoreCue>(GetTransientPackage());
+	Cue->Sections.Add(MakeSection(1, { Wave }), FGameplayTagQuery());
+
+	FUnderscoreTransportSimulator Simulator(Cue);
+	Simulator.AdvanceBeats(16);
+
+	TestEqual(TEXT("Default look-ahead"), Cue->PrimeLookAheadBars, 0);
+	TestEqual(TEXT("Nothing primed"), Simulator.GetBehavior()->GetSchedulingStats().NumPrimedSounds, 0);
+	TestEqual(TEXT("Wave never retained"), UnderscorePriming::GetNumRetains(Wave), 0);
+	TestTrue(TEXT("Clips still scheduled"), Simulator.GetScheduledPlays().Num() > 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
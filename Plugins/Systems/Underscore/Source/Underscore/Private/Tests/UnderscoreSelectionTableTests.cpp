@@ -0,0 +1,221 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformTime.h"
+#include "Math/NumericLimits.h"
+#include "Math/RandomStream.h"
+#include "NativeGameplayTags.h"
+#include "UnderscoreSelectionTable.h"
+#include "UnderscoreTestUtils.h"
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UnderscoreTest_Table_Explore, "Underscore.Test.Table.Explore");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UnderscoreTest_Table_Explore_Night, "Underscore.Test.Table.Explore.Night");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UnderscoreTest_Table_Combat, "Underscore.Test.Table.Combat");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UnderscoreTest_Table_Combat_Boss, "Underscore.Test.Table.Combat.Boss");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UnderscoreTest_Table_Stealth, "Underscore.Test.Table.Stealth");
+
+namespace UnderscoreSelectionTableTests
+{
+	static FGameplayTagContainer MakeRandomTags(FRandomStream& Random, const TArray<FGameplayTag>& InTags)
+	{
+		FGameplayTagContainer Tags;
+		for (const FGameplayTag& Tag : InTags)
+		{
+			if (Random.RandRange(0, 2) == 0)
+			{
+				Tags.AddTag(Tag);
+			}
+		}
+		return Tags;
+	}
+
+	static FGameplayTagQuery MakeRandomQuery(FRandomStream& Random, const TArray<FGameplayTag>& InTags)
+	{
+		const FGameplayTagContainer Tags = MakeRandomTags(Random, InTags);
+
+		switch (Random.RandRange(0, 5))
+		{
+		case 0: return FGameplayTagQuery();
+		case 1: return FGameplayTagQuery::MakeQuery_MatchAnyTags(Tags);
+		case 2: return FGameplayTagQuery::MakeQuery_MatchAllTags(Tags);
+		case 3: return FGameplayTagQuery::MakeQuery_MatchNoTags(Tags);
+		case 4: return FGameplayTagQuery::MakeQuery_ExactMatchAnyTags(Tags);
+		default: return FGameplayTagQuery::MakeQuery_ExactMatchAllTags(Tags);
+		}
+	}
+
+	static FUnderscoreQuantizationRules MakeRandomRules(FRandomStream& Random)
+	{
+		FUnderscoreQuantizationRules Rules;
+		Rules.Quantization = Random.RandRange(0, 1) ? EUnderscoreStingerQuantization::Bar : EUnderscoreStingerQuantization::Beat;
+
+		Rules.bRestrictBeatSyncPoints = Random.RandRange(0, 1) == 1;
+		for (int32 Beat = 1; Beat <= 4; ++Beat)
+		{
+			if (Random.RandRange(0, 1))
+			{
+				Rules.AllowedBeats.Add(Beat);
+			}
+		}
+
+		Rules.bRestrictBarSyncPoints = Random.RandRange(0, 2) == 0;
+		for (int32 Bar = 1; Bar <= 4; ++Bar)
+		{
+			if (Random.RandRange(0, 1))
+			{
+				Rules.AllowedBars.Add(Bar);
+			}
+		}
+
+		return Rules;
+	}
+
+	// The section choice before the selection table: the first section in Cue order whose condition is met
+	static UUnderscoreSection* ScanSections(const UUnderscoreCue* Cue, const FGameplayTagContainer& ActiveStates)
+	{
+		for (const TPair<UUnderscoreSection*, FGameplayTagQuery>& SectionIt : Cue->Sections)
+		{
+			if (SectionIt.Value.IsEmpty() || SectionIt.Value.Matches(ActiveStates))
+			{
+				return SectionIt.Key;
+			}
+		}
+		return nullptr;
+	}
+
+	// The transition choice before the selection table: every Cue transition, nearest trigger point first, Cue order on ties
+	static FUnderscoreTransition* ScanTransitions(UUnderscoreCue* Cue, const UUnderscoreSection* From, const UUnderscoreSection* To, const FUnderscoreTransport& EarliestStartPoint, FUnderscoreTransport& OutStartTime)
+	{
+		FUnderscoreTransition* BestTransition = nullptr;
+		FUnderscoreTransport OutTransport;
+		int32 NearestSyncPointBeats = TNumericLimits<int32>::Max();
+		FUnderscoreTransport BestSyncPoint;
+
+		for (FUnderscoreTransition& Transition : Cue->Transitions)
+		{
+			if ((Transition.To && Transition.To != To) || (Transition.From && Transition.From != From))
+			{
+				continue;
+			}
+
+			if (Transition.PlayRules.GetNextTriggerPoint(EarliestStartPoint, OutTransport))
+			{
+				int32 TotalBeats = OutTransport.ToBeats() - EarliestStartPoint.ToBeats();
+
+				if (TotalBeats < 0)
+				{
+					TotalBeats += (EarliestStartPoint.WrapLength * Cue->TimeSignature.NumBeats);
+				}
+
+				if (TotalBeats < NearestSyncPointBeats)
+				{
+					NearestSyncPointBeats = TotalBeats;
+					BestSyncPoint = OutTransport;
+					BestTransition = &Transition;
+				}
+			}
+		}
+
+		OutStartTime = BestSyncPoint;
+		return BestTransition;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnderscoreSelectionTableEquivalenceTest, "Underscore.SelectionTable.MatchesLinearScan", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FUnderscoreSelectionTableEquivalenceTest::RunTest(const FString& Parameters)
+{
+	using namespace UnderscoreTests;
+	using namespace UnderscoreSelectionTableTests;
+
+	constexpr int32 NumCues = 32;
+	constexpr int32 NumSections = 8;
+	constexpr int32 NumTransitions = 24;
+	constexpr int32 NumQueriesPerCue = 256;
+
+	const TArray<FGameplayTag> Tags = { TAG_UnderscoreTest_Table_Explore, TAG_UnderscoreTest_Table_Explore_Night, TAG_UnderscoreTest_Table_Combat, TAG_UnderscoreTest_Table_Combat_Boss, TAG_UnderscoreTest_Table_Stealth };
+
+	const int32 Seed = FPlatformTime::Cycles();
+	FRandomStream Random(Seed);
+	AddInfo(FString::Printf(TEXT("Seed %d"), Seed));
+
+	int32 NumMismatches = 0;
+
+	for (int32 CueIndex = 0; CueIndex < NumCues && NumMismatches == 0; ++CueIndex)
+	{
+		UUnderscoreCue* Cue = MakeCue();
+
+		TArray<UUnderscoreSection*> Sections;
+		for (int32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+		{
+			UUnderscoreSection* Section = MakeSection(Random.RandRange(1, 4), {});
+			Sections.Add(Section);
+			Cue->Sections.Add(Section, MakeRandomQuery(Random, Tags));
+		}
+
+		for (int32 TransitionIndex = 0; TransitionIndex < NumTransitions; ++TransitionIndex)
+		{
+			FUnderscoreTransition& Transition = Cue->Transitions.AddDefaulted_GetRef();
+			Transition.From = Random.RandRange(0, 3) == 0 ? nullptr : Sections[Random.RandRange(0, NumSections - 1)];
+			Transition.To = Random.RandRange(0, 3) == 0 ? nullptr : Sections[Random.RandRange(0, NumSections - 1)];
+			Transition.PlayRules = MakeRandomRules(Random);
+		}
+
+		FUnderscoreSelectionTable Table;
+		Table.Compile(Cue);
+
+		for (int32 QueryIndex = 0; QueryIndex < NumQueriesPerCue; ++QueryIndex)
+		{
+			// Repeated states and transport positions go through the memoized results
+			const FGameplayTagContainer ActiveStates = MakeRandomTags(Random, Tags);
+			Table.UpdateStates(ActiveStates, QueryIndex + 1);
+
+			const int32 FirstMatchingSection = Table.GetFirstMatchingSection();
+			UUnderscoreSection* TableSection = FirstMatchingSection != INDEX_NONE ? Table.GetSection(FirstMatchingSection) : nullptr;
+			if (TableSection != ScanSections(Cue, ActiveStates))
+			{
+				AddError(FString::Printf(TEXT("Cue %d query %d: section differs for states %s"), CueIndex, QueryIndex, *ActiveStates.ToStringSimple()));
+				++NumMismatches;
+			}
+
+			for (int32 SectionIndex = 0; SectionIndex < Table.NumSections(); ++SectionIndex)
+			{
+				const FGameplayTagQuery& Condition = Table.GetSectionCondition(SectionIndex);
+				if (Table.IsSectionMatching(SectionIndex) != (Condition.IsEmpty() || Condition.Matches(ActiveStates)))
+				{
+					AddError(FString::Printf(TEXT("Cue %d query %d: section %d matching differs for states %s"), CueIndex, QueryIndex, SectionIndex, *ActiveStates.ToStringSimple()));
+					++NumMismatches;
+				}
+			}
+
+			// 3/4 and 4/4 transports at the same bar and beat must not share results
+			FUnderscoreTransport EarliestStartPoint;
+			EarliestStartPoint.TimeSignature.NumBeats = Random.RandRange(3, 4);
+			EarliestStartPoint.WrapLength = Random.RandRange(1, 4);
+			EarliestStartPoint.Bar = Random.RandRange(1, EarliestStartPoint.WrapLength);
+			EarliestStartPoint.Beat = Random.RandRange(1, EarliestStartPoint.TimeSignature.NumBeats);
+
+			const UUnderscoreSection* From = Random.RandRange(0, 4) == 0 ? nullptr : Sections[Random.RandRange(0, NumSections - 1)];
+			const UUnderscoreSection* To = Random.RandRange(0, 4) == 0 ? nullptr : Sections[Random.RandRange(0, NumSections - 1)];
+
+			FUnderscoreTransport ScanStartTime;
+			FUnderscoreTransport TableStartTime;
+			const FUnderscoreTransition* ScanTransition = ScanTransitions(Cue, From, To, EarliestStartPoint, ScanStartTime);
+			const FUnderscoreTransition* TableTransition = Table.FindTransition(From, To, EarliestStartPoint, TableStartTime);
+
+			if (ScanTransition != TableTransition || (ScanTransition && (!(ScanStartTime == TableStartTime) || ScanStartTime.WrapLength != TableStartTime.WrapLength)))
+			{
+				AddError(FString::Printf(TEXT("Cue %d query %d: transition differs at %d | %d in %d/4, wrapping after %d bars"),
+					CueIndex, QueryIndex, EarliestStartPoint.Bar, EarliestStartPoint.Beat, EarliestStartPoint.TimeSignature.NumBeats, EarliestStartPoint.WrapLength));
+				++NumMismatches;
+			}
+		}
+	}
+
+	return NumMismatches == 0;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,57 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Sound/SoundWave.h"
+#include "UObject/Package.h"
+#include "UnderscoreCue.h"
+#include "UnderscoreSection.h"
+
+namespace UnderscoreTests
+{
+	// A wave that is never played, only long enough to cover InSeconds
+	inline USoundWave* MakeWave(const float InSeconds)
+	{
+		USoundWave* Wave = NewObject<USoundWave>(GetTransientPackage());
+		Wave->Duration = InSeconds;
+		return Wave;
+	}
+
+	inline UUnderscoreSection* MakeSection(const int32 InLength, const TArray<USoundWave*>& InLayerSounds)
+	{
+		UUnderscoreSection* Section = NewObject<UUnderscoreSection>(GetTransientPackage());
+		Section->Length = InLength;
+		Section->PickupLength = 0;
+		Section->bLoop = true;
+		Section->DestinationSection = nullptr;
+
+		for (USoundWave* Sound : InLayerSounds)
+		{
+			FUnderscoreSectionLayer& Layer = Section->Layers.AddDefaulted_GetRef();
+			Layer.Sound = Sound;
+		}
+
+		return Section;
+	}
+
+	// 4/4 at InBPM, no priming unless asked for
+	inline UUnderscoreCue* MakeCue(const float InBPM = 120.f)
+	{
+		UUnderscoreCue* Cue = NewObject<UUnderscoreCue>(GetTransientPackage());
+		Cue->BPM = InBPM;
+		Cue->PrimeLookAheadBars = 0;
+		return Cue;
+	}
+
+	// Seconds covering InBars bars of a 4/4 Cue at InBPM
+	inline float BarsToSeconds(const int32 InBars, const float InBPM = 120.f)
+	{
+		return InBars * 4 * 60.f / InBPM;
+	}
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
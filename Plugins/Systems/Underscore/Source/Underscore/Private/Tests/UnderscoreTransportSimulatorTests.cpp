@@ -0,0 +1,181 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "NativeGameplayTags.h"
+#include "UnderscoreTestUtils.h"
+#include "UnderscoreTransportSimulator.h"
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UnderscoreTest_Simulator_Combat, "Underscore.Test.Simulator.Combat");
+
+namespace UnderscoreTransportSimulatorTests
+{
+	static int32 CountPlays(const FUnderscoreTransportSimulator& Simulator, const USoundBase* Sound)
+	{
+		return Simulator.GetScheduledPlays().FilterByPredicate([Sound](const FUnderscoreSimulatedPlay& Play) { return Play.Sound == Sound; }).Num();
+	}
+
+	static const FUnderscoreSimulatedPlay* FindLastPlay(const FUnderscoreTransportSimulator& Simulator, const USoundBase* Sound)
+	{
+		const TArray<FUnderscoreSimulatedPlay>& Plays = Simulator.GetScheduledPlays();
+		for (int32 PlayIndex = Plays.Num() - 1; PlayIndex >= 0; --PlayIndex)
+		{
+			if (Plays[PlayIndex].Sound == Sound)
+			{
+				return &Plays[PlayIndex];
+			}
+		}
+		return nullptr;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnderscoreTransportSimulatorSchedulingTest, "Underscore.TransportSimulator.Scheduling", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FUnderscoreTransportSimulatorSchedulingTest::RunTest(const FString& Parameters)
+{
+	using namespace UnderscoreTests;
+	using namespace UnderscoreTransportSimulatorTests;
+
+	USoundWave* ExploreWave = MakeWave(BarsToSeconds(1));
+	USoundWave* CombatWave = MakeWave(BarsToSeconds(2));
+	USoundWave* StingerWave = MakeWave(1.f);
+
+	UUnderscoreSection* Combat = MakeSection(2, { CombatWave });
+	UUnderscoreSection* Explore = MakeSection(1, { ExploreWave });
+
+	FUnderscoreSectionStinger& Stinger = Explore->Stingers.AddDefaulted_GetRef();
+	Stinger.PlayEvent = TEXT("Hit");
+	Stinger.Sounds.Add(StingerWave, FGameplayTagQuery());
+
+	UUnderscoreCue* Cue = MakeCue();
+	Cue->Sections.Add(Combat, FGameplayTagQuery::MakeQuery_MatchTag(TAG_UnderscoreTest_Simulator_Combat));
+	Cue->Sections.Add(Explore, FGameplayTagQuery());
+
+	FUnderscoreTransportSimulator Simulator(Cue);
+	if (!TestNotNull(TEXT("Simulated behavior"), Simulator.GetBehavior()))
+	{
+		return false;
+	}
+
+	// Explore loops every bar
+	Simulator.AdvanceBeats(17);
+	TestTrue(TEXT("Explore looped"), CountPlays(Simulator, ExploreWave) >= 4);
+	TestEqual(TEXT("Combat not played"), CountPlays(Simulator, CombatWave), 0);
+
+	const TArray<FUnderscoreSimulatedPlay>& Plays = Simulator.GetScheduledPlays();
+	for (int32 PlayIndex = 1; PlayIndex < Plays.Num(); ++PlayIndex)
+	{
+		TestEqual(TEXT("Explore loop length in beats"), Plays[PlayIndex].TargetBeat - Plays[PlayIndex - 1].TargetBeat, 4);
+	}
+
+	// Finished clips come back through HandleAudioFinished, so at most the last loop and the one before are playing
+	TestTrue(TEXT("Clips finish"), Simulator.GetBehavior()->GetNumPlayingClips() <= 2);
+
+	// Stingers are quantized to the next beat
+	const int32 NumBeatsBeforeHit = Simulator.GetStats().NumBeats;
+	Simulator.TriggerEvent(TEXT("Hit"));
+	Simulator.AdvanceBeats(2);
+
+	const FUnderscoreSimulatedPlay* StingerPlay = FindLastPlay(Simulator, StingerWave);
+	if (TestNotNull(TEXT("Stinger scheduled"), StingerPlay))
+	{
+		TestTrue(TEXT("Stinger on one of the next beats"), StingerPlay->TargetBeat > NumBeatsBeforeHit && StingerPlay->TargetBeat <= NumBeatsBeforeHit + 3);
+	}
+
+	// Combat takes over at the next section boundary
+	Simulator.SetState(TAG_UnderscoreTest_Simulator_Combat);
+	Simulator.AdvanceBeats(8);
+
+	const FUnderscoreSimulatedPlay* CombatPlay = FindLastPlay(Simulator, CombatWave);
+	if (TestNotNull(TEXT("Combat scheduled"), CombatPlay))
+	{
+		TestEqual(TEXT("Combat volume"), CombatPlay->Volume, 1.f);
+	}
+
+	TestEqual(TEXT("No misses"), Simulator.GetBehavior()->GetSchedulingStats().NumMisses, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnderscoreTransportSimulatorBeatBenchmark, "Underscore.TransportSimulator.BeatBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FUnderscoreTransportSimulatorBeatBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace UnderscoreTests;
+
+	constexpr int32 NumSections = 64;
+	constexpr int32 NumLayers = 8;
+	constexpr int32 NumStingers = 8;
+	constexpr int32 NumBeats = 8192;
+
+	UUnderscoreCue* Cue = MakeCue();
+
+	// Sections alternate between requiring and excluding the Combat state, the last one is the fallback
+	for (int32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+	{
+		TArray<USoundWave*> LayerSounds;
+		for (int32 LayerIndex = 0; LayerIndex < NumLayers; ++LayerIndex)
+		{
+			LayerSounds.Add(MakeWave(BarsToSeconds(2)));
+		}
+
+		UUnderscoreSection* Section = MakeSection(2, LayerSounds);
+		for (int32 StingerIndex = 0; StingerIndex < NumStingers; ++StingerIndex)
+		{
+			FUnderscoreSectionStinger& Stinger = Section->Stingers.AddDefaulted_GetRef();
+			Stinger.PlayEvent = *FString::Printf(TEXT("Stinger%d"), StingerIndex);
+			Stinger.PlayRules.Quantization = StingerIndex % 2 ? EUnderscoreStingerQuantization::Bar : EUnderscoreStingerQuantization::Beat;
+			Stinger.Sounds.Add(MakeWave(1.f), FGameplayTagQuery());
+		}
+
+		FGameplayTagQuery Condition;
+		if (SectionIndex < NumSections - 1)
+		{
+			Condition = SectionIndex % 2 ? FGameplayTagQuery::MakeQuery_MatchTag(TAG_UnderscoreTest_Simulator_Combat) : FGameplayTagQuery::MakeQuery_MatchNoTags(FGameplayTagContainer(TAG_UnderscoreTest_Simulator_Combat));
+		}
+		Cue->Sections.Add(Section, Condition);
+	}
+
+	FUnderscoreTransportSimulator Simulator(Cue);
+	if (!TestNotNull(TEXT("Simulated behavior"), Simulator.GetBehavior()))
+	{
+		return false;
+	}
+
+	for (int32 Beat = 0; Beat < NumBeats; ++Beat)
+	{
+		if (Beat % 32 == 0)
+		{
+			if (Beat % 64 == 0)
+			{
+				Simulator.SetState(TAG_UnderscoreTest_Simulator_Combat);
+			}
+			else
+			{
+				Simulator.ClearState(TAG_UnderscoreTest_Simulator_Combat);
+			}
+		}
+
+		if (Beat % 3 == 0)
+		{
+			Simulator.TriggerEvent(*FString::Printf(TEXT("Stinger%d"), Beat % NumStingers));
+		}
+
+		Simulator.AdvanceBeats(1);
+	}
+
+	const FUnderscoreSimulatorStats& Stats = Simulator.GetStats();
+	AddInfo(FString::Printf(TEXT("%d beats, %d clips: %.3f us per beat on average, %.3f us at most"),
+		Stats.NumBeats, Simulator.GetScheduledPlays().Num(), Stats.GetAverageBeatSeconds() * 1e6, Stats.MaxBeatSeconds * 1e6));
+	AddInfo(FString::Printf(TEXT("Bytes left allocated by beats: %lld in total, %lld at most in one beat (0 without -llm)"), Stats.TotalBeatBytes, Stats.MaxBeatBytes));
+
+	TestEqual(TEXT("Beats delivered"), Stats.NumBeats, NumBeats);
+	TestTrue(TEXT("Clips scheduled"), Simulator.GetScheduledPlays().Num() > 0);
+	TestEqual(TEXT("No misses"), Simulator.GetBehavior()->GetSchedulingStats().NumMisses, 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
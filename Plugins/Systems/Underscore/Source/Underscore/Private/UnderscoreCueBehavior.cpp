@@ -3,6 +3,7 @@
 #include "UnderscoreCueBehavior.h"
 
 #include "Components/AudioComponent.h"
+#include "Kismet/GameplayStatics.h"
 #include "Containers/Map.h"
 #include "Containers/UnrealString.h"
 #include "HAL/PlatformCrt.h"
@@ -10,16 +11,85 @@
 #include "Logging/LogMacros.h"
 #include "Math/NumericLimits.h"
 #include "Sound/SoundBase.h"
+#include "Sound/SoundCue.h"
+#include "Sound/SoundNodeWavePlayer.h"
+#include "Sound/SoundWave.h"
 #include "Templates/Tuple.h"
 #include "Trace/Detail/Channel.h"
+#include "UObject/ObjectKey.h"
 #include "Underscore.h"
 #include "UnderscoreCue.h"
+#include "UnderscorePriming.h"
 #include "UnderscoreSubsystem.h"
 
 // if any sound on a component is set to a volume below SMALL_NUMBER, it will stop no matter what its virtualization settings are
 // This is equivalent to -70db, so effectively inaudible, but it won't be killed
 constexpr float SilentLayerVolume = 1.e-7f;
 
+namespace UnderscorePriming
+{
+	// Number of primes sharing each wave retained by RetainWave
+	static TMap<TObjectKey<USoundWave>, int32> RetainedWaves;
+
+	bool RetainWave(USoundWave* SoundWave)
+	{
+		if (int32* NumRetains = RetainedWaves.Find(SoundWave))
+		{
+			++(*NumRetains);
+			return true;
+		}
+
+		if (SoundWave->GetLoadingBehavior() == ESoundWaveLoadingBehavior::RetainOnLoad || SoundWave->IsRetainingAudio())
+		{
+			return false;
+		}
+
+		SoundWave->RetainCompressedAudio();
+		RetainedWaves.Add(SoundWave, 1);
+		return true;
+	}
+
+	void ReleaseWave(USoundWave* SoundWave)
+	{
+		int32* NumRetains = RetainedWaves.Find(SoundWave);
+		if (NumRetains == nullptr || --(*NumRetains) > 0)
+		{
+			return;
+		}
+
+		RetainedWaves.Remove(SoundWave);
+		SoundWave->ReleaseCompressedAudio();
+	}
+
+	int32 GetNumRetains(const USoundWave* SoundWave)
+	{
+		const int32* NumRetains = RetainedWaves.Find(SoundWave);
+		return NumRetains ? *NumRetains : 0;
+	}
+
+	// Waves that need to be resident for Sound to start on time
+	static void GatherSoundWaves(USoundBase* Sound, TArray<USoundWave*>& OutWaves)
+	{
+		if (USoundWave* SoundWave = Cast<USoundWave>(Sound))
+		{
+			OutWaves.AddUnique(SoundWave);
+		}
+		else if (USoundCue* SoundCue = Cast<USoundCue>(Sound))
+		{
+			TArray<USoundNodeWavePlayer*> WavePlayers;
+			SoundCue->RecursiveFindNode<USoundNodeWavePlayer>(SoundCue->FirstNode, WavePlayers);
+
+			for (USoundNodeWavePlayer* WavePlayer : WavePlayers)
+			{
+				if (USoundWave* SoundWave = WavePlayer ? WavePlayer->GetSoundWave() : nullptr)
+				{
+					OutWaves.AddUnique(SoundWave);
+				}
+			}
+		}
+	}
+}
+
 void UUnderscoreCueBehavior::SubscribeEventToTransport(const FUnderscoreTransport& InTransport, const FUnderscoreTransportEvent& InEvent, bool bExecuteOnceOnly /*= true*/)
 {
 	TransportEvents.Add({ InEvent, InTransport, bExecuteOnceOnly } );
@@ -27,6 +97,7 @@ void UUnderscoreCueBehavior::SubscribeEventToTransport(const FUnderscoreTranspor
 
 void UUnderscoreCueBehavior::OnQuartzBeat_Implementation(FName ClockName, EQuartzCommandQuantization QuantizationType, int32 NumBars, int32 Beat, float BeatFraction)
 {
+	++NumBeatsPlayed;
 	CurrentTransport.Beat++;
 	CurrentTransport.Wrap();
 
@@ -61,6 +132,8 @@ void UUnderscoreCueBehavior::OnQuartzBeat_Implementation(FName ClockName, EQuart
 		}
 	}
 
+	UpdateLookAhead();
+
 	OnBeat(CurrentTransport.Beat, CurrentTransport.Bar);
 }
 
@@ -269,6 +342,16 @@ void UUnderscoreCueBehavior::HandleAudioFinished(UAudioComponent* Component)
 	ActiveComponents.Remove(Component);
 	Component->OnAudioFinishedNative.RemoveAll(this);
 
+	// Played sounds don't need to stay pinned
+	for (auto PrimedIt = PrimedSounds.CreateIterator(); PrimedIt; ++PrimedIt)
+	{
+		if (PrimedIt->AudioComponents.RemoveSingleSwap(Component) > 0 && PrimedIt->AudioComponents.Num() == 0 && PrimedIt->bPendingStart == false)
+		{
+			ReleasePrimedSound(*PrimedIt);
+			PrimedIt.RemoveCurrent();
+		}
+	}
+
 	if (ActiveComponents.Num() >= 0)
 	{
 		return;
@@ -314,8 +397,11 @@ void UUnderscoreCueBehavior::OnStateChanged_Implementation()
 		}
 	}
 
+	// The upcoming section or transition may have changed
+	bLookAheadPrimed = false;
+
 	// Do we need to transition to a new section?
-	if (Subsystem->IsStateConditionValid(CurrentSectionCondition) == false)
+	if (IsCurrentSectionConditionValid() == false)
 	{
 		NextSection = nullptr;
 		QueueNextSection();
@@ -354,6 +440,8 @@ void UUnderscoreCueBehavior::OnStateChanged_Implementation()
 			NextSectionStartTime.Wrap();
 		}
 	}
+
+	UpdateLookAhead();
 }
 
 void UUnderscoreCueBehavior::StartCue_Implementation(UUnderscoreCue* InCue)
@@ -365,8 +453,11 @@ void UUnderscoreCueBehavior::StartCue_Implementation(UUnderscoreCue* InCue)
 	}
 
 	Cue = InCue;
+	SelectionTable.Compile(Cue);
+	CurrentSectionConditionIndex = INDEX_NONE;
 
 	OnQuartzBeatEvent.BindDynamic(this, &ThisClass::OnQuartzBeat);
+	OnQuartzCommandEvent.BindDynamic(this, &ThisClass::HandleQuartzCommandEvent);
 
 	if (Subsystem)
 	{
@@ -382,6 +473,7 @@ void UUnderscoreCueBehavior::StartCue_Implementation(UUnderscoreCue* InCue)
 	PlayState = EUnderscoreCueBehaviorPlayState::Playing;
 
 	QueueNextSection();
+	UpdateLookAhead();
 }
 
 void UUnderscoreCueBehavior::Stop_Implementation(float FadeTime)
@@ -396,6 +488,11 @@ void UUnderscoreCueBehavior::Stop_Implementation(float FadeTime)
 			}
 		}
 	}
+
+	ReleaseAllPrimedSounds();
+
+	UE_LOG(LogUnderscore, Log, TEXT("Cue %s stopped: %i sounds primed, %i late starts, %i misses"),
+		Cue != nullptr ? *Cue->GetName() : TEXT("None"), SchedulingStats.NumPrimedSounds, SchedulingStats.NumLateStarts, SchedulingStats.NumMisses);
 }
 
 void UUnderscoreCueBehavior::Pause_Implementation()
@@ -556,10 +653,9 @@ UAudioComponent* UUnderscoreCueBehavior::ScheduleClipNextBeat(USoundBase* Sound,
 		return nullptr;
 	}
 
-	if (UAudioComponent* Component = Subsystem->PrepareComponent(Sound))
+	if (UAudioComponent* Component = PrepareClipComponent(Sound))
 	{
-		static FQuartzQuantizationBoundary NextBeatBoundary = { EQuartzCommandQuantization::Beat, 1.f, EQuarztQuantizationReference::CurrentTimeRelative };
-		Component->PlayQuantized(Component, ClockHandle, NextBeatBoundary, FOnQuartzCommandEventBP(), 0.f, 0.f, Volume);
+		PlayClipNextBeat(Component, Volume);
 
 		Component->OnAudioFinishedNative.AddUObject(this, &ThisClass::HandleAudioFinished);
 		ActiveComponents.Add(Component);
@@ -570,12 +666,24 @@ UAudioComponent* UUnderscoreCueBehavior::ScheduleClipNextBeat(USoundBase* Sound,
 	}
 	else
 	{
+		++SchedulingStats.NumMisses;
 		UE_LOG(LogUnderscore, Warning, TEXT("Underscore Subsystem Failed to Create AudioComponent"));
 	}
 
 	return nullptr;
 }
 
+UAudioComponent* UUnderscoreCueBehavior::PrepareClipComponent(USoundBase* Sound)
+{
+	return Subsystem ? Subsystem->PrepareComponent(Sound) : nullptr;
+}
+
+void UUnderscoreCueBehavior::PlayClipNextBeat(UAudioComponent* Component, const float Volume)
+{
+	static FQuartzQuantizationBoundary NextBeatBoundary = { EQuartzCommandQuantization::Beat, 1.f, EQuarztQuantizationReference::CurrentTimeRelative };
+	Component->PlayQuantized(Component, ClockHandle, NextBeatBoundary, OnQuartzCommandEvent, 0.f, 0.f, Volume);
+}
+
 bool UUnderscoreCueBehavior::ShouldPlayLayer(const FUnderscoreSectionLayer& Layer) const
 {
 	if (Subsystem == nullptr)
@@ -599,7 +707,32 @@ bool UUnderscoreCueBehavior::NeedsTransition() const
 		return false;
 	}
 
-	return CurrentSectionCondition.IsEmpty() || !(Subsystem->IsStateConditionValid(CurrentSectionCondition));
+	return CurrentSectionCondition.IsEmpty() || !IsCurrentSectionConditionValid();
+}
+
+bool UUnderscoreCueBehavior::IsCurrentSectionConditionValid() const
+{
+	if (Subsystem == nullptr)
+	{
+		return false;
+	}
+
+	if (CurrentSectionConditionIndex != INDEX_NONE)
+	{
+		return GetSelectionTable().IsSectionMatching(CurrentSectionConditionIndex);
+	}
+
+	return Subsystem->IsStateConditionValid(CurrentSectionCondition);
+}
+
+const FUnderscoreSelectionTable& UUnderscoreCueBehavior::GetSelectionTable() const
+{
+	if (Subsystem)
+	{
+		SelectionTable.UpdateStates(Subsystem->GetActiveStates(), Subsystem->GetStatesSerial());
+	}
+
+	return SelectionTable;
 }
 
 void UUnderscoreCueBehavior::PlayTransition()
@@ -643,6 +776,8 @@ void UUnderscoreCueBehavior::PlayLayers(TArray<FUnderscoreSectionLayer>& InLayer
 				// Don't skip, but play silently in case we need to fade in
 				if (UAudioComponent* Component = ScheduleClipNextBeat(Layer.Sound, SilentLayerVolume))
 				{
+					OnLayerScheduled(Layer.Sound, Component);
+
 					Layer.AudioComponent = Component;
 					ActiveLayers.Add(Layer);
 				}
@@ -657,6 +792,8 @@ void UUnderscoreCueBehavior::PlayLayers(TArray<FUnderscoreSectionLayer>& InLayer
 
 		if (UAudioComponent* Component = ScheduleClipNextBeat(Layer.Sound, 1.f))
 		{
+			OnLayerScheduled(Layer.Sound, Component);
+
 			Layer.bPlaying = true;
 			Layer.AudioComponent = Component;
 			ActiveLayers.Add(Layer);
@@ -699,6 +836,28 @@ void UUnderscoreCueBehavior::SetWrapLength(const int32 BarsBeforeTrasportWrap)
 
 UUnderscoreSection* UUnderscoreCueBehavior::GetNextSection()
 {
+	int32 NewConditionIndex = INDEX_NONE;
+	UUnderscoreSection* Section = FindNextSection(NewConditionIndex);
+
+	if (NewConditionIndex != INDEX_NONE)
+	{
+		UE_LOG(LogUnderscore, Verbose, TEXT("Underscore Section Transition required: New Section: %s"), Section != nullptr ? *Section->GetName() : TEXT("None"));
+
+		CurrentSectionCondition = SelectionTable.GetSectionCondition(NewConditionIndex);
+		CurrentSectionConditionIndex = NewConditionIndex;
+	}
+	else if (Section != nullptr && Section == CurrentSection)
+	{
+		UE_LOG(LogUnderscore, Verbose, TEXT("Looping Section"));
+	}
+
+	return Section;
+}
+
+UUnderscoreSection* UUnderscoreCueBehavior::FindNextSection(int32& OutConditionIndex) const
+{
+	OutConditionIndex = INDEX_NONE;
+
 	if (Subsystem == nullptr)
 	{
 		return nullptr;
@@ -706,15 +865,13 @@ UUnderscoreSection* UUnderscoreCueBehavior::GetNextSection()
 
 	if (NeedsTransition())
 	{
-		for (auto SectionIt : Cue->Sections)
-		{
-			if (Subsystem->IsStateConditionValid(SectionIt.Value))
-			{
-				UE_LOG(LogUnderscore, Verbose, TEXT("Underscore Section Transition required: New Section: %s"), SectionIt.Key != nullptr ? *SectionIt.Key->GetName() : TEXT("None"));
+		const FUnderscoreSelectionTable& Table = GetSelectionTable();
+		const int32 SectionIndex = Table.GetFirstMatchingSection();
 
-				CurrentSectionCondition = SectionIt.Value;
-				return SectionIt.Key;
-			}
+		if (SectionIndex != INDEX_NONE)
+		{
+			OutConditionIndex = SectionIndex;
+			return Table.GetSection(SectionIndex);
 		}
 	}
 
@@ -722,7 +879,6 @@ UUnderscoreSection* UUnderscoreCueBehavior::GetNextSection()
 	{
 		if (CurrentSection->bLoop)
 		{
-			UE_LOG(LogUnderscore, Verbose, TEXT("Looping Section"));
 			return CurrentSection;
 		}
 
@@ -742,45 +898,201 @@ FUnderscoreTransition* UUnderscoreCueBehavior::GetTransitionForPendingSection(FU
 		return nullptr;
 	}
 
-	FUnderscoreTransition* BestTranstition = nullptr;
+	return FindTransition(CurrentSection, NextSection, OutStartTime);
+}
 
+FUnderscoreTransition* UUnderscoreCueBehavior::FindTransition(const UUnderscoreSection* From, const UUnderscoreSection* To, FUnderscoreTransport& OutStartTime) const
+{
 	// Look for Transitions start Next beat so it can start on a musical boundary
 	FUnderscoreTransport EarliestStartPoint = CurrentTransport;
 	EarliestStartPoint.Increment();
 
-	FUnderscoreTransport OutTransport;
+	FUnderscoreTransition* BestTransition = SelectionTable.FindTransition(From, To, EarliestStartPoint, OutStartTime);
 
-	int32 NearestSyncPointBeats = TNumericLimits<int32>::Max();
-	FUnderscoreTransport BestSyncPoint;
+	UE_CLOG(BestTransition != nullptr, LogUnderscore, VeryVerbose, TEXT("Next Trigger Point for Transition is %i | %i"), OutStartTime.Bar, OutStartTime.Beat);
 
-	for (FUnderscoreTransition& Transition : Cue->Transitions)
+	return BestTransition;
+}
+
+void UUnderscoreCueBehavior::HandleQuartzCommandEvent(EQuartzCommandDelegateSubType EventType, FName Name)
+{
+	if (EventType == EQuartzCommandDelegateSubType::CommandOnFailedToQueue || EventType == EQuartzCommandDelegateSubType::CommandOnCanceled)
 	{
-		if ((Transition.To && Transition.To != NextSection) 
-			|| (Transition.From && Transition.From != CurrentSection))
+		++SchedulingStats.NumMisses;
+		UE_LOG(LogUnderscore, Verbose, TEXT("Clip missed its beat at %i | %i"), CurrentTransport.Bar, CurrentTransport.Beat);
+	}
+}
+
+void UUnderscoreCueBehavior::UpdateLookAhead()
+{
+	ExpirePrimedSounds();
+
+	if (Cue == nullptr 
+		|| Cue->PrimeLookAheadBars <= 0 
+		|| Subsystem == nullptr
+		|| PlayState == EUnderscoreCueBehaviorPlayState::Stopped)
+	{
+		return;
+	}
+
+	const int32 BeatsPerBar = FMath::Max(Cue->TimeSignature.NumBeats, 1);
+
+	int32 BeatsUntilNextSection = NextSectionStartTime.ToBeats() - CurrentTransport.ToBeats();
+	if (BeatsUntilNextSection < 0)
+	{
+		BeatsUntilNextSection += CurrentTransport.WrapLength * BeatsPerBar;
+	}
+
+	if (BeatsUntilNextSection > Cue->PrimeLookAheadBars * BeatsPerBar)
+	{
+		return;
+	}
+
+	// Only evaluate once per section start, unless a state change invalidated the prediction
+	if (bLookAheadPrimed && LookAheadStartTime == NextSectionStartTime)
+	{
+		return;
+	}
+
+	bLookAheadPrimed = true;
+	LookAheadStartTime = NextSectionStartTime;
+
+	// Keep unscheduled primes for a bar past their expected start, in case the clock is running late
+	const int32 ExpireBeat = NumBeatsPlayed + BeatsUntilNextSection + BeatsPerBar;
+
+	if (bPendingTransition)
+	{
+		PrimeLayers(ActiveTransition.Layers, ExpireBeat);
+
+		if (NextSection)
 		{
-			continue;
+			PrimeLayers(NextSection->Layers, ExpireBeat + ActiveTransition.Length * BeatsPerBar);
 		}
+		return;
+	}
 
-		if (Transition.PlayRules.GetNextTriggerPoint(EarliestStartPoint, OutTransport))
+	int32 UpcomingConditionIndex = INDEX_NONE;
+	UUnderscoreSection* UpcomingSection = NextSection != nullptr ? NextSection : FindNextSection(UpcomingConditionIndex);
+
+	if (UpcomingSection == nullptr)
+	{
+		return;
+	}
+
+	FUnderscoreTransport TransitionStartTime;
+	if (UpcomingSection != CurrentSection)
+	{
+		if (const FUnderscoreTransition* Transition = FindTransition(CurrentSection, UpcomingSection, TransitionStartTime))
 		{
-			UE_LOG(LogUnderscore, Verbose, TEXT("Next Trigger Point for Transition is %i | %i"), OutTransport.Bar, OutTransport.Beat);
+			PrimeLayers(Transition->Layers, ExpireBeat);
+		}
+	}
 
-			int32 TotalBeats = OutTransport.ToBeats() - EarliestStartPoint.ToBeats();
+	PrimeLayers(UpcomingSection->Layers, ExpireBeat);
+}
 
-			if (TotalBeats < 0)
+void UUnderscoreCueBehavior::PrimeLayers(const TArray<FUnderscoreSectionLayer>& InLayers, const int32 InExpireBeat)
+{
+	for (const FUnderscoreSectionLayer& Layer : InLayers)
+	{
+		// Skipped layers won't be scheduled, crossfaded ones always are
+		if (Layer.Sound != nullptr && (Layer.bCrossfade || ShouldPlayLayer(Layer)))
+		{
+			PrimeSound(Layer.Sound, InExpireBeat);
+		}
+	}
+}
+
+void UUnderscoreCueBehavior::PrimeSound(USoundBase* Sound, const int32 InExpireBeat)
+{
+	FUnderscorePrimedSound* PrimedSound = PrimedSounds.FindByPredicate([Sound](const FUnderscorePrimedSound& Primed) { return Primed.Sound == Sound; });
+
+	if (PrimedSound == nullptr)
+	{
+		PrimedSound = &PrimedSounds.AddDefaulted_GetRef();
+		PrimedSound->Sound = Sound;
+
+		// Keep the compressed data resident until the sound has played, and start loading its first chunk now
+		TArray<USoundWave*> SoundWaves;
+		UnderscorePriming::GatherSoundWaves(Sound, SoundWaves);
+		for (USoundWave* SoundWave : SoundWaves)
+		{
+			if (UnderscorePriming::RetainWave(SoundWave))
 			{
-				TotalBeats += (EarliestStartPoint.WrapLength * Cue->TimeSignature.NumBeats);
+				PrimedSound->PinnedWaves.Add(SoundWave);
 			}
+		}
+		UGameplayStatics::PrimeSound(Sound);
 
-			if (TotalBeats < NearestSyncPointBeats)
+		++SchedulingStats.NumPrimedSounds;
+		UE_LOG(LogUnderscore, Verbose, TEXT("Priming %s at %i | %i"), *Sound->GetName(), CurrentTransport.Bar, CurrentTransport.Beat);
+	}
+
+	PrimedSound->bPendingStart = true;
+	PrimedSound->ExpireBeat = FMath::Max(PrimedSound->ExpireBeat, InExpireBeat);
+}
+
+void UUnderscoreCueBehavior::OnLayerScheduled(USoundBase* Sound, UAudioComponent* Component)
+{
+	FUnderscorePrimedSound* PrimedSound = PrimedSounds.FindByPredicate([Sound](const FUnderscorePrimedSound& Primed) { return Primed.Sound == Sound; });
+
+	if (PrimedSound == nullptr || PrimedSound->bPendingStart == false)
+	{
+		if (Cue != nullptr && Cue->PrimeLookAheadBars > 0)
+		{
+			++SchedulingStats.NumLateStarts;
+			UE_LOG(LogUnderscore, Verbose, TEXT("Layer %s scheduled without being primed"), *Sound->GetName());
+		}
+
+		if (PrimedSound == nullptr)
+		{
+			return;
+		}
+	}
+
+	PrimedSound->bPendingStart = false;
+	PrimedSound->AudioComponents.AddUnique(Component);
+}
+
+void UUnderscoreCueBehavior::ExpirePrimedSounds()
+{
+	for (auto PrimedIt = PrimedSounds.CreateIterator(); PrimedIt; ++PrimedIt)
+	{
+		if (PrimedIt->bPendingStart && PrimedIt->ExpireBeat < NumBeatsPlayed)
+		{
+			PrimedIt->bPendingStart = false;
+
+			if (PrimedIt->AudioComponents.Num() == 0)
 			{
-				NearestSyncPointBeats = TotalBeats;
-				BestSyncPoint = OutTransport;
-				BestTranstition = &Transition;
+				UE_LOG(LogUnderscore, Verbose, TEXT("Dropping unused prime for %s"), PrimedIt->Sound != nullptr ? *PrimedIt->Sound->GetName() : TEXT("None"));
+
+				ReleasePrimedSound(*PrimedIt);
+				PrimedIt.RemoveCurrent();
 			}
 		}
 	}
+}
+
+void UUnderscoreCueBehavior::ReleasePrimedSound(FUnderscorePrimedSound& PrimedSound)
+{
+	for (USoundWave* SoundWave : PrimedSound.PinnedWaves)
+	{
+		if (SoundWave)
+		{
+			UnderscorePriming::ReleaseWave(SoundWave);
+		}
+	}
+
+	PrimedSound.PinnedWaves.Reset();
+}
+
+void UUnderscoreCueBehavior::ReleaseAllPrimedSounds()
+{
+	for (FUnderscorePrimedSound& PrimedSound : PrimedSounds)
+	{
+		ReleasePrimedSound(PrimedSound);
+	}
 
-	OutStartTime = BestSyncPoint;
-	return BestTranstition;
+	PrimedSounds.Reset();
+	bLookAheadPrimed = false;
 }
@@ -0,0 +1,20 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "HAL/Platform.h"
+
+class USoundWave;
+
+// USoundWave::RetainCompressedAudio isn't refcounted, so primes from every Cue share one retain per wave. Game thread only
+namespace UnderscorePriming
+{
+	// Retains the wave's compressed audio for a prime. False if something else keeps it resident, in which case it must not be released
+	bool RetainWave(USoundWave* SoundWave);
+
+	// Releases a retain that RetainWave succeeded for. The wave is released with its last prime
+	void ReleaseWave(USoundWave* SoundWave);
+
+	// Primes currently retaining the wave
+	int32 GetNumRetains(const USoundWave* SoundWave);
+}
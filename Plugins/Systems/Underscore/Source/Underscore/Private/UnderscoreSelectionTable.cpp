@@ -0,0 +1,206 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UnderscoreSelectionTable.h"
+
+#include "Math/NumericLimits.h"
+#include "UnderscoreCue.h"
+
+void FUnderscoreSelectionTable::Compile(UUnderscoreCue* InCue)
+{
+	Reset();
+
+	if (InCue == nullptr)
+	{
+		return;
+	}
+
+	Cue = InCue;
+
+	Sections.Reserve(Cue->Sections.Num());
+	for (const TPair<UUnderscoreSection*, FGameplayTagQuery>& SectionIt : Cue->Sections)
+	{
+		Sections.Emplace(SectionIt.Key, SectionIt.Value);
+
+		for (const FGameplayTag& Tag : SectionIt.Value.GetGameplayTagArray())
+		{
+			ReferencedTags.AddUnique(Tag);
+		}
+	}
+
+	bKeyedOnStates = ReferencedTags.Num() <= MaxKeyedTags;
+
+	for (int32 TransitionIndex = 0; TransitionIndex < Cue->Transitions.Num(); ++TransitionIndex)
+	{
+		const FUnderscoreTransition& Transition = Cue->Transitions[TransitionIndex];
+		TransitionsByPair.FindOrAdd({ Transition.From, Transition.To }).Add(TransitionIndex);
+	}
+}
+
+void FUnderscoreSelectionTable::Reset()
+{
+	Cue = nullptr;
+	Sections.Reset();
+	ReferencedTags.Reset();
+	bKeyedOnStates = false;
+	TransitionsByPair.Reset();
+
+	EntriesByStates.Reset();
+	UnkeyedEntry = FStatesEntry();
+	CurrentEntry = nullptr;
+	StatesSerial = 0;
+	bHasStates = false;
+
+	TransitionResults.Reset();
+}
+
+void FUnderscoreSelectionTable::UpdateStates(const FGameplayTagContainer& InActiveStates, const uint32 InStatesSerial) const
+{
+	if (bHasStates && InStatesSerial == StatesSerial)
+	{
+		return;
+	}
+
+	bHasStates = true;
+	StatesSerial = InStatesSerial;
+
+	if (bKeyedOnStates == false)
+	{
+		EvaluateSections(InActiveStates, UnkeyedEntry);
+		CurrentEntry = &UnkeyedEntry;
+		return;
+	}
+
+	const uint64 Key = ComputeStatesKey(InActiveStates);
+	if (const FStatesEntry* Entry = EntriesByStates.Find(Key))
+	{
+		CurrentEntry = Entry;
+		return;
+	}
+
+	FStatesEntry& NewEntry = EntriesByStates.Add(Key);
+	EvaluateSections(InActiveStates, NewEntry);
+
+	// Adding can reallocate the map, so don't keep a pointer from before
+	CurrentEntry = &NewEntry;
+}
+
+bool FUnderscoreSelectionTable::IsSectionMatching(const int32 Index) const
+{
+	return CurrentEntry != nullptr && CurrentEntry->MatchingSections.IsValidIndex(Index) && CurrentEntry->MatchingSections[Index];
+}
+
+int32 FUnderscoreSelectionTable::GetFirstMatchingSection() const
+{
+	return CurrentEntry != nullptr ? CurrentEntry->FirstMatchingSection : INDEX_NONE;
+}
+
+FUnderscoreTransition* FUnderscoreSelectionTable::FindTransition(const UUnderscoreSection* From, const UUnderscoreSection* To, const FUnderscoreTransport& EarliestStartPoint, FUnderscoreTransport& OutStartTime) const
+{
+	if (Cue == nullptr)
+	{
+		return nullptr;
+	}
+
+	const FTransitionKey Key = { From, To, EarliestStartPoint.Bar, EarliestStartPoint.Beat, EarliestStartPoint.WrapLength, EarliestStartPoint.TimeSignature.NumBeats };
+	if (const FTransitionResult* Result = TransitionResults.Find(Key))
+	{
+		OutStartTime = Result->StartTime;
+		return Result->TransitionIndex != INDEX_NONE ? &Cue->Transitions[Result->TransitionIndex] : nullptr;
+	}
+
+	// Transitions with no From or To can play from or to anything
+	CandidateScratch.Reset();
+	const TPair<const UUnderscoreSection*, const UUnderscoreSection*> Pairs[] = { { From, To }, { From, nullptr }, { nullptr, To }, { nullptr, nullptr } };
+	for (int32 PairIndex = 0; PairIndex < UE_ARRAY_COUNT(Pairs); ++PairIndex)
+	{
+		bool bDuplicatePair = false;
+		for (int32 PreviousIndex = 0; PreviousIndex < PairIndex; ++PreviousIndex)
+		{
+			bDuplicatePair |= Pairs[PreviousIndex] == Pairs[PairIndex];
+		}
+
+		if (const TArray<int32>* Indices = bDuplicatePair ? nullptr : TransitionsByPair.Find(Pairs[PairIndex]))
+		{
+			CandidateScratch.Append(*Indices);
+		}
+	}
+
+	// Keep Cue order, so ties go to the same transition as a full scan
+	CandidateScratch.Sort();
+
+	FTransitionResult NewResult;
+	int32 NearestSyncPointBeats = TNumericLimits<int32>::Max();
+	FUnderscoreTransport OutTransport;
+
+	for (const int32 TransitionIndex : CandidateScratch)
+	{
+		const FUnderscoreTransition& Transition = Cue->Transitions[TransitionIndex];
+
+		if (Transition.PlayRules.GetNextTriggerPoint(EarliestStartPoint, OutTransport))
+		{
+			int32 TotalBeats = OutTransport.ToBeats() - EarliestStartPoint.ToBeats();
+
+			if (TotalBeats < 0)
+			{
+				TotalBeats += (EarliestStartPoint.WrapLength * Cue->TimeSignature.NumBeats);
+			}
+
+			if (TotalBeats < NearestSyncPointBeats)
+			{
+				NearestSyncPointBeats = TotalBeats;
+				NewResult.StartTime = OutTransport;
+				NewResult.TransitionIndex = TransitionIndex;
+			}
+		}
+	}
+
+	if (TransitionResults.Num() >= MaxMemoizedTransitions)
+	{
+		TransitionResults.Reset();
+	}
+	TransitionResults.Add(Key, NewResult);
+
+	OutStartTime = NewResult.StartTime;
+	return NewResult.TransitionIndex != INDEX_NONE ? &Cue->Transitions[NewResult.TransitionIndex] : nullptr;
+}
+
+uint64 FUnderscoreSelectionTable::ComputeStatesKey(const FGameplayTagContainer& InActiveStates) const
+{
+	uint64 Key = 0;
+
+	for (int32 TagIndex = 0; TagIndex < ReferencedTags.Num(); ++TagIndex)
+	{
+		if (InActiveStates.HasTag(ReferencedTags[TagIndex]))
+		{
+			Key |= 1ull << (2 * TagIndex);
+
+			if (InActiveStates.HasTagExact(ReferencedTags[TagIndex]))
+			{
+				Key |= 1ull << (2 * TagIndex + 1);
+			}
+		}
+	}
+
+	return Key;
+}
+
+void FUnderscoreSelectionTable::EvaluateSections(const FGameplayTagContainer& InActiveStates, FStatesEntry& OutEntry) const
+{
+	OutEntry.MatchingSections.Init(false, Sections.Num());
+	OutEntry.FirstMatchingSection = INDEX_NONE;
+
+	for (int32 SectionIndex = 0; SectionIndex < Sections.Num(); ++SectionIndex)
+	{
+		const FGameplayTagQuery& Condition = Sections[SectionIndex].Value;
+
+		if (Condition.IsEmpty() || Condition.Matches(InActiveStates))
+		{
+			OutEntry.MatchingSections[SectionIndex] = true;
+
+			if (OutEntry.FirstMatchingSection == INDEX_NONE)
+			{
+				OutEntry.FirstMatchingSection = SectionIndex;
+			}
+		}
+	}
+}
@@ -8,6 +8,7 @@
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "HAL/PlatformCrt.h"
+#include "HAL/PlatformTime.h"
 #include "Logging/LogCategory.h"
 #include "Logging/LogMacros.h"
 #include "Quartz/AudioMixerClockHandle.h"
@@ -79,6 +80,38 @@ void UUnderscoreSubsystem::StartCue(UUnderscoreCue* InCue)
 
 	CueManager->ClockHandle = ClockHandle;
 	CueManager->SetSubsystem(this);
+
+	// Enough components for the busiest section, a transition over it, and a stinger
+	int32 MaxSectionLayers = 0;
+	int32 MaxStingerSounds = 0;
+	USoundBase* WarmSound = nullptr;
+	for (const auto& SectionIt : InCue->Sections)
+	{
+		if (SectionIt.Key == nullptr)
+		{
+			continue;
+		}
+
+		MaxSectionLayers = FMath::Max(MaxSectionLayers, SectionIt.Key->Layers.Num());
+		for (const FUnderscoreSectionStinger& Stinger : SectionIt.Key->Stingers)
+		{
+			MaxStingerSounds = FMath::Max(MaxStingerSounds, Stinger.Sounds.Num());
+		}
+
+		if (WarmSound == nullptr && SectionIt.Key->Layers.Num() > 0)
+		{
+			WarmSound = SectionIt.Key->Layers[0].Sound;
+		}
+	}
+
+	int32 MaxTransitionLayers = 0;
+	for (const FUnderscoreTransition& Transition : InCue->Transitions)
+	{
+		MaxTransitionLayers = FMath::Max(MaxTransitionLayers, Transition.Layers.Num());
+	}
+
+	WarmComponentPool(WarmSound, MaxSectionLayers + MaxTransitionLayers + MaxStingerSounds);
+
 	CueManager->StartCue(InCue);
 
 	if (ClockHandle->IsClockRunning(World) == false)
@@ -161,6 +194,16 @@ float UUnderscoreSubsystem::GetBPM() const
 	return 0.f;
 }
 
+FUnderscoreCueSchedulingStats UUnderscoreSubsystem::GetSchedulingStats() const
+{
+	if (CueManager)
+	{
+		return CueManager->GetSchedulingStats();
+	}
+
+	return FUnderscoreCueSchedulingStats();
+}
+
 void UUnderscoreSubsystem::SetState(const FGameplayTag InState)
 {
 	if (InState.IsValid() == false)
@@ -172,6 +215,7 @@ void UUnderscoreSubsystem::SetState(const FGameplayTag InState)
 	ActiveStates.RemoveTags(TagsToClear);
 
 	ActiveStates.AddLeafTag(InState);
+	++StatesSerial;
 
 	if (CueManager)
 	{
@@ -185,6 +229,7 @@ void UUnderscoreSubsystem::ClearState(const FGameplayTag InState)
 {
 	FGameplayTagContainer TagsToClear = ActiveStates.Filter(InState.GetSingleTagContainer());
 	ActiveStates.RemoveTags(TagsToClear);
+	++StatesSerial;
 
 	if (CueManager)
 	{
@@ -197,6 +242,7 @@ void UUnderscoreSubsystem::ClearState(const FGameplayTag InState)
 void UUnderscoreSubsystem::ResetStates()
 {
 	ActiveStates.Reset();
+	++StatesSerial;
 }
 
 bool UUnderscoreSubsystem::IsStateActive(const FGameplayTag& InState) const
@@ -259,6 +305,9 @@ UAudioComponent* UUnderscoreSubsystem::CreateNewAudioComponent(USoundBase* Sound
 		AudioComponent->bReverb = false;
 		AudioComponent->bCenterChannelOnly = false;
 		AudioComponent->bIsPreviewSound = false;
+		AudioComponent->OnAudioFinishedNative.AddUObject(this, &ThisClass::HandleComponentFinished);
+
+		++NumComponentAllocations;
 
 		return AudioComponent;
 	}
@@ -268,20 +317,121 @@ UAudioComponent* UUnderscoreSubsystem::CreateNewAudioComponent(USoundBase* Sound
 
 UAudioComponent* UUnderscoreSubsystem::PrepareComponent(USoundBase* Sound)
 {
-	for (UAudioComponent* Component : ComponentPool)
+	const double Now = FPlatformTime::Seconds();
+	TrimComponentPool(Now);
+
+	while (FreeComponents.Num() > 0)
 	{
-		if (Component && Component->IsPlaying() == false)
+		UAudioComponent* Component = FreeComponents.Pop(false).Component;
+
+		// Components can be destroyed with their world
+		if (IsValid(Component))
 		{
 			Component->SetSound(Sound);
+			InUseComponents.Add(Component, Now);
 			return Component;
 		}
 	}
 
 	if (UAudioComponent* NewComponent = CreateNewAudioComponent(Sound))
 	{
-		ComponentPool.Add(NewComponent);
+		InUseComponents.Add(NewComponent, Now);
 		return NewComponent;
 	}
 
 	return nullptr;
-}
\ No newline at end of file
+}
+
+void UUnderscoreSubsystem::ReleaseComponent(UAudioComponent* Component)
+{
+	if (Component && InUseComponents.Remove(Component) > 0)
+	{
+		FreeComponents.Add({ Component, FPlatformTime::Seconds() });
+	}
+}
+
+void UUnderscoreSubsystem::WarmComponentPool(USoundBase* Sound, const int32 NumComponents)
+{
+	if (Sound == nullptr)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+
+	while (FreeComponents.Num() + InUseComponents.Num() < NumComponents)
+	{
+		UAudioComponent* NewComponent = CreateNewAudioComponent(Sound);
+
+		if (NewComponent == nullptr)
+		{
+			return;
+		}
+
+		FreeComponents.Add({ NewComponent, Now });
+	}
+}
+
+FUnderscoreComponentPoolStats UUnderscoreSubsystem::GetComponentPoolStats() const
+{
+	FUnderscoreComponentPoolStats Stats;
+	Stats.PoolSize = FreeComponents.Num() + InUseComponents.Num();
+	Stats.NumInUse = InUseComponents.Num();
+	Stats.NumAllocations = NumComponentAllocations;
+	Stats.NumTrimmed = NumComponentsTrimmed;
+	return Stats;
+}
+
+void UUnderscoreSubsystem::HandleComponentFinished(UAudioComponent* Component)
+{
+	ReleaseComponent(Component);
+}
+
+void UUnderscoreSubsystem::TrimComponentPool(const double Now)
+{
+	// Trimming is cheap, but doesn't need to happen more than once a second
+	if (PoolIdleTrimSeconds < 0.f || Now - LastPoolTrimTime < 1.0)
+	{
+		return;
+	}
+
+	LastPoolTrimTime = Now;
+	const double IdleThreshold = Now - PoolIdleTrimSeconds;
+
+	// Prepared components that never started playing will never finish either, once their quantization boundary is long gone
+	for (auto InUseIt = InUseComponents.CreateIterator(); InUseIt; ++InUseIt)
+	{
+		UAudioComponent* Component = InUseIt->Key;
+
+		if (IsValid(Component) == false)
+		{
+			InUseIt.RemoveCurrent();
+		}
+		else if (InUseIt->Value < IdleThreshold && Component->IsPlaying() == false)
+		{
+			// Idle from now on, so they go last to keep the free list oldest first
+			InUseIt.RemoveCurrent();
+			FreeComponents.Add({ Component, Now });
+		}
+	}
+
+	// The free list is in release order, so the oldest idle components are first
+	int32 NumToTrim = 0;
+	while (NumToTrim < FreeComponents.Num() && FreeComponents[NumToTrim].IdleSince < IdleThreshold)
+	{
+		if (UAudioComponent* Component = FreeComponents[NumToTrim].Component)
+		{
+			Component->OnAudioFinishedNative.RemoveAll(this);
+			Component->DestroyComponent();
+		}
+		++NumToTrim;
+	}
+
+	if (NumToTrim > 0)
+	{
+		FreeComponents.RemoveAt(0, NumToTrim);
+		NumComponentsTrimmed += NumToTrim;
+
+		UE_LOG(LogUnderscore, Verbose, TEXT("Trimmed %i idle Underscore components, %i left in the pool"), NumToTrim, FreeComponents.Num() + InUseComponents.Num());
+	}
+}
@@ -0,0 +1,222 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UnderscoreTransportSimulator.h"
+
+#include "Components/AudioComponent.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/PlatformTime.h"
+#include "Logging/LogMacros.h"
+#include "Sound/SoundBase.h"
+#include "UObject/Package.h"
+#include "Underscore.h"
+#include "UnderscoreCue.h"
+#include "UnderscoreSubsystem.h"
+
+LLM_DEFINE_TAG(Underscore_SimulatedBeat, TEXT("Underscore Simulated Beat"));
+
+namespace UnderscoreSimulator
+{
+	// Bytes currently allocated under the simulated beat tag, or 0 when the tracker is disabled
+	static int64 GetBeatBytes()
+	{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+		if (FLowLevelMemTracker::IsEnabled())
+		{
+			// Allocations are gathered from the threads' states on update
+			FLowLevelMemTracker& Tracker = FLowLevelMemTracker::Get();
+			Tracker.UpdateStatsPerFrame();
+			return Tracker.GetTagAmountForTracker(ELLMTracker::Default, LLM_TAG_NAME(Underscore_SimulatedBeat), ELLMTagSet::None);
+		}
+#endif
+		return 0;
+	}
+}
+
+void UUnderscoreSimulatedCueBehavior::OnQuartzBeat_Implementation(FName ClockName, EQuartzCommandQuantization QuantizationType, int32 NumBars, int32 Beat, float BeatFraction)
+{
+	// Clips ending on this beat are reported before it, as the audio thread would
+	FinishClips(NumBeatsPlayed + 1);
+
+	Super::OnQuartzBeat_Implementation(ClockName, QuantizationType, NumBars, Beat, BeatFraction);
+}
+
+void UUnderscoreSimulatedCueBehavior::Stop_Implementation(float FadeTime)
+{
+	Super::Stop_Implementation(FadeTime);
+
+	FinishClips(MAX_int32);
+}
+
+UAudioComponent* UUnderscoreSimulatedCueBehavior::PrepareClipComponent(USoundBase* Sound)
+{
+	UAudioComponent* Component = FreeComponents.Num() > 0 ? FreeComponents.Pop(false) : NewObject<UAudioComponent>(this);
+
+	// Never registered, so there is no audio device to go through
+	Component->Sound = Sound;
+	return Component;
+}
+
+void UUnderscoreSimulatedCueBehavior::PlayClipNextBeat(UAudioComponent* Component, const float Volume)
+{
+	FUnderscoreSimulatedPlay& Play = ScheduledPlays.AddDefaulted_GetRef();
+	Play.Sound = Component->Sound;
+	Play.Volume = Volume;
+	Play.TargetBeat = NumBeatsPlayed + 1;
+	Play.Transport = CurrentTransport;
+	Play.Transport.Increment();
+
+	int32 EndBeat = MAX_int32;
+	if (Component->Sound && Component->Sound->IsLooping() == false && GetBPM() > 0.f)
+	{
+		EndBeat = Play.TargetBeat + FMath::Max(1, FMath::CeilToInt(Component->Sound->GetDuration() * GetBPM() / 60.f));
+	}
+
+	PlayingClips.Add({ Component, EndBeat });
+}
+
+void UUnderscoreSimulatedCueBehavior::FinishClips(const int32 InBeat)
+{
+	for (int32 ClipIndex = 0; ClipIndex < PlayingClips.Num();)
+	{
+		if (PlayingClips[ClipIndex].EndBeat > InBeat)
+		{
+			++ClipIndex;
+			continue;
+		}
+
+		UAudioComponent* Component = PlayingClips[ClipIndex].Component;
+		PlayingClips.RemoveAt(ClipIndex, 1, false);
+
+		if (Component)
+		{
+			Component->OnAudioFinishedNative.Broadcast(Component);
+			FreeComponents.Add(Component);
+		}
+	}
+}
+
+FUnderscoreTransportSimulator::FUnderscoreTransportSimulator(UUnderscoreCue* InCue)
+	: Cue(InCue)
+{
+	check(IsInGameThread());
+
+	// Not part of any game instance, so it has no world to create audio components or clocks in
+	Subsystem = NewObject<UUnderscoreSubsystem>(GetTransientPackage());
+
+	if (Cue == nullptr)
+	{
+		UE_LOG(LogUnderscore, Warning, TEXT("Underscore Transport Simulator created without a Cue"));
+		return;
+	}
+
+	if (Cue->ManagerClassOverride != nullptr)
+	{
+		UE_LOG(LogUnderscore, Warning, TEXT("Underscore Transport Simulator ignores the Manager Class Override %s of Cue %s"), *Cue->ManagerClassOverride->GetName(), *Cue->GetName());
+	}
+
+	Behavior = NewObject<UUnderscoreSimulatedCueBehavior>(Subsystem);
+	Behavior->SetSubsystem(Subsystem);
+	Subsystem->SetCueManager(Behavior);
+
+	Behavior->StartCue(Cue);
+}
+
+FUnderscoreTransportSimulator::~FUnderscoreTransportSimulator()
+{
+	if (Behavior)
+	{
+		Behavior->Stop();
+	}
+
+	if (Subsystem)
+	{
+		Subsystem->SetCueManager(nullptr);
+	}
+}
+
+void FUnderscoreTransportSimulator::AdvanceBeats(const int32 NumBeats)
+{
+	if (Behavior == nullptr)
+	{
+		return;
+	}
+
+	for (int32 BeatIndex = 0; BeatIndex < NumBeats; ++BeatIndex)
+	{
+		const int64 BytesBefore = UnderscoreSimulator::GetBeatBytes();
+		const uint64 CyclesBefore = FPlatformTime::Cycles64();
+
+		{
+			LLM_SCOPE_BYTAG(Underscore_SimulatedBeat);
+
+			// Quartz reports the beat in the bar; the behavior keeps its own transport, so only the call matters
+			Behavior->OnQuartzBeat(Underscore::ClockName, EQuartzCommandQuantization::Beat, 0, 0, 0.f);
+		}
+
+		const double BeatSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - CyclesBefore);
+		const int64 BeatBytes = UnderscoreSimulator::GetBeatBytes() - BytesBefore;
+
+		++Stats.NumBeats;
+		Stats.TotalBeatSeconds += BeatSeconds;
+		Stats.MaxBeatSeconds = FMath::Max(Stats.MaxBeatSeconds, BeatSeconds);
+		Stats.TotalBeatBytes += BeatBytes;
+		Stats.MaxBeatBytes = FMath::Max(Stats.MaxBeatBytes, BeatBytes);
+	}
+}
+
+void FUnderscoreTransportSimulator::AdvanceTime(const float InSeconds)
+{
+	if (Cue == nullptr || Cue->BPM <= 0.f)
+	{
+		return;
+	}
+
+	const float SecondsPerBeat = 60.f / Cue->BPM;
+	PendingBeatSeconds += InSeconds;
+
+	const int32 NumBeats = FMath::FloorToInt(PendingBeatSeconds / SecondsPerBeat);
+	PendingBeatSeconds -= NumBeats * SecondsPerBeat;
+
+	AdvanceBeats(NumBeats);
+}
+
+void FUnderscoreTransportSimulator::SetState(const FGameplayTag InState)
+{
+	Subsystem->SetState(InState);
+}
+
+void FUnderscoreTransportSimulator::ClearState(const FGameplayTag InState)
+{
+	Subsystem->ClearState(InState);
+}
+
+void FUnderscoreTransportSimulator::TriggerEvent(const FName EventName)
+{
+	Subsystem->TriggerEvent(EventName);
+}
+
+const TArray<FUnderscoreSimulatedPlay>& FUnderscoreTransportSimulator::GetScheduledPlays() const
+{
+	static const TArray<FUnderscoreSimulatedPlay> NoPlays;
+	return Behavior ? Behavior->GetScheduledPlays() : NoPlays;
+}
+
+void FUnderscoreTransportSimulator::ResetScheduledPlays()
+{
+	if (Behavior)
+	{
+		Behavior->ResetScheduledPlays();
+	}
+}
+
+void FUnderscoreTransportSimulator::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(Cue);
+	Collector.AddReferencedObject(Subsystem);
+	Collector.AddReferencedObject(Behavior);
+}
+
+FString FUnderscoreTransportSimulator::GetReferencerName() const
+{
+	return TEXT("FUnderscoreTransportSimulator");
+}
@@ -37,4 +37,8 @@ public:
 	// Sounds to play between sections and the rules for when to play them
 	UPROPERTY(EditAnywhere)
 	TArray<FUnderscoreTransition> Transitions;
+
+	// How many bars before a section or transition starts its sounds are primed, so streamed layers are ready on the beat. 0 disables priming
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0"))
+	int32 PrimeLookAheadBars = 0;
 };
\ No newline at end of file
@@ -13,12 +13,14 @@
 #include "UObject/WeakObjectPtr.h"
 #include "UnderscoreCue.h"
 #include "UnderscoreSection.h"
+#include "UnderscoreSelectionTable.h"
 
 #include "UnderscoreCueBehavior.generated.h"
 
 class UAudioComponent;
 class UQuartzClockHandle;
 class USoundBase;
+class USoundWave;
 class UUnderscoreSubsystem;
 struct FFrame;
 
@@ -55,6 +57,49 @@ struct FUnderscoreScheduledStinger
 	FUnderscoreSectionStinger Stinger;
 };
 
+// A sound primed ahead of its start time. Its waves are kept in the stream cache until it has played
+USTRUCT()
+struct FUnderscorePrimedSound
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	USoundBase* Sound = nullptr;
+
+	// Waves this prime retained, not the ones kept resident by something else
+	UPROPERTY(Transient)
+	TArray<USoundWave*> PinnedWaves;
+
+	// Components playing this sound since it was scheduled
+	UPROPERTY(Transient)
+	TArray<UAudioComponent*> AudioComponents;
+
+	// Beat count after which the prime is dropped if the sound hasn't been scheduled, ex. after a state change
+	int32 ExpireBeat = 0;
+
+	// Primed by the look-ahead and not scheduled yet
+	bool bPendingStart = false;
+};
+
+// How well a Cue's sounds were ready when they had to be scheduled
+USTRUCT(BlueprintType)
+struct FUnderscoreCueSchedulingStats
+{
+	GENERATED_BODY()
+
+	// Sounds primed ahead of their start time
+	UPROPERTY(BlueprintReadOnly)
+	int32 NumPrimedSounds = 0;
+
+	// Section and transition layers scheduled without having been primed, which are likely to come in late
+	UPROPERTY(BlueprintReadOnly)
+	int32 NumLateStarts = 0;
+
+	// Clips that could not be scheduled, or that the clock failed to queue or cancelled
+	UPROPERTY(BlueprintReadOnly)
+	int32 NumMisses = 0;
+};
+
 // An object that contains the logic to control a Cue
 // Able to overridden with blueprint subclasses on a Per-Cue basis
 UCLASS(Blueprintable)
@@ -72,6 +117,9 @@ public:
 	UPROPERTY()
 	FOnQuartzMetronomeEventBP OnQuartzBeatEvent;
 
+	UPROPERTY()
+	FOnQuartzCommandEventBP OnQuartzCommandEvent;
+
 	UFUNCTION(BlueprintNativeEvent)
 	void StartCue(UUnderscoreCue* InCue);
 
@@ -119,6 +167,9 @@ public:
 	UFUNCTION(BlueprintCallable)
 	EUnderscoreCueBehaviorPlayState GetPlayState() { return PlayState; }
 
+	UFUNCTION(BlueprintCallable)
+	const FUnderscoreCueSchedulingStats& GetSchedulingStats() const { return SchedulingStats; }
+
 	UFUNCTION(BlueprintCallable)
 	void SubscribeEventToTransport(const FUnderscoreTransport& InTransport, const FUnderscoreTransportEvent& InEvent, bool bExecuteOnceOnly = true);
 
@@ -127,6 +178,9 @@ public:
 
 	void HandleAudioFinished(UAudioComponent* Component);
 
+	UFUNCTION()
+	void HandleQuartzCommandEvent(EQuartzCommandDelegateSubType EventType, FName Name);
+
 	void SetSubsystem(UUnderscoreSubsystem* InSubsystem) { Subsystem = InSubsystem; }
 
 protected:
@@ -152,6 +206,12 @@ protected:
 	UPROPERTY(Transient, BlueprintReadOnly)
 	FGameplayTagQuery CurrentSectionCondition;
 
+	// Index of CurrentSectionCondition in the SelectionTable, if it came from there
+	int32 CurrentSectionConditionIndex = INDEX_NONE;
+
+	// Cue sections and transitions, compiled in StartCue
+	FUnderscoreSelectionTable SelectionTable;
+
 	UPROPERTY(Transient)
 	UUnderscoreSubsystem* Subsystem;
 
@@ -194,10 +254,20 @@ protected:
 	UFUNCTION(BlueprintCallable)
 	UAudioComponent* ScheduleClipNextBeat(USoundBase* Sound, const float Volume = 1.f);
 
+	// The component a clip will play on, taken from the Subsystem's pool. Null if none could be created
+	virtual UAudioComponent* PrepareClipComponent(USoundBase* Sound);
+
+	// Starts a prepared component on the next beat of the Cue's clock
+	virtual void PlayClipNextBeat(UAudioComponent* Component, const float Volume);
+
 	bool ShouldPlayLayer(const FUnderscoreSectionLayer& Layer) const;
 
 	// return true if the current section condition is no longer valid due to state changes
 	bool NeedsTransition() const;
+	bool IsCurrentSectionConditionValid() const;
+
+	// The SelectionTable, up to date with the Subsystem's states
+	const FUnderscoreSelectionTable& GetSelectionTable() const;
 	void PlayTransition();
 	void PlayLayers(TArray<FUnderscoreSectionLayer>& InLayers);
 
@@ -219,6 +289,10 @@ protected:
 
 	FUnderscoreTransition* GetTransitionForPendingSection(FUnderscoreTransport& OutStartTime);
 
+	// Side-effect free versions of the above, so the look-ahead can evaluate them before the fact
+	UUnderscoreSection* FindNextSection(int32& OutConditionIndex) const;
+	FUnderscoreTransition* FindTransition(const UUnderscoreSection* From, const UUnderscoreSection* To, FUnderscoreTransport& OutStartTime) const;
+
 	// Picks the next section to be played, and either adds it to the Queue or plays it immediately
 	void QueueNextSection();
 
@@ -226,9 +300,33 @@ protected:
 	UFUNCTION(BlueprintCallable)
 	void SetNextSection(UUnderscoreSection* Section, const int32 StartBar, const int32 StartBeat);
 
-	TArray<UAudioComponent*> ActiveComponents;
+	// Clips this cue scheduled that have not finished yet
+	TSet<UAudioComponent*> ActiveComponents;
 
 	// Any events that need to be broadcast at a specific Bar/Beat;
 	UPROPERTY()
 	TArray<FUnderscoreTransportEventHandle> TransportEvents;
+
+	// Sounds that will be needed within the Cue's PrimeLookAheadBars, or that are still playing since
+	UPROPERTY(Transient)
+	TArray<FUnderscorePrimedSound> PrimedSounds;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	FUnderscoreCueSchedulingStats SchedulingStats;
+
+	// Beats played since the Cue started
+	int32 NumBeatsPlayed = 0;
+
+	// The section start the look-ahead last primed for. Cleared when the prediction may have changed
+	FUnderscoreTransport LookAheadStartTime;
+	bool bLookAheadPrimed = false;
+
+	// Prime what will play at NextSectionStartTime once it is within the look-ahead
+	void UpdateLookAhead();
+	void PrimeLayers(const TArray<FUnderscoreSectionLayer>& InLayers, const int32 InExpireBeat);
+	void PrimeSound(USoundBase* Sound, const int32 InExpireBeat);
+	void OnLayerScheduled(USoundBase* Sound, UAudioComponent* Component);
+	void ExpirePrimedSounds();
+	void ReleasePrimedSound(FUnderscorePrimedSound& PrimedSound);
+	void ReleaseAllPrimedSounds();
 };
\ No newline at end of file
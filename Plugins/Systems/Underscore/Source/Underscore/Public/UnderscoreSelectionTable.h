@@ -0,0 +1,107 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/BitArray.h"
+#include "Containers/Map.h"
+#include "GameplayTagContainer.h"
+#include "HAL/Platform.h"
+#include "Templates/Tuple.h"
+#include "UnderscoreSection.h"
+
+class UUnderscoreCue;
+
+// Section and transition selection for a Cue, compiled when the Cue starts
+// Section conditions only depend on which of the tags they reference are active, so their results are memoized per
+// combination of those tags and only looked up again when one of them changes
+class UNDERSCORE_API FUnderscoreSelectionTable
+{
+public:
+	void Compile(UUnderscoreCue* InCue);
+	void Reset();
+
+	bool IsCompiled() const { return Cue != nullptr; }
+
+	// Re-evaluates the section conditions if ActiveStates changed since the last call, as identified by InStatesSerial
+	void UpdateStates(const FGameplayTagContainer& InActiveStates, const uint32 InStatesSerial) const;
+
+	int32 NumSections() const { return Sections.Num(); }
+	UUnderscoreSection* GetSection(const int32 Index) const { return Sections[Index].Key; }
+	const FGameplayTagQuery& GetSectionCondition(const int32 Index) const { return Sections[Index].Value; }
+
+	// Whether the condition of the section at Index is met by the last states, empty conditions always are
+	bool IsSectionMatching(const int32 Index) const;
+
+	// The first section in Cue order whose condition is met by the last states, or INDEX_NONE
+	int32 GetFirstMatchingSection() const;
+
+	// Same choice as scanning every Cue transition from EarliestStartPoint, only considering the ones that can go From -> To
+	FUnderscoreTransition* FindTransition(const UUnderscoreSection* From, const UUnderscoreSection* To, const FUnderscoreTransport& EarliestStartPoint, FUnderscoreTransport& OutStartTime) const;
+
+private:
+	struct FStatesEntry
+	{
+		TBitArray<> MatchingSections;
+		int32 FirstMatchingSection = INDEX_NONE;
+	};
+
+	struct FTransitionKey
+	{
+		const UUnderscoreSection* From = nullptr;
+		const UUnderscoreSection* To = nullptr;
+		int32 Bar = 0;
+		int32 Beat = 0;
+		int32 WrapLength = 0;
+
+		// Trigger points are found by incrementing the transport, which wraps on the bar length
+		int32 NumBeats = 0;
+
+		bool operator==(const FTransitionKey& Other) const
+		{
+			return From == Other.From && To == Other.To && Bar == Other.Bar && Beat == Other.Beat && WrapLength == Other.WrapLength && NumBeats == Other.NumBeats;
+		}
+
+		friend uint32 GetTypeHash(const FTransitionKey& Key)
+		{
+			const uint32 TransportHash = HashCombine(HashCombine(GetTypeHash(Key.Bar), GetTypeHash(Key.Beat)), HashCombine(GetTypeHash(Key.WrapLength), GetTypeHash(Key.NumBeats)));
+			return HashCombine(HashCombine(GetTypeHash(Key.From), GetTypeHash(Key.To)), TransportHash);
+		}
+	};
+
+	struct FTransitionResult
+	{
+		int32 TransitionIndex = INDEX_NONE;
+		FUnderscoreTransport StartTime;
+	};
+
+	// Two bits per referenced tag: HasTag and HasTagExact, so both matching flavors of a query are covered
+	static constexpr int32 MaxKeyedTags = 32;
+
+	// Past this, memoized transitions are dropped rather than growing without bounds
+	static constexpr int32 MaxMemoizedTransitions = 4096;
+
+	uint64 ComputeStatesKey(const FGameplayTagContainer& InActiveStates) const;
+	void EvaluateSections(const FGameplayTagContainer& InActiveStates, FStatesEntry& OutEntry) const;
+
+	UUnderscoreCue* Cue = nullptr;
+
+	// Cue->Sections in iteration order
+	TArray<TPair<UUnderscoreSection*, FGameplayTagQuery>> Sections;
+
+	// Every tag referenced by a section condition
+	TArray<FGameplayTag> ReferencedTags;
+	bool bKeyedOnStates = false;
+
+	// Transition indices for each From -> To pair, either of which can be null, in Cue order
+	TMap<TPair<const UUnderscoreSection*, const UUnderscoreSection*>, TArray<int32>> TransitionsByPair;
+
+	mutable TMap<uint64, FStatesEntry> EntriesByStates;
+	mutable FStatesEntry UnkeyedEntry;
+	mutable const FStatesEntry* CurrentEntry = nullptr;
+	mutable uint32 StatesSerial = 0;
+	mutable bool bHasStates = false;
+
+	mutable TMap<FTransitionKey, FTransitionResult> TransitionResults;
+	mutable TArray<int32> CandidateScratch;
+};
@@ -31,7 +31,41 @@ class UUnderscoreCue;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FUnderscoreSyncEvent, FName, EventName);
 
-UCLASS(BlueprintType)
+// An idle component waiting in the pool's free list
+USTRUCT()
+struct FUnderscorePooledComponent
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	UAudioComponent* Component = nullptr;
+
+	// FPlatformTime::Seconds() when it was returned to the pool
+	double IdleSince = 0.0;
+};
+
+USTRUCT(BlueprintType)
+struct FUnderscoreComponentPoolStats
+{
+	GENERATED_BODY()
+
+	// Components owned by the pool, idle or not
+	UPROPERTY(BlueprintReadOnly)
+	int32 PoolSize = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 NumInUse = 0;
+
+	// Components created since the subsystem started, including warm ones
+	UPROPERTY(BlueprintReadOnly)
+	int32 NumAllocations = 0;
+
+	// Idle components destroyed after PoolIdleTrimSeconds
+	UPROPERTY(BlueprintReadOnly)
+	int32 NumTrimmed = 0;
+};
+
+UCLASS(BlueprintType, Config = Game)
 class UNDERSCORE_API UUnderscoreSubsystem : public UGameInstanceSubsystem
 {
 	GENERATED_BODY()
@@ -73,9 +107,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Underscore")
 	bool IsPlaying() const;
 
+	// Routes states and events to a behavior started without StartCue, ex. by FUnderscoreTransportSimulator
+	void SetCueManager(UUnderscoreCueBehavior* InCueManager) { CueManager = InCueManager; }
+
 	UFUNCTION(BlueprintCallable, Category = "Underscore")
 	float GetBPM() const;
 
+	// Priming, late start and miss counters of the playing Cue
+	UFUNCTION(BlueprintCallable, Category = "Underscore")
+	FUnderscoreCueSchedulingStats GetSchedulingStats() const;
+
 	UFUNCTION(BlueprintCallable, Category = "Underscore")
 	void SetState(const FGameplayTag InState);
 
@@ -91,15 +132,32 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Underscore")
 	bool IsStateConditionValid(const FGameplayTagQuery& InCondition) const;
 
+	const FGameplayTagContainer& GetActiveStates() const { return ActiveStates; }
+
+	// Changes every time ActiveStates does, so cached evaluations of it can tell when they are stale
+	uint32 GetStatesSerial() const { return StatesSerial; }
+
 	UFUNCTION(BlueprintCallable, Category = "Underscore")
 	FQuartzTimeSignature GetTimeSignature() const;
 
 	UFUNCTION(BlueprintCallable, Category = "Underscore")
 	UQuartzClockHandle* GetClock() const;
 
+	// Takes an idle component from the pool, or creates one. It goes back to the pool when it finishes playing
 	UFUNCTION(BlueprintCallable, Category = "Underscore")
 	UAudioComponent* PrepareComponent(USoundBase* Sound);
 
+	// Returns a component that was prepared but will not be played
+	UFUNCTION(BlueprintCallable, Category = "Underscore")
+	void ReleaseComponent(UAudioComponent* Component);
+
+	// Creates idle components until the pool holds at least NumComponents
+	UFUNCTION(BlueprintCallable, Category = "Underscore")
+	void WarmComponentPool(USoundBase* Sound, const int32 NumComponents);
+
+	UFUNCTION(BlueprintCallable, Category = "Underscore")
+	FUnderscoreComponentPoolStats GetComponentPoolStats() const;
+
 	// Helper to find the correct quartz clock for your underscore cue
 	UFUNCTION(BlueprintCallable, Category = "Underscore")
 	void SubscribeToQuantizationEvent(EQuartzCommandQuantization InQuantizationBoundary, const FOnQuartzMetronomeEventBP& OnQuantizationEvent);
@@ -108,8 +166,21 @@ public:
 
 protected:
 
+	// Idle components, most recently returned last
 	UPROPERTY(Transient)
-	TArray<UAudioComponent*> ComponentPool;
+	TArray<FUnderscorePooledComponent> FreeComponents;
+
+	// Prepared components, and FPlatformTime::Seconds() when they were prepared
+	UPROPERTY(Transient)
+	TMap<UAudioComponent*, double> InUseComponents;
+
+	// Idle components are destroyed after this many seconds. Negative to never trim
+	UPROPERTY(Config)
+	float PoolIdleTrimSeconds = 30.f;
+
+	int32 NumComponentAllocations = 0;
+	int32 NumComponentsTrimmed = 0;
+	double LastPoolTrimTime = 0.0;
 
 	UPROPERTY(Transient)
 	UUnderscoreCueBehavior* CueManager = nullptr;
@@ -120,6 +191,13 @@ protected:
 	UPROPERTY(Transient)
 	FGameplayTagContainer ActiveStates;
 
+	uint32 StatesSerial = 0;
+
 	UFUNCTION()
 	UAudioComponent* CreateNewAudioComponent(USoundBase* Sound);
+
+	void HandleComponentFinished(UAudioComponent* Component);
+
+	// Destroys components idle for longer than PoolIdleTrimSeconds, and reclaims prepared ones that never played
+	void TrimComponentPool(const double Now);
 };
\ No newline at end of file
@@ -0,0 +1,142 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "GameplayTagContainer.h"
+#include "HAL/Platform.h"
+#include "UObject/GCObject.h"
+#include "UObject/NameTypes.h"
+#include "UnderscoreCueBehavior.h"
+#include "UnderscoreSection.h"
+
+#include "UnderscoreTransportSimulator.generated.h"
+
+class UAudioComponent;
+class USoundBase;
+class UUnderscoreCue;
+class UUnderscoreSubsystem;
+
+// A clip the Cue scheduled while simulated
+USTRUCT()
+struct FUnderscoreSimulatedPlay
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	USoundBase* Sound = nullptr;
+
+	float Volume = 1.f;
+
+	// Beat the clip starts on, counting from the first simulated beat
+	int32 TargetBeat = 0;
+
+	// Cue transport at TargetBeat
+	FUnderscoreTransport Transport;
+};
+
+// A simulated clip that hasn't finished yet
+USTRUCT()
+struct FUnderscoreSimulatedClip
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	UAudioComponent* Component = nullptr;
+
+	// Beat on which the clip finishes. MAX_int32 for clips that never do on their own
+	int32 EndBeat = 0;
+};
+
+// The default Cue behavior, with clips played on unregistered components instead of the Quartz clock
+// Every clip keeps going through the regular scheduling bookkeeping, and finishes once its sound's duration has elapsed
+UCLASS(Transient, NotBlueprintable, HideDropdown)
+class UNDERSCORE_API UUnderscoreSimulatedCueBehavior : public UUnderscoreCueBehavior
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnQuartzBeat_Implementation(FName ClockName, EQuartzCommandQuantization QuantizationType, int32 NumBars, int32 Beat, float BeatFraction) override;
+	virtual void Stop_Implementation(float FadeTime) override;
+
+	const TArray<FUnderscoreSimulatedPlay>& GetScheduledPlays() const { return ScheduledPlays; }
+	void ResetScheduledPlays() { ScheduledPlays.Reset(); }
+
+	int32 GetNumPlayingClips() const { return PlayingClips.Num(); }
+
+protected:
+	virtual UAudioComponent* PrepareClipComponent(USoundBase* Sound) override;
+	virtual void PlayClipNextBeat(UAudioComponent* Component, const float Volume) override;
+
+	// Finishes the clips whose EndBeat is InBeat or earlier
+	void FinishClips(const int32 InBeat);
+
+	UPROPERTY(Transient)
+	TArray<FUnderscoreSimulatedPlay> ScheduledPlays;
+
+	UPROPERTY(Transient)
+	TArray<FUnderscoreSimulatedClip> PlayingClips;
+
+	// Components back from finished clips
+	UPROPERTY(Transient)
+	TArray<UAudioComponent*> FreeComponents;
+};
+
+struct FUnderscoreSimulatorStats
+{
+	int32 NumBeats = 0;
+
+	// Time spent in OnQuartzBeat
+	double TotalBeatSeconds = 0.0;
+	double MaxBeatSeconds = 0.0;
+
+	// Bytes OnQuartzBeat left allocated, as tracked by the low level memory tracker. Only counted when it is enabled
+	int64 TotalBeatBytes = 0;
+	int64 MaxBeatBytes = 0;
+
+	double GetAverageBeatSeconds() const { return NumBeats > 0 ? TotalBeatSeconds / NumBeats : 0.0; }
+};
+
+// Drives a Cue without a Quartz clock, world or audio device, so its beat path can be tested and benchmarked headless.
+// Beats are delivered through OnQuartzBeat as fast as requested, and every clip the Cue schedules is recorded with the
+// beat it targets. Cues with a ManagerClassOverride are simulated with the default behavior.
+class UNDERSCORE_API FUnderscoreTransportSimulator : public FGCObject
+{
+public:
+	explicit FUnderscoreTransportSimulator(UUnderscoreCue* InCue);
+	virtual ~FUnderscoreTransportSimulator();
+
+	FUnderscoreTransportSimulator(const FUnderscoreTransportSimulator&) = delete;
+	FUnderscoreTransportSimulator& operator=(const FUnderscoreTransportSimulator&) = delete;
+
+	// Delivers NumBeats beats in a row
+	void AdvanceBeats(const int32 NumBeats);
+
+	// Delivers the beats that would have happened in InSeconds at the Cue's BPM. Partial beats carry over to the next call
+	void AdvanceTime(const float InSeconds);
+
+	void SetState(const FGameplayTag InState);
+	void ClearState(const FGameplayTag InState);
+	void TriggerEvent(const FName EventName);
+
+	const TArray<FUnderscoreSimulatedPlay>& GetScheduledPlays() const;
+	void ResetScheduledPlays();
+
+	const FUnderscoreSimulatorStats& GetStats() const { return Stats; }
+	UUnderscoreSimulatedCueBehavior* GetBehavior() const { return Behavior; }
+	UUnderscoreSubsystem* GetSubsystem() const { return Subsystem; }
+
+	// FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	// end FGCObject
+
+private:
+	UUnderscoreCue* Cue = nullptr;
+	UUnderscoreSubsystem* Subsystem = nullptr;
+	UUnderscoreSimulatedCueBehavior* Behavior = nullptr;
+
+	FUnderscoreSimulatorStats Stats;
+
+	float PendingBeatSeconds = 0.f;
+};
@@ -28,6 +28,7 @@ AkAudioInput Delegates
 
 DECLARE_DELEGATE_RetVal_ThreeParams(bool, FAkGlobalAudioInputDelegate, uint32, uint32, float**);
 DECLARE_DELEGATE_OneParam(FAkGlobalAudioFormatDelegate, AkAudioFormat&);
+DECLARE_DELEGATE(FAkGlobalAudioInputEndDelegate);
 
 /*------------------------------------------------------------------------------------
 FAkAudioInputManager
@@ -45,6 +46,7 @@ public:
      * @param AudioSamplesDelegate Callback that fills the audio samples buffer
      * @param AudioFormatDelegate Callback that sets the audio format
      * @param AudioContext Context where this input is used (Editor, Player, or other)
+     * @param AudioEndDelegate Callback executed once the play ended, whether it stopped by itself or was stopped
      * @return ID assigned by Wwise SoundEngine
      */
     static AkPlayingID PostAudioInputEvent(
@@ -52,7 +54,8 @@ public:
 	    AActor* Actor,
 	    FAkGlobalAudioInputDelegate AudioSamplesDelegate,
 	    FAkGlobalAudioFormatDelegate AudioFormatDelegate,
-        EAkAudioContext AudioContext = EAkAudioContext::Foreign
+        EAkAudioContext AudioContext = EAkAudioContext::Foreign,
+		FAkGlobalAudioInputEndDelegate AudioEndDelegate = FAkGlobalAudioInputEndDelegate()
     );
 
 	/**
@@ -63,6 +66,7 @@ public:
 	 * @param AudioSamplesDelegate Callback that fills the audio samples buffer
 	 * @param AudioFormatDelegate Callback that sets the audio format
      * @param AudioContext Context where this input is used (Editor, Player, or other)
+     * @param AudioEndDelegate Callback executed once the play ended, whether it stopped by itself or was stopped
      * @return ID assigned by Wwise SoundEngine
 	 */
 	static AkPlayingID PostAudioInputEvent(
@@ -70,7 +74,8 @@ public:
 		UAkComponent* Component,
 		FAkGlobalAudioInputDelegate AudioSamplesDelegate,
 		FAkGlobalAudioFormatDelegate AudioFormatDelegate,
-        EAkAudioContext AudioContext = EAkAudioContext::Foreign
+        EAkAudioContext AudioContext = EAkAudioContext::Foreign,
+		FAkGlobalAudioInputEndDelegate AudioEndDelegate = FAkGlobalAudioInputEndDelegate()
 	);
 
 	/**
@@ -81,6 +86,7 @@ public:
 	 * @param AudioSamplesDelegate Callback that fills the audio samples buffer
 	 * @param AudioFormatDelegate Callback that sets the audio format
      * @param AudioContext Context where this input is used (Editor, Player, or other)
+     * @param AudioEndDelegate Callback executed once the play ended, whether it stopped by itself or was stopped
      * @return ID assigned by Wwise SoundEngine
 	 */
 	static AkPlayingID PostAudioInputEvent(
@@ -88,7 +94,8 @@ public:
 		AkGameObjectID GameObject,
 		FAkGlobalAudioInputDelegate AudioSamplesDelegate,
 		FAkGlobalAudioFormatDelegate AudioFormatDelegate,
-        EAkAudioContext AudioContext = EAkAudioContext::Foreign
+        EAkAudioContext AudioContext = EAkAudioContext::Foreign,
+		FAkGlobalAudioInputEndDelegate AudioEndDelegate = FAkGlobalAudioInputEndDelegate()
 	);
 
 	/**
@@ -98,13 +105,15 @@ public:
 	 * @param AudioSamplesDelegate Callback that fills the audio samples buffer
 	 * @param AudioFormatDelegate Callback that sets the audio format
      * @param AudioContext Context where this input is used (Editor, Player, or other)
+     * @param AudioEndDelegate Callback executed once the play ended, whether it stopped by itself or was stopped
      * @return ID assigned by Wwise SoundEngine
 	 */
 	static AkPlayingID PostAudioInputEvent(
 		UAkAudioEvent* Event,
 		FAkGlobalAudioInputDelegate AudioSamplesDelegate,
 		FAkGlobalAudioFormatDelegate AudioFormatDelegate,
-        EAkAudioContext AudioContext = EAkAudioContext::Foreign
+        EAkAudioContext AudioContext = EAkAudioContext::Foreign,
+		FAkGlobalAudioInputEndDelegate AudioEndDelegate = FAkGlobalAudioInputEndDelegate()
 	);
 
     // ReSharper disable once CppDoxygenUnresolvedReference
@@ -343,6 +343,10 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Initialization", meta=(ConfigRestartRequired=true, EditCondition="AudioRouting == EAkUnrealAudioRouting::Custom"))
 	bool bAkAudioMixerEnabled = false;
 
+	// Amount of media memory, in KB, kept loaded after its last user unloads it, so it can be reused without reloading. 0 disables it.
+	UPROPERTY(Config, EditAnywhere, Category = "Initialization", meta = (ClampMin = "0", ConfigRestartRequired=true))
+	int32 MediaResidencyBudgetKB = 0;
+
 	// The default value of the "Attenuation Scaling Factor" when an AkComponent is created.
 	UPROPERTY(Config, EditAnywhere, Category = "Initialization", meta = (ClampMin = "0.0"))
 	float DefaultScalingFactor = 1.0f;
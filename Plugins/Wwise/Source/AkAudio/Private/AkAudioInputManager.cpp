@@ -38,6 +38,7 @@ struct FAudioInputDelegates
 {
 	FAkGlobalAudioInputDelegate AudioSamplesDelegate;
 	FAkGlobalAudioFormatDelegate AudioFormatDelegate;
+	FAkGlobalAudioInputEndDelegate AudioEndDelegate;
 };
 
 /*------------------------------------------------------------------------------------
@@ -195,16 +196,18 @@ namespace FAkAudioInputHelpers
 
 	static void AddAudioInputPlayingID(AkPlayingID PlayingID,
 		FAkGlobalAudioInputDelegate AudioSamplesDelegate,
-		FAkGlobalAudioFormatDelegate AudioFormatDelegate)
+		FAkGlobalAudioFormatDelegate AudioFormatDelegate,
+		FAkGlobalAudioInputEndDelegate AudioEndDelegate)
 	{
 		FScopeLock MapLock(&MapSection);
-		AudioInputDelegates.Add((uint32)PlayingID, { AudioSamplesDelegate, AudioFormatDelegate });
+		AudioInputDelegates.Add((uint32)PlayingID, { AudioSamplesDelegate, AudioFormatDelegate, AudioEndDelegate });
 	}
 
 	/* Posts an event and associates the AudioSamplesDelegate and AudioFormatDelegate delegates with the resulting playing id. */
 	AkPlayingID PostAudioInputEvent(TFunction<AkPlayingID(FAkAudioDevice* AkDevice)> PostEventCall,
 							        FAkGlobalAudioInputDelegate AudioSamplesDelegate,
-							        FAkGlobalAudioFormatDelegate AudioFormatDelegate)
+							        FAkGlobalAudioFormatDelegate AudioFormatDelegate,
+							        FAkGlobalAudioInputEndDelegate AudioEndDelegate)
 	{
 		TryInitialize();
 		AkPlayingID PlayingID = AK_INVALID_PLAYING_ID;
@@ -214,7 +217,7 @@ namespace FAkAudioInputHelpers
 			PlayingID = PostEventCall(AkDevice);
 			if (PlayingID != AK_INVALID_PLAYING_ID)
 			{
-				AddAudioInputPlayingID(PlayingID, AudioSamplesDelegate, AudioFormatDelegate);
+				AddAudioInputPlayingID(PlayingID, AudioSamplesDelegate, AudioFormatDelegate, AudioEndDelegate);
 			}
 		}
 		return PlayingID;
@@ -229,10 +232,12 @@ namespace FAkAudioInputHelpers
 			{
 				uint32 PlayingID = (uint32)EventInfo->playingID;
 
+				FAudioInputDelegates Delegates;
 				{
 					FScopeLock MapLock(&MapSection);
-					AudioInputDelegates.Remove(PlayingID);
+					AudioInputDelegates.RemoveAndCopyValue(PlayingID, Delegates);
 				}
+				Delegates.AudioEndDelegate.ExecuteIfBound();
 			}
 		}
 	}
@@ -247,7 +252,8 @@ AkPlayingID FAkAudioInputManager::PostAudioInputEvent(
     AActor * Actor,
     FAkGlobalAudioInputDelegate AudioSamplesDelegate,
     FAkGlobalAudioFormatDelegate AudioFormatDelegate,
-	EAkAudioContext AudioContext
+	EAkAudioContext AudioContext,
+	FAkGlobalAudioInputEndDelegate AudioEndDelegate
 )
 {
 	if (!IsValid(Event))
@@ -277,7 +283,7 @@ AkPlayingID FAkAudioInputManager::PostAudioInputEvent(
 		UE_CLOG(LIKELY(Result != AK_INVALID_PLAYING_ID), LogAkAudio, VeryVerbose,
 			TEXT("FAkAudioInputManager::PostAudioInputEvent: Posted input event %s to actor %s. PlayId=%" PRIu32), *Event->GetName(), *Actor->GetName(), Result);
 		return Result;
-	}, AudioSamplesDelegate, AudioFormatDelegate);
+	}, AudioSamplesDelegate, AudioFormatDelegate, AudioEndDelegate);
 }
 
 AkPlayingID FAkAudioInputManager::PostAudioInputEvent(
@@ -285,7 +291,8 @@ AkPlayingID FAkAudioInputManager::PostAudioInputEvent(
 	UAkComponent* Component,
 	FAkGlobalAudioInputDelegate AudioSamplesDelegate,
 	FAkGlobalAudioFormatDelegate AudioFormatDelegate,
-	EAkAudioContext AudioContext)
+	EAkAudioContext AudioContext,
+	FAkGlobalAudioInputEndDelegate AudioEndDelegate)
 {
 	if (!IsValid(Event))
 	{
@@ -314,7 +321,7 @@ AkPlayingID FAkAudioInputManager::PostAudioInputEvent(
 		UE_CLOG(LIKELY(Result != AK_INVALID_PLAYING_ID), LogAkAudio, VeryVerbose,
 			TEXT("FAkAudioInputManager::PostAudioInputEvent: Posted input event %s to component %s. PlayId=%" PRIu32), *Event->GetName(), *Component->GetName(), Result);
 		return Result;
-	}, AudioSamplesDelegate, AudioFormatDelegate);
+	}, AudioSamplesDelegate, AudioFormatDelegate, AudioEndDelegate);
 }
 
 AkPlayingID FAkAudioInputManager::PostAudioInputEvent(
@@ -322,7 +329,8 @@ AkPlayingID FAkAudioInputManager::PostAudioInputEvent(
 	AkGameObjectID GameObject,
 	FAkGlobalAudioInputDelegate AudioSamplesDelegate,
 	FAkGlobalAudioFormatDelegate AudioFormatDelegate,
-	EAkAudioContext AudioContext)
+	EAkAudioContext AudioContext,
+	FAkGlobalAudioInputEndDelegate AudioEndDelegate)
 {
 	if (!IsValid(Event))
 	{
@@ -349,12 +357,13 @@ AkPlayingID FAkAudioInputManager::PostAudioInputEvent(
 		UE_CLOG(LIKELY(Result != AK_INVALID_PLAYING_ID), LogAkAudio, VeryVerbose,
 			TEXT("FAkAudioInputManager::PostAudioInputEvent: Posted input event %s to %" PRIu64 ". PlayId=%" PRIu32), *Event->GetName(), GameObject, Result);
 		return Result;
-	}, AudioSamplesDelegate, AudioFormatDelegate);
+	}, AudioSamplesDelegate, AudioFormatDelegate, AudioEndDelegate);
 }
 
 AkPlayingID FAkAudioInputManager::PostAudioInputEvent(UAkAudioEvent* Event,
 	FAkGlobalAudioInputDelegate AudioSamplesDelegate, FAkGlobalAudioFormatDelegate AudioFormatDelegate,
-	EAkAudioContext AudioContext)
+	EAkAudioContext AudioContext,
+	FAkGlobalAudioInputEndDelegate AudioEndDelegate)
 {
 	if (!IsValid(Event))
 	{
@@ -375,10 +384,15 @@ AkPlayingID FAkAudioInputManager::PostAudioInputEvent(UAkAudioEvent* Event,
 		UE_CLOG(LIKELY(Result != AK_INVALID_PLAYING_ID), LogAkAudio, VeryVerbose,
 			TEXT("FAkAudioInputManager::PostAudioInputEvent: Posted ambient input event %s. PlayId=%" PRIu32), *Event->GetName(), Result);
 		return Result;
-	}, AudioSamplesDelegate, AudioFormatDelegate);
+	}, AudioSamplesDelegate, AudioFormatDelegate, AudioEndDelegate);
 }
 
 void FAkAudioInputManager::Stop(uint32 PlayingId)
 {
-	FAkAudioInputHelpers::AudioInputDelegates.Remove(PlayingId);
+	FAudioInputDelegates Delegates;
+	{
+		FScopeLock MapLock(&FAkAudioInputHelpers::MapSection);
+		FAkAudioInputHelpers::AudioInputDelegates.RemoveAndCopyValue(PlayingId, Delegates);
+	}
+	Delegates.AudioEndDelegate.ExecuteIfBound();
 }
@@ -32,6 +32,7 @@ public class AkAudioMixer : ModuleRules
 
 				"AudioMixer",
 				"AudioMixerCore",
+				"SignalProcessing",
 #if UE_5_0_OR_LATER
 				"BinkAudioDecoder",
 #endif
@@ -0,0 +1,134 @@
+/*******************************************************************************
+The content of this file includes portions of the proprietary AUDIOKINETIC Wwise
+Technology released in source code form as part of the game integration package.
+The content of this file may not be used without valid licenses to the
+AUDIOKINETIC Wwise Technology.
+Note that the use of the game engine is subject to the Unreal(R) Engine End User
+License Agreement at https://www.unrealengine.com/en-US/eula/unreal
+
+License Usage
+
+Licensees holding valid licenses to the AUDIOKINETIC Wwise Technology may use
+this file in accordance with the end user license agreement provided with the
+software or, alternatively, in accordance with the terms contained
+in a written agreement between you and Audiokinetic Inc.
+Copyright (c) 2024 Audiokinetic Inc.
+*******************************************************************************/
+
+#include "AkMixerBufferRing.h"
+
+#include "WwiseUnrealDefines.h"
+
+#if UE_5_1_OR_LATER
+#include "DSP/FloatArrayMath.h"
+#endif
+
+void FAkMixerBufferRing::Initialize(int32 InNumChannels, int32 InNumFrames, int32 InNumSlots)
+{
+	check(InNumChannels > 0 && InNumFrames > 0 && InNumSlots > 0);
+
+	NumChannels = InNumChannels;
+	NumFrames = InNumFrames;
+	NumSlots = InNumSlots;
+	ChannelStride = Align(InNumFrames, AUDIO_NUM_FLOATS_PER_VECTOR_REGISTER);
+
+	Storage.SetNumUninitialized(NumSlots * NumChannels * ChannelStride);
+	ChannelPointers.SetNumUninitialized(NumSlots * NumChannels);
+	for (int32 Plane = 0; Plane < ChannelPointers.Num(); ++Plane)
+	{
+		ChannelPointers[Plane] = Storage.GetData() + Plane * ChannelStride;
+	}
+
+	Reset();
+}
+
+void FAkMixerBufferRing::Reset()
+{
+	WriteIndex.store(0, std::memory_order_relaxed);
+	ReadIndex.store(0, std::memory_order_relaxed);
+	NumUnderruns.store(0, std::memory_order_relaxed);
+	NumOverruns.store(0, std::memory_order_relaxed);
+}
+
+int32 FAkMixerBufferRing::GetNumQueued() const
+{
+	return (int32)(WriteIndex.load(std::memory_order_acquire) - ReadIndex.load(std::memory_order_acquire));
+}
+
+bool FAkMixerBufferRing::Push(const float* InInterleaved)
+{
+	if (UNLIKELY(!IsInitialized()))
+	{
+		return false;
+	}
+
+	const uint32 Write = WriteIndex.load(std::memory_order_relaxed);
+	const uint32 Read = ReadIndex.load(std::memory_order_acquire);
+	if (UNLIKELY(Write - Read >= (uint32)NumSlots))
+	{
+		NumOverruns.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	float* const* SlotChannels = &ChannelPointers[(Write % NumSlots) * NumChannels];
+	Deinterleave(InInterleaved, SlotChannels, NumChannels, NumFrames);
+
+	WriteIndex.store(Write + 1, std::memory_order_release);
+	return true;
+}
+
+bool FAkMixerBufferRing::Pop(float* const* OutChannelBuffers)
+{
+	if (UNLIKELY(!IsInitialized()))
+	{
+		return false;
+	}
+
+	const uint32 Read = ReadIndex.load(std::memory_order_relaxed);
+	const uint32 Write = WriteIndex.load(std::memory_order_acquire);
+	if (UNLIKELY(Read == Write))
+	{
+		NumUnderruns.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	float* const* SlotChannels = &ChannelPointers[(Read % NumSlots) * NumChannels];
+	for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+	{
+		FMemory::Memcpy(OutChannelBuffers[Channel], SlotChannels[Channel], NumFrames * sizeof(float));
+	}
+
+	ReadIndex.store(Read + 1, std::memory_order_release);
+	return true;
+}
+
+void FAkMixerBufferRing::Deinterleave(const float* InInterleaved, float* const* OutChannelBuffers, int32 InNumChannels, int32 InNumFrames)
+{
+	// The two-channel kernel works on whole vector registers.
+	const bool bVectorFrames = (InNumFrames % AUDIO_NUM_FLOATS_PER_VECTOR_REGISTER) == 0;
+
+	if (InNumChannels == 1)
+	{
+		FMemory::Memcpy(OutChannelBuffers[0], InInterleaved, InNumFrames * sizeof(float));
+	}
+	else if (InNumChannels == 2 && bVectorFrames)
+	{
+		Audio::BufferDeinterleave2ChannelFast(InInterleaved, OutChannelBuffers[0], OutChannelBuffers[1], InNumFrames);
+	}
+	else
+	{
+#if UE_5_1_OR_LATER
+		Audio::ArrayDeinterleave(InInterleaved, OutChannelBuffers, InNumFrames, InNumChannels);
+#else
+		for (int32 Channel = 0; Channel < InNumChannels; ++Channel)
+		{
+			const float* RESTRICT Source = InInterleaved + Channel;
+			float* RESTRICT Destination = OutChannelBuffers[Channel];
+			for (int32 Frame = 0; Frame < InNumFrames; ++Frame)
+			{
+				Destination[Frame] = Source[Frame * InNumChannels];
+			}
+		}
+#endif
+	}
+}
@@ -28,6 +28,8 @@ Copyright (c) 2024 Audiokinetic Inc.
 #include "CoreGlobals.h"
 #include "UObject/UObjectGlobals.h"
 
+#include <inttypes.h>
+
 #if WITH_ENGINE && !UE_5_4_OR_LATER
 #include "AudioPluginUtilities.h"
 #include "OpusAudioInfo.h"
@@ -55,7 +57,7 @@ FAkMixerPlatform::FAkMixerPlatform() :
 	bIsInitialized(false),
 	bIsDeviceOpen(false),
 	InputEvent(nullptr),
-	OutputBuffer(nullptr),
+	bIsConsumingBuffers(false),
 	OutputBufferByteLength(0)
 {
 #if !WITH_EDITOR && !UE_5_4_OR_LATER
@@ -83,12 +85,8 @@ void FAkMixerPlatform::WriteSilence(uint32 NumChannels, uint32 NumSamples, float
 {
 	for (uint32 Channel = 0; Channel < NumChannels; Channel++)
 	{
-		for (uint32 Sample = 0; Sample < NumSamples; Sample++)
-		{
-			OutBufferToFill[Channel][Sample] = 0;
-		}
+		FMemory::Memzero(OutBufferToFill[Channel], NumSamples * sizeof(float));
 	}
-
 }
 
 bool FAkMixerPlatform::OnNextBuffer(uint32 NumChannels, uint32 NumSamples, float** OutBufferToFill)
@@ -105,7 +103,7 @@ bool FAkMixerPlatform::OnNextBuffer(uint32 NumChannels, uint32 NumSamples, float
 			AudioStreamInfo.StreamState == Audio::EAudioOutputStreamState::Stopping ? TEXT("Stopping") : TEXT("Unknown"));
 
 		bFailureShown = true;
-		OutputBuffer = nullptr;
+		bIsConsumingBuffers.store(false, std::memory_order_release);
 		WriteSilence(NumChannels, NumSamples, OutBufferToFill);
 		ReadNextBuffer();
 		return true;
@@ -121,7 +119,7 @@ bool FAkMixerPlatform::OnNextBuffer(uint32 NumChannels, uint32 NumSamples, float
 			AudioStreamInfo.StreamState == Audio::EAudioOutputStreamState::Stopping ? TEXT("Stopping") : TEXT("Unknown"));
 
 		bFailureShown = true;
-		OutputBuffer = nullptr;
+		bIsConsumingBuffers.store(false, std::memory_order_release);
 		WriteSilence(NumChannels, NumSamples, OutBufferToFill);
 		ReadNextBuffer();
 		return true;
@@ -156,8 +154,14 @@ bool FAkMixerPlatform::OnNextBuffer(uint32 NumChannels, uint32 NumSamples, float
 		return false;
 	}
 
-	OutputBuffer = OutBufferToFill;
+	// ReadNextBuffer makes the mixer produce its next buffer into the ring through SubmitBuffer.
+	bIsConsumingBuffers.store(true, std::memory_order_release);
 	ReadNextBuffer();
+
+	if (UNLIKELY(!BufferRing.Pop(OutBufferToFill)))
+	{
+		WriteSilence(NumChannels, NumSamples, OutBufferToFill);
+	}
 	return true;
 }
 
@@ -270,6 +274,7 @@ bool FAkMixerPlatform::OpenAudioStream(const Audio::FAudioMixerOpenStreamParams&
 	}
 
 	OutputBufferByteLength = OpenStreamParams.NumFrames * AudioStreamInfo.DeviceInfo.NumChannels * GetAudioStreamChannelSize();
+	BufferRing.Initialize(AudioStreamInfo.DeviceInfo.NumChannels, OpenStreamParams.NumFrames);
 
 	UE_LOG(LogAkAudioMixer, Verbose, TEXT("Opening Audio stream for device: %s"), *GetDeviceId())
 
@@ -343,11 +348,12 @@ bool FAkMixerPlatform::CloseAudioStream()
 		StopRunningNullDevice();
 	}
 
-	{
-		FScopeLock ScopedLock(&OutputBufferMutex);
-		OutputBuffer = nullptr;
-		OutputBufferByteLength = 0;
-	}
+	bIsConsumingBuffers.store(false, std::memory_order_release);
+	OutputBufferByteLength = 0;
+
+	UE_CLOG(BufferRing.GetNumUnderruns() > 0 || BufferRing.GetNumOverruns() > 0, LogAkAudioMixer, Verbose,
+		TEXT("Audio stream for device %s had %" PRIu64 " buffer underruns and %" PRIu64 " buffer overruns."),
+		*GetDeviceId(), BufferRing.GetNumUnderruns(), BufferRing.GetNumOverruns());
 
 	if (FAkAudioDevice::IsInitialized())
 	{
@@ -422,19 +428,10 @@ Audio::FAudioPlatformDeviceInfo FAkMixerPlatform::GetPlatformDeviceInfo() const
 
 void FAkMixerPlatform::SubmitBuffer(const uint8* Buffer)
 {
-	FScopeLock ScopedLock(&OutputBufferMutex);
-
-	if (OutputBuffer)
+	// Buffers produced while Wwise isn't consuming them (null device, failed state) are discarded.
+	if (bIsConsumingBuffers.load(std::memory_order_acquire))
 	{
-		for (int32 Channel = 0; Channel < AudioStreamInfo.DeviceInfo.NumChannels; Channel++)
-		{
-			for (int32 Frame = 0; Frame < AudioStreamInfo.NumOutputFrames; Frame++)
-			{
-				FMemory::Memcpy(&OutputBuffer[Channel][Frame],
-					&Buffer[sizeof(float) * ((AudioStreamInfo.DeviceInfo.NumChannels * Frame) + Channel)],
-					sizeof(float));
-			}
-		}
+		BufferRing.Push(reinterpret_cast<const float*>(Buffer));
 	}
 }
 
@@ -0,0 +1,92 @@
+/*******************************************************************************
+The content of this file includes portions of the proprietary AUDIOKINETIC Wwise
+Technology released in source code form as part of the game integration package.
+The content of this file may not be used without valid licenses to the
+AUDIOKINETIC Wwise Technology.
+Note that the use of the game engine is subject to the Unreal(R) Engine End User
+License Agreement at https://www.unrealengine.com/en-US/eula/unreal
+
+License Usage
+
+Licensees holding valid licenses to the AUDIOKINETIC Wwise Technology may use
+this file in accordance with the end user license agreement provided with the
+software or, alternatively, in accordance with the terms contained
+in a written agreement between you and Audiokinetic Inc.
+Copyright (c) 2024 Audiokinetic Inc.
+*******************************************************************************/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DSP/BufferVectorOperations.h"
+
+#include <atomic>
+
+/**
+ * Single-producer/single-consumer ring of preallocated planar buffers.
+ *
+ * The producer is the Unreal mixer (through FAkMixerPlatform::SubmitBuffer), which deinterleaves a whole mixer
+ * buffer into the next free slot. The consumer is the Wwise audio input callback, which copies the oldest slot
+ * into Wwise's channel buffers. Neither side locks or allocates once the ring is initialized.
+ */
+class FAkMixerBufferRing
+{
+public:
+	static constexpr int32 DefaultNumSlots = 4;
+
+	FAkMixerBufferRing() = default;
+	FAkMixerBufferRing(const FAkMixerBufferRing&) = delete;
+	FAkMixerBufferRing& operator=(const FAkMixerBufferRing&) = delete;
+
+	/**
+	 * Allocates NumSlots planar buffers of InNumChannels x InNumFrames.
+	 * Not thread-safe: neither the producer nor the consumer must be running.
+	 */
+	void Initialize(int32 InNumChannels, int32 InNumFrames, int32 InNumSlots = DefaultNumSlots);
+
+	/** Drops all queued buffers and resets the counters. Not thread-safe. */
+	void Reset();
+
+	bool IsInitialized() const { return NumChannels > 0 && NumFrames > 0; }
+	int32 GetNumChannels() const { return NumChannels; }
+	int32 GetNumFrames() const { return NumFrames; }
+	int32 GetNumSlots() const { return NumSlots; }
+	int32 GetNumQueued() const;
+
+	/**
+	 * Producer side. Deinterleaves NumChannels x NumFrames samples into the next free slot.
+	 * @return false, and counts an overrun, when every slot is already queued. The buffer is dropped.
+	 */
+	bool Push(const float* InInterleaved);
+
+	/**
+	 * Consumer side. Copies the oldest queued slot into OutChannelBuffers.
+	 * @return false, and counts an underrun, when nothing is queued. OutChannelBuffers is left untouched.
+	 */
+	bool Pop(float* const* OutChannelBuffers);
+
+	uint64 GetNumUnderruns() const { return NumUnderruns.load(std::memory_order_relaxed); }
+	uint64 GetNumOverruns() const { return NumOverruns.load(std::memory_order_relaxed); }
+
+	/** Deinterleaves InNumFrames frames of InNumChannels channels using the vectorized Audio helpers when possible. */
+	static void Deinterleave(const float* InInterleaved, float* const* OutChannelBuffers, int32 InNumChannels, int32 InNumFrames);
+
+private:
+	int32 NumChannels = 0;
+	int32 NumFrames = 0;
+	int32 NumSlots = 0;
+
+	/** NumSlots x NumChannels planes of ChannelStride floats. Each plane starts on a vector boundary. */
+	Audio::AlignedFloatBuffer Storage;
+	int32 ChannelStride = 0;
+
+	/** NumSlots x NumChannels pointers into Storage, so Push doesn't have to compute them. */
+	TArray<float*> ChannelPointers;
+
+	/** Monotonic indices. Only the producer writes WriteIndex, only the consumer writes ReadIndex. */
+	std::atomic<uint32> WriteIndex{ 0 };
+	std::atomic<uint32> ReadIndex{ 0 };
+
+	std::atomic<uint64> NumUnderruns{ 0 };
+	std::atomic<uint64> NumOverruns{ 0 };
+};
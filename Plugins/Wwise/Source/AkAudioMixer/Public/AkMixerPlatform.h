@@ -18,8 +18,11 @@ Copyright (c) 2024 Audiokinetic Inc.
 #pragma once
 
 #include "AudioMixer.h"
+#include "AkMixerBufferRing.h"
 #include "WwiseUnrealDefines.h"
 
+#include <atomic>
+
 class FAudioMixerInputComponent;
 class UAkAudioEvent;
 
@@ -61,14 +64,17 @@ public:
 	FString GetDeviceId() const;
 	virtual FAudioPlatformSettings GetPlatformSettings() const override;
 
+	uint64 GetNumBufferUnderruns() const { return BufferRing.GetNumUnderruns(); }
+	uint64 GetNumBufferOverruns() const { return BufferRing.GetNumOverruns(); }
+
 private:
 	FAudioMixerInputComponent* AkAudioMixerInputComponent;
 	bool bIsInitialized;
 	bool bIsDeviceOpen;
 	UAkAudioEvent* InputEvent;
-	float** OutputBuffer;
+	FAkMixerBufferRing BufferRing;
+	std::atomic<bool> bIsConsumingBuffers;
 	int OutputBufferByteLength;
-	FCriticalSection OutputBufferMutex;
 	FDelegateHandle AkAudioModuleInitHandle;
 
 	void OnAkAudioModuleInit();
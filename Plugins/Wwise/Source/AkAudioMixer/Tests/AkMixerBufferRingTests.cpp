@@ -0,0 +1,195 @@
+/*******************************************************************************
+The content of this file includes portions of the proprietary AUDIOKINETIC Wwise
+Technology released in source code form as part of the game integration package.
+The content of this file may not be used without valid licenses to the
+AUDIOKINETIC Wwise Technology.
+Note that the use of the game engine is subject to the Unreal(R) Engine End User
+License Agreement at https://www.unrealengine.com/en-US/eula/unreal
+
+License Usage
+
+Licensees holding valid licenses to the AUDIOKINETIC Wwise Technology may use
+this file in accordance with the end user license agreement provided with the
+software or, alternatively, in accordance with the terms contained
+in a written agreement between you and Audiokinetic Inc.
+Copyright (c) 2024 Audiokinetic Inc.
+*******************************************************************************/
+
+#include "Wwise/WwiseUnitTests.h"
+
+#if WWISE_UNIT_TESTS
+#include "AkMixerBufferRing.h"
+
+namespace AkMixerBufferRingTests
+{
+	// Every sample has a unique value: Frame in the integer part, Channel in the fraction.
+	static float SampleValue(int32 Buffer, int32 Frame, int32 Channel)
+	{
+		return (float)(Buffer * 10000 + Frame) + (float)Channel / 16.f;
+	}
+
+	static void FillInterleaved(TArray<float>& Interleaved, int32 Buffer, int32 NumChannels, int32 NumFrames)
+	{
+		Interleaved.SetNumUninitialized(NumChannels * NumFrames);
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Interleaved[Frame * NumChannels + Channel] = SampleValue(Buffer, Frame, Channel);
+			}
+		}
+	}
+
+	struct FPlanarOutput
+	{
+		TArray<TArray<float>> Channels;
+		TArray<float*> Pointers;
+
+		FPlanarOutput(int32 NumChannels, int32 NumFrames)
+		{
+			Channels.SetNum(NumChannels);
+			for (auto& Channel : Channels)
+			{
+				Channel.SetNumZeroed(NumFrames);
+				Pointers.Add(Channel.GetData());
+			}
+		}
+
+		bool Matches(int32 Buffer, int32 NumFrames) const
+		{
+			for (int32 Channel = 0; Channel < Channels.Num(); ++Channel)
+			{
+				for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+				{
+					if (Channels[Channel][Frame] != SampleValue(Buffer, Frame, Channel))
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+	};
+}
+
+WWISE_TEST_CASE(AkAudioMixer_BufferRing_Smoke, "Wwise::AkAudioMixer::BufferRing_Smoke", "[ApplicationContextMask][SmokeFilter]")
+{
+	using namespace AkMixerBufferRingTests;
+
+	SECTION("Static")
+	{
+		static_assert(!std::is_copy_constructible<FAkMixerBufferRing>::value, "Cannot copy a Buffer Ring");
+		static_assert(!std::is_copy_assignable<FAkMixerBufferRing>::value, "Cannot assign a Buffer Ring");
+	}
+
+	SECTION("Sample accuracy")
+	{
+		const int32 ChannelCounts[] = { 1, 2, 4, 6, 8 };
+		const int32 FrameCounts[] = { 256, 1024, 261 };
+		for (const int32 NumChannels : ChannelCounts)
+		{
+			for (const int32 NumFrames : FrameCounts)
+			{
+				FAkMixerBufferRing Ring;
+				Ring.Initialize(NumChannels, NumFrames);
+				FPlanarOutput Output(NumChannels, NumFrames);
+				TArray<float> Interleaved;
+
+				for (int32 Buffer = 0; Buffer < 3 * FAkMixerBufferRing::DefaultNumSlots; ++Buffer)
+				{
+					FillInterleaved(Interleaved, Buffer, NumChannels, NumFrames);
+					CHECK(Ring.Push(Interleaved.GetData()));
+					CHECK(Ring.Pop(Output.Pointers.GetData()));
+					CHECK(Output.Matches(Buffer, NumFrames));
+				}
+				CHECK(Ring.GetNumUnderruns() == 0);
+				CHECK(Ring.GetNumOverruns() == 0);
+			}
+		}
+	}
+
+	SECTION("Buffers are popped in order")
+	{
+		constexpr const int32 NumChannels = 6;
+		constexpr const int32 NumFrames = 512;
+		FAkMixerBufferRing Ring;
+		Ring.Initialize(NumChannels, NumFrames);
+		FPlanarOutput Output(NumChannels, NumFrames);
+		TArray<float> Interleaved;
+
+		for (int32 Buffer = 0; Buffer < Ring.GetNumSlots(); ++Buffer)
+		{
+			FillInterleaved(Interleaved, Buffer, NumChannels, NumFrames);
+			CHECK(Ring.Push(Interleaved.GetData()));
+		}
+		CHECK(Ring.GetNumQueued() == Ring.GetNumSlots());
+
+		for (int32 Buffer = 0; Buffer < Ring.GetNumSlots(); ++Buffer)
+		{
+			CHECK(Ring.Pop(Output.Pointers.GetData()));
+			CHECK(Output.Matches(Buffer, NumFrames));
+		}
+		CHECK(Ring.GetNumQueued() == 0);
+	}
+
+	SECTION("Underrun and overrun counters")
+	{
+		constexpr const int32 NumChannels = 2;
+		constexpr const int32 NumFrames = 128;
+		FAkMixerBufferRing Ring;
+		Ring.Initialize(NumChannels, NumFrames, 2);
+		FPlanarOutput Output(NumChannels, NumFrames);
+		TArray<float> Interleaved;
+		FillInterleaved(Interleaved, 0, NumChannels, NumFrames);
+
+		CHECK_FALSE(Ring.Pop(Output.Pointers.GetData()));
+		CHECK(Ring.GetNumUnderruns() == 1);
+
+		CHECK(Ring.Push(Interleaved.GetData()));
+		CHECK(Ring.Push(Interleaved.GetData()));
+		CHECK_FALSE(Ring.Push(Interleaved.GetData()));
+		CHECK(Ring.GetNumOverruns() == 1);
+
+		Ring.Reset();
+		CHECK(Ring.GetNumQueued() == 0);
+		CHECK(Ring.GetNumUnderruns() == 0);
+		CHECK(Ring.GetNumOverruns() == 0);
+	}
+}
+
+WWISE_TEST_CASE(AkAudioMixer_BufferRing_Perf, "Wwise::AkAudioMixer::BufferRing_Perf", "[ApplicationContextMask][PerfFilter]")
+{
+	using namespace AkMixerBufferRingTests;
+
+	SECTION("Throughput")
+	{
+		constexpr const int32 NumFrames = 1024;
+		constexpr const int32 LoopCount = 20000;
+		constexpr const int ExpectedUS = 1000000;
+
+		const int32 ChannelCounts[] = { 2, 6, 8 };
+		for (const int32 NumChannels : ChannelCounts)
+		{
+			FAkMixerBufferRing Ring;
+			Ring.Initialize(NumChannels, NumFrames);
+			FPlanarOutput Output(NumChannels, NumFrames);
+			TArray<float> Interleaved;
+			FillInterleaved(Interleaved, 0, NumChannels, NumFrames);
+
+			FDateTime StartTime = FDateTime::UtcNow();
+			for (int i = 0; i < LoopCount; ++i)
+			{
+				Ring.Push(Interleaved.GetData());
+				Ring.Pop(Output.Pointers.GetData());
+			}
+			FTimespan Duration = FDateTime::UtcNow() - StartTime;
+			WWISE_TEST_LOG("BufferRing %d channels: %dus < %dus", NumChannels, (int)Duration.GetTotalMicroseconds(), ExpectedUS);
+			CHECK(Duration.GetTotalMicroseconds() < ExpectedUS);
+			CHECK(Output.Matches(0, NumFrames));
+			CHECK(Ring.GetNumUnderruns() == 0);
+			CHECK(Ring.GetNumOverruns() == 0);
+		}
+	}
+}
+
+#endif // WWISE_UNIT_TESTS
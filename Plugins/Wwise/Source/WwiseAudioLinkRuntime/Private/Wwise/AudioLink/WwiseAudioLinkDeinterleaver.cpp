@@ -0,0 +1,205 @@
+/*******************************************************************************
+The content of this file includes portions of the proprietary AUDIOKINETIC Wwise
+Technology released in source code form as part of the game integration package.
+The content of this file may not be used without valid licenses to the
+AUDIOKINETIC Wwise Technology.
+Note that the use of the game engine is subject to the Unreal(R) Engine End User
+License Agreement at https://www.unrealengine.com/en-US/eula/unreal
+ 
+License Usage
+ 
+Licensees holding valid licenses to the AUDIOKINETIC Wwise Technology may use
+this file in accordance with the end user license agreement provided with the
+software or, alternatively, in accordance with the terms contained
+in a written agreement between you and Audiokinetic Inc.
+Copyright (c) 2024 Audiokinetic Inc.
+*******************************************************************************/
+
+
+#include "Wwise/AudioLink/WwiseAudioLinkDeinterleaver.h"
+
+#include "DSP/BufferVectorOperations.h"
+#include "Math/VectorRegister.h"
+
+namespace WwiseAudioLinkDeinterleaver
+{
+	constexpr int32 FramesPerVector = 4;
+
+	// Four frames of four channels, one frame per register, into one channel per register.
+	FORCEINLINE void Transpose4(const VectorRegister4Float& F0, const VectorRegister4Float& F1, const VectorRegister4Float& F2, const VectorRegister4Float& F3,
+		VectorRegister4Float& OutC0, VectorRegister4Float& OutC1, VectorRegister4Float& OutC2, VectorRegister4Float& OutC3)
+	{
+		const VectorRegister4Float Evens01 = VectorShuffle(F0, F1, 0, 2, 0, 2);
+		const VectorRegister4Float Odds01 = VectorShuffle(F0, F1, 1, 3, 1, 3);
+		const VectorRegister4Float Evens23 = VectorShuffle(F2, F3, 0, 2, 0, 2);
+		const VectorRegister4Float Odds23 = VectorShuffle(F2, F3, 1, 3, 1, 3);
+		OutC0 = VectorShuffle(Evens01, Evens23, 0, 2, 0, 2);
+		OutC1 = VectorShuffle(Odds01, Odds23, 0, 2, 0, 2);
+		OutC2 = VectorShuffle(Evens01, Evens23, 1, 3, 1, 3);
+		OutC3 = VectorShuffle(Odds01, Odds23, 1, 3, 1, 3);
+	}
+
+	// Four frames of three channels packed in three registers: [a0 b0 c0 a1] [b1 c1 a2 b2] [c2 a3 b3 c3]
+	FORCEINLINE void Deinterleave3(const VectorRegister4Float& X0, const VectorRegister4Float& X1, const VectorRegister4Float& X2,
+		VectorRegister4Float& OutA, VectorRegister4Float& OutB, VectorRegister4Float& OutC)
+	{
+		OutA = VectorShuffle(VectorShuffle(X0, X0, 0, 0, 3, 3), VectorShuffle(X1, X2, 2, 2, 1, 1), 0, 2, 0, 2);
+		OutB = VectorShuffle(VectorShuffle(X0, X1, 1, 1, 0, 0), VectorShuffle(X1, X2, 3, 3, 2, 2), 0, 2, 0, 2);
+		OutC = VectorShuffle(VectorShuffle(X0, X1, 2, 2, 1, 1), VectorShuffle(X2, X2, 0, 0, 3, 3), 0, 2, 0, 2);
+	}
+
+	void Deinterleave4(const float* RESTRICT In, float* const* Out, int32 Offset, int32 NumVectorFrames)
+	{
+		for (int32 Frame = 0; Frame < NumVectorFrames; Frame += FramesPerVector, In += 4 * FramesPerVector)
+		{
+			VectorRegister4Float C0, C1, C2, C3;
+			Transpose4(VectorLoad(In), VectorLoad(In + 4), VectorLoad(In + 8), VectorLoad(In + 12), C0, C1, C2, C3);
+			VectorStore(C0, Out[0] + Offset + Frame);
+			VectorStore(C1, Out[1] + Offset + Frame);
+			VectorStore(C2, Out[2] + Offset + Frame);
+			VectorStore(C3, Out[3] + Offset + Frame);
+		}
+	}
+
+	void Deinterleave6(const float* RESTRICT In, float* const* Out, int32 Offset, int32 NumVectorFrames)
+	{
+		for (int32 Frame = 0; Frame < NumVectorFrames; Frame += FramesPerVector, In += 6 * FramesPerVector)
+		{
+			const VectorRegister4Float R0 = VectorLoad(In);
+			const VectorRegister4Float R1 = VectorLoad(In + 4);
+			const VectorRegister4Float R2 = VectorLoad(In + 8);
+			const VectorRegister4Float R3 = VectorLoad(In + 12);
+			const VectorRegister4Float R4 = VectorLoad(In + 16);
+			const VectorRegister4Float R5 = VectorLoad(In + 20);
+
+			// Even samples hold channels 0, 2, 4 and odd samples hold channels 1, 3, 5, each as a 3-channel stream.
+			VectorRegister4Float C0, C1, C2, C3, C4, C5;
+			Deinterleave3(VectorShuffle(R0, R1, 0, 2, 0, 2), VectorShuffle(R2, R3, 0, 2, 0, 2), VectorShuffle(R4, R5, 0, 2, 0, 2), C0, C2, C4);
+			Deinterleave3(VectorShuffle(R0, R1, 1, 3, 1, 3), VectorShuffle(R2, R3, 1, 3, 1, 3), VectorShuffle(R4, R5, 1, 3, 1, 3), C1, C3, C5);
+
+			VectorStore(C0, Out[0] + Offset + Frame);
+			VectorStore(C1, Out[1] + Offset + Frame);
+			VectorStore(C2, Out[2] + Offset + Frame);
+			VectorStore(C3, Out[3] + Offset + Frame);
+			VectorStore(C4, Out[4] + Offset + Frame);
+			VectorStore(C5, Out[5] + Offset + Frame);
+		}
+	}
+
+	void Deinterleave8(const float* RESTRICT In, float* const* Out, int32 Offset, int32 NumVectorFrames)
+	{
+		for (int32 Frame = 0; Frame < NumVectorFrames; Frame += FramesPerVector, In += 8 * FramesPerVector)
+		{
+			// Split each frame into its even channels (0, 2, 4, 6) and its odd channels (1, 3, 5, 7).
+			VectorRegister4Float Evens[FramesPerVector];
+			VectorRegister4Float Odds[FramesPerVector];
+			for (int32 SubFrame = 0; SubFrame < FramesPerVector; ++SubFrame)
+			{
+				const VectorRegister4Float Lo = VectorLoad(In + 8 * SubFrame);
+				const VectorRegister4Float Hi = VectorLoad(In + 8 * SubFrame + 4);
+				Evens[SubFrame] = VectorShuffle(Lo, Hi, 0, 2, 0, 2);
+				Odds[SubFrame] = VectorShuffle(Lo, Hi, 1, 3, 1, 3);
+			}
+
+			VectorRegister4Float C[8];
+			Transpose4(Evens[0], Evens[1], Evens[2], Evens[3], C[0], C[2], C[4], C[6]);
+			Transpose4(Odds[0], Odds[1], Odds[2], Odds[3], C[1], C[3], C[5], C[7]);
+			for (int32 Channel = 0; Channel < 8; ++Channel)
+			{
+				VectorStore(C[Channel], Out[Channel] + Offset + Frame);
+			}
+		}
+	}
+
+	void DeinterleaveScalar(const float* RESTRICT In, int32 NumChannels, float* const* Out, int32 Offset, int32 FirstFrame, int32 EndFrame)
+	{
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			float* RESTRICT Destination = Out[Channel] + Offset;
+			for (int32 Frame = FirstFrame; Frame < EndFrame; ++Frame)
+			{
+				Destination[Frame] = In[Frame * NumChannels + Channel];
+			}
+		}
+	}
+}
+
+void FWwiseAudioLinkDeinterleaver::Deinterleave(const float* InInterleaved, int32 InNumChannels, int32 InNumFrames, float* const* OutChannelBuffers, int32 InFrameOffset)
+{
+	using namespace WwiseAudioLinkDeinterleaver;
+
+	if (InNumFrames <= 0)
+	{
+		return;
+	}
+
+	const int32 NumVectorFrames = InNumFrames - InNumFrames % FramesPerVector;
+	int32 NumFramesDone = NumVectorFrames;
+
+	switch (InNumChannels)
+	{
+	case 1:
+		FMemory::Memcpy(OutChannelBuffers[0] + InFrameOffset, InInterleaved, InNumFrames * sizeof(float));
+		return;
+	case 2:
+		Audio::BufferDeinterleave2ChannelFast(InInterleaved, OutChannelBuffers[0] + InFrameOffset, OutChannelBuffers[1] + InFrameOffset, NumVectorFrames);
+		break;
+	case 4:
+		Deinterleave4(InInterleaved, OutChannelBuffers, InFrameOffset, NumVectorFrames);
+		break;
+	case 6:
+		Deinterleave6(InInterleaved, OutChannelBuffers, InFrameOffset, NumVectorFrames);
+		break;
+	case 8:
+		Deinterleave8(InInterleaved, OutChannelBuffers, InFrameOffset, NumVectorFrames);
+		break;
+	default:
+		NumFramesDone = 0;
+		break;
+	}
+
+	DeinterleaveScalar(InInterleaved, InNumChannels, OutChannelBuffers, InFrameOffset, NumFramesDone, InNumFrames);
+}
+
+bool FWwiseAudioLinkDeinterleaver::PopDeinterleaved(FPopFunction InPop, int32 InNumChannels, int32 InNumFrames, float* const* OutChannelBuffers, int32& OutNumFramesPopped)
+{
+	OutNumFramesPopped = 0;
+	if (UNLIKELY(InNumChannels <= 0 || InNumChannels > ScratchSizeInSamples))
+	{
+		return false;
+	}
+
+	if (InNumChannels == 1)
+	{
+		// Pop the data directly onto Wwise buffers.
+		return InPop(OutChannelBuffers[0], InNumFrames, OutNumFramesPopped);
+	}
+
+	alignas(16) float Scratch[ScratchSizeInSamples];
+	// Keep chunks a multiple of the vector width so only the last chunk goes through the scalar tail.
+	const int32 MaxScratchFrames = ScratchSizeInSamples / InNumChannels;
+	const int32 ChunkFrames = MaxScratchFrames >= WwiseAudioLinkDeinterleaver::FramesPerVector
+		? MaxScratchFrames - MaxScratchFrames % WwiseAudioLinkDeinterleaver::FramesPerVector
+		: MaxScratchFrames;
+
+	bool bMoreDataRemaining = true;
+	while (OutNumFramesPopped < InNumFrames && bMoreDataRemaining)
+	{
+		const int32 NumFramesRequested = FMath::Min(ChunkFrames, InNumFrames - OutNumFramesPopped);
+		const int32 NumSamplesRequested = NumFramesRequested * InNumChannels;
+
+		int32 NumSamplesPopped = 0;
+		bMoreDataRemaining = InPop(Scratch, NumSamplesRequested, NumSamplesPopped);
+
+		const int32 NumFramesPopped = NumSamplesPopped / InNumChannels;
+		Deinterleave(Scratch, InNumChannels, NumFramesPopped, OutChannelBuffers, OutNumFramesPopped);
+		OutNumFramesPopped += NumFramesPopped;
+
+		if (NumSamplesPopped < NumSamplesRequested)
+		{
+			// The producer is starving. What's left will be picked up on the next callback.
+			break;
+		}
+	}
+	return bMoreDataRemaining;
+}
@@ -0,0 +1,48 @@
+/*******************************************************************************
+The content of this file includes portions of the proprietary AUDIOKINETIC Wwise
+Technology released in source code form as part of the game integration package.
+The content of this file may not be used without valid licenses to the
+AUDIOKINETIC Wwise Technology.
+Note that the use of the game engine is subject to the Unreal(R) Engine End User
+License Agreement at https://www.unrealengine.com/en-US/eula/unreal
+ 
+License Usage
+ 
+Licensees holding valid licenses to the AUDIOKINETIC Wwise Technology may use
+this file in accordance with the end user license agreement provided with the
+software or, alternatively, in accordance with the terms contained
+in a written agreement between you and Audiokinetic Inc.
+Copyright (c) 2024 Audiokinetic Inc.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+/**
+ * Moves interleaved AudioLink samples into Wwise's non-interleaved channel buffers.
+ *
+ * IBufferedAudioOutput only exposes PopBuffer into caller-owned memory, so samples are popped in small chunks
+ * through a stack buffer that stays in cache, and each chunk is deinterleaved straight into the Wwise buffers.
+ * Mono, stereo, quad, 5.1 and 7.1 use vectorized kernels. Other layouts use a scalar loop.
+ */
+struct FWwiseAudioLinkDeinterleaver
+{
+	/** Pops up to InBufferSizeInSamples interleaved samples. Returns false once the producer has no more data. */
+	using FPopFunction = TFunctionRef<bool(float* OutBuffer, int32 InBufferSizeInSamples, int32& OutSamplesWritten)>;
+
+	/** Number of floats in the stack buffer used for one chunk. */
+	static constexpr int32 ScratchSizeInSamples = 2048;
+
+	/**
+	 * Pops up to InNumFrames frames of InNumChannels channels and deinterleaves them into OutChannelBuffers.
+	 * @param OutNumFramesPopped Number of frames written at the start of each channel buffer.
+	 * @return Whether the producer has more data remaining.
+	 */
+	static bool PopDeinterleaved(FPopFunction InPop, int32 InNumChannels, int32 InNumFrames, float* const* OutChannelBuffers, int32& OutNumFramesPopped);
+
+	/** Deinterleaves InNumFrames frames into OutChannelBuffers, writing each channel at InFrameOffset. */
+	static void Deinterleave(const float* InInterleaved, int32 InNumChannels, int32 InNumFrames, float* const* OutChannelBuffers, int32 InFrameOffset = 0);
+};
@@ -18,6 +18,7 @@ Copyright (c) 2024 Audiokinetic Inc.
 #include "Wwise/AudioLink/WwiseAudioLinkInputClient.h"
 #include "Wwise/AudioLink/WwiseAudioLinkSettings.h"
 #include "Wwise/AudioLink/WwiseAudioLinkComponent.h"
+#include "Wwise/AudioLink/WwiseAudioLinkDeinterleaver.h"
 #include "Wwise/AudioLink/WwiseAudioLinkFactory.h"
 #include "Wwise/AudioLink/WwiseAudioLinkSynchronizer.h"
 
@@ -49,6 +50,7 @@ FWwiseAudioLinkInputClient::FWwiseAudioLinkInputClient(
 FWwiseAudioLinkInputClient::~FWwiseAudioLinkInputClient()
 {
 	Unregister();
+	ReleasePlayingProducer();
 }
 
 void FWwiseAudioLinkInputClient::Start(UWwiseAudioLinkComponent* InAkComponent)
@@ -107,7 +109,9 @@ void FWwiseAudioLinkInputClient::Start(UWwiseAudioLinkComponent* InAkComponent)
 			StartEvent.Get(),
 			InAkComponent,
 			FAkGlobalAudioInputDelegate::CreateSP(SelfSP, &FWwiseAudioLinkInputClient::GetSamples),
-			FAkGlobalAudioFormatDelegate::CreateSP(SelfSP, &FWwiseAudioLinkInputClient::GetFormat)
+			FAkGlobalAudioFormatDelegate::CreateSP(SelfSP, &FWwiseAudioLinkInputClient::GetFormat),
+			EAkAudioContext::Foreign,
+			FAkGlobalAudioInputEndDelegate::CreateSP(SelfSP, &FWwiseAudioLinkInputClient::OnPlayEnded)
 		);
 		UE_CLOG(UNLIKELY(PlayId.load() == AK_INVALID_PLAYING_ID), LogWwiseAudioLink, Error,
 			TEXT("FWwiseAudioLinkInputClient::Start: Error playing Component %" PRIu64 " (%s) in client %" PRIu64 " (%s)"),
@@ -167,7 +171,9 @@ void FWwiseAudioLinkInputClient::Start()
 			StartEvent.Get(),
 			ObjectId,
 			FAkGlobalAudioInputDelegate::CreateSP(SelfSP, &FWwiseAudioLinkInputClient::GetSamples),
-			FAkGlobalAudioFormatDelegate::CreateSP(SelfSP, &FWwiseAudioLinkInputClient::GetFormat)
+			FAkGlobalAudioFormatDelegate::CreateSP(SelfSP, &FWwiseAudioLinkInputClient::GetFormat),
+			EAkAudioContext::Foreign,
+			FAkGlobalAudioInputEndDelegate::CreateSP(SelfSP, &FWwiseAudioLinkInputClient::OnPlayEnded)
 		);
 
 		UE_CLOG(UNLIKELY(PlayId.load() == AK_INVALID_PLAYING_ID), LogWwiseAudioLink, Error,
@@ -213,6 +219,33 @@ void FWwiseAudioLinkInputClient::Stop()
 
 		PlayId = AK_INVALID_PLAYING_ID;
 	}	
+
+	ReleasePlayingProducer();
+}
+
+void FWwiseAudioLinkInputClient::ReleasePlayingProducer()
+{
+	bPlayingProducerReleased = true;
+	delete PlayingProducer.exchange(nullptr);
+}
+
+void FWwiseAudioLinkInputClient::ReturnPlayingProducer(TUniquePtr<FSharedBufferedOutputPtr> Producer)
+{
+	PlayingProducer.store(Producer.Release());
+
+	// A release while the producer was out found nothing to free. Either it is seen here, or it comes after the store and frees it itself.
+	if (UNLIKELY(bPlayingProducerReleased))
+	{
+		delete PlayingProducer.exchange(nullptr);
+	}
+}
+
+/** Called from the Wwise callback thread once the play ended, whether it ran out of data or was stopped externally */
+void FWwiseAudioLinkInputClient::OnPlayEnded()
+{
+	UE_LOG(LogWwiseAudioLinkLowLevel, VeryVerbose, TEXT("FWwiseAudioLinkInputClient::OnPlayEnded, PlayId=%d, Name=%s, This=0x%p"),
+		PlayId.load(), *ProducerName.GetPlainNameString(), this);
+	ReleasePlayingProducer();
 }
 
 void FWwiseAudioLinkInputClient::Register(const FName& InNameOfProducingSource)
@@ -329,11 +362,17 @@ bool FWwiseAudioLinkInputClient::GetSamples(uint32 InNumChannels, uint32 InNumFr
 {
 	SCOPED_NAMED_EVENT(WwiseAudioLink_GetSamples, FColor::Red);
 
-	FSharedBufferedOutputPtr StrongBufferProducer{ WeakProducer.Pin() };
-	if (!StrongBufferProducer.IsValid())
+	// Taken out of the slot while popping and put back after, which keeps it alive without a lock. Dropped on the early outs.
+	TUniquePtr<FSharedBufferedOutputPtr> PlayingProducerRef(PlayingProducer.exchange(nullptr));
+	if (UNLIKELY(!PlayingProducerRef.IsValid()))
 	{
-		// Return false, to indicate no more data.
-		return false;
+		FSharedBufferedOutputPtr StrongProducer = WeakProducer.Pin();
+		if (!StrongProducer.IsValid())
+		{
+			// Return false, to indicate no more data.
+			return false;
+		}
+		PlayingProducerRef = MakeUnique<FSharedBufferedOutputPtr>(MoveTemp(StrongProducer));
 	}
 
 	if (UNLIKELY(UnrealFormat.NumChannels == 0))
@@ -348,67 +387,30 @@ bool FWwiseAudioLinkInputClient::GetSamples(uint32 InNumChannels, uint32 InNumFr
 		return false;
 	}
 
+	// Pop the data straight onto Wwise buffers, deinterleaving as we go.
+	// Keep record if the Producer has told us there's no more data.
 	int32 NumFramesPopped = 0;
-	bool bMoreDataRemaining = false;
-
-	// Always zero the buffer before we start.
-	for (uint32 Channel = 0; Channel < InNumChannels; ++Channel)
-	{
-		FMemory::Memzero(InChannelBuffers[Channel], InNumFrames * sizeof(float));
-	}
-
-	if (UnrealFormat.NumChannels == 1)
-	{
-		// Pop the data directly onto Wwise buffers.
-		// Keep record if the Producer has told us there's no more data.
-		bMoreDataRemaining = StrongBufferProducer->PopBuffer(InChannelBuffers[0], InNumFrames, NumFramesPopped);
-	}
-	else
-	{
-		// Make sure we have enough space in our temp buffer
-		int32 NumInterleavedSamplesNeeded = InNumFrames * UnrealFormat.NumChannels;
-		if (NumInterleavedSamplesNeeded > InterleavedBuffer.Num())
+	IBufferedAudioOutput& Producer = **PlayingProducerRef;
+	bool bMoreDataRemaining = FWwiseAudioLinkDeinterleaver::PopDeinterleaved(
+		[&Producer](float* OutBuffer, int32 InBufferSizeInSamples, int32& OutSamplesWritten)
 		{
-			InterleavedBuffer.SetNumUninitialized(
-				NumInterleavedSamplesNeeded,
-				true		// bAllowShrinking
-			);
-		}
-
-		// Pop the data onto an intermediate buffer for deinterleaving.
-		// Keep record if the Producer has told us there's no more data.
-		int32 NumInterleavedSamplesPopped = 0;
-		bMoreDataRemaining = StrongBufferProducer->PopBuffer(InterleavedBuffer.GetData(), NumInterleavedSamplesNeeded, NumInterleavedSamplesPopped);
-		NumFramesPopped = NumInterleavedSamplesPopped / UnrealFormat.NumChannels;
+			return Producer.PopBuffer(OutBuffer, InBufferSizeInSamples, OutSamplesWritten);
+		},
+		UnrealFormat.NumChannels, InNumFrames, InChannelBuffers, NumFramesPopped);
 
-		if (NumFramesPopped > 0)
+	// Zero what the producer could not provide, and the channels it does not have.
+	const uint32 NumChannelsWritten = FMath::Min(InNumChannels, (uint32)UnrealFormat.NumChannels);
+	if (NumFramesPopped < (int32)InNumFrames)
+	{
+		for (uint32 Channel = 0; Channel < NumChannelsWritten; ++Channel)
 		{
-			// De-interleave.
-			switch (UnrealFormat.NumChannels)
-			{
-				// Stereo.
-				case 2:
-				{
-					Audio::BufferDeinterleave2ChannelFast(InterleavedBuffer.GetData(), InChannelBuffers[0], InChannelBuffers[1], NumFramesPopped);
-					break;
-				}
-
-				// Generic version. 
-				default:
-				{
-					const float* InterleavedPtr = InterleavedBuffer.GetData();
-					for (int32 Frame = 0; Frame < NumFramesPopped; ++Frame)
-					{
-						for (int32 Channel = 0; Channel < UnrealFormat.NumChannels; ++Channel)
-						{
-							InChannelBuffers[Channel][Frame] = *InterleavedPtr++;
-						}
-					}
-					break;
-				}
-			}
+			FMemory::Memzero(InChannelBuffers[Channel] + NumFramesPopped, (InNumFrames - NumFramesPopped) * sizeof(float));
 		}
 	}
+	for (uint32 Channel = NumChannelsWritten; Channel < InNumChannels; ++Channel)
+	{
+		FMemory::Memzero(InChannelBuffers[Channel], InNumFrames * sizeof(float));
+	}
 
 	const int32 UnwrittenFrames = InNumFrames - NumFramesPopped;
 
@@ -456,6 +458,11 @@ bool FWwiseAudioLinkInputClient::GetSamples(uint32 InNumChannels, uint32 InNumFr
 		NumStarvedBuffersInARow = 0;
 	}
 
+	if (bMoreDataRemaining)
+	{
+		ReturnPlayingProducer(MoveTemp(PlayingProducerRef));
+	}
+
 	// Tell Wwise if this is the last buffer which will stop if it is.
 	return bMoreDataRemaining;
 }
@@ -465,15 +472,17 @@ void FWwiseAudioLinkInputClient::GetFormat(AkAudioFormat& io_AudioFormat)
 {
 	SCOPED_NAMED_EVENT(WwiseAudioLink_GetFormat, FColor::Red);
 	
-	// Ensure we're still listening to a sub mix that exists.
-	FSharedBufferedOutputPtr StrongPtr{ WeakProducer.Pin() };
-	if (!StrongPtr.IsValid())
+	// Ensure we're still listening to a sub mix that exists, and keep it for the duration of the play.
+	bPlayingProducerReleased = false;
+	FSharedBufferedOutputPtr StrongProducer = WeakProducer.Pin();
+	delete PlayingProducer.exchange(StrongProducer.IsValid() ? new FSharedBufferedOutputPtr(StrongProducer) : nullptr);
+	if (!StrongProducer.IsValid())
 	{
 		return;
 	}
     // Cache the format from the Consumer.
     // Ensure the format is known at this point.
-    if(!StrongPtr->GetFormat(UnrealFormat))
+    if(!StrongProducer->GetFormat(UnrealFormat))
     {
         UE_LOG(LogWwiseAudioLink, Error, TEXT("FWwiseAudioLinkInputClient::GetFormat: UnrealFormat is invalid"));
         return;
@@ -24,7 +24,6 @@ Copyright (c) 2024 Audiokinetic Inc.
 
 #include "AK/SoundEngine/Common/AkTypes.h"
 #include "AkAudioDevice.h"
-#include "DSP/BufferVectorOperations.h"
 
 class UWwiseAudioLinkComponent;
 
@@ -55,10 +54,24 @@ private:
 
 	// Called from WWise thread.
 	void GetFormat(AkAudioFormat& io_AudioFormat);
+
+	// Called from WWise thread, once the play ended.
+	void OnPlayEnded();
+
+	// Called from the Wwise render thread to give back the producer it took out of PlayingProducer.
+	void ReturnPlayingProducer(TUniquePtr<FSharedBufferedOutputPtr> Producer);
+
+	void ReleasePlayingProducer();
 	
-	Audio::AlignedFloatBuffer InterleavedBuffer;
 	TWeakObjectPtr<AActor> UnsafeAttachment;
 	FWeakBufferedOutputPtr WeakProducer;
+
+	// Pinned in GetFormat and kept until the play ends or is stopped. GetSamples takes it out for the duration of a pop, so a
+	// release from another thread never frees it underneath the render thread, and the render thread never waits on a lock.
+	std::atomic<FSharedBufferedOutputPtr*> PlayingProducer{ nullptr };
+
+	// Set by ReleasePlayingProducer, for a release that found the slot empty because GetSamples had the producer out.
+	std::atomic<bool> bPlayingProducerReleased{ false };
 	UAudioLinkSettingsAbstract::FSharedSettingsProxyPtr SettingsProxy;
 	IBufferedAudioOutput::FBufferFormat UnrealFormat;
 
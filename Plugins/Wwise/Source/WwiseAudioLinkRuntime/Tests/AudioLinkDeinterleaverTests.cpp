@@ -0,0 +1,186 @@
+/*******************************************************************************
+The content of this file includes portions of the proprietary AUDIOKINETIC Wwise
+Technology released in source code form as part of the game integration package.
+The content of this file may not be used without valid licenses to the
+AUDIOKINETIC Wwise Technology.
+Note that the use of the game engine is subject to the Unreal(R) Engine End User
+License Agreement at https://www.unrealengine.com/en-US/eula/unreal
+ 
+License Usage
+ 
+Licensees holding valid licenses to the AUDIOKINETIC Wwise Technology may use
+this file in accordance with the end user license agreement provided with the
+software or, alternatively, in accordance with the terms contained
+in a written agreement between you and Audiokinetic Inc.
+Copyright (c) 2024 Audiokinetic Inc.
+*******************************************************************************/
+
+
+#include "Wwise/WwiseUnitTests.h"
+
+#if WWISE_UNIT_TESTS && UE_5_1_OR_LATER
+#include "Wwise/AudioLink/WwiseAudioLinkDeinterleaver.h"
+
+namespace AudioLinkDeinterleaverTests
+{
+	static float SampleValue(int32 Frame, int32 Channel)
+	{
+		return (float)Frame + (float)Channel / 16.f;
+	}
+
+	// Stands in for IBufferedAudioOutput::PopBuffer, serving a synthetic interleaved stream.
+	struct FSyntheticProducer
+	{
+		TArray<float> Interleaved;
+		int32 ReadPosition = 0;
+		int32 NumChannels = 0;
+
+		FSyntheticProducer(int32 InNumChannels, int32 InNumFrames)
+			: NumChannels(InNumChannels)
+		{
+			Interleaved.SetNumUninitialized(InNumChannels * InNumFrames);
+			for (int32 Frame = 0; Frame < InNumFrames; ++Frame)
+			{
+				for (int32 Channel = 0; Channel < InNumChannels; ++Channel)
+				{
+					Interleaved[Frame * InNumChannels + Channel] = SampleValue(Frame, Channel);
+				}
+			}
+		}
+
+		bool Pop(float* OutBuffer, int32 InBufferSizeInSamples, int32& OutSamplesWritten)
+		{
+			OutSamplesWritten = FMath::Min(InBufferSizeInSamples, Interleaved.Num() - ReadPosition);
+			FMemory::Memcpy(OutBuffer, Interleaved.GetData() + ReadPosition, OutSamplesWritten * sizeof(float));
+			ReadPosition += OutSamplesWritten;
+			return true;
+		}
+
+		void Rewind() { ReadPosition = 0; }
+	};
+
+	struct FPlanarOutput
+	{
+		TArray<TArray<float>> Channels;
+		TArray<float*> Pointers;
+
+		FPlanarOutput(int32 NumChannels, int32 NumFrames)
+		{
+			Channels.SetNum(NumChannels);
+			for (auto& Channel : Channels)
+			{
+				Channel.SetNumZeroed(NumFrames);
+				Pointers.Add(Channel.GetData());
+			}
+		}
+
+		bool Matches(int32 NumFrames, int32 FirstFrame = 0) const
+		{
+			for (int32 Channel = 0; Channel < Channels.Num(); ++Channel)
+			{
+				for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+				{
+					if (Channels[Channel][Frame] != SampleValue(FirstFrame + Frame, Channel))
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+	};
+}
+
+WWISE_TEST_CASE(AudioLink_Deinterleaver_Smoke, "Wwise::AudioLink::Deinterleaver_Smoke", "[ApplicationContextMask][SmokeFilter]")
+{
+	using namespace AudioLinkDeinterleaverTests;
+
+	SECTION("Sample accuracy")
+	{
+		const int32 ChannelCounts[] = { 1, 2, 3, 4, 6, 8, 12 };
+		const int32 FrameCounts[] = { 1, 7, 256, 1024, 1027 };
+		for (const int32 NumChannels : ChannelCounts)
+		{
+			for (const int32 NumFrames : FrameCounts)
+			{
+				FSyntheticProducer Producer(NumChannels, NumFrames);
+				FPlanarOutput Output(NumChannels, NumFrames);
+				int32 NumFramesPopped = 0;
+				FWwiseAudioLinkDeinterleaver::PopDeinterleaved(
+					[&Producer](float* OutBuffer, int32 InSize, int32& OutWritten) { return Producer.Pop(OutBuffer, InSize, OutWritten); },
+					NumChannels, NumFrames, Output.Pointers.GetData(), NumFramesPopped);
+				CHECK(NumFramesPopped == NumFrames);
+				CHECK(Output.Matches(NumFrames));
+			}
+		}
+	}
+
+	SECTION("Starving producer")
+	{
+		constexpr const int32 NumChannels = 6;
+		constexpr const int32 NumFramesAvailable = 300;
+		constexpr const int32 NumFramesRequested = 1024;
+		FSyntheticProducer Producer(NumChannels, NumFramesAvailable);
+		FPlanarOutput Output(NumChannels, NumFramesRequested);
+		int32 NumFramesPopped = 0;
+		FWwiseAudioLinkDeinterleaver::PopDeinterleaved(
+			[&Producer](float* OutBuffer, int32 InSize, int32& OutWritten) { return Producer.Pop(OutBuffer, InSize, OutWritten); },
+			NumChannels, NumFramesRequested, Output.Pointers.GetData(), NumFramesPopped);
+		CHECK(NumFramesPopped == NumFramesAvailable);
+		CHECK(Output.Matches(NumFramesAvailable));
+	}
+
+	SECTION("Frame offset")
+	{
+		constexpr const int32 NumChannels = 8;
+		constexpr const int32 NumFrames = 64;
+		constexpr const int32 Offset = 12;
+		FSyntheticProducer Producer(NumChannels, NumFrames);
+		FPlanarOutput Output(NumChannels, NumFrames + Offset);
+		FWwiseAudioLinkDeinterleaver::Deinterleave(Producer.Interleaved.GetData(), NumChannels, NumFrames, Output.Pointers.GetData(), Offset);
+		bool bMatches = true;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				bMatches &= Output.Channels[Channel][Offset + Frame] == SampleValue(Frame, Channel);
+			}
+		}
+		CHECK(bMatches);
+	}
+}
+
+WWISE_TEST_CASE(AudioLink_Deinterleaver_Perf, "Wwise::AudioLink::Deinterleaver_Perf", "[ApplicationContextMask][PerfFilter]")
+{
+	using namespace AudioLinkDeinterleaverTests;
+
+	SECTION("PopDeinterleavedPerf")
+	{
+		constexpr const int32 NumFrames = 1024;
+		constexpr const int LoopCount = 20000;
+		constexpr const int ExpectedUS = 1000000;
+
+		const int32 ChannelCounts[] = { 1, 2, 6, 8 };
+		for (const int32 NumChannels : ChannelCounts)
+		{
+			FSyntheticProducer Producer(NumChannels, NumFrames);
+			FPlanarOutput Output(NumChannels, NumFrames);
+
+			FDateTime StartTime = FDateTime::UtcNow();
+			for (int i = 0; i < LoopCount; ++i)
+			{
+				Producer.Rewind();
+				int32 NumFramesPopped = 0;
+				FWwiseAudioLinkDeinterleaver::PopDeinterleaved(
+					[&Producer](float* OutBuffer, int32 InSize, int32& OutWritten) { return Producer.Pop(OutBuffer, InSize, OutWritten); },
+					NumChannels, NumFrames, Output.Pointers.GetData(), NumFramesPopped);
+			}
+			FTimespan Duration = FDateTime::UtcNow() - StartTime;
+			WWISE_TEST_LOG("PopDeinterleavedPerf %d channels: %dus < %dus", NumChannels, (int)Duration.GetTotalMicroseconds(), ExpectedUS);
+			CHECK(Duration.GetTotalMicroseconds() < ExpectedUS);
+			CHECK(Output.Matches(NumFrames));
+		}
+	}
+}
+
+#endif // WWISE_UNIT_TESTS && UE_5_1_OR_LATER
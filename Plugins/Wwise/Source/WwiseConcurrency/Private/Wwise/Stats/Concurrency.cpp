@@ -26,6 +26,8 @@ DEFINE_STAT(STAT_WwiseConcurrencyGameThread);
 DEFINE_STAT(STAT_WwiseExecutionQueues);
 DEFINE_STAT(STAT_WwiseExecutionQueueAsyncCalls);
 DEFINE_STAT(STAT_WwiseExecutionQueueAsyncWaitCalls);
+DEFINE_STAT(STAT_WwiseExecutionQueueLaunches);
+DEFINE_STAT(STAT_WwiseExecutionQueueOps);
 
 DEFINE_STAT(STAT_WwiseFutures);
 DEFINE_STAT(STAT_WwiseFuturesWithEvent);
@@ -32,6 +32,7 @@ WWISE_EXECUTIONQUEUE_TEST_CONST bool FWwiseExecutionQueue::Test::bMockEngineDele
 WWISE_EXECUTIONQUEUE_TEST_CONST bool FWwiseExecutionQueue::Test::bMockEngineDeleted{ false };
 WWISE_EXECUTIONQUEUE_TEST_CONST bool FWwiseExecutionQueue::Test::bMockSleepOnStateUpdate{ false };
 WWISE_EXECUTIONQUEUE_TEST_CONST bool FWwiseExecutionQueue::Test::bReduceLogVerbosity{ false };
+WWISE_EXECUTIONQUEUE_TEST_CONST bool FWwiseExecutionQueue::Test::bDisableBatching{ false };
 
 struct FWwiseExecutionQueue::TLS
 {
@@ -57,6 +58,10 @@ FWwiseExecutionQueue::~FWwiseExecutionQueue()
 	UE_CLOG(UNLIKELY(bDeleteOnceClosed && WorkerState.load(std::memory_order_seq_cst) != EWorkerState::Closed), LogWwiseConcurrency, Fatal, TEXT("Deleting FWwiseExectionQueue twice!"));
 
 	Close();
+	if (FEvent* Event = ClosedEvent.exchange(nullptr))
+	{
+		FPlatformProcess::ReturnSynchEventToPool(Event);
+	}
 	ASYNC_DEC_DWORD_STAT(STAT_WwiseExecutionQueues);
 	UE_CLOG(Test::IsExtremelyVerbose(), LogWwiseConcurrency, VeryVerbose, TEXT("FWwiseExecutionQueue::~FWwiseExecutionQueue(%p \"%s\") [%" PRIi32 "]: Deleted Execution Queue"), this, DebugName, FPlatformTLS::GetCurrentThreadId());
 }
@@ -64,7 +69,7 @@ FWwiseExecutionQueue::~FWwiseExecutionQueue()
 void FWwiseExecutionQueue::Async(const TCHAR* InDebugName, FBasicFunction&& InFunction)
 {
 	UE_CLOG(Test::IsExtremelyVerbose(), LogWwiseConcurrency, VeryVerbose, TEXT("FWwiseExecutionQueue::Async(%p \"%s\") [%" PRIi32 "]: Enqueuing async function %" PRIu64), this, DebugName, FPlatformTLS::GetCurrentThreadId(), (intptr_t&)InFunction);
-	if (UNLIKELY(IsBeingClosed() || !OpQueue.Enqueue(FOpQueueItem(InDebugName, MoveTemp(InFunction)))))
+	if (UNLIKELY(IsBeingClosed() || !Enqueue(FOpQueueItem(InDebugName, MoveTemp(InFunction)))))
 	{
 		ASYNC_INC_DWORD_STAT(STAT_WwiseExecutionQueueAsyncCalls);
 		UE_CLOG(Test::IsExtremelyVerbose(), LogWwiseConcurrency, VeryVerbose, TEXT("FWwiseExecutionQueue::Async(%p \"%s\") [%" PRIi32 "]: Executing async function %" PRIu64), this, DebugName, FPlatformTLS::GetCurrentThreadId(), (intptr_t&)InFunction);
@@ -114,7 +119,7 @@ void FWwiseExecutionQueue::AsyncWait(const TCHAR* InDebugName, FBasicFunction&&
 	SCOPED_WWISECONCURRENCY_EVENT_4(TEXT("FWwiseExecutionQueue::AsyncWait"));
 	UE_CLOG(Test::IsExtremelyVerbose(), LogWwiseConcurrency, VeryVerbose, TEXT("FWwiseExecutionQueue::AsyncWait(%p \"%s\") [%" PRIi32 "]: Enqueuing async wait function %" PRIu64), this, DebugName, FPlatformTLS::GetCurrentThreadId(), (intptr_t&)InFunction);
 	FEventRef Event(EEventMode::ManualReset);
-	if (UNLIKELY(IsBeingClosed() || !OpQueue.Enqueue(FOpQueueItem(InDebugName, [this, &Event, &InFunction] {
+	if (UNLIKELY(IsBeingClosed() || !Enqueue(FOpQueueItem(InDebugName, [this, &Event, &InFunction] {
 		ASYNC_INC_DWORD_STAT(STAT_WwiseExecutionQueueAsyncWaitCalls);
 		UE_CLOG(Test::IsExtremelyVerbose(), LogWwiseConcurrency, VeryVerbose, TEXT("FWwiseExecutionQueue::AsyncWait(%p \"%s\") [%" PRIi32 "]: Executing async wait function %" PRIu64), this, DebugName, FPlatformTLS::GetCurrentThreadId(), (intptr_t&)InFunction);
 		InFunction();
@@ -137,20 +142,25 @@ void FWwiseExecutionQueue::Close()
 		return;
 	}
 
+	// Created before the worker can be asked to close, so it always has an event to trigger.
+	FEvent* Event = GetOrCreateClosedEvent();
+
 	AsyncWait(WWISECONCURRENCY_ASYNC_NAME("FWwiseExecutionQueue::Close"), [this]
 	{
 		TrySetRunningWorkerToClosing();
 	});
 
-	auto State = WorkerState.load(std::memory_order_relaxed);
-	if (State != EWorkerState::Closed)
+	if (WorkerState.load(std::memory_order_seq_cst) != EWorkerState::Closed)
 	{
 		SCOPED_WWISECONCURRENCY_EVENT_4(TEXT("FWwiseExecutionQueue::Close Waiting"));
 		UE_CLOG(Test::IsExtremelyVerbose(), LogWwiseConcurrency, VeryVerbose, TEXT("FWwiseExecutionQueue::Close(%p \"%s\") [%" PRIi32 "]: Waiting for Closed"), this, DebugName, FPlatformTLS::GetCurrentThreadId());
-		while (State != EWorkerState::Closed)
+
+		Event->Wait();
+
+		// The worker triggers the event right before its last state update.
+		while (WorkerState.load(std::memory_order_seq_cst) != EWorkerState::Closed)
 		{
 			FPlatformProcess::Yield();
-			State = WorkerState.load(std::memory_order_relaxed);
 		}
 	}
 	UE_CLOG(Test::IsExtremelyVerbose(), LogWwiseConcurrency, VeryVerbose, TEXT("FWwiseExecutionQueue::Close(%p \"%s\") [%" PRIi32 "]: Done Closing"), this, DebugName, FPlatformTLS::GetCurrentThreadId());
@@ -202,12 +212,60 @@ bool FWwiseExecutionQueue::IsRunningInThisThread() const
 	return this == TLS::CurrentExecutionQueue;
 }
 
+FWwiseExecutionQueue::FStats FWwiseExecutionQueue::GetStats() const
+{
+	FStats Result;
+	Result.NumLaunches = NumLaunches.load(std::memory_order_relaxed);
+	Result.NumOps = NumOps.load(std::memory_order_relaxed);
+	Result.MaxQueueDepth = MaxQueueDepth.load(std::memory_order_relaxed);
+	Result.TotalLatencySeconds = FPlatformTime::ToSeconds64(TotalLatencyCycles.load(std::memory_order_relaxed));
+	return Result;
+}
+
+FEvent* FWwiseExecutionQueue::GetOrCreateClosedEvent()
+{
+	FEvent* Event = ClosedEvent.load(std::memory_order_seq_cst);
+	if (Event)
+	{
+		return Event;
+	}
+
+	// Concurrent Close() calls all wait on the first event created.
+	FEvent* NewEvent = FPlatformProcess::GetSynchEventFromPool(true);
+	if (ClosedEvent.compare_exchange_strong(Event, NewEvent, std::memory_order_seq_cst))
+	{
+		return NewEvent;
+	}
+	FPlatformProcess::ReturnSynchEventToPool(NewEvent);
+	return Event;
+}
+
+bool FWwiseExecutionQueue::Enqueue(FOpQueueItem&& InItem)
+{
+	if (UNLIKELY(!OpQueue.Enqueue(MoveTemp(InItem))))
+	{
+		return false;
+	}
+
+	const int32 Depth = QueueDepth.fetch_add(1, std::memory_order_relaxed) + 1;
+	int32 PreviousMax = MaxQueueDepth.load(std::memory_order_relaxed);
+	while (Depth > PreviousMax && !MaxQueueDepth.compare_exchange_weak(PreviousMax, Depth, std::memory_order_relaxed))
+	{
+	}
+	return true;
+}
+
+bool FWwiseExecutionQueue::CanLaunchWorkerTask() const
+{
+	return !(UNLIKELY(!IWwiseConcurrencyModule::GetModule() || Test::bMockEngineDeletion || Test::bMockEngineDeleted) &&
+		UNLIKELY(!FTaskGraphInterface::IsRunning() || Test::bMockEngineDeleted));
+}
+
 void FWwiseExecutionQueue::StartWorkerIfNeeded()
 {
 	if (!TrySetRunningWorkerToAddOp() && TrySetStoppedWorkerToRunning())
 	{
-		if (UNLIKELY(!IWwiseConcurrencyModule::GetModule() || Test::bMockEngineDeletion || Test::bMockEngineDeleted) &&
-			UNLIKELY(!FTaskGraphInterface::IsRunning() || Test::bMockEngineDeleted))
+		if (!CanLaunchWorkerTask())
 		{
 			UE_CLOG(!Test::bMockEngineDeleted, LogWwiseConcurrency, VeryVerbose,
 				TEXT("FWwiseExecutionQueue::StartWorkerIfNeeded(%p \"%s\") [%" PRIi32 "]: No Task Graph. Do tasks now"),
@@ -237,19 +295,33 @@ void FWwiseExecutionQueue::StartWorkerIfNeeded()
 void FWwiseExecutionQueue::Work()
 {
 	UE_CLOG(Test::IsExtremelyVerbose(), LogWwiseConcurrency, VeryVerbose, TEXT("FWwiseExecutionQueue::Work(%p \"%s\") [%" PRIi32 "]: Started worker."), this, DebugName, FPlatformTLS::GetCurrentThreadId());
+	NumLaunches.fetch_add(1, std::memory_order_relaxed);
+	ASYNC_INC_DWORD_STAT(STAT_WwiseExecutionQueueLaunches);
 
+	FWorkerBatch Batch;
 	do
 	{
-		ProcessWork();
+		ProcessWork(Batch);
 	}
-	while (KeepWorking());
+	while (KeepWorking(Batch));
 }
 
-bool FWwiseExecutionQueue::KeepWorking()
+bool FWwiseExecutionQueue::KeepWorking(const FWorkerBatch& Batch)
 {
 	const auto CurrentThreadId = FPlatformTLS::GetCurrentThreadId();
 	const auto bDeleteOnceClosedCopy = this->bDeleteOnceClosed;
 
+	if (UNLIKELY(Batch.bBudgetSpent))
+	{
+		// Operations are still queued, so the state can't be Stopped nor Closed. Continue in a new task.
+		UE_CLOG(Test::IsExtremelyVerbose(), LogWwiseConcurrency, VeryVerbose, TEXT("FWwiseExecutionQueue::KeepWorking(%p \"%s\") [%" PRIi32 "]: Budget spent after %" PRIi32 " ops. Relaunching worker."), this, DebugName, CurrentThreadId, Batch.NumOps);
+		LaunchWwiseTask(WWISECONCURRENCY_ASYNC_NAME("FWwiseExecutionQueue::KeepWorking"), TaskPriority, [this]
+		{
+			Work();
+		});
+		return false;
+	}
+
 	if (LIKELY(TrySetRunningWorkerToStopped()))
 	{
 		UE_CLOG(Test::IsExtremelyVerbose(), LogWwiseConcurrency, VeryVerbose, TEXT("FWwiseExecutionQueue::KeepWorking(%p \"%s\") [%" PRIi32 "]: Stopped worker."), this, DebugName, CurrentThreadId);
@@ -257,20 +329,28 @@ bool FWwiseExecutionQueue::KeepWorking()
 		// Don't execute operations here, as the Execution Queue might be deleted here.
 		return false;
 	}
-	else if (LIKELY(TrySetClosingWorkerToClosed()))
+	else if (WorkerState.load(std::memory_order_seq_cst) == EWorkerState::Closing)
 	{
-		// We were exiting and we don't have operations anymore. Immediately return, as our worker is not valid at this point.
-		// Don't do any operations here!
-
-		if (bDeleteOnceClosedCopy)		// We use a copy since the deletion might've already occurred
+		// Close() created its event before asking us to close. Trigger it now, as we can be deleted as soon as we are Closed.
+		if (FEvent* Event = ClosedEvent.load(std::memory_order_seq_cst))
+		{
+			Event->Trigger();
+		}
+		if (LIKELY(TrySetClosingWorkerToClosed()))
 		{
-			LaunchWwiseTask(WWISECONCURRENCY_ASYNC_NAME("FWwiseExecutionQueue::KeepWorking delete"), [this]
+			// We were exiting and we don't have operations anymore. Immediately return, as our worker is not valid at this point.
+			// Don't do any operations here!
+
+			if (bDeleteOnceClosedCopy)		// We use a copy since the deletion might've already occurred
 			{
-				UE_CLOG(Test::IsExtremelyVerbose(), LogWwiseConcurrency, VeryVerbose, TEXT("FWwiseExecutionQueue::KeepWorking(%p \"%s\") [%" PRIi32 "]: Auto deleting on Any Thread"), this, DebugName, FPlatformTLS::GetCurrentThreadId());
-				delete this;
-			});
+				LaunchWwiseTask(WWISECONCURRENCY_ASYNC_NAME("FWwiseExecutionQueue::KeepWorking delete"), [this]
+				{
+					UE_CLOG(Test::IsExtremelyVerbose(), LogWwiseConcurrency, VeryVerbose, TEXT("FWwiseExecutionQueue::KeepWorking(%p \"%s\") [%" PRIi32 "]: Auto deleting on Any Thread"), this, DebugName, FPlatformTLS::GetCurrentThreadId());
+					delete this;
+				});
+			}
+			return false;
 		}
-		return false;
 	}
 
 	// Error cases
@@ -301,24 +381,67 @@ bool FWwiseExecutionQueue::KeepWorking()
 	}
 }
 
-void FWwiseExecutionQueue::ProcessWork()
+void FWwiseExecutionQueue::ProcessWork(FWorkerBatch& Batch)
 {
 	TrySetAddOpWorkerToRunning();
 
 	auto* PreviousExecutionQueue = TLS::CurrentExecutionQueue;
 	TLS::CurrentExecutionQueue = this;
-	
-	for (const FOpQueueItem* Op; (Op = OpQueue.Peek()) != nullptr; OpQueue.Pop())
+
+	// Budgets only apply when a new worker task can take over.
+	const bool bHasBudget = !Test::bDisableBatching && FPlatformProcess::SupportsMultithreading() && CanLaunchWorkerTask();
+	const uint64 MaxCycles = bHasBudget ? (uint64)(Batching::MaxSecondsPerLaunch / FPlatformTime::GetSecondsPerCycle64()) : 0;
+
+	for (const FOpQueueItem* Op; (Op = OpQueue.Peek()) != nullptr || WaitForMoreWork(Batch); OpQueue.Pop())
 	{
+		if (Op == nullptr)
+		{
+			Op = OpQueue.Peek();
+		}
+
+		if (UNLIKELY(bHasBudget && Batch.NumOps > 0 &&
+			(Batch.NumOps >= Batching::MaxOpsPerLaunch || FPlatformTime::Cycles64() - Batch.StartCycles >= MaxCycles)))
+		{
+			Batch.bBudgetSpent = true;
+			break;
+		}
+
+		TotalLatencyCycles.fetch_add(FPlatformTime::Cycles64() - Op->EnqueueCycles, std::memory_order_relaxed);
+		{
 #if ENABLE_NAMED_EVENTS
-		SCOPED_NAMED_EVENT_TCHAR_CONDITIONAL(Op->DebugName, WwiseNamedEvents::Color3, Op->DebugName != nullptr);
+			SCOPED_NAMED_EVENT_TCHAR_CONDITIONAL(Op->DebugName, WwiseNamedEvents::Color3, Op->DebugName != nullptr);
 #endif
-		Op->Function();
+			Op->Function();
+		}
+		++Batch.NumOps;
+		NumOps.fetch_add(1, std::memory_order_relaxed);
+		ASYNC_INC_DWORD_STAT(STAT_WwiseExecutionQueueOps);
+		QueueDepth.fetch_sub(1, std::memory_order_relaxed);
 	}
 
 	TLS::CurrentExecutionQueue = PreviousExecutionQueue;
 }
 
+bool FWwiseExecutionQueue::WaitForMoreWork(const FWorkerBatch& Batch)
+{
+	// Only linger after a burst, and never while closing: Close() is waiting on us.
+	if (Test::bDisableBatching || Batch.NumOps < 2 || !FPlatformProcess::SupportsMultithreading() || IsBeingClosed())
+	{
+		return false;
+	}
+
+	const uint64 LingerEndCycles = FPlatformTime::Cycles64() + (uint64)(Batching::LingerSeconds / FPlatformTime::GetSecondsPerCycle64());
+	while (FPlatformTime::Cycles64() < LingerEndCycles)
+	{
+		if (OpQueue.Peek() != nullptr)
+		{
+			return true;
+		}
+		FPlatformProcess::Yield();
+	}
+	return OpQueue.Peek() != nullptr;
+}
+
 bool FWwiseExecutionQueue::TrySetStoppedWorkerToRunning()
 {
 	return TryStateUpdate(EWorkerState::Stopped, EWorkerState::Running);
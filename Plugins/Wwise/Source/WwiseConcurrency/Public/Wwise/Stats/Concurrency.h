@@ -31,6 +31,8 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("Executing op in Game Thread"), STAT_WwiseConcurr
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Number of ExecutionQueues"), STAT_WwiseExecutionQueues, STATGROUP_WwiseConcurrency, WWISECONCURRENCY_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("ExecutionQueue Async calls"), STAT_WwiseExecutionQueueAsyncCalls, STATGROUP_WwiseConcurrency, WWISECONCURRENCY_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("ExecutionQueue AsyncWait calls"), STAT_WwiseExecutionQueueAsyncWaitCalls, STATGROUP_WwiseConcurrency, WWISECONCURRENCY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("ExecutionQueue worker launches"), STAT_WwiseExecutionQueueLaunches, STATGROUP_WwiseConcurrency, WWISECONCURRENCY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("ExecutionQueue ops executed"), STAT_WwiseExecutionQueueOps, STATGROUP_WwiseConcurrency, WWISECONCURRENCY_API);
 
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Number of Futures"), STAT_WwiseFutures, STATGROUP_WwiseConcurrency, WWISECONCURRENCY_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Number of Futures with Events"), STAT_WwiseFuturesWithEvent, STATGROUP_WwiseConcurrency, WWISECONCURRENCY_API);
@@ -19,6 +19,7 @@ Copyright (c) 2024 Audiokinetic Inc.
 
 #include "Async/TaskGraphInterfaces.h"
 #include "Containers/Queue.h"
+#include "HAL/Event.h"
 #include "Misc/DateTime.h"
 #include "Misc/QueuedThreadPool.h"
 #include "Wwise/WwiseTask.h"
@@ -106,26 +107,44 @@ struct WWISECONCURRENCY_API FWwiseExecutionQueue
 
 	bool IsRunningInThisThread() const;
 
+	/**
+	 * @brief Execution counters for this Execution Queue, since its creation.
+	*/
+	struct FStats
+	{
+		uint64 NumLaunches{ 0 };			///< Number of worker tasks started
+		uint64 NumOps{ 0 };					///< Number of operations executed by worker tasks
+		int32 MaxQueueDepth{ 0 };			///< Highest number of operations waiting to be executed at once
+		double TotalLatencySeconds{ 0.0 };	///< Total time operations waited between being enqueued and being executed
+
+		double GetOpsPerLaunch() const { return NumLaunches > 0 ? (double)NumOps / (double)NumLaunches : 0.0; }
+	};
+	FStats GetStats() const;
+
 	struct FOpQueueItem
 	{
 #if ENABLE_NAMED_EVENTS
 		FOpQueueItem() : DebugName(nullptr), Function([]{}) {}
 		FOpQueueItem(const TCHAR* InDebugName, FBasicFunction&& InFunction) :
 			DebugName(InDebugName),
-			Function(MoveTemp(InFunction))
+			Function(MoveTemp(InFunction)),
+			EnqueueCycles(FPlatformTime::Cycles64())
 		{}
 		FOpQueueItem(FOpQueueItem&& Rhs) :
 			DebugName(Rhs.DebugName),
-			Function(MoveTemp(Rhs.Function))
+			Function(MoveTemp(Rhs.Function)),
+			EnqueueCycles(Rhs.EnqueueCycles)
 		{
 		}
 #else
 		FOpQueueItem() : Function([]{}) {}
 		FOpQueueItem(const TCHAR*, FBasicFunction&& InFunction) :
-			Function(MoveTemp(InFunction))
+			Function(MoveTemp(InFunction)),
+			EnqueueCycles(FPlatformTime::Cycles64())
 		{}
 		FOpQueueItem(FOpQueueItem&& Rhs) :
-			Function(MoveTemp(Rhs.Function))
+			Function(MoveTemp(Rhs.Function)),
+			EnqueueCycles(Rhs.EnqueueCycles)
 		{
 		}
 #endif		
@@ -143,6 +162,7 @@ struct WWISECONCURRENCY_API FWwiseExecutionQueue
 		const TCHAR* DebugName;
 #endif
 		FBasicFunction Function;
+		uint64 EnqueueCycles{ 0 };
 	};
 
 private:
@@ -159,15 +179,36 @@ private:
 	std::atomic<EWorkerState> WorkerState{ EWorkerState::Stopped };
 	bool bDeleteOnceClosed{ false };
 
+	/** Created once by the first Close(), and triggered by the worker right before it becomes Closed. */
+	std::atomic<FEvent*> ClosedEvent{ nullptr };
+
 	using FOpQueue = TQueue<FOpQueueItem, EQueueMode::Mpsc>;
 	FOpQueue OpQueue;
 
+	std::atomic<int32> QueueDepth{ 0 };
+	std::atomic<int32> MaxQueueDepth{ 0 };
+	std::atomic<uint64> NumLaunches{ 0 };
+	std::atomic<uint64> NumOps{ 0 };
+	std::atomic<uint64> TotalLatencyCycles{ 0 };
+
+	/** Work done by the current worker task, checked against the Batching budgets. */
+	struct FWorkerBatch
+	{
+		const uint64 StartCycles{ FPlatformTime::Cycles64() };
+		int32 NumOps{ 0 };
+		bool bBudgetSpent{ false };
+	};
+
 	struct TLS;
 
+	FEvent* GetOrCreateClosedEvent();
+	bool Enqueue(FOpQueueItem&& InItem);
+	bool CanLaunchWorkerTask() const;
 	void StartWorkerIfNeeded();
 	void Work();
-	bool KeepWorking();
-	void ProcessWork();
+	bool KeepWorking(const FWorkerBatch& Batch);
+	void ProcessWork(FWorkerBatch& Batch);
+	bool WaitForMoreWork(const FWorkerBatch& Batch);
 	bool TrySetStoppedWorkerToRunning();
 	bool TrySetRunningWorkerToStopped();
 	bool TrySetRunningWorkerToAddOp();
@@ -185,6 +226,22 @@ private:
 	FWwiseExecutionQueue& operator=(FWwiseExecutionQueue&& Rhs) = delete;
 
 public:
+	/**
+	 * @brief Batching budgets shared by every Execution Queue.
+	 *
+	 * A worker task executes operations until the queue is empty or one of the budgets is spent. When a budget is spent
+	 * while operations remain, the worker hands its thread back and continues in a newly launched task.
+	 *
+	 * A worker that just executed more than one operation keeps polling an empty queue for up to LingerSeconds before
+	 * stopping. Bursts of small operations are then executed by the same task, instead of launching one task each.
+	*/
+	struct Batching
+	{
+		static constexpr int32 MaxOpsPerLaunch{ 4096 };
+		static constexpr double MaxSecondsPerLaunch{ 0.005 };
+		static constexpr double LingerSeconds{ 0.00002 };
+	};
+
 	struct WWISECONCURRENCY_API Test
 	{
 #if defined(WITH_LOW_LEVEL_TESTS) && WITH_LOW_LEVEL_TESTS || defined(WITH_AUTOMATION_TESTS) || (WITH_DEV_AUTOMATION_TESTS || WITH_PERF_AUTOMATION_TESTS)
@@ -197,6 +254,7 @@ public:
 		static WWISE_EXECUTIONQUEUE_TEST_CONST bool bMockEngineDeleted;
 		static WWISE_EXECUTIONQUEUE_TEST_CONST bool bMockSleepOnStateUpdate;
 		static WWISE_EXECUTIONQUEUE_TEST_CONST bool bReduceLogVerbosity;
+		static WWISE_EXECUTIONQUEUE_TEST_CONST bool bDisableBatching;	///< Workers drain the queue once and stop, without budgets nor lingering
 		static bool IsExtremelyVerbose(){ return bExtremelyVerbose && !bReduceLogVerbosity; }
 	};
 };
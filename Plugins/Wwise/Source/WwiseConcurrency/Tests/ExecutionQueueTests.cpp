@@ -20,6 +20,7 @@ Copyright (c) 2024 Audiokinetic Inc.
 #if WWISE_UNIT_TESTS
 #include "Wwise/WwiseExecutionQueue.h"
 #include <atomic>
+#include <inttypes.h>
 
 WWISE_TEST_CASE(Concurrency_ExecutionQueue_Smoke, "Wwise::Concurrency::ExecutionQueue_Smoke", "[ApplicationContextMask][SmokeFilter]")
 {
@@ -110,6 +111,37 @@ WWISE_TEST_CASE(Concurrency_ExecutionQueue_Smoke, "Wwise::Concurrency::Execution
 		});
 		CHECK_FALSE(ExecutionQueue.IsRunningInThisThread());
 	}
+
+	SECTION("Stats")
+	{
+		if (!FPlatformProcess::SupportsMultithreading())
+		{
+			return;		// The blocking op below would run inline.
+		}
+
+		constexpr const int LoopCount = 10;
+		FWwiseExecutionQueue ExecutionQueue(WWISE_TEST_ASYNC_NAME);
+		CHECK(ExecutionQueue.GetStats().NumOps == 0);
+
+		FEventRef Unblock;
+		ExecutionQueue.Async(WWISE_TEST_ASYNC_NAME, [&Unblock]
+		{
+			Unblock->Wait();
+		});
+		for (int i = 0; i < LoopCount; ++i)
+		{
+			ExecutionQueue.Async(WWISE_TEST_ASYNC_NAME, []{});
+		}
+		Unblock->Trigger();
+		ExecutionQueue.AsyncWait(WWISE_TEST_ASYNC_NAME, []{});
+
+		const auto Stats = ExecutionQueue.GetStats();
+		CHECK(Stats.NumOps == LoopCount + 2);
+		CHECK(Stats.NumLaunches >= 1);
+		CHECK(Stats.MaxQueueDepth >= LoopCount);
+		CHECK(Stats.GetOpsPerLaunch() > 1.0);
+		CHECK(Stats.TotalLatencySeconds > 0.0);
+	}
 }
 
 WWISE_TEST_CASE(Concurrency_ExecutionQueue_Perf, "Wwise::Concurrency::ExecutionQueue_Perf", "[ApplicationContextMask][PerfFilter]")
@@ -173,6 +205,61 @@ WWISE_TEST_CASE(Concurrency_ExecutionQueue_Perf, "Wwise::Concurrency::ExecutionQ
 		CHECK(Value.load() == LoopCount);
 		CHECK(Duration.GetTotalMicroseconds() < ExpectedUS);
 	}
+
+	SECTION("TaskLaunchBatching")
+	{
+		const bool bReduceLogVerbosity = FWwiseExecutionQueue::Test::bReduceLogVerbosity;
+		const bool bDisableBatching = FWwiseExecutionQueue::Test::bDisableBatching;
+		FWwiseExecutionQueue::Test::bReduceLogVerbosity = true;
+		ON_SCOPE_EXIT
+		{
+			FWwiseExecutionQueue::Test::bReduceLogVerbosity = bReduceLogVerbosity;
+			FWwiseExecutionQueue::Test::bDisableBatching = bDisableBatching;
+		};
+
+		// Small bursts of tiny ops, like the Resource Loader and File Cache issue while loading a level.
+		constexpr const int BurstCount = 2000;
+		constexpr const int OpsPerBurst = 4;
+		const auto RunBursts = [](FTimespan& OutDuration)
+		{
+			std::atomic<int> Value{ 0 };
+			FWwiseExecutionQueue::FStats Stats;
+			FDateTime StartTime = FDateTime::UtcNow();
+			{
+				FWwiseExecutionQueue ExecutionQueue(WWISE_TEST_ASYNC_NAME);
+				for (int Burst = 0; Burst < BurstCount; ++Burst)
+				{
+					for (int i = 0; i < OpsPerBurst; ++i)
+					{
+						ExecutionQueue.Async(WWISE_TEST_ASYNC_NAME, [&Value]
+						{
+							++Value;
+						});
+					}
+					FPlatformProcess::Yield();
+				}
+				ExecutionQueue.AsyncWait(WWISE_TEST_ASYNC_NAME, []{});
+				Stats = ExecutionQueue.GetStats();
+			}
+			OutDuration = FDateTime::UtcNow() - StartTime;
+			CHECK(Value.load() == BurstCount * OpsPerBurst);
+			return Stats;
+		};
+
+		// Without batching, the worker runs the previous loop: drain what is queued, then stop.
+		FTimespan BeforeDuration;
+		FWwiseExecutionQueue::Test::bDisableBatching = true;
+		const auto Before = RunBursts(BeforeDuration);
+
+		FTimespan AfterDuration;
+		FWwiseExecutionQueue::Test::bDisableBatching = false;
+		const auto After = RunBursts(AfterDuration);
+
+		WWISE_TEST_LOG("TaskLaunchBatching before: %" PRIu64 " launches (%.1f ops/launch) in %dus. After: %" PRIu64 " launches (%.1f ops/launch) in %dus. Max depth %" PRIi32 ".",
+			Before.NumLaunches, Before.GetOpsPerLaunch(), (int)BeforeDuration.GetTotalMicroseconds(),
+			After.NumLaunches, After.GetOpsPerLaunch(), (int)AfterDuration.GetTotalMicroseconds(), After.MaxQueueDepth);
+		CHECK(After.NumLaunches <= Before.NumLaunches);
+	}
 }
 
 WWISE_TEST_CASE(Concurrency_ExecutionQueue, "Wwise::Concurrency::ExecutionQueue", "[ApplicationContextMask][ProductFilter]")
@@ -37,6 +37,11 @@ DEFINE_STAT(STAT_WwiseFileHandlerBatchedRequests);
 DEFINE_STAT(STAT_WwiseFileHandlerPendingRequests);
 DEFINE_STAT(STAT_WwiseFileHandlerTotalRequests);
 DEFINE_STAT(STAT_WwiseFileHandlerTotalStreamedMB);
+DEFINE_STAT(STAT_WwiseFileHandlerIdleFileHandles);
+DEFINE_STAT(STAT_WwiseFileHandlerFileHandlePoolHits);
+DEFINE_STAT(STAT_WwiseFileHandlerCoalescedRequests);
+DEFINE_STAT(STAT_WwiseFileHandlerTotalCoalescedMB);
+DEFINE_STAT(STAT_WwiseFileHandlerPrefetchHits);
 
 DEFINE_STAT(STAT_WwiseFileHandlerIORequestLatency); 
 DEFINE_STAT(STAT_WwiseFileHandlerFileOperationLatency);
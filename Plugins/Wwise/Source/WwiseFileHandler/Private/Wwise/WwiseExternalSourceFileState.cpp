@@ -252,6 +252,7 @@ void FWwiseStreamedExternalSourceFileState::LoadInSoundEngine(FLoadInSoundEngine
 		}
 
 		iFileSize = StreamedFile->GetFileSize();
+		StreamedFile->SetStreamingGranularity(StreamingGranularity);
 		UE_LOG(LogWwiseFileHandler, Verbose, TEXT("FWwiseStreamedExternalSourceFileState::LoadInSoundEngine %" PRIu32 " (%s)"), MediaId, *MediaPathName.ToString());
 		INC_DWORD_STAT(STAT_WwiseFileHandlerLoadedExternalSourceMedia);
 		return LoadInSoundEngineSucceeded(MoveTemp(Callback));
@@ -54,6 +54,10 @@ FWwiseFileCache::FWwiseFileCache():
 
 FWwiseFileCache::~FWwiseFileCache()
 {
+	CloseIdleFileHandles();
+
+	FScopeLock Lock(&FileHandlePoolLock);
+	UE_CLOG(FileHandlePool.Num() > 0, LogWwiseFileHandler, Log, TEXT("FWwiseFileCache::~FWwiseFileCache: %" PRIi32 " file handle(s) still in use. Will leak."), FileHandlePool.Num());
 }
 
 void FWwiseFileCache::CreateFileCacheHandle(
@@ -69,6 +73,166 @@ void FWwiseFileCache::CreateFileCacheHandle(
 	OutHandle->Open(MoveTemp(OnDone));
 }
 
+bool FWwiseFileCache::AcquireFileHandle(const FString& Pathname, IAsyncReadFileHandle*& OutFileHandle, int64& OutFileSize)
+{
+	FScopeLock Lock(&FileHandlePoolLock);
+	auto* PooledFileHandle = FileHandlePool.Find(Pathname);
+	if (!PooledFileHandle)
+	{
+		++NumFileHandlePoolMisses;
+		return false;
+	}
+
+	if (PooledFileHandle->NumUsers++ == 0 && PooledFileHandle->IdleNode)
+	{
+		IdleFileHandles.RemoveNode(PooledFileHandle->IdleNode);
+		PooledFileHandle->IdleNode = nullptr;
+		DEC_DWORD_STAT(STAT_WwiseFileHandlerIdleFileHandles);
+	}
+	OutFileHandle = PooledFileHandle->FileHandle;
+	OutFileSize = PooledFileHandle->FileSize;
+
+	++NumFileHandlePoolHits;
+	INC_DWORD_STAT(STAT_WwiseFileHandlerFileHandlePoolHits);
+	return true;
+}
+
+bool FWwiseFileCache::AddFileHandle(const FString& Pathname, IAsyncReadFileHandle* InFileHandle, int64 InFileSize)
+{
+	FScopeLock Lock(&FileHandlePoolLock);
+	if (FileHandlePool.Contains(Pathname))
+	{
+		// Opened concurrently by another handle. The caller keeps its own.
+		return false;
+	}
+	FileHandlePool.Add(Pathname, FPooledFileHandle{ InFileHandle, InFileSize, 1 });
+	return true;
+}
+
+void FWwiseFileCache::ReleaseFileHandle(const FString& Pathname, IAsyncReadFileHandle* InFileHandle)
+{
+	TArray<IAsyncReadFileHandle*> FileHandlesToClose;
+	{
+		FScopeLock Lock(&FileHandlePoolLock);
+		auto* PooledFileHandle = FileHandlePool.Find(Pathname);
+		if (UNLIKELY(!PooledFileHandle || PooledFileHandle->FileHandle != InFileHandle || PooledFileHandle->NumUsers <= 0))
+		{
+			UE_LOG(LogWwiseFileHandler, Error, TEXT("FWwiseFileCache::ReleaseFileHandle: Releasing unknown file handle for %s."), *Pathname);
+			return;
+		}
+		if (--PooledFileHandle->NumUsers > 0)
+		{
+			return;
+		}
+
+		IdleFileHandles.AddTail(Pathname);
+		PooledFileHandle->IdleNode = IdleFileHandles.GetTail();
+		INC_DWORD_STAT(STAT_WwiseFileHandlerIdleFileHandles);
+		while (IdleFileHandles.Num() > FMath::Max(MaxIdleFileHandles, 0))
+		{
+			auto* LeastRecentlyUsed = IdleFileHandles.GetHead();
+			FileHandlesToClose.Add(FileHandlePool.FindAndRemoveChecked(LeastRecentlyUsed->GetValue()).FileHandle);
+			IdleFileHandles.RemoveNode(LeastRecentlyUsed);
+			DEC_DWORD_STAT(STAT_WwiseFileHandlerIdleFileHandles);
+		}
+	}
+	CloseFileHandles(MoveTemp(FileHandlesToClose));
+}
+
+void FWwiseFileCache::CloseIdleFileHandles()
+{
+	TArray<IAsyncReadFileHandle*> FileHandlesToClose;
+	{
+		FScopeLock Lock(&FileHandlePoolLock);
+		for (const auto& Idle : IdleFileHandles)
+		{
+			FileHandlesToClose.Add(FileHandlePool.FindAndRemoveChecked(Idle).FileHandle);
+			DEC_DWORD_STAT(STAT_WwiseFileHandlerIdleFileHandles);
+		}
+		IdleFileHandles.Empty();
+	}
+	CloseFileHandles(MoveTemp(FileHandlesToClose));
+}
+
+void FWwiseFileCache::CloseFileHandles(TArray<IAsyncReadFileHandle*>&& FileHandles)
+{
+	SCOPED_WWISEFILEHANDLER_EVENT_3(TEXT("FWwiseFileCache::CloseFileHandles"));
+	for (auto* FileHandle : FileHandles)
+	{
+		delete FileHandle;
+		DEC_DWORD_STAT(STAT_WwiseFileHandlerOpenedStreams);
+	}
+}
+
+FWwiseFileCache::FStats FWwiseFileCache::GetStats() const
+{
+	FStats Result;
+	Result.NumFileHandlePoolHits = NumFileHandlePoolHits.load(std::memory_order_relaxed);
+	Result.NumFileHandlePoolMisses = NumFileHandlePoolMisses.load(std::memory_order_relaxed);
+	Result.NumCoalescedRequests = NumCoalescedRequests.load(std::memory_order_relaxed);
+	Result.NumCoalescedReads = NumCoalescedReads.load(std::memory_order_relaxed);
+	Result.CoalescedBytes = CoalescedBytes.load(std::memory_order_relaxed);
+	Result.NumPrefetchHits = NumPrefetchHits.load(std::memory_order_relaxed);
+	return Result;
+}
+
+struct FWwiseFileCacheHandle::FBatchScope::TLS
+{
+	static thread_local FBatchScope* Outermost;
+};
+thread_local FWwiseFileCacheHandle::FBatchScope* FWwiseFileCacheHandle::FBatchScope::TLS::Outermost = nullptr;
+
+FWwiseFileCacheHandle::FBatchScope::FBatchScope() :
+	bIsOutermost(TLS::Outermost == nullptr)
+{
+	if (bIsOutermost)
+	{
+		TLS::Outermost = this;
+	}
+}
+
+FWwiseFileCacheHandle::FBatchScope::~FBatchScope()
+{
+	if (!bIsOutermost)
+	{
+		return;
+	}
+	TLS::Outermost = nullptr;
+	if (PendingReads.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPED_WWISEFILEHANDLER_EVENT_3(TEXT("FWwiseFileCacheHandle::FBatchScope Flush"));
+	PendingReads.StableSort([](const TPair<FWwiseFileCacheHandle*, FPendingRead>& Lhs, const TPair<FWwiseFileCacheHandle*, FPendingRead>& Rhs)
+	{
+		return Lhs.Key < Rhs.Key;
+	});
+
+	FPendingReads Reads;
+	for (int32 Index = 0; Index < PendingReads.Num(); ++Index)
+	{
+		auto* Handle = PendingReads[Index].Key;
+		Reads.Emplace(MoveTemp(PendingReads[Index].Value));
+		if (Index + 1 == PendingReads.Num() || PendingReads[Index + 1].Key != Handle)
+		{
+			Handle->IssueReads(MoveTemp(Reads));
+			Reads.Reset();
+		}
+	}
+}
+
+bool FWwiseFileCacheHandle::FBatchScope::Defer(FWwiseFileCacheHandle* Handle, FPendingRead& Read)
+{
+	auto* Outermost = TLS::Outermost;
+	if (!Outermost)
+	{
+		return false;
+	}
+	Outermost->PendingReads.Emplace(Handle, MoveTemp(Read));
+	return true;
+}
+
 FWwiseFileCacheHandle::FWwiseFileCacheHandle(const FString& InPathname) :
 	Pathname { InPathname },
 	FileHandle { nullptr },
@@ -82,14 +246,30 @@ FWwiseFileCacheHandle::~FWwiseFileCacheHandle()
 {
 	SCOPED_WWISEFILEHANDLER_EVENT_3(TEXT("FWwiseFileCacheHandle::~FWwiseFileCacheHandle"));
 
-	const auto* FileHandleToDestroy = FileHandle; FileHandle = nullptr;
+	auto* FileHandleToDestroy = FileHandle; FileHandle = nullptr;
 
 	const auto NumRequests = RequestsInFlight.load(std::memory_order_seq_cst);
 	if (LIKELY(NumRequests == 0))
 	{
-		UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::~FWwiseFileCacheHandle (%p): Closing %s."), this, *Pathname);
-		delete FileHandleToDestroy;
-		DEC_DWORD_STAT(STAT_WwiseFileHandlerOpenedStreams);
+		if (bPooledFileHandle)
+		{
+			const auto FileCache = FWwiseFileCache::Get();
+			if (LIKELY(FileCache))
+			{
+				UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::~FWwiseFileCacheHandle (%p): Releasing %s."), this, *Pathname);
+				FileCache->ReleaseFileHandle(Pathname, FileHandleToDestroy);
+			}
+			else
+			{
+				UE_LOG(LogWwiseFileHandler, Log, TEXT("FWwiseFileCacheHandle::~FWwiseFileCacheHandle (%p): Releasing %s after FileCache module is destroyed. Will leak."), this, *Pathname);
+			}
+		}
+		else if (FileHandleToDestroy)
+		{
+			UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::~FWwiseFileCacheHandle (%p): Closing %s."), this, *Pathname);
+			delete FileHandleToDestroy;
+			DEC_DWORD_STAT(STAT_WwiseFileHandlerOpenedStreams);
+		}
 	}
 	else
 	{
@@ -135,10 +315,20 @@ void FWwiseFileCacheHandle::Open(FWwiseFileOperationDone&& OnDone)
 	}
 
 	++RequestsInFlight;
-	FileCache->OpenQueue.Async(WWISEFILEHANDLER_ASYNC_NAME("FWwiseFileCacheHandle::Open async"), [this, OnDone = MoveTemp(OnDone)]() mutable
+	FileCache->OpenQueue.Async(WWISEFILEHANDLER_ASYNC_NAME("FWwiseFileCacheHandle::Open async"), [this, FileCache, OnDone = MoveTemp(OnDone)]() mutable
 	{
 		check(!FileHandle);
 
+		if (FileCache->AcquireFileHandle(Pathname, FileHandle, FileSize))
+		{
+			UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::Open (%p): Reusing pooled file handle for %s."), this, *Pathname);
+			bPooledFileHandle = true;
+			delete InitializationStat; InitializationStat = nullptr;
+			CallDone(true, MoveTemp(InitializationDone));
+			RemoveRequestInFlight();
+			return;
+		}
+
 		UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::Open (%p): Opening %s."), this, *Pathname);
 		IAsyncReadFileHandle* CurrentFileHandle;
 		ASYNC_INC_DWORD_STAT(STAT_WwiseFileHandlerOpenedStreams);
@@ -181,6 +371,11 @@ void FWwiseFileCacheHandle::OnSizeRequestDone(bool bWasCancelled, IAsyncReadRequ
 	FileSize = Request->GetSizeResults();
 
 	const bool bSizeOpSuccess = LIKELY(FileSize > 0);
+	if (bSizeOpSuccess)
+	{
+		const auto FileCache = FWwiseFileCache::Get();
+		bPooledFileHandle = FileCache && FileCache->AddFileHandle(Pathname, FileHandle, FileSize);
+	}
 
 	UE_CLOG(!bSizeOpSuccess, LogWwiseFileHandler, Log, TEXT("FWwiseFileCacheHandle::OnSizeRequestDone (%p): Streamed file \"%s\" could not be opened."), this, *Pathname);
 	UE_CLOG(bSizeOpSuccess, LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::OnSizeRequestDone (%p): Initializing %s succeeded."), this, *Pathname);
@@ -260,19 +455,141 @@ void FWwiseFileCacheHandle::ReadData(uint8* OutBuffer, int64 Offset, int64 Bytes
 	EAsyncIOPriorityAndFlags Priority, FWwiseFileOperationDone&& OnDone)
 {
 	SCOPED_WWISEFILEHANDLER_EVENT_3(TEXT("FWwiseFileCacheHandle::ReadData"));
-	FWwiseAsyncCycleCounter Stat(GET_STATID(STAT_WwiseFileHandlerFileOperationLatency));
 	++RequestsInFlight;
+	check(BytesToRead > 0);
+
+	FPendingRead Read{ OutBuffer, Offset, BytesToRead, Priority, MoveTemp(OnDone) };
+	if (FBatchScope::Defer(this, Read))
+	{
+		UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::ReadData (%p): Deferring %" PRIi64 "@%" PRIi64 " in %s"), this, BytesToRead, Offset, *Pathname);
+		return;
+	}
+
+	FPendingReads Reads;
+	Reads.Emplace(MoveTemp(Read));
+	IssueReads(MoveTemp(Reads));
+}
 
-	IAsyncReadFileHandle* CurrentFileHandle = FileHandle;
-	if (UNLIKELY(!CurrentFileHandle))
+void FWwiseFileCacheHandle::IssueReads(FPendingReads&& Reads)
+{
+	SCOPED_WWISEFILEHANDLER_EVENT_3(TEXT("FWwiseFileCacheHandle::IssueReads"));
+	if (UNLIKELY(!FileHandle))
 	{
 		UE_LOG(LogWwiseFileHandler, Error, TEXT("FWwiseFileCacheHandle::ReadData (%p): Trying to read in file %s while it was not properly initialized."), this, *Pathname);
-		OnReadDataDone(false, MoveTemp(OnDone));
+		for (auto& Read : Reads)
+		{
+			OnReadDataDone(false, MoveTemp(Read.OnDone));
+			RemoveRequestInFlight();
+		}
 		return;
 	}
 
-	UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::ReadData (%p): %" PRIi64 "@%" PRIi64 " in %s"), this, BytesToRead, Offset, *Pathname);
-	FAsyncFileCallBack ReadCallbackFunction = [this, OnDone = new FWwiseFileOperationDone(MoveTemp(OnDone)), BytesToRead, Stat = MoveTemp(Stat)](bool bWasCancelled, IAsyncReadRequest* Request) mutable
+	// Serve what was already prefetched, or is being prefetched
+	FPendingReads PrefetchedReads;
+	{
+		FScopeLock Lock(&ReadLock);
+		for (int32 Index = Reads.Num() - 1; Index >= 0; --Index)
+		{
+			auto& Read = Reads[Index];
+			if (PrefetchBuffer.Num() > 0 && Read.Offset >= PrefetchOffset && Read.GetEnd() <= PrefetchOffset + PrefetchBuffer.Num())
+			{
+				FMemory::Memcpy(Read.OutBuffer, PrefetchBuffer.GetData() + (Read.Offset - PrefetchOffset), Read.BytesToRead);
+				PrefetchedReads.Emplace(MoveTemp(Read));
+			}
+			else if (InFlightPrefetchEnd > InFlightPrefetchOffset && Read.Offset >= InFlightPrefetchOffset && Read.GetEnd() <= InFlightPrefetchEnd)
+			{
+				InFlightPrefetchReads.Emplace(MoveTemp(Read));
+			}
+			else
+			{
+				continue;
+			}
+			LastReadEnd = FMath::Max(LastReadEnd, Read.GetEnd());
+			Reads.RemoveAt(Index, 1, false);
+		}
+	}
+	for (auto& Read : PrefetchedReads)
+	{
+		UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::ReadData (%p): %" PRIi64 "@%" PRIi64 " in %s served from prefetch"), this, Read.BytesToRead, Read.Offset, *Pathname);
+		if (auto* FileCache = FWwiseFileCache::Get())
+		{
+			++FileCache->NumPrefetchHits;
+		}
+		INC_DWORD_STAT(STAT_WwiseFileHandlerPrefetchHits);
+		OnReadDataDone(true, MoveTemp(Read.OnDone));
+		RemoveRequestInFlight();
+	}
+	if (Reads.Num() == 0)
+	{
+		return;
+	}
+
+	const auto FileCache = FWwiseFileCache::Get();
+	const int64 MaxCoalescedReadSize = FileCache ? FileCache->MaxCoalescedReadSize : 0;
+	const int64 Granularity = StreamingGranularity.load(std::memory_order_relaxed);
+
+	Reads.StableSort([](const FPendingRead& Lhs, const FPendingRead& Rhs)
+	{
+		return Lhs.Offset < Rhs.Offset;
+	});
+
+	for (int32 RunStart = 0; RunStart < Reads.Num();)
+	{
+		// Merge adjacent or overlapping reads
+		const int64 Offset = Reads[RunStart].Offset;
+		int64 End = Reads[RunStart].GetEnd();
+		auto Priority = Reads[RunStart].Priority;
+		int32 RunEnd = RunStart + 1;
+		for (; RunEnd < Reads.Num() && Reads[RunEnd].Offset <= End && FMath::Max(End, Reads[RunEnd].GetEnd()) - Offset <= MaxCoalescedReadSize; ++RunEnd)
+		{
+			End = FMath::Max(End, Reads[RunEnd].GetEnd());
+			if ((Reads[RunEnd].Priority & AIOP_PRIORITY_MASK) > (Priority & AIOP_PRIORITY_MASK))
+			{
+				Priority = Reads[RunEnd].Priority;
+			}
+		}
+
+		// Extend sequential streams with the next granularity block, unless one is already on its way
+		int64 PrefetchBytes = 0;
+		{
+			FScopeLock Lock(&ReadLock);
+			if (Granularity > 0 && Offset == LastReadEnd && InFlightPrefetchEnd <= InFlightPrefetchOffset)
+			{
+				PrefetchBytes = FMath::Clamp(FileSize - End, (int64)0, Granularity);
+				if (PrefetchBytes > 0)
+				{
+					InFlightPrefetchOffset = End;
+					InFlightPrefetchEnd = End + PrefetchBytes;
+				}
+			}
+			LastReadEnd = End;
+		}
+
+		const int32 NumReads = RunEnd - RunStart;
+		if (NumReads == 1 && PrefetchBytes == 0)
+		{
+			IssueRead(MoveTemp(Reads[RunStart]));
+		}
+		else
+		{
+			FPendingReads Run;
+			for (int32 Index = RunStart; Index < RunEnd; ++Index)
+			{
+				Run.Emplace(MoveTemp(Reads[Index]));
+			}
+			IssueCoalescedRead(MoveTemp(Run), Offset, End - Offset, PrefetchBytes, Priority);
+		}
+		RunStart = RunEnd;
+	}
+}
+
+void FWwiseFileCacheHandle::IssueRead(FPendingRead&& Read)
+{
+	FWwiseAsyncCycleCounter Stat(GET_STATID(STAT_WwiseFileHandlerFileOperationLatency));
+	const auto BytesToRead = Read.BytesToRead;
+
+	UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::ReadData (%p): %" PRIi64 "@%" PRIi64 " in %s"), this, BytesToRead, Read.Offset, *Pathname);
+	FAsyncFileCallBack ReadCallbackFunction = [this, OnDone = new FWwiseFileOperationDone(MoveTemp(Read.OnDone)), BytesToRead, Stat = MoveTemp(Stat)](bool bWasCancelled, IAsyncReadRequest* Request) mutable
 	{
 		SCOPED_WWISEFILEHANDLER_EVENT_3(TEXT("FWwiseFileCacheHandle::ReadData Callback"));
 		if (!bWasCancelled && Request)	// Do not add Request->GetReadResults() since it will break subsequent results retrievals.
@@ -283,8 +600,106 @@ void FWwiseFileCacheHandle::ReadData(uint8* OutBuffer, int64 Offset, int64 Bytes
 		delete OnDone;
 		DeleteRequest(Request);
 	};
+
+	const auto* Request = ReadRequest(Read.Offset, BytesToRead, Read.Priority, &ReadCallbackFunction, Read.OutBuffer);
+	if (UNLIKELY(!Request))
+	{
+		UE_LOG(LogWwiseFileHandler, Verbose, TEXT("FWwiseFileCacheHandle::ReadData (%p): ReadRequest %s failed instantiating."), this, *Pathname);
+		ReadCallbackFunction(true, nullptr);
+	}
+	else
+	{
+		UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::ReadData (%p req:%p) [%" PRIi32 "]: Created request"), this, Request, FPlatformTLS::GetCurrentThreadId());
+	}
+}
+
+void FWwiseFileCacheHandle::IssueCoalescedRead(FPendingReads&& Reads, int64 Offset, int64 BytesToRead, int64 PrefetchBytes, EAsyncIOPriorityAndFlags Priority)
+{
+	FWwiseAsyncCycleCounter Stat(GET_STATID(STAT_WwiseFileHandlerFileOperationLatency));
+	++RequestsInFlight;		// For the coalesced request itself
+
+	const int64 TotalBytes = BytesToRead + PrefetchBytes;
+	UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::ReadData (%p): Coalescing %" PRIi32 " read(s) in %" PRIi64 "@%" PRIi64 " (+%" PRIi64 " prefetch) in %s"), this, Reads.Num(), BytesToRead, Offset, PrefetchBytes, *Pathname);
+	if (auto* FileCache = FWwiseFileCache::Get())
+	{
+		++FileCache->NumCoalescedRequests;
+		FileCache->NumCoalescedReads += Reads.Num();
+		FileCache->CoalescedBytes += TotalBytes;
+	}
+	INC_DWORD_STAT(STAT_WwiseFileHandlerCoalescedRequests);
+	INC_FLOAT_STAT_BY(STAT_WwiseFileHandlerTotalCoalescedMB, static_cast<float>(TotalBytes) / 1024 / 1024);
+
+	auto* Buffer = new TArray<uint8>;
+	Buffer->SetNumUninitialized(TotalBytes);
+	auto* PendingReads = new FPendingReads(MoveTemp(Reads));
+
+	FAsyncFileCallBack ReadCallbackFunction = [this, Buffer, PendingReads, Offset, PrefetchBytes, Stat = MoveTemp(Stat)](bool bWasCancelled, IAsyncReadRequest* Request) mutable
+	{
+		SCOPED_WWISEFILEHANDLER_EVENT_3(TEXT("FWwiseFileCacheHandle::ReadData Coalesced Callback"));
+		const bool bResult = !bWasCancelled && Request && Request->GetReadResults();
+		if (bResult)
+		{
+			ASYNC_INC_FLOAT_STAT_BY(STAT_WwiseFileHandlerTotalStreamedMB, static_cast<float>(Buffer->Num()) / 1024 / 1024);
+		}
+		OnCoalescedReadDone(bResult, MoveTemp(*PendingReads), MoveTemp(*Buffer), Offset, PrefetchBytes);
+		delete PendingReads;
+		delete Buffer;
+		DeleteRequest(Request);
+	};
+
+	const auto* Request = ReadRequest(Offset, TotalBytes, Priority, &ReadCallbackFunction, Buffer->GetData());
+	if (UNLIKELY(!Request))
+	{
+		UE_LOG(LogWwiseFileHandler, Verbose, TEXT("FWwiseFileCacheHandle::ReadData (%p): Coalesced ReadRequest %s failed instantiating."), this, *Pathname);
+		ReadCallbackFunction(true, nullptr);
+	}
+	else
+	{
+		UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::ReadData (%p req:%p) [%" PRIi32 "]: Created coalesced request"), this, Request, FPlatformTLS::GetCurrentThreadId());
+	}
+}
+
+void FWwiseFileCacheHandle::OnCoalescedReadDone(bool bResult, FPendingReads&& Reads, TArray<uint8>&& Buffer, int64 Offset, int64 PrefetchBytes)
+{
+	for (auto& Read : Reads)
+	{
+		if (bResult)
+		{
+			FMemory::Memcpy(Read.OutBuffer, Buffer.GetData() + (Read.Offset - Offset), Read.BytesToRead);
+		}
+		OnReadDataDone(bResult, MoveTemp(Read.OnDone));
+		RemoveRequestInFlight();
+	}
+
+	if (PrefetchBytes == 0)
+	{
+		return;
+	}
+
+	// Keep the buffer around for the next sequential reads, and serve the ones that arrived while it was being read.
+	FPendingReads WaitingReads;
+	{
+		FScopeLock Lock(&ReadLock);
+		InFlightPrefetchOffset = InFlightPrefetchEnd = 0;
+		WaitingReads = MoveTemp(InFlightPrefetchReads);
+		InFlightPrefetchReads.Reset();
+		if (bResult)
+		{
+			PrefetchOffset = Offset;
+			PrefetchBuffer = MoveTemp(Buffer);
+		}
+	}
+	if (WaitingReads.Num() > 0)
+	{
+		// Failed prefetches fall back to individual requests.
+		IssueReads(MoveTemp(WaitingReads));
+	}
+}
+
+IAsyncReadRequest* FWwiseFileCacheHandle::ReadRequest(int64 Offset, int64 BytesToRead, EAsyncIOPriorityAndFlags Priority,
+	FAsyncFileCallBack* Callback, uint8* OutBuffer)
+{
 	ASYNC_INC_FLOAT_STAT_BY(STAT_WwiseFileHandlerStreamingKB, static_cast<float>(BytesToRead) / 1024);
-	check(BytesToRead > 0);
 
 #if STATS
 	switch (Priority & EAsyncIOPriorityAndFlags::AIOP_PRIORITY_MASK)
@@ -300,16 +715,7 @@ void FWwiseFileCacheHandle::ReadData(uint8* OutBuffer, int64 Offset, int64 Bytes
 	}
 #endif
 	SCOPED_WWISEFILEHANDLER_EVENT_3(TEXT("FWwiseFileCacheHandle::ReadData Async ReadRequest"));
-	const auto* Request = CurrentFileHandle->ReadRequest(Offset, BytesToRead, Priority, &ReadCallbackFunction, OutBuffer);
-	if (UNLIKELY(!Request))
-	{
-		UE_LOG(LogWwiseFileHandler, Verbose, TEXT("FWwiseFileCacheHandle::ReadData (%p): ReadRequest %s failed instantiating."), this, *Pathname);
-		ReadCallbackFunction(true, nullptr);
-	}
-	else
-	{
-		UE_LOG(LogWwiseFileHandler, VeryVerbose, TEXT("FWwiseFileCacheHandle::ReadData (%p req:%p) [%" PRIi32 "]: Created request"), this, Request, FPlatformTLS::GetCurrentThreadId());
-	}
+	return FileHandle->ReadRequest(Offset, BytesToRead, Priority, Callback, OutBuffer);
 }
 
 void FWwiseFileCacheHandle::ReadAkData(uint8* OutBuffer, int64 Offset, int64 BytesToRead, int8 AkPriority, FWwiseFileOperationDone&& OnDone)
@@ -21,6 +21,7 @@ Copyright (c) 2024 Audiokinetic Inc.
 #include "Wwise/WwiseWriteFileState.h"
 #include "Wwise/WwiseSoundBankManager.h"
 #include "Wwise/WwiseExternalSourceManager.h"
+#include "Wwise/WwiseFileCache.h"
 #include "Wwise/WwiseMediaManager.h"
 #include "Wwise/WwiseStreamableFileHandler.h"
 
@@ -229,6 +230,8 @@ void FWwiseIOHookImpl::BatchRead(
 
 	BatchExecutionQueue.Async(WWISEFILEHANDLER_ASYNC_NAME("FWwiseIOHookImpl::BatchRead Async"), [this, TransferItems = TArray<BatchIoTransferItem>(in_pTransferItems, in_uNumTransfers)]() mutable
 	{
+		// Reads of the same file are coalesced once every transfer of the batch is known
+		FWwiseFileCacheHandle::FBatchScope BatchScope;
 		for (auto& TransferItem : TransferItems)
 		{
 			auto& FileDesc = *TransferItem.pFileDesc;
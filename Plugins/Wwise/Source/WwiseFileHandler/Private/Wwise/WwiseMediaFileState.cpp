@@ -281,6 +281,7 @@ void FWwiseStreamedMediaFileState::LoadInSoundEngine(FLoadInSoundEngineCallback&
 		}
 
 		iFileSize = StreamedFile->GetFileSize();
+		StreamedFile->SetStreamingGranularity(StreamingGranularity);
 		UE_CLOG(pMediaMemory == nullptr, LogWwiseFileHandler, Verbose, TEXT("FWwiseStreamedMediaFileState::LoadInSoundEngine: Loaded: %" PRIu32 " (%s)"), MediaId, *DebugName.ToString());
 		UE_CLOG(pMediaMemory != nullptr, LogWwiseFileHandler, Verbose, TEXT("FWwiseStreamedMediaFileState::LoadInSoundEngine: Loaded: %" PRIu32 " (%s) with prefetch @ %p %" PRIu32 " bytes."), MediaId, *DebugName.ToString(), pMediaMemory, uMediaSize);
 		INC_DWORD_STAT(STAT_WwiseFileHandlerLoadedMedia);
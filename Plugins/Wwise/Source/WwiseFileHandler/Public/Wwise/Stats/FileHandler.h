@@ -46,6 +46,11 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batched Requests"), STAT_WwiseFileHandle
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Requests"), STAT_WwiseFileHandlerPendingRequests, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Total Requests"), STAT_WwiseFileHandlerTotalRequests, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
 DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Total Streaming MB"), STAT_WwiseFileHandlerTotalStreamedMB, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Idle Pooled File Handles"), STAT_WwiseFileHandlerIdleFileHandles, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("File Handle Pool Hits"), STAT_WwiseFileHandlerFileHandlePoolHits, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Coalesced Requests"), STAT_WwiseFileHandlerCoalescedRequests, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Total Coalesced MB"), STAT_WwiseFileHandlerTotalCoalescedMB, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Prefetch Hits"), STAT_WwiseFileHandlerPrefetchHits, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
 
 DECLARE_CYCLE_STAT_EXTERN(TEXT("IO Request Latency"), STAT_WwiseFileHandlerIORequestLatency, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("File Operation Latency"), STAT_WwiseFileHandlerFileOperationLatency, STATGROUP_WwiseFileHandlerLowLevelIO, WWISEFILEHANDLER_API);
@@ -17,11 +17,16 @@ Copyright (c) 2024 Audiokinetic Inc.
 
 #pragma once
 
+#include "Async/AsyncFileHandle.h"
+#include "Containers/List.h"
 #include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/CriticalSection.h"
 #include "AkInclude.h"
 
 #include "Wwise/WwiseExecutionQueue.h"
 
+#include <atomic>
+
 class FWwiseAsyncCycleCounter;
 class FWwiseFileCacheHandle;
 
@@ -50,13 +55,97 @@ public:
 	virtual ~FWwiseFileCache();
 	virtual void CreateFileCacheHandle(FWwiseFileCacheHandle*& OutHandle, const FString& Pathname, FWwiseFileOperationDone&& OnDone);
 
+	/**
+	 * Opened file handles are shared by pathname.
+	 *
+	 * A file handle stays open as long as a FWwiseFileCacheHandle uses it. Once unused, it is kept open in a
+	 * bounded LRU list, so reopening a recently closed file doesn't go through the platform file again.
+	 */
+	virtual bool AcquireFileHandle(const FString& Pathname, IAsyncReadFileHandle*& OutFileHandle, int64& OutFileSize);
+	virtual bool AddFileHandle(const FString& Pathname, IAsyncReadFileHandle* InFileHandle, int64 InFileSize);
+	virtual void ReleaseFileHandle(const FString& Pathname, IAsyncReadFileHandle* InFileHandle);
+	virtual void CloseIdleFileHandles();
+
+	struct FStats
+	{
+		uint64 NumFileHandlePoolHits{ 0 };		///< Opens that reused a pooled file handle
+		uint64 NumFileHandlePoolMisses{ 0 };	///< Opens that had to open the file
+		uint64 NumCoalescedRequests{ 0 };		///< Read requests issued for more than one read, or with a prefetch
+		uint64 NumCoalescedReads{ 0 };			///< Reads served by these requests
+		uint64 CoalescedBytes{ 0 };				///< Bytes read by these requests
+		uint64 NumPrefetchHits{ 0 };			///< Reads served from prefetched data, without a request
+	};
+	FStats GetStats() const;
+
 	FWwiseExecutionQueue OpenQueue;
 	FWwiseExecutionQueue DeleteRequestQueue;
+
+	/** Number of unused file handles kept open. 0 closes files as soon as they are unused. */
+	int32 MaxIdleFileHandles{ 32 };
+
+	/** Reads are never coalesced into requests larger than this. */
+	int64 MaxCoalescedReadSize{ 1024 * 1024 };
+
+protected:
+	friend class FWwiseFileCacheHandle;
+
+	using FIdleFileHandleList = TDoubleLinkedList<FString>;
+	struct FPooledFileHandle
+	{
+		IAsyncReadFileHandle* FileHandle;
+		int64 FileSize;
+		int32 NumUsers;
+		FIdleFileHandleList::TDoubleLinkedListNode* IdleNode{ nullptr };	// Our entry in IdleFileHandles while unused
+	};
+	FCriticalSection FileHandlePoolLock;
+	TMap<FString, FPooledFileHandle> FileHandlePool;
+	FIdleFileHandleList IdleFileHandles;		// Least recently used first
+
+	std::atomic<uint64> NumFileHandlePoolHits{ 0 };
+	std::atomic<uint64> NumFileHandlePoolMisses{ 0 };
+	std::atomic<uint64> NumCoalescedRequests{ 0 };
+	std::atomic<uint64> NumCoalescedReads{ 0 };
+	std::atomic<uint64> CoalescedBytes{ 0 };
+	std::atomic<uint64> NumPrefetchHits{ 0 };
+
+	void CloseFileHandles(TArray<IAsyncReadFileHandle*>&& FileHandles);
 };
 
 class WWISEFILEHANDLER_API FWwiseFileCacheHandle
 {
+protected:
+	struct FPendingRead
+	{
+		uint8* OutBuffer;
+		int64 Offset;
+		int64 BytesToRead;
+		EAsyncIOPriorityAndFlags Priority;
+		FWwiseFileOperationDone OnDone;
+
+		int64 GetEnd() const { return Offset + BytesToRead; }
+	};
+	using FPendingReads = TArray<FPendingRead, TInlineAllocator<4>>;
+
 public:
+	/**
+	 * Defers the ReadData calls done in this thread until the outermost scope ends.
+	 *
+	 * Deferred reads are then issued per file, adjacent or overlapping reads being coalesced into a single request.
+	 */
+	class WWISEFILEHANDLER_API FBatchScope
+	{
+	public:
+		FBatchScope();
+		~FBatchScope();
+
+		static bool Defer(FWwiseFileCacheHandle* Handle, FPendingRead& Read);
+
+	private:
+		struct TLS;
+		bool bIsOutermost;
+		TArray<TPair<FWwiseFileCacheHandle*, FPendingRead>> PendingReads;
+	};
+
 	FWwiseFileCacheHandle(const FString& Pathname);
 	virtual ~FWwiseFileCacheHandle();
 	virtual void CloseAndDelete();
@@ -67,6 +156,9 @@ public:
 	void ReadAkData(uint8* OutBuffer, int64 Offset, int64 BytesToRead, int8 AkPriority, FWwiseFileOperationDone&& OnDone);
 	void ReadAkData(const AkIoHeuristics& Heuristics, AkAsyncIOTransferInfo& TransferInfo, FWwiseAkFileOperationDone&& Callback);
 
+	/** Sequential reads are extended by this many bytes, and the next reads are served from memory. 0 disables prefetching. */
+	void SetStreamingGranularity(uint32 InStreamingGranularity) { StreamingGranularity = InStreamingGranularity; }
+
 	const FString& GetPathname() const { return Pathname; }
 	int64 GetFileSize() const { return FileSize; }
 
@@ -75,12 +167,30 @@ protected:
 
 	IAsyncReadFileHandle* FileHandle;
 	int64 FileSize;
+	bool bPooledFileHandle{ false };
+
+	std::atomic<uint32> StreamingGranularity{ 0 };
+
+	/** Sequential read detection and prefetched data. Protected by ReadLock. */
+	FCriticalSection ReadLock;
+	int64 LastReadEnd{ 0 };
+	int64 PrefetchOffset{ 0 };
+	TArray<uint8> PrefetchBuffer;
+	int64 InFlightPrefetchOffset{ 0 };
+	int64 InFlightPrefetchEnd{ 0 };
+	FPendingReads InFlightPrefetchReads;		// Reads waiting for the prefetch in flight
 
 	FWwiseFileOperationDone InitializationDone;
 	FWwiseAsyncCycleCounter* InitializationStat;
 
 	std::atomic<int32> RequestsInFlight { 0 };
 
+	virtual void IssueReads(FPendingReads&& Reads);
+	virtual void IssueRead(FPendingRead&& Read);
+	virtual void IssueCoalescedRead(FPendingReads&& Reads, int64 Offset, int64 BytesToRead, int64 PrefetchBytes, EAsyncIOPriorityAndFlags Priority);
+	virtual void OnCoalescedReadDone(bool bResult, FPendingReads&& Reads, TArray<uint8>&& Buffer, int64 Offset, int64 PrefetchBytes);
+	IAsyncReadRequest* ReadRequest(int64 Offset, int64 BytesToRead, EAsyncIOPriorityAndFlags Priority, FAsyncFileCallBack* Callback, uint8* OutBuffer);
+
 	void DeleteRequest(IAsyncReadRequest* Request);
 	virtual void OnDeleteRequest(IAsyncReadRequest* Request);
 	virtual void RemoveRequestInFlight();
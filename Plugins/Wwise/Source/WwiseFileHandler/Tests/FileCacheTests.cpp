@@ -0,0 +1,218 @@
+/*******************************************************************************
+The content of this file includes portions of the proprietary AUDIOKINETIC Wwise
+Technology released in source code form as part of the game integration package.
+The content of this file may not be used without valid licenses to the
+AUDIOKINETIC Wwise Technology.
+Note that the use of the game engine is subject to the Unreal(R) Engine End User
+License Agreement at https://www.unrealengine.com/en-US/eula/unreal
+
+License Usage
+
+Licensees holding valid licenses to the AUDIOKINETIC Wwise Technology may use
+this file in accordance with the end user license agreement provided with the
+software or, alternatively, in accordance with the terms contained
+in a written agreement between you and Audiokinetic Inc.
+Copyright (c) 2024 Audiokinetic Inc.
+*******************************************************************************/
+
+#include "Wwise/WwiseUnitTests.h"
+
+#if WWISE_UNIT_TESTS
+#include "Wwise/WwiseFileCache.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include <atomic>
+
+namespace WwiseFileCacheTests
+{
+	static uint8 ByteAt(int64 Offset)
+	{
+		return (uint8)((Offset * 31) ^ (Offset >> 8));
+	}
+
+	static FString WriteSyntheticFile(const TCHAR* Name, int64 Size)
+	{
+		const auto Pathname = FPaths::ProjectIntermediateDir() / TEXT("WwiseFileCacheTests") / Name;
+		TArray<uint8> Content;
+		Content.SetNumUninitialized(Size);
+		for (int64 Offset = 0; Offset < Size; ++Offset)
+		{
+			Content[Offset] = ByteAt(Offset);
+		}
+		CHECK(FFileHelper::SaveArrayToFile(Content, *Pathname));
+		return Pathname;
+	}
+
+	static bool Matches(const uint8* Buffer, int64 Offset, int64 Size)
+	{
+		for (int64 Byte = 0; Byte < Size; ++Byte)
+		{
+			if (Buffer[Byte] != ByteAt(Offset + Byte))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static FWwiseFileCacheHandle* OpenHandle(FWwiseFileCache& FileCache, const FString& Pathname)
+	{
+		FEventRef Done;
+		bool bOpened{ false };
+		FWwiseFileCacheHandle* Handle{ nullptr };
+		FileCache.CreateFileCacheHandle(Handle, Pathname, [&Done, &bOpened](bool bResult)
+		{
+			bOpened = bResult;
+			Done->Trigger();
+		});
+		CHECK(Done->Wait(1000));
+		CHECK(bOpened);
+		return Handle;
+	}
+
+	struct FRead
+	{
+		int64 Offset;
+		int64 Size;
+		TArray<uint8> Buffer;
+		bool bResult{ false };
+	};
+
+	static void ReadAll(FWwiseFileCacheHandle& Handle, TArray<FRead>& Reads, bool bBatch)
+	{
+		std::atomic<int> Remaining{ Reads.Num() };
+		FEventRef Done;
+		{
+			TOptional<FWwiseFileCacheHandle::FBatchScope> BatchScope;
+			if (bBatch)
+			{
+				BatchScope.Emplace();
+			}
+			for (auto& Read : Reads)
+			{
+				Read.Buffer.SetNumZeroed(Read.Size);
+				Handle.ReadData(Read.Buffer.GetData(), Read.Offset, Read.Size, AIOP_Normal, [&Read, &Remaining, &Done](bool bResult)
+				{
+					Read.bResult = bResult;
+					if (--Remaining == 0)
+					{
+						Done->Trigger();
+					}
+				});
+			}
+		}
+		CHECK(Done->Wait(1000));
+		for (const auto& Read : Reads)
+		{
+			CHECK(Read.bResult);
+			CHECK(Matches(Read.Buffer.GetData(), Read.Offset, Read.Size));
+		}
+	}
+}
+
+WWISE_TEST_CASE(FileHandler_FileCache_Smoke, "Wwise::FileHandler::FileCache_Smoke", "[ApplicationContextMask][SmokeFilter]")
+{
+	using namespace WwiseFileCacheTests;
+
+	auto* FileCache = FWwiseFileCache::Get();
+	if (!FileCache)
+	{
+		WWISE_TEST_LOG("FileCache not available. Skipping.");
+		return;
+	}
+
+	SECTION("Reopening uses the handle pool")
+	{
+		const auto Pathname = WriteSyntheticFile(TEXT("Reopen.bin"), 16 * 1024);
+		FileCache->CloseIdleFileHandles();
+		const auto Before = FileCache->GetStats();
+
+		auto* First = OpenHandle(*FileCache, Pathname);
+		CHECK(First->GetFileSize() == 16 * 1024);
+		First->CloseAndDelete();
+
+		auto* Second = OpenHandle(*FileCache, Pathname);
+		CHECK(Second->GetFileSize() == 16 * 1024);
+		TArray<FRead> Reads{ FRead{ 0, 4096 } };
+		ReadAll(*Second, Reads, false);
+		Second->CloseAndDelete();
+
+		const auto After = FileCache->GetStats();
+		CHECK(After.NumFileHandlePoolMisses - Before.NumFileHandlePoolMisses == 1);
+		CHECK(After.NumFileHandlePoolHits - Before.NumFileHandlePoolHits == 1);
+	}
+
+	SECTION("Batched reads are coalesced")
+	{
+		const auto Pathname = WriteSyntheticFile(TEXT("Coalesce.bin"), 64 * 1024);
+		auto* Handle = OpenHandle(*FileCache, Pathname);
+		const auto Before = FileCache->GetStats();
+
+		// Two adjacent, one overlapping, one apart
+		TArray<FRead> Reads{ FRead{ 8192, 4096 }, FRead{ 0, 4096 }, FRead{ 4096, 4096 }, FRead{ 6000, 4000 }, FRead{ 32768, 1024 } };
+		ReadAll(*Handle, Reads, true);
+
+		const auto After = FileCache->GetStats();
+		CHECK(After.NumCoalescedRequests - Before.NumCoalescedRequests == 1);
+		CHECK(After.NumCoalescedReads - Before.NumCoalescedReads == 4);
+		CHECK(After.CoalescedBytes - Before.CoalescedBytes == 12288);
+		Handle->CloseAndDelete();
+	}
+
+	SECTION("Sequential reads are prefetched")
+	{
+		constexpr const int64 Granularity = 4096;
+		const auto Pathname = WriteSyntheticFile(TEXT("Prefetch.bin"), 16 * Granularity + 100);
+		auto* Handle = OpenHandle(*FileCache, Pathname);
+		Handle->SetStreamingGranularity(Granularity);
+		const auto Before = FileCache->GetStats();
+
+		for (int64 Offset = 0; Offset < Handle->GetFileSize(); Offset += Granularity)
+		{
+			TArray<FRead> Reads{ FRead{ Offset, FMath::Min(Granularity, Handle->GetFileSize() - Offset) } };
+			ReadAll(*Handle, Reads, false);
+		}
+
+		const auto After = FileCache->GetStats();
+		WWISE_TEST_LOG("Prefetch: %d hits, %d coalesced requests for 17 reads.",
+			(int)(After.NumPrefetchHits - Before.NumPrefetchHits), (int)(After.NumCoalescedRequests - Before.NumCoalescedRequests));
+		CHECK(After.NumPrefetchHits - Before.NumPrefetchHits >= 8);
+		Handle->CloseAndDelete();
+	}
+
+	IFileManager::Get().DeleteDirectory(*(FPaths::ProjectIntermediateDir() / TEXT("WwiseFileCacheTests")), false, true);
+}
+
+WWISE_TEST_CASE(FileHandler_FileCache_Perf, "Wwise::FileHandler::FileCache_Perf", "[ApplicationContextMask][PerfFilter]")
+{
+	using namespace WwiseFileCacheTests;
+
+	auto* FileCache = FWwiseFileCache::Get();
+	if (!FileCache)
+	{
+		WWISE_TEST_LOG("FileCache not available. Skipping.");
+		return;
+	}
+
+	SECTION("Reopen")
+	{
+		constexpr const int LoopCount = 500;
+		constexpr const int ExpectedUS = 1000000;
+		const auto Pathname = WriteSyntheticFile(TEXT("ReopenPerf.bin"), 4096);
+
+		FDateTime StartTime = FDateTime::UtcNow();
+		for (int i = 0; i < LoopCount; ++i)
+		{
+			OpenHandle(*FileCache, Pathname)->CloseAndDelete();
+		}
+		FTimespan Duration = FDateTime::UtcNow() - StartTime;
+		WWISE_TEST_LOG("FileCache Reopen %dus < %dus", (int)Duration.GetTotalMicroseconds(), ExpectedUS);
+		CHECK(Duration.GetTotalMicroseconds() < ExpectedUS);
+	}
+
+	IFileManager::Get().DeleteDirectory(*(FPaths::ProjectIntermediateDir() / TEXT("WwiseFileCacheTests")), false, true);
+}
+
+#endif // WWISE_UNIT_TESTS
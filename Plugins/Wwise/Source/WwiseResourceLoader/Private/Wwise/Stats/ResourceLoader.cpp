@@ -27,6 +27,9 @@ DEFINE_STAT(STAT_WwiseResourceLoaderMedia);
 DEFINE_STAT(STAT_WwiseResourceLoaderShareSets);
 DEFINE_STAT(STAT_WwiseResourceLoaderSoundBanks);
 DEFINE_STAT(STAT_WwiseResourceLoaderSwitchContainerCombinations);
+DEFINE_STAT(STAT_WwiseResourceLoaderColdMedia);
+DEFINE_STAT(STAT_WwiseResourceLoaderColdMediaMemory);
+DEFINE_STAT(STAT_WwiseResourceLoaderMediaReloadHits);
 
 DEFINE_STAT(STAT_WwiseResourceLoaderTiming);
 
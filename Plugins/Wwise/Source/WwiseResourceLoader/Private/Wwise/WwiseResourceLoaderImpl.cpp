@@ -33,6 +33,7 @@ Copyright (c) 2024 Audiokinetic Inc.
 #include "Wwise/WwiseSoundBankManager.h"
 
 #include "Async/Async.h"
+#include "HAL/FileManager.h"
 
 #include <inttypes.h>
 
@@ -65,6 +66,7 @@ bool FWwiseSwitchContainerLeafGroupValueUsageCount::HaveAllKeys() const
 }
 
 WWISE_RESOURCELOADERIMPL_TEST_CONST bool FWwiseResourceLoaderImpl::Test::bMockSleepOnMediaLoad{ false };
+WWISE_RESOURCELOADERIMPL_TEST_CONST int64 FWwiseResourceLoaderImpl::Test::MockMediaResidentSize{ 0 };
 
 FWwiseResourceLoaderImpl::FWwiseResourceLoaderImpl() :
 	ExecutionQueue(WWISE_EQ_NAME("FWwiseResourceLoaderImpl::ExecutionQueue"))
@@ -85,6 +87,16 @@ FWwiseResourceLoaderImpl::FWwiseResourceLoaderImpl(
 #endif
 }
 
+FWwiseResourceLoaderImpl::~FWwiseResourceLoaderImpl()
+{
+	TArray<FWwiseMediaCookedData> Evicted;
+	{
+		FScopeLock Lock(&MediaResidencyLock);
+		EvictColdMediaLocked(0, Evicted);
+	}
+	UnloadEvictedMedia(MoveTemp(Evicted), []{});
+}
+
 FName FWwiseResourceLoaderImpl::GetUnrealExternalSourcePath() const
 {
 #if WITH_EDITORONLY_DATA
@@ -2635,6 +2647,72 @@ void FWwiseResourceLoaderImpl::LoadMediaFile(const FWwiseMediaCookedData& InMedi
 	UE_LOG(LogWwiseResourceLoader, VeryVerbose, TEXT("[LoadMediaAsync: %" PRIu32 "] %s at %s"),
 		(uint32)InMedia.MediaId, *InMedia.DebugName.ToString(), *InMedia.MediaPathName.ToString());
 
+	{
+		FScopeLock Lock(&MediaResidencyLock);
+		auto* Residency = MediaResidency.Find(InMedia);
+		if (!Residency || !Residency->bCold)
+		{
+			const bool bTrackResidency = Residency || GetMediaResidencyBudget() > 0;
+			if (bTrackResidency)
+			{
+				if (!Residency)
+				{
+					Residency = &MediaResidency.Add(InMedia);
+				}
+				++Residency->NumUses;
+				++NumMediaReloadMisses;
+			}
+			Lock.Unlock();
+			return LoadMediaFileFromManager(InMedia, bTrackResidency, MoveTemp(InCallback));
+		}
+
+		// The cold media still holds its Media Manager reference
+		check(Residency->NumUses == 0);
+		Residency->bCold = false;
+		Residency->NumUses = 1;
+		ColdMedia.RemoveSingle(InMedia);
+		ColdMediaBytes -= Residency->ResidentSize;
+		DEC_DWORD_STAT(STAT_WwiseResourceLoaderColdMedia);
+		DEC_MEMORY_STAT_BY(STAT_WwiseResourceLoaderColdMediaMemory, Residency->ResidentSize);
+		++NumMediaReloadHits;
+		INC_DWORD_STAT(STAT_WwiseResourceLoaderMediaReloadHits);
+	}
+
+	UE_LOG(LogWwiseResourceLoader, VeryVerbose, TEXT("[LoadMediaAsync: %" PRIu32 "] %s: Reusing cold media."),
+		(uint32)InMedia.MediaId, *InMedia.DebugName.ToString());
+	InCallback(true);
+}
+
+void FWwiseResourceLoaderImpl::LoadMediaFileFromManager(const FWwiseMediaCookedData& InMedia, bool bInTrackResidency, FLoadFileCallback&& InCallback) const
+{
+	if (bInTrackResidency)
+	{
+		InCallback = [this, InMedia, InCallback = MoveTemp(InCallback)](bool bInResult) mutable
+		{
+			if (UNLIKELY(!bInResult))
+			{
+				// Failed loads don't hold a Media Manager reference
+				FScopeLock Lock(&MediaResidencyLock);
+				auto* Residency = MediaResidency.Find(InMedia);
+				if (Residency && --Residency->NumUses == 0 && !Residency->bCold)
+				{
+					MediaResidency.Remove(InMedia);
+				}
+			}
+			else
+			{
+				// Measured now, outside of the lock, so unloading into the cold media never queries the file system
+				const int64 ResidentSize = GetMediaResidentSize(InMedia);
+				FScopeLock Lock(&MediaResidencyLock);
+				if (auto* Residency = MediaResidency.Find(InMedia))
+				{
+					Residency->ResidentSize = ResidentSize;
+				}
+			}
+			InCallback(bInResult);
+		};
+	}
+
 	if (UNLIKELY(!MediaManager))
 	{
 		MediaManager = IWwiseMediaManager::Get();
@@ -2660,6 +2738,32 @@ void FWwiseResourceLoaderImpl::UnloadMediaFile(const FWwiseMediaCookedData& InMe
 	UE_LOG(LogWwiseResourceLoader, VeryVerbose, TEXT("[UnloadMediaAsync: %" PRIu32 "] %s at %s"),
 		(uint32)InMedia.MediaId, *InMedia.DebugName.ToString(), *InMedia.MediaPathName.ToString());
 
+	{
+		FScopeLock Lock(&MediaResidencyLock);
+		auto* Residency = MediaResidency.Find(InMedia);
+		if (Residency && !Residency->bCold && --Residency->NumUses == 0)
+		{
+			const auto Budget = GetMediaResidencyBudget();
+			if (Budget > 0)
+			{
+				// Keep the last Media Manager reference, and evict older cold media if needed
+				Residency->bCold = true;
+				ColdMedia.Add(InMedia);
+				ColdMediaBytes += Residency->ResidentSize;
+				INC_DWORD_STAT(STAT_WwiseResourceLoaderColdMedia);
+				INC_MEMORY_STAT_BY(STAT_WwiseResourceLoaderColdMediaMemory, Residency->ResidentSize);
+				UE_LOG(LogWwiseResourceLoader, VeryVerbose, TEXT("[UnloadMediaAsync: %" PRIu32 "] %s: Keeping cold media (%" PRIi64 " bytes)."),
+					(uint32)InMedia.MediaId, *InMedia.DebugName.ToString(), Residency->ResidentSize);
+
+				TArray<FWwiseMediaCookedData> Evicted;
+				EvictColdMediaLocked(Budget, Evicted);
+				Lock.Unlock();
+				UnloadEvictedMedia(MoveTemp(Evicted), MoveTemp(InCallback));
+				return;
+			}
+			MediaResidency.Remove(InMedia);
+		}
+	}
 
 	if (UNLIKELY(!MediaManager))
 	{
@@ -2676,6 +2780,106 @@ void FWwiseResourceLoaderImpl::UnloadMediaFile(const FWwiseMediaCookedData& InMe
 	});
 }
 
+void FWwiseResourceLoaderImpl::SetMediaResidencyBudget(int64 InBudgetBytes)
+{
+	SCOPED_WWISERESOURCELOADER_EVENT_2(TEXT("FWwiseResourceLoaderImpl::SetMediaResidencyBudget"));
+	UE_LOG(LogWwiseResourceLoader, Verbose, TEXT("SetMediaResidencyBudget: %" PRIi64 " bytes."), InBudgetBytes);
+
+	TArray<FWwiseMediaCookedData> Evicted;
+	{
+		FScopeLock Lock(&MediaResidencyLock);
+		MediaResidencyBudget.store(FMath::Max(InBudgetBytes, (int64)0), std::memory_order_relaxed);
+		EvictColdMediaLocked(InBudgetBytes, Evicted);
+	}
+	UnloadEvictedMedia(MoveTemp(Evicted), []{});
+}
+
+FWwiseResourceLoaderImpl::FMediaResidencyStats FWwiseResourceLoaderImpl::GetMediaResidencyStats() const
+{
+	FMediaResidencyStats Result;
+	{
+		FScopeLock Lock(&MediaResidencyLock);
+		Result.NumColdMedia = ColdMedia.Num();
+		Result.ColdMediaBytes = ColdMediaBytes;
+	}
+	Result.NumReloadHits = NumMediaReloadHits.load(std::memory_order_relaxed);
+	Result.NumReloadMisses = NumMediaReloadMisses.load(std::memory_order_relaxed);
+	Result.NumEvictions = NumMediaEvictions.load(std::memory_order_relaxed);
+	return Result;
+}
+
+void FWwiseResourceLoaderImpl::FlushColdMediaAsync(FWwiseResourceUnloadPromise&& Promise)
+{
+	SCOPED_WWISERESOURCELOADER_EVENT_2(TEXT("FWwiseResourceLoaderImpl::FlushColdMediaAsync"));
+	TArray<FWwiseMediaCookedData> Evicted;
+	{
+		FScopeLock Lock(&MediaResidencyLock);
+		EvictColdMediaLocked(0, Evicted);
+	}
+	UnloadEvictedMedia(MoveTemp(Evicted), [Promise = MoveTemp(Promise)]() mutable
+	{
+		Promise.EmplaceValue();
+	});
+}
+
+int64 FWwiseResourceLoaderImpl::GetMediaResidentSize(const FWwiseMediaCookedData& InMedia) const
+{
+	if (UNLIKELY(Test::MockMediaResidentSize > 0))
+	{
+		return Test::MockMediaResidentSize;
+	}
+	if (InMedia.bStreaming)
+	{
+		return InMedia.PrefetchSize;
+	}
+	return FMath::Max(IFileManager::Get().FileSize(*GetUnrealPath(InMedia.MediaPathName)), (int64)0);
+}
+
+void FWwiseResourceLoaderImpl::EvictColdMediaLocked(int64 InBudgetBytes, TArray<FWwiseMediaCookedData>& OutEvicted) const
+{
+	while (ColdMedia.Num() > 0 && (InBudgetBytes <= 0 || ColdMediaBytes > InBudgetBytes))
+	{
+		auto Media = ColdMedia[0];
+		ColdMedia.RemoveAt(0);
+
+		const auto Residency = MediaResidency.FindAndRemoveChecked(Media);
+		ColdMediaBytes -= Residency.ResidentSize;
+		DEC_DWORD_STAT(STAT_WwiseResourceLoaderColdMedia);
+		DEC_MEMORY_STAT_BY(STAT_WwiseResourceLoaderColdMediaMemory, Residency.ResidentSize);
+		++NumMediaEvictions;
+		OutEvicted.Emplace(MoveTemp(Media));
+	}
+}
+
+void FWwiseResourceLoaderImpl::UnloadEvictedMedia(TArray<FWwiseMediaCookedData>&& InEvicted, FUnloadFileCallback&& InCallback) const
+{
+	if (InEvicted.Num() == 0)
+	{
+		InCallback();
+		return;
+	}
+
+	// The evicted cooked data is owned here, as the objects that referenced it might be gone.
+	auto* Evicted = new TArray<FWwiseMediaCookedData>(MoveTemp(InEvicted));
+	auto* NumLeft = new std::atomic<int32>(Evicted->Num());
+	auto* Callback = new FUnloadFileCallback(MoveTemp(InCallback));
+	for (const auto& Media : *Evicted)
+	{
+		UE_LOG(LogWwiseResourceLoader, VeryVerbose, TEXT("[UnloadMediaAsync: %" PRIu32 "] %s: Evicting cold media."),
+			(uint32)Media.MediaId, *Media.DebugName.ToString());
+		UnloadMediaFile(Media, [Evicted, NumLeft, Callback]() mutable
+		{
+			if (--*NumLeft == 0)
+			{
+				(*Callback)();
+				delete Callback;
+				delete NumLeft;
+				delete Evicted;
+			}
+		});
+	}
+}
+
 void FWwiseResourceLoaderImpl::LoadExternalSourceFile(const FWwiseExternalSourceCookedData& InExternalSource, FLoadFileCallback&& InCallback) const
 {
 	UE_LOG(LogWwiseResourceLoader, VeryVerbose, TEXT("[LoadExternalSourceAsync: %" PRIu32 "] %s"),
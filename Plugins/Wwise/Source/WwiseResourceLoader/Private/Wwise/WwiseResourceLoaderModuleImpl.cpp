@@ -18,6 +18,8 @@ Copyright (c) 2024 Audiokinetic Inc.
 #include "Wwise/WwiseResourceLoaderModuleImpl.h"
 #include "Wwise/WwiseResourceLoaderImpl.h"
 
+#include "Misc/ConfigCacheIni.h"
+
 IMPLEMENT_MODULE(FWwiseResourceLoaderModule, WwiseResourceLoader)
 
 FWwiseResourceLoader* FWwiseResourceLoaderModule::GetResourceLoader()
@@ -44,7 +46,14 @@ FWwiseResourceLoader* FWwiseResourceLoaderModule::GetResourceLoader()
 FWwiseResourceLoaderImpl* FWwiseResourceLoaderModule::InstantiateResourceLoaderImpl()
 {
 	SCOPED_WWISERESOURCELOADER_EVENT(TEXT("FWwiseResourceLoaderModule::InstantiateResourceLoaderImpl"));
-	return new FWwiseResourceLoaderImpl;
+	auto* ResourceLoaderImpl = new FWwiseResourceLoaderImpl;
+
+	int32 MediaResidencyBudgetKB = 0;
+	if (GConfig && GConfig->GetInt(TEXT("/Script/AkAudio.AkSettings"), TEXT("MediaResidencyBudgetKB"), MediaResidencyBudgetKB, GGameIni) && MediaResidencyBudgetKB > 0)
+	{
+		ResourceLoaderImpl->SetMediaResidencyBudget((int64)MediaResidencyBudgetKB * 1024);
+	}
+	return ResourceLoaderImpl;
 }
 
 FWwiseResourceLoader* FWwiseResourceLoaderModule::InstantiateResourceLoader()
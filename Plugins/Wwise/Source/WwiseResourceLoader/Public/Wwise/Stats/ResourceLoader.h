@@ -34,6 +34,9 @@ DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Referenced Media"), STAT_WwiseResour
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Referenced ShareSets"), STAT_WwiseResourceLoaderShareSets, STATGROUP_WwiseResourceLoader, WWISERESOURCELOADER_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Referenced SoundBanks"), STAT_WwiseResourceLoaderSoundBanks, STATGROUP_WwiseResourceLoader, WWISERESOURCELOADER_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Referenced Switch Container Combinations"), STAT_WwiseResourceLoaderSwitchContainerCombinations, STATGROUP_WwiseResourceLoader, WWISERESOURCELOADER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Cold Media"), STAT_WwiseResourceLoaderColdMedia, STATGROUP_WwiseResourceLoader, WWISERESOURCELOADER_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Cold Media Memory"), STAT_WwiseResourceLoaderColdMediaMemory, STATGROUP_WwiseResourceLoader, WWISERESOURCELOADER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Media Reload Hits"), STAT_WwiseResourceLoaderMediaReloadHits, STATGROUP_WwiseResourceLoader, WWISERESOURCELOADER_API);
 
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Resource Loading"), STAT_WwiseResourceLoaderTiming, STATGROUP_WwiseResourceLoader, WWISERESOURCELOADER_API);
 
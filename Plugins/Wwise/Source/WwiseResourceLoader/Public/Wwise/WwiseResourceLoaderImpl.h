@@ -38,6 +38,8 @@ Copyright (c) 2024 Audiokinetic Inc.
 
 #include "Wwise/Stats/ResourceLoader.h"
 
+#include <atomic>
+
 #if WITH_EDITORONLY_DATA
 #include "Engine/EngineTypes.h"
 #include "UObject/SoftObjectPath.h"
@@ -255,7 +257,7 @@ public:
 	 */
 	FWwiseResourceLoaderImpl(IWwiseExternalSourceManager& ExternalSourceManager, IWwiseMediaManager& MediaManager, IWwiseSoundBankManager& SoundBankManager);
 
-	virtual ~FWwiseResourceLoaderImpl() {}
+	virtual ~FWwiseResourceLoaderImpl();
 
 	FName GetUnrealExternalSourcePath() const;
 	FString GetUnrealPath() const;
@@ -310,6 +312,38 @@ public:
 	virtual void LoadSoundBankAsync(FWwiseLoadedSoundBankPromise&& Promise, FWwiseLoadedSoundBankPtr&& InSoundBankListNode);
 	virtual void UnloadSoundBankAsync(FWwiseResourceUnloadPromise&& Promise, FWwiseLoadedSoundBankPtr&& InSoundBankListNode);
 
+	/**
+	 * @brief Media residency counters, since the budget was first set.
+	*/
+	struct FMediaResidencyStats
+	{
+		int32 NumColdMedia{ 0 };		///< Unused media kept loaded
+		int64 ColdMediaBytes{ 0 };		///< Estimated memory used by the cold media
+		uint64 NumReloadHits{ 0 };		///< Media loads served by a cold media
+		uint64 NumReloadMisses{ 0 };	///< Media loads that went through the Media Manager
+		uint64 NumEvictions{ 0 };		///< Cold media unloaded because of the budget
+	};
+
+	/**
+	 * @brief Sets the memory budget for unused media.
+	 *
+	 * When the budget is above 0, media that isn't used anymore isn't unloaded immediately. It is kept in a "cold"
+	 * LRU list, and loading it again is immediate. Cold media is only unloaded, least recently used first, when
+	 * the cold media total goes over the budget. A budget of 0 unloads every cold media and disables residency.
+	 *
+	 * @param InBudgetBytes Memory budget in bytes.
+	*/
+	virtual void SetMediaResidencyBudget(int64 InBudgetBytes);
+	int64 GetMediaResidencyBudget() const { return MediaResidencyBudget.load(std::memory_order_relaxed); }
+	FMediaResidencyStats GetMediaResidencyStats() const;
+
+	/**
+	 * @brief Unloads every cold media, keeping the budget as is.
+	 *
+	 * @param Promise Fulfilled once the Media Manager unloaded every cold media.
+	*/
+	virtual void FlushColdMediaAsync(FWwiseResourceUnloadPromise&& Promise);
+
 	// Checks whether no element remains pending in the Resource Loader at this point. Used for unit testing. 
 	bool IsEmpty() const
 	{
@@ -440,6 +474,31 @@ protected:
 	mutable IWwiseMediaManager* MediaManager{nullptr};
 	mutable IWwiseSoundBankManager* SoundBankManager{nullptr};
 
+	/**
+	 * @brief Media loaded by this Resource Loader while residency is enabled.
+	 *
+	 * Every use holds a Media Manager reference. When the last use is unloaded, its reference is kept by the
+	 * cold media instead of being released.
+	*/
+	struct FMediaResidency
+	{
+		int32 NumUses{ 0 };
+		int64 ResidentSize{ 0 };			// Measured once loaded, and accounted for while cold
+		bool bCold{ false };
+	};
+	mutable FCriticalSection MediaResidencyLock;
+	mutable TMap<FWwiseMediaCookedData, FMediaResidency> MediaResidency;
+	mutable TArray<FWwiseMediaCookedData> ColdMedia;		// Least recently used first
+	mutable int64 ColdMediaBytes{ 0 };
+	std::atomic<int64> MediaResidencyBudget{ 0 };
+	mutable std::atomic<uint64> NumMediaReloadHits{ 0 };
+	mutable std::atomic<uint64> NumMediaReloadMisses{ 0 };
+	mutable std::atomic<uint64> NumMediaEvictions{ 0 };
+
+	virtual int64 GetMediaResidentSize(const FWwiseMediaCookedData& InMedia) const;
+	void EvictColdMediaLocked(int64 InBudgetBytes, TArray<FWwiseMediaCookedData>& OutEvicted) const;
+	void UnloadEvictedMedia(TArray<FWwiseMediaCookedData>&& InEvicted, FUnloadFileCallback&& InCallback) const;
+
 	virtual void LoadAuxBusResources(FWwiseResourceLoadPromise&& Promise, FWwiseLoadedAuxBusInfo::FLoadedData& LoadedData, const FWwiseAuxBusCookedData& InCookedData);
 	virtual void LoadEventResources(FWwiseResourceLoadPromise&& Promise, FWwiseLoadedEventInfo::FLoadedData& LoadedData, const FWwiseEventCookedData& InCookedData);
 	virtual void LoadEventSwitchContainerResources(FWwiseResourceLoadPromise&& Promise, FWwiseLoadedEventInfo::FLoadedData& LoadedData, const FWwiseEventCookedData& InCookedData);
@@ -498,6 +557,7 @@ protected:
 	void LoadSoundBankFile(const FWwiseSoundBankCookedData& InSoundBank, FLoadFileCallback&& InCallback) const;
 	void UnloadSoundBankFile(const FWwiseSoundBankCookedData& InSoundBank, FUnloadFileCallback&& InCallback) const;
 	void LoadMediaFile(const FWwiseMediaCookedData& InMedia, FLoadFileCallback&& InCallback) const;
+	void LoadMediaFileFromManager(const FWwiseMediaCookedData& InMedia, bool bInTrackResidency, FLoadFileCallback&& InCallback) const;
 	void UnloadMediaFile(const FWwiseMediaCookedData& InMedia, FUnloadFileCallback&& InCallback) const;
 	void LoadExternalSourceFile(const FWwiseExternalSourceCookedData& InExternalSource, FLoadFileCallback&& InCallback) const;
 	void UnloadExternalSourceFile(const FWwiseExternalSourceCookedData& InExternalSource, FUnloadFileCallback&& InCallback) const;
@@ -527,6 +587,7 @@ public:
 #define WWISE_RESOURCELOADERIMPL_TEST_CONST const
 #endif
 		static WWISE_RESOURCELOADERIMPL_TEST_CONST bool bMockSleepOnMediaLoad;
+		static WWISE_RESOURCELOADERIMPL_TEST_CONST int64 MockMediaResidentSize;
 	};
 
 };
@@ -2042,6 +2042,89 @@ WWISE_TEST_CASE(ResourceLoader_Media, "Wwise::ResourceLoader::ResourceLoader_Med
 		CHECK(SoundBankManager.IsEmpty());
 		CHECK(ResourceLoaderImpl.IsEmpty());
 	}
+
+	SECTION("Cold media residency")
+	{
+		const int64 MockMediaResidentSize = FWwiseResourceLoaderImpl::Test::MockMediaResidentSize;
+		FWwiseResourceLoaderImpl::Test::MockMediaResidentSize = 1024;
+		ON_SCOPE_EXIT { FWwiseResourceLoaderImpl::Test::MockMediaResidentSize = MockMediaResidentSize; };
+
+		FWwiseMockExternalSourceManager ExternalSourceManager;
+		FWwiseMockMediaManager MediaManager;
+		FWwiseMockSoundBankManager SoundBankManager;
+		FWwiseResourceLoaderImpl ResourceLoaderImpl(ExternalSourceManager, MediaManager, SoundBankManager);
+		ResourceLoaderImpl.SetMediaResidencyBudget(1024);
+
+		FWwiseLocalizedEventCookedData CookedData[2];
+		for (uint32 i = 0; i < 2; ++i)
+		{
+			FWwiseEventCookedData Data;
+			FWwiseSoundBankCookedData SoundBank;
+			SoundBank.SoundBankId = i + 1;
+			Data.SoundBanks.Emplace(SoundBank);
+
+			FWwiseMediaCookedData Media;
+			Media.MediaId = i + 1;
+			Data.Media.Emplace(MoveTemp(Media));
+
+			CookedData[i].EventLanguageMap.Emplace(FWwiseLanguageCookedData::Sfx, MoveTemp(Data));
+		}
+
+		auto LoadAndUnload = [&ResourceLoaderImpl](const FWwiseLocalizedEventCookedData& InCookedData)
+		{
+			auto* Node = ResourceLoaderImpl.CreateEventNode(InCookedData, nullptr);
+			CHECK(Node);
+			if (UNLIKELY(!Node))
+			{
+				return;
+			}
+
+			FWwiseLoadedEventPromise LoadPromise;
+			auto LoadFuture = LoadPromise.GetFuture();
+			ResourceLoaderImpl.LoadEventAsync(MoveTemp(LoadPromise), MoveTemp(Node));
+			auto Loaded = LoadFuture.Get();		// Synchronously
+			CHECK(Loaded);
+			if (UNLIKELY(!Loaded))
+			{
+				return;
+			}
+
+			FWwiseResourceUnloadPromise UnloadPromise;
+			auto UnloadFuture = UnloadPromise.GetFuture();
+			ResourceLoaderImpl.UnloadEventAsync(MoveTemp(UnloadPromise), MoveTemp(Loaded));
+			UnloadFuture.Get();		// Synchronously
+		};
+
+		// Unloaded media stays loaded within the budget
+		LoadAndUnload(CookedData[0]);
+		CHECK(MediaManager.IsMediaLoaded(1));
+		CHECK(ResourceLoaderImpl.GetMediaResidencyStats().NumColdMedia == 1);
+		CHECK(ResourceLoaderImpl.GetMediaResidencyStats().ColdMediaBytes == 1024);
+
+		// Reloading it doesn't go through the Media Manager
+		LoadAndUnload(CookedData[0]);
+		CHECK(MediaManager.IsMediaLoaded(1));
+		CHECK(ResourceLoaderImpl.GetMediaResidencyStats().NumReloadHits == 1);
+
+		// A second cold media over the budget evicts the oldest one
+		LoadAndUnload(CookedData[1]);
+		CHECK(!MediaManager.IsMediaLoaded(1));
+		CHECK(MediaManager.IsMediaLoaded(2));
+		CHECK(ResourceLoaderImpl.GetMediaResidencyStats().NumColdMedia == 1);
+		CHECK(ResourceLoaderImpl.GetMediaResidencyStats().NumEvictions == 1);
+
+		// Flushing releases everything
+		FWwiseResourceUnloadPromise FlushPromise;
+		auto FlushFuture = FlushPromise.GetFuture();
+		ResourceLoaderImpl.FlushColdMediaAsync(MoveTemp(FlushPromise));
+		FlushFuture.Get();		// Synchronously
+
+		CHECK(ResourceLoaderImpl.GetMediaResidencyStats().NumColdMedia == 0);
+		CHECK(ExternalSourceManager.IsEmpty());
+		CHECK(MediaManager.IsEmpty());
+		CHECK(SoundBankManager.IsEmpty());
+		CHECK(ResourceLoaderImpl.IsEmpty());
+	}
 }
 
 #endif // WWISE_UNIT_TESTS
\ No newline at end of file
@@ -21,6 +21,7 @@ Copyright (c) 2024 Audiokinetic Inc.
 #include "GameFramework/WorldSettings.h"
 #include "Internationalization/Internationalization.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/ScopeLock.h"
 #include "Sound/SoundBase.h"
 #include "NiagaraCustomVersion.h"
 #include "NiagaraSystemInstance.h"
@@ -104,6 +105,388 @@ namespace NiagaraWwiseParticleHelpers
 
 		return AkComponent;
 	}
+
+	/** A pooled component moved to the new event's location, or a newly spawned one if the pool is empty */
+	UAkComponent* AcquireAkComponent(FWwiseEventInterface_InstanceData* InstanceData, class UAkAudioEvent* AkEvent, const USceneComponent* NiagaraComponent, FVector Location, FRotator Orientation, UWorld* World)
+	{
+		while (InstanceData->ComponentPool.Num() > 0)
+		{
+			UAkComponent* AkComponent = InstanceData->ComponentPool.Pop(false).Get();
+			DEC_DWORD_STAT(STAT_WwiseNiagaraPooledComponents);
+			if (IsValid(AkComponent) && AkComponent->IsRegistered() && AkComponent->GetWorld() == World)
+			{
+				// Still registered, so the game object is reused as is
+				AkComponent->AkAudioEvent = AkEvent;
+				AkComponent->SetWorldLocationAndRotation(Location, Orientation.Quaternion());
+				++InstanceData->NumComponentsReused;
+				INC_DWORD_STAT(STAT_WwiseNiagaraReusedComponents);
+				return AkComponent;
+			}
+		}
+
+		UAkComponent* AkComponent = SpawnAkComponentAtLocation(AkEvent, NiagaraComponent, Location, Orientation, World, InstanceData->bStopWhenComponentIsDestroyed, false);
+		if (AkComponent)
+		{
+			if (InstanceData->ComponentPoolSize > 0)
+			{
+				// Released components go back to the pool or are destroyed explicitly, they must not go away on their own when the event ends
+				AkComponent->SetAutoDestroy(false);
+			}
+			++InstanceData->NumComponentsSpawned;
+			INC_DWORD_STAT(STAT_WwiseNiagaraSpawnedComponents);
+		}
+		return AkComponent;
+	}
+
+	/** Stops and pools or destroys the component of a finished persistent event. Returns false if pooling is disabled, leaving it to the caller. */
+	bool ReleaseAkComponent(FWwiseEventInterface_InstanceData* InstanceData, UAkComponent* AkComponent)
+	{
+		if (InstanceData->ComponentPoolSize <= 0)
+		{
+			return false;
+		}
+		if (!IsValid(AkComponent))
+		{
+			return true;
+		}
+
+		AkComponent->Stop();
+		if (InstanceData->ComponentPool.Num() >= InstanceData->ComponentPoolSize || !AkComponent->IsRegistered())
+		{
+			AkComponent->ConditionalBeginDestroy();
+			return true;
+		}
+
+		// Game Parameters set on the game object would otherwise carry over to the next event
+		if (auto* AudioDevice = FAkAudioDevice::Get())
+		{
+			for (const TWeakObjectPtr<UAkRtpc>& GameParameter : InstanceData->GameParameters)
+			{
+				if (GameParameter.IsValid())
+				{
+					AudioDevice->ResetRTPCValue(GameParameter.Get(), AkComponent->GetAkGameObjectID(), 0);
+				}
+			}
+		}
+
+		InstanceData->ComponentPool.Add(AkComponent);
+		INC_DWORD_STAT(STAT_WwiseNiagaraPooledComponents);
+		return true;
+	}
+
+	/** Posts the event for a new persistent handle, on a pooled or newly spawned component */
+	void PostPersistentEvent(FWwiseEventInterface_InstanceData* InstanceData, FNiagaraSystemInstance* SystemInstance, FWwisePersistentEventSlot& Slot, const FWwisePersistentAudioCommand& Command)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_WwiseNiagaraCreateEvent);
+		TWeakObjectPtr<UAkAudioEvent> Event = InstanceData->EventToPost;
+		USceneComponent* NiagaraComponent = SystemInstance ? SystemInstance->GetAttachComponent() : nullptr;
+
+		if (NiagaraComponent && Event.IsValid())
+		{
+			UWorld* World = NiagaraComponent->GetWorld();
+			if (!World)
+			{
+				UE_LOG(LogAkAudio, Warning, TEXT("Niagara PostPersistentEvent: Cannot post event because world is invalid."));
+				return;
+			}
+			if (!World->AllowAudioPlayback())
+			{
+				return;
+			}
+			auto* AudioDevice = FAkAudioDevice::Get();
+			if (UNLIKELY(!AudioDevice))
+			{
+				UE_LOG(LogAkAudio, Warning, TEXT("Niagara PostPersistentEvent: Failed to post AkAudioEvent '%s' at a location without an Audio Device."), *Event->GetName());
+				return;
+			}
+
+			UAkComponent* AkComponent = AcquireAkComponent(InstanceData, Event.Get(), NiagaraComponent, Command.Position, Command.Rotation, World);
+
+			if (AkComponent == nullptr)
+			{
+				// failed to create component (perhaps because audio is disabled)
+				return;
+			}
+
+			EAkAudioContext AudioContext = EAkAudioContext::GameplayAudio;
+#if WITH_EDITOR
+			if (GIsEditor && !FApp::IsGame())
+			{
+				AudioContext = EAkAudioContext::EditorAudio;
+			}
+#endif
+			uint32 PlayingId = Event->PostOnComponent(AkComponent, nullptr, nullptr, nullptr, (AkCallbackType)0, nullptr, true, AudioContext);
+			if (PlayingId == AK_INVALID_PLAYING_ID )
+			{
+				if (!ReleaseAkComponent(InstanceData, AkComponent))
+				{
+					AkComponent->ConditionalBeginDestroy();
+				}
+				return;
+			}
+
+			Slot.Component = AkComponent;
+			Slot.PlayingID = PlayingId;
+			Slot.bActive = true;
+		}
+	}
+
+	/** Ends a persistent event. Its slot stays reserved until the particle stops using the handle. */
+	void StopPersistentEvent(FWwiseEventInterface_InstanceData* InstanceData, FWwisePersistentEventSlot& Slot, bool bDestroyIfNotPooled)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_WwiseNiagaraStopEvent);
+		UAkComponent* AkComponent = Slot.Component.Get();
+		if (AkComponent && !ReleaseAkComponent(InstanceData, AkComponent))
+		{
+			if (bDestroyIfNotPooled)
+			{
+				AkComponent->ConditionalBeginDestroy();
+			}
+			else
+			{
+				AkComponent->Stop();
+			}
+		}
+		Slot.Component.Reset();
+		Slot.PlayingID = AK_INVALID_PLAYING_ID;
+		Slot.bActive = false;
+	}
+
+	/** Batches the commands of one VM call, so that space in the instance's buffer is reserved once per batch rather than once per particle */
+	class FPersistentAudioCommandWriter
+	{
+	public:
+		explicit FPersistentAudioCommandWriter(FWwiseEventInterface_InstanceData* InInstanceData)
+			: InstanceData(InInstanceData)
+		{
+		}
+
+		~FPersistentAudioCommandWriter()
+		{
+			Flush();
+		}
+
+		FWwisePersistentAudioCommand& Add(EWwisePersistentAudioAction Action, int32 AudioHandle)
+		{
+			if (NumBatched == BatchSize)
+			{
+				Flush();
+			}
+			FWwisePersistentAudioCommand& Command = Batch[NumBatched++];
+			Command.Action = Action;
+			Command.AudioHandle = AudioHandle;
+			return Command;
+		}
+
+		void Flush()
+		{
+			InstanceData->EnqueuePersistentCommands(Batch, NumBatched);
+			NumBatched = 0;
+		}
+
+	private:
+		static constexpr int32 BatchSize = 64;
+
+		FWwiseEventInterface_InstanceData* InstanceData;
+		FWwisePersistentAudioCommand Batch[BatchSize];
+		int32 NumBatched = 0;
+	};
+
+	/** Commands the buffer holds before the first tick that needs more */
+	constexpr int32 InitialPersistentCommandCapacity = 1024;
+}
+
+int32 FWwiseEventInterface_InstanceData::AllocatePersistentHandle()
+{
+	int32 SlotIndex = NumFreePersistentSlots.Decrement();
+	if (SlotIndex >= 0)
+	{
+		SlotIndex = FreePersistentSlots[SlotIndex];
+	}
+	else
+	{
+		// The game thread adds the slots past the end on the next tick
+		SlotIndex = NumPersistentSlots.Increment() - 1;
+		if (SlotIndex >= MaxPersistentSlots)
+		{
+			return 0;
+		}
+	}
+
+	const int32 Generation = SlotIndex < PersistentSlots.Num() ? PersistentSlots[SlotIndex].Generation : 0;
+	return ((Generation & HandleGenerationMask) << HandleSlotBits) | (SlotIndex + 1);
+}
+
+void FWwiseEventInterface_InstanceData::EnqueuePersistentCommands(const FWwisePersistentAudioCommand* Commands, int32 Count)
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	const int32 First = NumPersistentCommands.Add(Count);
+	const int32 NumToCopy = FMath::Clamp(PersistentCommands.Num() - First, 0, Count);
+	if (NumToCopy > 0)
+	{
+		FMemory::Memcpy(PersistentCommands.GetData() + First, Commands, NumToCopy * sizeof(FWwisePersistentAudioCommand));
+	}
+
+	// Never dropped: a lost Post leaves its particle with a live handle and no sound, a lost Stop leaves the sound playing
+	if (NumToCopy < Count)
+	{
+		FScopeLock Lock(&OverflowPersistentCommandsLock);
+		OverflowPersistentCommands.Append(Commands + NumToCopy, Count - NumToCopy);
+	}
+}
+
+FWwisePersistentEventSlot* FWwiseEventInterface_InstanceData::FindPersistentSlot(int32 Handle)
+{
+	if (Handle <= 0)
+	{
+		return nullptr;
+	}
+
+	const int32 SlotIndex = (Handle & HandleSlotMask) - 1;
+	if (!PersistentSlots.IsValidIndex(SlotIndex))
+	{
+		return nullptr;
+	}
+
+	FWwisePersistentEventSlot& Slot = PersistentSlots[SlotIndex];
+	if (Slot.bFree || (Slot.Generation & HandleGenerationMask) != (Handle >> HandleSlotBits))
+	{
+		return nullptr;
+	}
+	return &Slot;
+}
+
+void FWwiseEventInterface_InstanceData::ProcessPersistentCommands(FNiagaraSystemInstance* SystemInstance)
+{
+	SCOPE_CYCLE_COUNTER(STAT_WwiseNiagaraUpdateEvent);
+	ClaimPersistentSlots();
+	++TickCount;
+
+	const int32 NumQueued = NumPersistentCommands.Set(0);
+	const int32 NumCommands = FMath::Min(NumQueued, PersistentCommands.Num());
+	for (int32 Index = 0; Index < NumCommands; ++Index)
+	{
+		RunPersistentCommand(SystemInstance, PersistentCommands[Index]);
+	}
+
+	// The VM is done for this tick, so the overflow is ours without the lock. A handle's commands all come from the thread
+	// running its particle, so the ones that spilled were queued after those that fit and run in the same order.
+	if (OverflowPersistentCommands.Num() > 0)
+	{
+		for (const FWwisePersistentAudioCommand& Command : OverflowPersistentCommands)
+		{
+			RunPersistentCommand(SystemInstance, Command);
+		}
+		OverflowPersistentCommands.Reset();
+
+		UE_LOG(LogWwiseNiagara, Verbose, TEXT("Niagara PostPersistentEvent: %d commands were queued in a buffer of %d, growing it."), NumQueued, PersistentCommands.Num());
+		PersistentCommands.SetNumUninitialized(FMath::RoundUpToPowerOfTwo(NumQueued));
+	}
+
+	// Free the handles that were not used this tick, ending their events. It also stops sounds if an emitter is culled by scalability.
+	for (int32 SlotIndex = 0; SlotIndex < PersistentSlots.Num(); ++SlotIndex)
+	{
+		FWwisePersistentEventSlot& Slot = PersistentSlots[SlotIndex];
+		if (Slot.bFree || Slot.LastUpdateTick == TickCount)
+		{
+			continue;
+		}
+		if (Slot.bActive)
+		{
+			NiagaraWwiseParticleHelpers::StopPersistentEvent(this, Slot, true);
+		}
+		FreePersistentSlot(SlotIndex);
+	}
+	NumFreePersistentSlots.Set(FreePersistentSlots.Num());
+}
+
+void FWwiseEventInterface_InstanceData::RunPersistentCommand(FNiagaraSystemInstance* SystemInstance, const FWwisePersistentAudioCommand& Command)
+{
+	FWwisePersistentEventSlot* Slot = FindPersistentSlot(Command.AudioHandle);
+	if (!Slot)
+	{
+		return;
+	}
+
+	Slot->LastUpdateTick = TickCount;
+	switch (Command.Action)
+	{
+	case EWwisePersistentAudioAction::Post:
+		++NumPersistentPosts;
+		NiagaraWwiseParticleHelpers::PostPersistentEvent(this, SystemInstance, *Slot, Command);
+		break;
+
+	case EWwisePersistentAudioAction::SetPosition:
+		if (Slot->Component.IsValid())
+		{
+			Slot->Component->SetWorldLocation(Command.Position);
+		}
+		break;
+
+	case EWwisePersistentAudioAction::SetRotation:
+		if (Slot->Component.IsValid())
+		{
+			Slot->Component->SetWorldRotation(Command.Rotation);
+		}
+		break;
+
+	case EWwisePersistentAudioAction::SetGameParameter:
+		if (Slot->Component.IsValid() && GameParameters.IsValidIndex(Command.GameParameterIndex) && GameParameters[Command.GameParameterIndex].IsValid())
+		{
+			Slot->Component->SetRTPCValue(GameParameters[Command.GameParameterIndex].Get(), Command.GameParameterValue, 0, {});
+		}
+		break;
+
+	case EWwisePersistentAudioAction::Stop:
+		NiagaraWwiseParticleHelpers::StopPersistentEvent(this, *Slot, false);
+		break;
+
+	case EWwisePersistentAudioAction::KeepAlive:
+		break;
+	}
+}
+
+void FWwiseEventInterface_InstanceData::DiscardPersistentCommands()
+{
+	ClaimPersistentSlots();
+	NumPersistentCommands.Set(0);
+	OverflowPersistentCommands.Reset();
+}
+
+void FWwiseEventInterface_InstanceData::ClaimPersistentSlots()
+{
+	// The VM took free slots from the end of the list
+	const int32 NumFree = FMath::Max(NumFreePersistentSlots.GetValue(), 0);
+	for (int32 Index = NumFree; Index < FreePersistentSlots.Num(); ++Index)
+	{
+		PersistentSlots[FreePersistentSlots[Index]].bFree = false;
+	}
+	FreePersistentSlots.SetNum(NumFree, false);
+
+	const int32 NumSlots = FMath::Min(NumPersistentSlots.GetValue(), (int32)MaxPersistentSlots);
+	if (NumSlots > PersistentSlots.Num())
+	{
+		// Only growing allocates; the free list can then take every slot without reallocating
+		PersistentSlots.SetNum(NumSlots);
+		FreePersistentSlots.Reserve(NumSlots);
+	}
+	NumPersistentSlots.Set(PersistentSlots.Num());
+	NumFreePersistentSlots.Set(FreePersistentSlots.Num());
+}
+
+void FWwiseEventInterface_InstanceData::FreePersistentSlot(int32 SlotIndex)
+{
+	FWwisePersistentEventSlot& Slot = PersistentSlots[SlotIndex];
+	Slot.Component.Reset();
+	Slot.PlayingID = AK_INVALID_PLAYING_ID;
+	Slot.bActive = false;
+	Slot.bFree = true;
+	++Slot.Generation;
+	FreePersistentSlots.Add(SlotIndex);
 }
 
 UNiagaraDataInterfaceWwiseEvent::UNiagaraDataInterfaceWwiseEvent(FObjectInitializer const& ObjectInitializer) : Super(ObjectInitializer)
@@ -182,6 +565,14 @@ bool UNiagaraDataInterfaceWwiseEvent::InitPerInstanceData(void* PerInstanceData,
 	}
 	PIData->bStopWhenComponentIsDestroyed = bStopWhenComponentIsDestroyed;
 
+	// Components that have to keep playing after their particle dies can't be taken back
+	if (bStopWhenComponentIsDestroyed)
+	{
+		PIData->ComponentPoolSize = PersistentComponentPoolSize;
+		PIData->ComponentPool.Reserve(PersistentComponentPoolSize);
+	}
+	PIData->PersistentCommands.SetNumUninitialized(NiagaraWwiseParticleHelpers::InitialPersistentCommandCapacity);
+
 #if WITH_EDITORONLY_DATA
 	PIData->bOnlyActiveDuringGameplay = bOnlyActiveDuringGameplay;
 #endif
@@ -193,13 +584,28 @@ void UNiagaraDataInterfaceWwiseEvent::DestroyPerInstanceData(void* PerInstanceDa
 	SCOPED_WWISENIAGARA_EVENT(TEXT("NiagaraDataInterfaceWwiseEvent::DestroyPerInstanceData"));
 	FWwiseEventInterface_InstanceData* InstData = (FWwiseEventInterface_InstanceData*)PerInstanceData;
 
-	for (const auto& Entry : InstData->PersistentComponents)
+	for (const FWwisePersistentEventSlot& Slot : InstData->PersistentSlots)
+	{
+		if (Slot.bActive && Slot.Component.IsValid())
+		{
+			Slot.Component->Stop();
+			if (InstData->ComponentPoolSize > 0)
+			{
+				Slot.Component->ConditionalBeginDestroy();
+			}
+		}
+	}
+	for (const TWeakObjectPtr<UAkComponent>& PooledComponent : InstData->ComponentPool)
 	{
-		if (Entry.Value.IsValid())
+		if (PooledComponent.IsValid())
 		{
-			Entry.Value->Stop();
+			PooledComponent->ConditionalBeginDestroy();
 		}
 	}
+	DEC_DWORD_STAT_BY(STAT_WwiseNiagaraPooledComponents, InstData->ComponentPool.Num());
+
+	UE_LOG(LogWwiseNiagara, Verbose, TEXT("Persistent events of %s: %d posted, %d components spawned, %d reused from the pool"),
+		*GetPathNameSafe(this), InstData->NumPersistentPosts, InstData->NumComponentsSpawned, InstData->NumComponentsReused);
 	InstData->~FWwiseEventInterface_InstanceData();
 }
 
@@ -244,7 +650,7 @@ bool UNiagaraDataInterfaceWwiseEvent::PerInstanceTickPostSimulate(void* PerInsta
 	if (World->HasBegunPlay() == false && PIData->bOnlyActiveDuringGameplay)
 	{
 		PIData->OneShotQueue.Empty();
-		PIData->PersistentAudioActionQueue.Empty();
+		PIData->DiscardPersistentCommands();
 		return false;
 	}
 #endif
@@ -293,35 +699,8 @@ bool UNiagaraDataInterfaceWwiseEvent::PerInstanceTickPostSimulate(void* PerInsta
 	}
 
 	// process the persistent event updates
-	FPersistentWwiseParticleData Value;
-	TSet<int32> UpdatedAudioHandles;
 	ensure(IsInGameThread());
-	while (PIData->PersistentAudioActionQueue.Dequeue(Value))
-	{
-		// since we are in the game thread here, it is safe for the callback to access the AkComponent
-		if (Value.UpdateCallback)
-		{
-			Value.UpdateCallback(PIData, SystemInstance);
-		}
-		UpdatedAudioHandles.Add(Value.AudioHandle);
-	}
-
-	// destroy all persistent event AkComponents that were not updated this frame
-	// It also stops sounds if an emitter is culled by scalability.
-	for (auto Iterator = PIData->PersistentComponents.CreateIterator(); Iterator; ++Iterator)
-	{
-		if (!UpdatedAudioHandles.Contains(Iterator.Key()))
-		{
-			SCOPE_CYCLE_COUNTER(STAT_WwiseNiagaraStopEvent);
-			TWeakObjectPtr<UAkComponent> WeakComponent = Iterator.Value();
-			UAkComponent* AudioComponent = WeakComponent.IsValid() ? WeakComponent.Get() : nullptr;
-			if (AudioComponent)
-			{
-				AudioComponent->ConditionalBeginDestroy();
-			}
-			Iterator.RemoveCurrent();
-		}
-	}
+	PIData->ProcessPersistentCommands(SystemInstance);
 	return false;
 }
 
@@ -333,7 +712,8 @@ bool UNiagaraDataInterfaceWwiseEvent::Equals(const UNiagaraDataInterface* Other)
 	}
 
 	const UNiagaraDataInterfaceWwiseEvent* OtherPlayer = CastChecked<UNiagaraDataInterfaceWwiseEvent>(Other);
-	return OtherPlayer->EventToPost == EventToPost && OtherPlayer->bLimitPostsPerTick == bLimitPostsPerTick && OtherPlayer->MaxPostsPerTick == MaxPostsPerTick;
+	return OtherPlayer->EventToPost == EventToPost && OtherPlayer->bLimitPostsPerTick == bLimitPostsPerTick && OtherPlayer->MaxPostsPerTick == MaxPostsPerTick
+		&& OtherPlayer->PersistentComponentPoolSize == PersistentComponentPoolSize;
 }
 
 void UNiagaraDataInterfaceWwiseEvent::GetFunctions(TArray<FNiagaraFunctionSignature>& OutFunctions)
@@ -525,6 +905,7 @@ void UNiagaraDataInterfaceWwiseEvent::UpdatePosition(FUnrealVectorVMContext& Con
 	FNDIInputParam<int32> AudioHandleInParam(Context);
 	FNDIInputParam<FUnrealFloatVector> PositionParam(Context);
 	checkfSlow(InstData.Get(), TEXT("Wwise Event interface has invalid instance data. %s"), *GetPathName());
+	NiagaraWwiseParticleHelpers::FPersistentAudioCommandWriter CommandWriter(InstData.Get());
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
@@ -536,18 +917,7 @@ void UNiagaraDataInterfaceWwiseEvent::UpdatePosition(FUnrealVectorVMContext& Con
 #endif
 		if (Handle > 0)
 		{
-
-			FPersistentWwiseParticleData AudioData;
-			AudioData.AudioHandle = Handle;
-			AudioData.UpdateCallback = [Position, Handle](FWwiseEventInterface_InstanceData* InstanceData, FNiagaraSystemInstance*)
-			{
-				TWeakObjectPtr<UAkComponent> AkComponent = InstanceData->PersistentComponents.FindRef(Handle);
-				if (AkComponent.IsValid())
-				{
-					AkComponent->SetWorldLocation(Position);
-				}
-			};
-			InstData->PersistentAudioActionQueue.Enqueue(AudioData);
+			CommandWriter.Add(EWwisePersistentAudioAction::SetPosition, Handle).Position = Position;
 		}
 	}
 }
@@ -558,6 +928,7 @@ void UNiagaraDataInterfaceWwiseEvent::UpdateRotation(FUnrealVectorVMContext& Con
 	VectorVM::FUserPtrHandler<FWwiseEventInterface_InstanceData> InstData(Context);
 	FNDIInputParam<int32> AudioHandleInParam(Context);
 	FNDIInputParam<FUnrealFloatVector> RotationParam(Context);
+	NiagaraWwiseParticleHelpers::FPersistentAudioCommandWriter CommandWriter(InstData.Get());
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
 		int32 Handle = AudioHandleInParam.GetAndAdvance();
@@ -566,17 +937,7 @@ void UNiagaraDataInterfaceWwiseEvent::UpdateRotation(FUnrealVectorVMContext& Con
 		FRotator Rotation = FRotator(InRot.X, InRot.Y, InRot.Z);
 		if (Handle > 0)
 		{
-			FPersistentWwiseParticleData AudioData;
-			AudioData.AudioHandle = Handle;
-			AudioData.UpdateCallback = [Rotation, Handle](FWwiseEventInterface_InstanceData* InstanceData, FNiagaraSystemInstance*)
-			{
-				TWeakObjectPtr<UAkComponent> AkComponent = InstanceData->PersistentComponents.FindRef(Handle);
-				if (AkComponent.IsValid())
-				{
-					AkComponent->SetWorldRotation(Rotation);
-				}
-			};
-			InstData->PersistentAudioActionQueue.Enqueue(AudioData);
+			CommandWriter.Add(EWwisePersistentAudioAction::SetRotation, Handle).Rotation = Rotation;
 		}
 	}
 }
@@ -589,6 +950,7 @@ void UNiagaraDataInterfaceWwiseEvent::SetGameParameter(FUnrealVectorVMContext& C
 	FNDIInputParam<int32> AudioHandleInParam(Context);
 	FNDIInputParam<int32> GameParameterIndexParam(Context);
 	FNDIInputParam<float> GameParameterValueParam(Context);
+	NiagaraWwiseParticleHelpers::FPersistentAudioCommandWriter CommandWriter(InstData.Get());
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
 		int32 Handle = AudioHandleInParam.GetAndAdvance();
@@ -597,21 +959,9 @@ void UNiagaraDataInterfaceWwiseEvent::SetGameParameter(FUnrealVectorVMContext& C
 
 		if (Handle > 0)
 		{
-			FPersistentWwiseParticleData AudioData;
-			AudioData.AudioHandle = Handle;
-			AudioData.UpdateCallback = [Handle, GameParameterIndex, GameParameterValue](FWwiseEventInterface_InstanceData* InstanceData, FNiagaraSystemInstance*)
-			{
-				if (InstanceData->GameParameters.Num() > GameParameterIndex)
-				{
-					TWeakObjectPtr<UAkRtpc> GameParameter = InstanceData->GameParameters[GameParameterIndex];
-					TWeakObjectPtr<UAkComponent> AkComponent = InstanceData->PersistentComponents.FindRef(Handle);
-					if (AkComponent.IsValid() && GameParameter.IsValid())
-					{
-						AkComponent->SetRTPCValue(GameParameter.Get(), GameParameterValue, 0, {});
-					}
-				}
-			};
-			InstData->PersistentAudioActionQueue.Enqueue(AudioData);
+			FWwisePersistentAudioCommand& Command = CommandWriter.Add(EWwisePersistentAudioAction::SetGameParameter, Handle);
+			Command.GameParameterIndex = GameParameterIndex;
+			Command.GameParameterValue = GameParameterValue;
 		}
 	}
 }
@@ -633,12 +983,10 @@ void UNiagaraDataInterfaceWwiseEvent::SetPausedState(FUnrealVectorVMContext& Con
 
 		if (Handle > 0)
 		{
-			FPersistentWwiseParticleData AudioData;
-
-			auto PlayingID = InstData->PlayingIDs.Find(Handle);
-			if (!PlayingID)
+			const FWwisePersistentEventSlot* Slot = InstData->FindPersistentSlot(Handle);
+			if (!Slot || !Slot->bActive)
 			{
-				return;
+				continue;
 			}
 
 			auto* SoundEngine = IWwiseSoundEngineAPI::Get();
@@ -648,11 +996,11 @@ void UNiagaraDataInterfaceWwiseEvent::SetPausedState(FUnrealVectorVMContext& Con
 			}
 			if (IsPaused)
 			{
-				SoundEngine->ExecuteActionOnPlayingID(AK::SoundEngine::AkActionOnEventType_Pause, *PlayingID);
+				SoundEngine->ExecuteActionOnPlayingID(AK::SoundEngine::AkActionOnEventType_Pause, Slot->PlayingID);
 			}
 			else
 			{
-				SoundEngine->ExecuteActionOnPlayingID(AK::SoundEngine::AkActionOnEventType_Resume, *PlayingID);
+				SoundEngine->ExecuteActionOnPlayingID(AK::SoundEngine::AkActionOnEventType_Resume, Slot->PlayingID);
 			}
 		}
 	}
@@ -668,6 +1016,7 @@ void UNiagaraDataInterfaceWwiseEvent::StopPersistentEvent(FUnrealVectorVMContext
 	FNDIInputParam<FNiagaraBool> StopParam(Context);
 
 	checkfSlow(InstData.Get(), TEXT("Wwise Event interface has invalid instance data. %s"), *GetPathName());
+	NiagaraWwiseParticleHelpers::FPersistentAudioCommandWriter CommandWriter(InstData.Get());
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
@@ -676,14 +1025,7 @@ void UNiagaraDataInterfaceWwiseEvent::StopPersistentEvent(FUnrealVectorVMContext
 
 		if (Handle > 0 && DoStop)
 		{
-			FPersistentWwiseParticleData AudioData;
-
-			auto AkComponent = InstData->PersistentComponents.FindRef(Handle);
-			if (AkComponent.IsValid())
-			{
-				AkComponent->Stop();
-			}
-			InstData->PersistentComponents.Remove(Handle);
+			CommandWriter.Add(EWwisePersistentAudioAction::Stop, Handle);
 		}
 	}
 }
@@ -743,6 +1085,7 @@ void UNiagaraDataInterfaceWwiseEvent::PostPersistentEvent(FUnrealVectorVMContext
 	FNDIOutputParam<int32> AudioHandleOutParam(Context);
 
 	checkfSlow(InstData.Get(), TEXT("Wwise Event interface has invalid instance data. %s"), *GetPathName());
+	NiagaraWwiseParticleHelpers::FPersistentAudioCommandWriter CommandWriter(InstData.Get());
 
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
@@ -754,79 +1097,30 @@ void UNiagaraDataInterfaceWwiseEvent::PostPersistentEvent(FUnrealVectorVMContext
 		FVector Position = PositionParam.GetAndAdvance();
 #endif
 		FUnrealFloatVector InRot = RotationParam.GetAndAdvance();
-		float StartTime = StartTimeParam.GetAndAdvance();
+		StartTimeParam.GetAndAdvance();
 
 		FRotator Rotation = FRotator(InRot.X, InRot.Y, InRot.Z);
 
-		FPersistentWwiseParticleData AudioData;
 		if (ShouldPlay)
 		{
 			if (Handle <= 0)
 			{
 				// play a new sound
-				Handle = InstData->HandleCount.Increment();
-				SCOPE_CYCLE_COUNTER(STAT_WwiseNiagaraCreateEvent);
-				AudioData.AudioHandle = Handle;
-				AudioData.UpdateCallback = [Handle, Position, Rotation, StartTime](FWwiseEventInterface_InstanceData* InstanceData, FNiagaraSystemInstance* SystemInstance)
+				Handle = InstData->AllocatePersistentHandle();
+				if (Handle > 0)
 				{
-					TWeakObjectPtr<UAkAudioEvent> Event = InstanceData->EventToPost;
-					USceneComponent* NiagaraComponent = SystemInstance->GetAttachComponent();
-
-					if (NiagaraComponent && Event.IsValid())
-					{
-						UWorld* World = NiagaraComponent->GetWorld();
-						if (!World)
-						{
-							UE_LOG(LogAkAudio, Warning, TEXT("Niagara PostPersistentEvent: Cannot post event because world is invalid."));
-							return;
-						}
-						if (!World->AllowAudioPlayback())
-						{
-							return;
-						}
-						auto* AudioDevice = FAkAudioDevice::Get();
-						if (UNLIKELY(!AudioDevice))
-						{
-							UE_LOG(LogAkAudio, Warning, TEXT("Niagara PostPersistentEvent: Failed to post AkAudioEvent '%s' at a location without an Audio Device."), *Event->GetName());
-							return;
-						}
-
-						UAkComponent* AkComponent = NiagaraWwiseParticleHelpers::SpawnAkComponentAtLocation(Event.Get(), NiagaraComponent, Position, Rotation, World, InstanceData->bStopWhenComponentIsDestroyed, false);
-
-						if (AkComponent == nullptr)
-						{
-							// failed to create component (perhaps because audio is disabled)
-							return;
-						}
-
-						EAkAudioContext AudioContext = EAkAudioContext::GameplayAudio;
-#if WITH_EDITOR
-						if (GIsEditor && !FApp::IsGame())
-						{
-							AudioContext = EAkAudioContext::EditorAudio;
-						}
-#endif
-						uint32 PlayingId = Event->PostOnComponent(AkComponent, nullptr, nullptr, nullptr, (AkCallbackType)0, nullptr, true, AudioContext);
-						if (PlayingId == AK_INVALID_PLAYING_ID )
-						{
-							AkComponent->ConditionalBeginDestroy();
-							return;
-						}
-
-
-						InstanceData->PlayingIDs.Add(Handle,PlayingId);
-						InstanceData->PersistentComponents.Add(Handle, AkComponent);
-					}
-				};
+					FWwisePersistentAudioCommand& Command = CommandWriter.Add(EWwisePersistentAudioAction::Post, Handle);
+					Command.Position = Position;
+					Command.Rotation = Rotation;
+				}
 			}
 
 			else
 			{
-				// add a dummy entry to keep the component alive
-				AudioData.AudioHandle = Handle;
+				// keep the sound alive
+				CommandWriter.Add(EWwisePersistentAudioAction::KeepAlive, Handle);
 			}
 			
-			InstData->PersistentAudioActionQueue.Enqueue(AudioData);
 			AudioHandleOutParam.SetAndAdvance(Handle);
 			continue;
 		}
@@ -835,18 +1129,7 @@ void UNiagaraDataInterfaceWwiseEvent::PostPersistentEvent(FUnrealVectorVMContext
 		if (Handle > 0)
 		{
 			// stop sound
-			AudioData.AudioHandle = Handle;
-			AudioData.UpdateCallback = [Handle](FWwiseEventInterface_InstanceData* InstanceData,  FNiagaraSystemInstance*)
-			{
-				SCOPE_CYCLE_COUNTER(STAT_WwiseNiagaraStopEvent);
-				TWeakObjectPtr<UAkComponent> AkComponent = InstanceData->PersistentComponents.FindRef(Handle);
-				if (AkComponent.IsValid())
-				{
-					AkComponent->Stop();
-					InstanceData->PersistentComponents.Remove(Handle);
-				}
-			};
-			InstData->PersistentAudioActionQueue.Enqueue(AudioData);
+			CommandWriter.Add(EWwisePersistentAudioAction::Stop, Handle);
 		}
 
 		AudioHandleOutParam.SetAndAdvance(0);
@@ -867,6 +1150,7 @@ bool UNiagaraDataInterfaceWwiseEvent::CopyToInternal(UNiagaraDataInterface* Dest
 	OtherTyped->bLimitPostsPerTick = bLimitPostsPerTick;
 	OtherTyped->MaxPostsPerTick = MaxPostsPerTick;
 	OtherTyped->bStopWhenComponentIsDestroyed = bStopWhenComponentIsDestroyed;
+	OtherTyped->PersistentComponentPoolSize = PersistentComponentPoolSize;
 #if WITH_EDITORONLY_DATA
 	OtherTyped->bOnlyActiveDuringGameplay = bOnlyActiveDuringGameplay;
 #endif
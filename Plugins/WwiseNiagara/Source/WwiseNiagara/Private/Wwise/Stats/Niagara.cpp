@@ -20,5 +20,8 @@ Copyright (c) 2024 Audiokinetic Inc.
 DEFINE_STAT(STAT_WwiseNiagaraCreateEvent);
 DEFINE_STAT(STAT_WwiseNiagaraUpdateEvent);
 DEFINE_STAT(STAT_WwiseNiagaraStopEvent);
+DEFINE_STAT(STAT_WwiseNiagaraSpawnedComponents);
+DEFINE_STAT(STAT_WwiseNiagaraReusedComponents);
+DEFINE_STAT(STAT_WwiseNiagaraPooledComponents);
 
 DEFINE_LOG_CATEGORY(LogWwiseNiagara);
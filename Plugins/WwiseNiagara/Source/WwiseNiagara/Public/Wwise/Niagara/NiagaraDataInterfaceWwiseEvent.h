@@ -25,6 +25,7 @@ Copyright (c) 2024 Audiokinetic Inc.
 #include "WwiseUEFeatures.h"
 #include "WwiseUnrealHelper.h"
 
+#include "HAL/CriticalSection.h"
 #include "UObject/WeakObjectPtr.h"
 #include "NiagaraDataInterfaceWwiseEvent.generated.h"
 
@@ -44,23 +45,80 @@ struct FWwiseEventParticleData
 	float StartTime = 1;
 };
 
-struct FPersistentWwiseParticleData
+enum class EWwisePersistentAudioAction : uint8
 {
+	/** Only keeps the event alive this tick */
+	KeepAlive,
+	Post,
+	SetPosition,
+	SetRotation,
+	SetGameParameter,
+	Stop,
+};
+
+/** A persistent event action recorded by the VM. Plain data, so the VM threads copy it straight into the instance's command buffer. */
+struct FWwisePersistentAudioCommand
+{
+	EWwisePersistentAudioAction Action = EWwisePersistentAudioAction::KeepAlive;
 	int32 AudioHandle = 0;
+	int32 GameParameterIndex = 0;
+	float GameParameterValue = 0.f;
+	FVector Position;
+	FRotator Rotation;
+};
+
+/** The game thread state of one persistent event handle */
+struct FWwisePersistentEventSlot
+{
+	TWeakObjectPtr<UAkComponent> Component;
+	uint32 PlayingID = 0;
+
+	/** The value of FWwiseEventInterface_InstanceData::TickCount when a command last used this slot */
+	uint32 LastUpdateTick = 0;
 
-	/** The update callback is executed in PerInstanceTickPostSimulate, which runs on the game thread */
-	TFunction<void(struct FWwiseEventInterface_InstanceData*,FNiagaraSystemInstance*)> UpdateCallback;
+	/** Bumped every time the slot is freed, so that handles of a previous event are ignored */
+	uint16 Generation = 0;
+
+	/** The event is playing on Component. A handle whose event failed to post or was stopped keeps its slot until it is no longer used. */
+	bool bActive = false;
+	bool bFree = false;
 };
 
 struct FWwiseEventInterface_InstanceData
 {
 	/** We use a lock-free queue here because multiple threads might try to push data to it at the same time. */
 	TQueue<FWwiseEventParticleData, EQueueMode::Mpsc> OneShotQueue;
-	TQueue<FPersistentWwiseParticleData, EQueueMode::Mpsc> PersistentAudioActionQueue;
-	FThreadSafeCounter HandleCount;
 
-	TSortedMap<int32, TWeakObjectPtr<UAkComponent>> PersistentComponents;
-	TSortedMap<int32, int32 > PlayingIDs;
+	/** Handles are the slot index plus one in the low bits, and the slot's generation above */
+	static constexpr int32 HandleSlotBits = 20;
+	static constexpr int32 HandleSlotMask = (1 << HandleSlotBits) - 1;
+	static constexpr int32 MaxPersistentSlots = HandleSlotMask;
+	static constexpr int32 HandleGenerationMask = (1 << (31 - HandleSlotBits)) - 1;
+
+	/** Filled by the VM threads, which reserve space with NumPersistentCommands, and drained in PerInstanceTickPostSimulate.
+	 *  It is only resized on the game thread, when a tick had more commands than it could hold. */
+	TArray<FWwisePersistentAudioCommand> PersistentCommands;
+	FThreadSafeCounter NumPersistentCommands;
+
+	/** The commands that did not fit in PersistentCommands, run after them on the same tick */
+	TArray<FWwisePersistentAudioCommand> OverflowPersistentCommands;
+	FCriticalSection OverflowPersistentCommandsLock;
+
+	/** Indexed by the handle's slot. Only changed in PerInstanceTickPostSimulate, while the VM is not running. */
+	TArray<FWwisePersistentEventSlot> PersistentSlots;
+
+	/** Freed slots; the VM threads take them from the end, down from NumFreePersistentSlots, before adding new slots past NumPersistentSlots */
+	TArray<int32> FreePersistentSlots;
+	FThreadSafeCounter NumFreePersistentSlots;
+	FThreadSafeCounter NumPersistentSlots;
+	uint32 TickCount = 0;
+
+	/** Stopped AkComponents that are still registered with the world, reused by persistent events instead of spawning new ones */
+	TArray<TWeakObjectPtr<UAkComponent>> ComponentPool;
+	int32 ComponentPoolSize = 0;
+	int32 NumPersistentPosts = 0;
+	int32 NumComponentsSpawned = 0;
+	int32 NumComponentsReused = 0;
 
 	TWeakObjectPtr<UAkAudioEvent> EventToPost;
 	TArray<TWeakObjectPtr<UAkRtpc>> GameParameters;
@@ -77,6 +135,27 @@ struct FWwiseEventInterface_InstanceData
 #if WITH_EDITORONLY_DATA
 	bool bOnlyActiveDuringGameplay = false;
 #endif
+
+	/** VM threads: reserves a slot for a new persistent event. Returns its handle, or 0 if every slot is taken. */
+	int32 AllocatePersistentHandle();
+
+	/** VM threads: commands that don't fit spill into OverflowPersistentCommands, and the buffer grows before the next tick */
+	void EnqueuePersistentCommands(const FWwisePersistentAudioCommand* Commands, int32 Count);
+
+	/** The slot of a live handle, null for 0 and for handles that were already freed */
+	FWwisePersistentEventSlot* FindPersistentSlot(int32 Handle);
+
+	/** Game thread: runs the queued commands, then frees the handles that got none, ending their events. SystemInstance is only needed to post events. */
+	void ProcessPersistentCommands(FNiagaraSystemInstance* SystemInstance);
+
+	/** Game thread: drops the queued commands, keeping every event alive */
+	void DiscardPersistentCommands();
+
+private:
+	/** Takes in the slots the VM claimed since the last tick, from the free list and past the end */
+	void ClaimPersistentSlots();
+	void FreePersistentSlot(int32 SlotIndex);
+	void RunPersistentCommand(FNiagaraSystemInstance* SystemInstance, const FWwisePersistentAudioCommand& Command);
 };
 
 /** This Data Interface can be used to post Wwise events driven by particle data. */
@@ -109,6 +188,11 @@ public:
 	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Audio")
 	bool bStopWhenComponentIsDestroyed = true;
 
+	/** The number of stopped AkComponents each system instance keeps registered for the next persistent events to reuse, instead of
+	 *  destroying them when their particle dies and spawning new ones. Only used if Stop When Component Is Destroyed is set. 0 disables it. */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Audio", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bStopWhenComponentIsDestroyed"))
+	int32 PersistentComponentPoolSize = 16;
+
 #if WITH_EDITORONLY_DATA
 	/** If true, this data interface only processes sounds during active gameplay, and not while using Realtime Rendering in the open viewport.
 	 * This is useful when you are working in the preview window and the sounds annoy you. */
@@ -25,6 +25,9 @@ DECLARE_STATS_GROUP(TEXT("Niagara"), STATGROUP_WwiseNiagara, STATCAT_Wwise);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Create persistent event"), STAT_WwiseNiagaraCreateEvent, STATGROUP_WwiseNiagara, WWISENIAGARA_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Update persistent event"), STAT_WwiseNiagaraUpdateEvent, STATGROUP_WwiseNiagara, WWISENIAGARA_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Stop persistent event"), STAT_WwiseNiagaraStopEvent, STATGROUP_WwiseNiagara, WWISENIAGARA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawned persistent event components"), STAT_WwiseNiagaraSpawnedComponents, STATGROUP_WwiseNiagara, WWISENIAGARA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Reused persistent event components"), STAT_WwiseNiagaraReusedComponents, STATGROUP_WwiseNiagara, WWISENIAGARA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled persistent event components"), STAT_WwiseNiagaraPooledComponents, STATGROUP_WwiseNiagara, WWISENIAGARA_API);
 
 WWISENIAGARA_API DECLARE_LOG_CATEGORY_EXTERN(LogWwiseNiagara, Log, All);
 
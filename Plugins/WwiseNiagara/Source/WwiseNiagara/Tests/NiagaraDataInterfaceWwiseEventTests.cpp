@@ -0,0 +1,204 @@
+/*******************************************************************************
+The content of this file includes portions of the proprietary AUDIOKINETIC Wwise
+Technology released in source code form as part of the game integration package.
+The content of this file may not be used without valid licenses to the
+AUDIOKINETIC Wwise Technology.
+Note that the use of the game engine is subject to the Unreal(R) Engine End User
+License Agreement at https://www.unrealengine.com/en-US/eula/unreal
+ 
+License Usage
+ 
+Licensees holding valid licenses to the AUDIOKINETIC Wwise Technology may use
+this file in accordance with the end user license agreement provided with the
+software or, alternatively, in accordance with the terms contained
+in a written agreement between you and Audiokinetic Inc.
+Copyright (c) 2024 Audiokinetic Inc.
+*******************************************************************************/
+
+#include "Wwise/WwiseUnitTests.h"
+
+#if WWISE_UNIT_TESTS
+#include "Wwise/Niagara/NiagaraDataInterfaceWwiseEvent.h"
+#include "Async/ParallelFor.h"
+
+namespace WwiseNiagaraTests
+{
+	/** VM chunks run their external functions as one call each, from any thread */
+	constexpr int32 ParticlesPerChunk = 128;
+
+	FWwisePersistentAudioCommand MakeCommand(EWwisePersistentAudioAction Action, int32 AudioHandle)
+	{
+		FWwisePersistentAudioCommand Command;
+		Command.Action = Action;
+		Command.AudioHandle = AudioHandle;
+		Command.Position = FVector::ZeroVector;
+		Command.Rotation = FRotator::ZeroRotator;
+		return Command;
+	}
+
+	/** PostPersistentEvent for particles that don't have a handle yet */
+	void PostParticles(FWwiseEventInterface_InstanceData& InstanceData, TArray<int32>& OutHandles, int32 NumParticles)
+	{
+		OutHandles.SetNumZeroed(NumParticles);
+		ParallelFor(FMath::DivideAndRoundUp(NumParticles, ParticlesPerChunk), [&InstanceData, &OutHandles, NumParticles](int32 Chunk)
+		{
+			FWwisePersistentAudioCommand Commands[ParticlesPerChunk];
+			int32 NumCommands = 0;
+			for (int32 Particle = Chunk * ParticlesPerChunk; Particle < FMath::Min((Chunk + 1) * ParticlesPerChunk, NumParticles); ++Particle)
+			{
+				OutHandles[Particle] = InstanceData.AllocatePersistentHandle();
+				Commands[NumCommands++] = MakeCommand(EWwisePersistentAudioAction::Post, OutHandles[Particle]);
+			}
+			InstanceData.EnqueuePersistentCommands(Commands, NumCommands);
+		});
+	}
+
+	/** A tick of a persistent event module on every particle: keep alive, follow the particle and drive a Game Parameter */
+	void UpdateParticles(FWwiseEventInterface_InstanceData& InstanceData, const TArray<int32>& Handles)
+	{
+		ParallelFor(FMath::DivideAndRoundUp(Handles.Num(), ParticlesPerChunk), [&InstanceData, &Handles](int32 Chunk)
+		{
+			FWwisePersistentAudioCommand Commands[ParticlesPerChunk * 3];
+			int32 NumCommands = 0;
+			for (int32 Particle = Chunk * ParticlesPerChunk; Particle < FMath::Min((Chunk + 1) * ParticlesPerChunk, Handles.Num()); ++Particle)
+			{
+				Commands[NumCommands++] = MakeCommand(EWwisePersistentAudioAction::KeepAlive, Handles[Particle]);
+
+				FWwisePersistentAudioCommand& Position = Commands[NumCommands++];
+				Position = MakeCommand(EWwisePersistentAudioAction::SetPosition, Handles[Particle]);
+				Position.Position = FVector(Particle, Chunk, 0.f);
+
+				FWwisePersistentAudioCommand& GameParameter = Commands[NumCommands++];
+				GameParameter = MakeCommand(EWwisePersistentAudioAction::SetGameParameter, Handles[Particle]);
+				GameParameter.GameParameterValue = Particle * 0.01f;
+			}
+			InstanceData.EnqueuePersistentCommands(Commands, NumCommands);
+		});
+	}
+
+	int32 CountLiveHandles(FWwiseEventInterface_InstanceData& InstanceData, const TArray<int32>& Handles)
+	{
+		int32 Count = 0;
+		for (int32 Handle : Handles)
+		{
+			Count += InstanceData.FindPersistentSlot(Handle) ? 1 : 0;
+		}
+		return Count;
+	}
+}
+
+WWISE_TEST_CASE(Niagara_PersistentEvents_Smoke, "Wwise::Niagara::PersistentEvents_Smoke", "[ApplicationContextMask][SmokeFilter]")
+{
+	using namespace WwiseNiagaraTests;
+
+	SECTION("Handles are freed when no longer used, and stale handles are ignored")
+	{
+		FWwiseEventInterface_InstanceData InstanceData;
+		InstanceData.PersistentCommands.SetNumUninitialized(64);
+
+		TArray<int32> Handles;
+		PostParticles(InstanceData, Handles, 2);
+		InstanceData.ProcessPersistentCommands(nullptr);
+		CHECK(Handles[0] > 0);
+		CHECK(Handles[1] > 0);
+		CHECK(Handles[0] != Handles[1]);
+		CHECK(CountLiveHandles(InstanceData, Handles) == 2);
+
+		const TArray<int32> Survivor = { Handles[1] };
+		UpdateParticles(InstanceData, Survivor);
+		InstanceData.ProcessPersistentCommands(nullptr);
+		CHECK(InstanceData.FindPersistentSlot(Handles[0]) == nullptr);
+		CHECK(InstanceData.FindPersistentSlot(Handles[1]) != nullptr);
+
+		// The freed slot is reused under a new handle
+		TArray<int32> NewHandles;
+		PostParticles(InstanceData, NewHandles, 1);
+		UpdateParticles(InstanceData, Survivor);
+		InstanceData.ProcessPersistentCommands(nullptr);
+		CHECK(NewHandles[0] != Handles[0]);
+		CHECK((NewHandles[0] & FWwiseEventInterface_InstanceData::HandleSlotMask) == (Handles[0] & FWwiseEventInterface_InstanceData::HandleSlotMask));
+		CHECK(InstanceData.FindPersistentSlot(NewHandles[0]) != nullptr);
+		CHECK(InstanceData.FindPersistentSlot(Handles[0]) == nullptr);
+		CHECK(InstanceData.PersistentSlots.Num() == 2);
+	}
+
+	SECTION("Overflowing the command buffer keeps every handle and grows it")
+	{
+		FWwiseEventInterface_InstanceData InstanceData;
+		InstanceData.PersistentCommands.SetNumUninitialized(64);
+
+		// 136 of the Posts don't fit in the buffer, and still run on this tick
+		TArray<int32> Handles;
+		PostParticles(InstanceData, Handles, 200);
+		InstanceData.ProcessPersistentCommands(nullptr);
+		CHECK(InstanceData.NumPersistentPosts == 200);
+		CHECK(InstanceData.OverflowPersistentCommands.Num() == 0);
+		CHECK(InstanceData.PersistentCommands.Num() >= 200);
+		CHECK(CountLiveHandles(InstanceData, Handles) == 200);
+
+		// Posting again in a buffer that is too small, in the middle of a tick that overflows too
+		TArray<int32> MoreHandles;
+		InstanceData.PersistentCommands.SetNumUninitialized(64);
+		UpdateParticles(InstanceData, Handles);
+		PostParticles(InstanceData, MoreHandles, 100);
+		InstanceData.ProcessPersistentCommands(nullptr);
+		CHECK(InstanceData.NumPersistentPosts == 300);
+		CHECK(CountLiveHandles(InstanceData, MoreHandles) == 100);
+		CHECK(CountLiveHandles(InstanceData, Handles) == 200);
+
+		CHECK(InstanceData.PersistentCommands.Num() >= 700);
+
+		// Handles that get no command on a tick are freed, overflow or not
+		UpdateParticles(InstanceData, Handles);
+		InstanceData.ProcessPersistentCommands(nullptr);
+		CHECK(CountLiveHandles(InstanceData, Handles) == 200);
+		CHECK(CountLiveHandles(InstanceData, MoreHandles) == 0);
+	}
+}
+
+WWISE_TEST_CASE(Niagara_PersistentEvents_Perf, "Wwise::Niagara::PersistentEvents_Perf", "[ApplicationContextMask][PerfFilter]")
+{
+	using namespace WwiseNiagaraTests;
+
+	SECTION("10k particles")
+	{
+		constexpr const int NumParticles = 10000;
+		constexpr const int NumTicks = 100;
+		constexpr const int ExpectedUS = 500000;
+
+		FWwiseEventInterface_InstanceData InstanceData;
+		InstanceData.PersistentCommands.SetNumUninitialized(1024);
+
+		TArray<int32> Handles;
+		PostParticles(InstanceData, Handles, NumParticles);
+		InstanceData.ProcessPersistentCommands(nullptr);
+
+		// Lets the command buffer grow to the steady state
+		UpdateParticles(InstanceData, Handles);
+		InstanceData.ProcessPersistentCommands(nullptr);
+
+		const FWwisePersistentAudioCommand* CommandData = InstanceData.PersistentCommands.GetData();
+		const FWwisePersistentEventSlot* SlotData = InstanceData.PersistentSlots.GetData();
+
+		FTimespan VMDuration;
+		FTimespan PostSimulateDuration;
+		for (int Tick = 0; Tick < NumTicks; ++Tick)
+		{
+			FDateTime StartTime = FDateTime::UtcNow();
+			UpdateParticles(InstanceData, Handles);
+			FDateTime VMEndTime = FDateTime::UtcNow();
+			InstanceData.ProcessPersistentCommands(nullptr);
+			PostSimulateDuration += FDateTime::UtcNow() - VMEndTime;
+			VMDuration += VMEndTime - StartTime;
+		}
+
+		WWISE_TEST_LOG("PersistentEvents %d particles, %d ticks: VM %dus, post simulate %dus < %dus",
+			NumParticles, NumTicks, (int)VMDuration.GetTotalMicroseconds(), (int)PostSimulateDuration.GetTotalMicroseconds(), ExpectedUS);
+		CHECK(CountLiveHandles(InstanceData, Handles) == NumParticles);
+		CHECK(InstanceData.PersistentCommands.GetData() == CommandData);
+		CHECK(InstanceData.PersistentSlots.GetData() == SlotData);
+		CHECK(PostSimulateDuration.GetTotalMicroseconds() < ExpectedUS);
+	}
+}
+
+#endif // WWISE_UNIT_TESTS
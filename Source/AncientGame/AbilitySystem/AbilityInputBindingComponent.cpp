@@ -44,6 +44,14 @@ void UAbilityInputBindingComponent::SetInputBinding(UInputAction* InputAction, F
 	{
 		AbilityInputBinding = &MappedAbilities.Add(InputAction);
 		AbilityInputBinding->InputID = GetNextInputID();
+
+		// Cleared earlier in this update, so its input component bindings are still there to take back
+		FAbilityInputBinding PendingRemovedBinding;
+		if (PendingRemovedBindings.RemoveAndCopyValue(InputAction, PendingRemovedBinding))
+		{
+			AbilityInputBinding->OnPressedHandle = PendingRemovedBinding.OnPressedHandle;
+			AbilityInputBinding->OnReleasedHandle = PendingRemovedBinding.OnReleasedHandle;
+		}
 	}
 
 	if (BindingAbility)
@@ -52,6 +60,8 @@ void UAbilityInputBindingComponent::SetInputBinding(UInputAction* InputAction, F
 	}
 
 	AbilityInputBinding->BoundAbilitiesStack.Push(AbilityHandle);
+	AbilityInputActions.Add(AbilityHandle, InputAction);
+
 	TryBindAbilityInput(InputAction, *AbilityInputBinding);
 }
 
@@ -59,44 +69,34 @@ void UAbilityInputBindingComponent::ClearInputBinding(FGameplayAbilitySpecHandle
 {
 	using namespace AbilityInputBindingComponent_Impl;
 
-	if (FGameplayAbilitySpec* FoundAbility = FindAbilitySpec(AbilityHandle))
+	// Find the mapping for this ability
+	UInputAction* InputAction = nullptr;
+	if (!AbilityInputActions.RemoveAndCopyValue(AbilityHandle, InputAction))
+	{
+		return;
+	}
+
+	FAbilityInputBinding* AbilityInputBinding = MappedAbilities.Find(InputAction);
+	if (AbilityInputBinding && AbilityInputBinding->BoundAbilitiesStack.Remove(AbilityHandle) > 0)
 	{
-		// Find the mapping for this ability
-		auto MappedIterator = MappedAbilities.CreateIterator();
-		while (MappedIterator)
+		if (AbilityInputBinding->BoundAbilitiesStack.Num() > 0)
 		{
-			if (MappedIterator.Value().InputID == FoundAbility->InputID)
+			FGameplayAbilitySpec* StackedAbility = FindAbilitySpec(AbilityInputBinding->BoundAbilitiesStack.Top());
+			if (StackedAbility && StackedAbility->InputID == 0)
 			{
-				break;
+				StackedAbility->InputID = AbilityInputBinding->InputID;
 			}
-
-			++MappedIterator;
 		}
-
-		if (MappedIterator)
+		else
 		{
-			FAbilityInputBinding& AbilityInputBinding = MappedIterator.Value();
-
-			if (AbilityInputBinding.BoundAbilitiesStack.Remove(AbilityHandle) > 0)
-			{
-				if (AbilityInputBinding.BoundAbilitiesStack.Num() > 0)
-				{
-					FGameplayAbilitySpec* StackedAbility = FindAbilitySpec(AbilityInputBinding.BoundAbilitiesStack.Top());
-					if (StackedAbility && StackedAbility->InputID == 0)
-					{
-						StackedAbility->InputID = AbilityInputBinding.InputID;
-					}
-				}
-				else
-				{
-					// NOTE: This will invalidate the `AbilityInputBinding` ref above
-					RemoveEntry(MappedIterator.Key());
-				}
-				// DO NOT act on `AbilityInputBinding` after here (it could have been removed)
-
+			// NOTE: This will invalidate the `AbilityInputBinding` pointer above
+			RemoveEntry(InputAction);
+		}
+		// DO NOT act on `AbilityInputBinding` after here (it could have been removed)
 
-				FoundAbility->InputID = InvalidInputID;
-			}
+		if (FGameplayAbilitySpec* FoundAbility = FindAbilitySpec(AbilityHandle))
+		{
+			FoundAbility->InputID = InvalidInputID;
 		}
 	}
 }
@@ -106,8 +106,30 @@ void UAbilityInputBindingComponent::ClearAbilityBindings(UInputAction* InputActi
 	RemoveEntry(InputAction);
 }
 
+void UAbilityInputBindingComponent::BeginInputBindingUpdate()
+{
+	++InputBindingUpdateDepth;
+}
+
+void UAbilityInputBindingComponent::CommitInputBindingUpdate()
+{
+	if (!ensure(InputBindingUpdateDepth > 0) || --InputBindingUpdateDepth > 0)
+	{
+		return;
+	}
+
+	RemovePendingBindings();
+
+	for (auto& InputBinding : MappedAbilities)
+	{
+		TryBindAbilityInput(InputBinding.Key, InputBinding.Value);
+	}
+}
+
 void UAbilityInputBindingComponent::ResetBindings()
 {
+	RemovePendingBindings();
+
 	for (auto& InputBinding : MappedAbilities)
 	{
 		if (InputComponent)
@@ -115,6 +137,8 @@ void UAbilityInputBindingComponent::ResetBindings()
 			InputComponent->RemoveBindingByHandle(InputBinding.Value.OnPressedHandle);
 			InputComponent->RemoveBindingByHandle(InputBinding.Value.OnReleasedHandle);
 		}
+		InputBinding.Value.OnPressedHandle = 0;
+		InputBinding.Value.OnReleasedHandle = 0;
 
 		if (AbilityComponent)
 		{
@@ -140,13 +164,7 @@ void UAbilityInputBindingComponent::SetupPlayerControls_Implementation(UEnhanced
 
 	for (auto& Ability : MappedAbilities)
 	{
-		UInputAction* InputAction = Ability.Key;
-
-		// Pressed event
-		InputComponent->BindAction(InputAction, ETriggerEvent::Started, this, &UAbilityInputBindingComponent::OnAbilityInputPressed, InputAction);
-
-		// Released event
-		InputComponent->BindAction(InputAction, ETriggerEvent::Completed, this, &UAbilityInputBindingComponent::OnAbilityInputReleased, InputAction);
+		TryBindAbilityInput(Ability.Key, Ability.Value);
 	}
 
 	RunAbilitySystemSetup();
@@ -222,11 +240,7 @@ void UAbilityInputBindingComponent::RemoveEntry(UInputAction* InputAction)
 {
 	if (FAbilityInputBinding* Bindings = MappedAbilities.Find(InputAction))
 	{
-		if (InputComponent)
-		{
-			InputComponent->RemoveBindingByHandle(Bindings->OnPressedHandle);
-			InputComponent->RemoveBindingByHandle(Bindings->OnReleasedHandle);
-		}
+		RemoveInputComponentBindings(InputAction, *Bindings);
 
 		for (FGameplayAbilitySpecHandle AbilityHandle : Bindings->BoundAbilitiesStack)
 		{
@@ -237,12 +251,52 @@ void UAbilityInputBindingComponent::RemoveEntry(UInputAction* InputAction)
 			{
 				AbilitySpec->InputID = InvalidInputID;
 			}
+
+			UInputAction* const* MappedAction = AbilityInputActions.Find(AbilityHandle);
+			if (MappedAction && *MappedAction == InputAction)
+			{
+				AbilityInputActions.Remove(AbilityHandle);
+			}
 		}
 
 		MappedAbilities.Remove(InputAction);
 	}
 }
 
+void UAbilityInputBindingComponent::RemoveInputComponentBindings(UInputAction* InputAction, FAbilityInputBinding& AbilityInputBinding)
+{
+	if (InputComponent && (AbilityInputBinding.OnPressedHandle != 0 || AbilityInputBinding.OnReleasedHandle != 0))
+	{
+		if (InputBindingUpdateDepth > 0)
+		{
+			FAbilityInputBinding& PendingRemovedBinding = PendingRemovedBindings.Add(InputAction);
+			PendingRemovedBinding.OnPressedHandle = AbilityInputBinding.OnPressedHandle;
+			PendingRemovedBinding.OnReleasedHandle = AbilityInputBinding.OnReleasedHandle;
+		}
+		else
+		{
+			InputComponent->RemoveBindingByHandle(AbilityInputBinding.OnPressedHandle);
+			InputComponent->RemoveBindingByHandle(AbilityInputBinding.OnReleasedHandle);
+		}
+	}
+
+	AbilityInputBinding.OnPressedHandle = 0;
+	AbilityInputBinding.OnReleasedHandle = 0;
+}
+
+void UAbilityInputBindingComponent::RemovePendingBindings()
+{
+	if (InputComponent)
+	{
+		for (const TPair<UInputAction*, FAbilityInputBinding>& PendingRemovedBinding : PendingRemovedBindings)
+		{
+			InputComponent->RemoveBindingByHandle(PendingRemovedBinding.Value.OnPressedHandle);
+			InputComponent->RemoveBindingByHandle(PendingRemovedBinding.Value.OnReleasedHandle);
+		}
+	}
+	PendingRemovedBindings.Reset();
+}
+
 FGameplayAbilitySpec* UAbilityInputBindingComponent::FindAbilitySpec(FGameplayAbilitySpecHandle Handle)
 {
 	FGameplayAbilitySpec* FoundAbility = nullptr;
@@ -255,7 +309,8 @@ FGameplayAbilitySpec* UAbilityInputBindingComponent::FindAbilitySpec(FGameplayAb
 
 void UAbilityInputBindingComponent::TryBindAbilityInput(UInputAction* InputAction, FAbilityInputBinding& AbilityInputBinding)
 {
-	if (InputComponent)
+	// Deferred to CommitInputBindingUpdate while batching
+	if (InputComponent && InputBindingUpdateDepth == 0)
 	{
 		// Pressed event
 		if (AbilityInputBinding.OnPressedHandle == 0)
@@ -269,4 +324,4 @@ void UAbilityInputBindingComponent::TryBindAbilityInput(UInputAction* InputActio
 			AbilityInputBinding.OnReleasedHandle = InputComponent->BindAction(InputAction, ETriggerEvent::Completed, this, &UAbilityInputBindingComponent::OnAbilityInputReleased, InputAction).GetHandle();
 		}
 	}
-}
\ No newline at end of file
+}
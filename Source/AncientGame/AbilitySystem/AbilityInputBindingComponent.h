@@ -59,13 +59,62 @@ private:
 
 	void RemoveEntry(UInputAction* InputAction);
 
+	/**
+	 * Holds back input component changes until the matching CommitInputBindingUpdate, which applies everything
+	 * bound and cleared in between in one pass. Actions cleared and bound again in between keep their input component
+	 * bindings. Calls can be nested; the outermost commit applies. Only reachable through FAbilityInputBindingUpdateScope,
+	 * so every begin is matched by a commit.
+	 */
+	void BeginInputBindingUpdate();
+	void CommitInputBindingUpdate();
+
 	FGameplayAbilitySpec* FindAbilitySpec(FGameplayAbilitySpecHandle Handle);
+	/** Binds whichever events aren't bound yet */
 	void TryBindAbilityInput(UInputAction* InputAction, FAbilityInputBinding& AbilityInputBinding);
+	void RemoveInputComponentBindings(UInputAction* InputAction, FAbilityInputBinding& AbilityInputBinding);
+	void RemovePendingBindings();
 
 private:
+	friend class FAbilityInputBindingUpdateScope;
+
 	UPROPERTY(transient)
 	UAbilitySystemComponent* AbilityComponent;
 
 	UPROPERTY(transient)
 	TMap<UInputAction*, FAbilityInputBinding> MappedAbilities;
+
+	/** Which input action each bound ability is stacked on */
+	TMap<FGameplayAbilitySpecHandle, UInputAction*> AbilityInputActions;
+
+	/** Begin/CommitInputBindingUpdate nesting, and the bindings of the actions cleared since, removed by the commit unless bound again */
+	int32 InputBindingUpdateDepth = 0;
+	TMap<UInputAction*, FAbilityInputBinding> PendingRemovedBindings;
+};
+
+/** Batches the binding changes made on a UAbilityInputBindingComponent while in scope */
+class FAbilityInputBindingUpdateScope
+{
+public:
+	explicit FAbilityInputBindingUpdateScope(UAbilityInputBindingComponent* InComponent)
+		: Component(InComponent)
+	{
+		if (Component)
+		{
+			Component->BeginInputBindingUpdate();
+		}
+	}
+
+	~FAbilityInputBindingUpdateScope()
+	{
+		if (Component)
+		{
+			Component->CommitInputBindingUpdate();
+		}
+	}
+
+	FAbilityInputBindingUpdateScope(const FAbilityInputBindingUpdateScope&) = delete;
+	FAbilityInputBindingUpdateScope& operator=(const FAbilityInputBindingUpdateScope&) = delete;
+
+private:
+	UAbilityInputBindingComponent* Component;
 };
@@ -5,6 +5,7 @@
 #include "Abilities/GameplayAbility.h"
 #include "Abilities/GameplayAbilityTypes.h"
 #include "AbilitySystem/AncientGameAbilityAttributeSet.h"
+#include "AbilitySystem/AttributeSetInitializer.h"
 #include "Animation/AncientGameAnimInstance.h"
 #include "Animation/AnimInstance.h"
 #include "AttributeSet.h"
@@ -125,7 +126,7 @@ void UAncientGameAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes()
 				UAttributeSet* NewAttribSet = NewObject<UAttributeSet>(this, Attributes.AttributeSetType);
 				if (Attributes.InitializationData)
 				{
-					NewAttribSet->InitFromMetaDataTable(Attributes.InitializationData);
+					FAncientGameAttributeSetInitializer::InitFromMetaDataTable(NewAttribSet, Attributes.InitializationData);
 				}
 				AddedAttributes.Add(NewAttribSet);
 				AddAttributeSetSubobject(NewAttribSet);
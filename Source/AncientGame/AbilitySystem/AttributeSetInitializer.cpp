@@ -0,0 +1,162 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AbilitySystem/AttributeSetInitializer.h"
+
+#include "AncientGame.h"
+#include "AttributeSet.h"
+#include "Containers/UnrealString.h"
+#include "Engine/DataTable.h"
+#include "Logging/LogMacros.h"
+#include "Misc/AssertionMacros.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectGlobals.h"
+
+//////////////////////////////////////////////////////////////////////
+// FAncientGameAttributeSetInitializer
+
+void FAncientGameAttributeSetInitializer::InitFromMetaDataTable(UAttributeSet* AttributeSet, const UDataTable* DataTable)
+{
+	check(IsInGameThread());
+
+	if (AttributeSet && DataTable)
+	{
+		FAncientGameAttributeSetInitializerCache::Get().FindOrCompile(AttributeSet->GetClass(), DataTable).Apply(AttributeSet);
+	}
+}
+
+void FAncientGameAttributeSetInitializer::InvalidateAll()
+{
+	FAncientGameAttributeSetInitializerCache::Get().InvalidateAll();
+}
+
+void FAncientGameAttributeSetInitializer::Compile(const UClass* AttributeSetClass, const UDataTable* DataTable)
+{
+	// Mirrors UAttributeSet::InitFromMetaDataTable
+	static const FString Context = FString(TEXT("FAncientGameAttributeSetInitializer::Compile"));
+
+	NumericValues.Reset();
+	AttributeDataValues.Reset();
+
+	for (TFieldIterator<FProperty> It(AttributeSetClass, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		FProperty* Property = *It;
+		FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+		const bool bIsAttributeData = NumericProperty == nullptr && FGameplayAttribute::IsGameplayAttributeDataProperty(Property);
+		if (NumericProperty == nullptr && !bIsAttributeData)
+		{
+			continue;
+		}
+
+		const FString RowNameStr = FString::Printf(TEXT("%s.%s"), *Property->GetOwnerVariant().GetName(), *Property->GetName());
+		const FAttributeMetaData* MetaData = DataTable->FindRow<FAttributeMetaData>(FName(*RowNameStr), Context, false);
+		if (MetaData == nullptr)
+		{
+			continue;
+		}
+
+		if (NumericProperty)
+		{
+			NumericValues.Add({ NumericProperty, NumericProperty->GetOffset_ForInternal(), MetaData->BaseValue });
+		}
+		else
+		{
+			AttributeDataValues.Add({ Property->GetOffset_ForInternal(), MetaData->BaseValue });
+		}
+	}
+}
+
+void FAncientGameAttributeSetInitializer::Apply(UAttributeSet* AttributeSet) const
+{
+	uint8* Container = reinterpret_cast<uint8*>(AttributeSet);
+
+	for (const FNumericValue& Numeric : NumericValues)
+	{
+		Numeric.Property->SetFloatingPointPropertyValue(Container + Numeric.Offset, Numeric.Value);
+	}
+
+	for (const FAttributeDataValue& AttributeData : AttributeDataValues)
+	{
+		FGameplayAttributeData* DataPtr = reinterpret_cast<FGameplayAttributeData*>(Container + AttributeData.Offset);
+		DataPtr->SetBaseValue(AttributeData.Value);
+		DataPtr->SetCurrentValue(AttributeData.Value);
+	}
+
+	AttributeSet->PrintDebug();
+}
+
+//////////////////////////////////////////////////////////////////////
+// FAncientGameAttributeSetInitializerCache
+
+FAncientGameAttributeSetInitializerCache& FAncientGameAttributeSetInitializerCache::Get()
+{
+	static FAncientGameAttributeSetInitializerCache Cache;
+	return Cache;
+}
+
+FAncientGameAttributeSetInitializerCache::FAncientGameAttributeSetInitializerCache()
+{
+	// Reloaded classes can have different layouts
+	FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+	{
+		InvalidateAll();
+	});
+
+#if WITH_EDITOR
+	// Covers recompiled Blueprint attribute sets
+	FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([this](const FCoreUObjectDelegates::FReplacementObjectMap&)
+	{
+		InvalidateAll();
+	});
+#endif
+}
+
+const FAncientGameAttributeSetInitializer& FAncientGameAttributeSetInitializerCache::FindOrCompile(const UClass* AttributeSetClass, const UDataTable* DataTable)
+{
+	const FInitializerKey Key(AttributeSetClass, DataTable);
+	if (const FAncientGameAttributeSetInitializer* Initializer = Initializers.Find(Key))
+	{
+		return *Initializer;
+	}
+
+	FAncientGameAttributeSetInitializer& Initializer = Initializers.Add(Key);
+	Initializer.Compile(AttributeSetClass, DataTable);
+	++NumCompiled;
+
+	if (!DataTableChangedHandles.Contains(DataTable))
+	{
+		const FObjectKey DataTableKey(DataTable);
+		FDelegateHandle Handle = const_cast<UDataTable*>(DataTable)->OnDataTableChanged().AddLambda([this, DataTableKey]()
+		{
+			RemoveInitializersFor(DataTableKey);
+		});
+		DataTableChangedHandles.Add(DataTable, Handle);
+	}
+
+	UE_LOG(LogAncientGame, Verbose, TEXT("Compiled attribute initializer for %s from %s (%d values)"),
+		*AttributeSetClass->GetName(), *DataTable->GetName(), Initializer.GetNumValues());
+
+	return Initializer;
+}
+
+void FAncientGameAttributeSetInitializerCache::InvalidateDataTable(const UDataTable* DataTable)
+{
+	RemoveInitializersFor(FObjectKey(DataTable));
+}
+
+void FAncientGameAttributeSetInitializerCache::RemoveInitializersFor(FObjectKey DataTableKey)
+{
+	for (auto It = Initializers.CreateIterator(); It; ++It)
+	{
+		if (It->Key.Get<1>() == DataTableKey)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FAncientGameAttributeSetInitializerCache::InvalidateAll()
+{
+	// Table bindings are kept; they only ever invalidate
+	Initializers.Reset();
+}
@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "CoreTypes.h"
+#include "Delegates/IDelegateInstance.h"
+#include "Templates/Tuple.h"
+#include "UObject/ObjectKey.h"
+
+class FNumericProperty;
+class UAttributeSet;
+class UClass;
+class UDataTable;
+
+/**
+ * What UAttributeSet::InitFromMetaDataTable does for one attribute set class and one table, worked out once: which
+ * properties have rows, where they live in the object and what value they get. Applying it to a new set is a flat
+ * pass over those, with no row name building, table lookups or property iteration.
+ */
+class FAncientGameAttributeSetInitializer
+{
+public:
+	/** Initializes AttributeSet from DataTable, compiling and caching the initializer for the pair the first time it is seen */
+	static void InitFromMetaDataTable(UAttributeSet* AttributeSet, const UDataTable* DataTable);
+
+	/** Drops every cached initializer, e.g. after classes have been reloaded */
+	static void InvalidateAll();
+
+	void Apply(UAttributeSet* AttributeSet) const;
+
+	int32 GetNumValues() const { return NumericValues.Num() + AttributeDataValues.Num(); }
+
+private:
+	friend class FAncientGameAttributeSetInitializerCache;
+
+	void Compile(const UClass* AttributeSetClass, const UDataTable* DataTable);
+
+	struct FNumericValue
+	{
+		const FNumericProperty* Property;
+		int32 Offset;
+		float Value;
+	};
+
+	/** FGameplayAttributeData; base and current value both start at Value */
+	struct FAttributeDataValue
+	{
+		int32 Offset;
+		float Value;
+	};
+
+	TArray<FNumericValue> NumericValues;
+	TArray<FAttributeDataValue> AttributeDataValues;
+};
+
+/** Compiled initializers per (attribute set class, DataTable), invalidated when either changes */
+class FAncientGameAttributeSetInitializerCache
+{
+public:
+	static FAncientGameAttributeSetInitializerCache& Get();
+
+	const FAncientGameAttributeSetInitializer& FindOrCompile(const UClass* AttributeSetClass, const UDataTable* DataTable);
+
+	void InvalidateDataTable(const UDataTable* DataTable);
+	void InvalidateAll();
+
+	int32 GetNumCompiled() const { return NumCompiled; }
+
+private:
+	FAncientGameAttributeSetInitializerCache();
+
+	void RemoveInitializersFor(FObjectKey DataTableKey);
+
+	typedef TTuple<FObjectKey, FObjectKey> FInitializerKey;
+	TMap<FInitializerKey, FAncientGameAttributeSetInitializer> Initializers;
+
+	/** OnDataTableChanged bindings for every table with a cached initializer */
+	TMap<FObjectKey, FDelegateHandle> DataTableChangedHandles;
+
+	int32 NumCompiled = 0;
+};
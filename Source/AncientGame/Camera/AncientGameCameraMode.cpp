@@ -65,6 +65,16 @@ void FAncientGameCameraModeView::Blend(const FAncientGameCameraModeView& Other,
 /* UAncientGameCameraMode
  *****************************************************************************/
 
+void UAncientGameCameraMode::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	const UClass* Class = GetClass();
+	bUpdateViewInScript = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAncientGameCameraMode, UpdateView));
+	bPivotLocationInScript = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAncientGameCameraMode, GetPivotLocation));
+	bPivotRotationInScript = Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAncientGameCameraMode, GetPivotRotation));
+}
+
 void UAncientGameCameraMode::OnActivation(AActor* TargetActor)
 {
 	ReceiveActivation(TargetActor);
@@ -77,10 +87,27 @@ void UAncientGameCameraMode::OnDeactivation()
 
 void UAncientGameCameraMode::UpdateCameraMode(float DeltaTime, AActor* TargetActor)
 {
-	View = UpdateView(DeltaTime, TargetActor);
+	UpdateCameraView(DeltaTime, TargetActor, nullptr);
 	UpdateBlending(DeltaTime);
 }
 
+void UAncientGameCameraMode::UpdateCameraView(float DeltaTime, AActor* TargetActor, FAncientGameCameraPivotCache* InPivotCache)
+{
+	PivotCache = InPivotCache;
+	View = bUpdateViewInScript ? UpdateView(DeltaTime, TargetActor) : UpdateView_Implementation(DeltaTime, TargetActor);
+	PivotCache = nullptr;
+}
+
+FVector UAncientGameCameraMode::EvalPivotLocation(AActor* TargetActor) const
+{
+	return bPivotLocationInScript ? GetPivotLocation(TargetActor) : GetPivotLocation_Implementation(TargetActor);
+}
+
+FRotator UAncientGameCameraMode::EvalPivotRotation(AActor* TargetActor) const
+{
+	return bPivotRotationInScript ? GetPivotRotation(TargetActor) : GetPivotRotation_Implementation(TargetActor);
+}
+
 void UAncientGameCameraMode::SetBlendWeight(float Weight)
 {
 	BlendWeight = FMath::Clamp(Weight, 0.0f, 1.0f);
@@ -119,8 +146,8 @@ void UAncientGameCameraMode::SetBlendWeight(float Weight)
 FAncientGameCameraModeView UAncientGameCameraMode::UpdateView_Implementation(float DeltaTime, AActor* TargetActor)
 {
 	FAncientGameCameraModeView NewView;
-	NewView.Location = NewView.PivotLocation = GetPivotLocation(TargetActor);
-	NewView.Rotation = GetPivotRotation(TargetActor);
+	NewView.Location = NewView.PivotLocation = EvalPivotLocation(TargetActor);
+	NewView.Rotation = EvalPivotRotation(TargetActor);
 	NewView.Rotation.Pitch = FMath::ClampAngle(NewView.Rotation.Pitch, ViewPitchMin, ViewPitchMax);
 	NewView.FieldOfView = FieldOfView;
 
@@ -138,6 +165,12 @@ FAncientGameCameraModeView UAncientGameCameraMode::UpdateView_Implementation(flo
 
 FVector UAncientGameCameraMode::GetPivotLocation_Implementation(AActor* TargetActor) const
 {
+	const bool bUseCache = PivotCache && (PivotCache->TargetActor == TargetActor);
+	if (bUseCache && PivotCache->bHasLocation)
+	{
+		return PivotCache->Location;
+	}
+
 	FVector ViewLocation(ForceInit);
 
 	if (const APawn* TargetPawn = Cast<APawn>(TargetActor))
@@ -170,6 +203,12 @@ FVector UAncientGameCameraMode::GetPivotLocation_Implementation(AActor* TargetAc
 		ViewLocation = TargetActor->GetActorLocation();
 	}
 
+	if (bUseCache)
+	{
+		PivotCache->bHasLocation = true;
+		PivotCache->Location = ViewLocation;
+	}
+
 	return ViewLocation;
 }
 
@@ -177,13 +216,27 @@ FRotator UAncientGameCameraMode::GetPivotRotation_Implementation(AActor* TargetA
 {
 	FRotator ViewRotation(ForceInit);
 
-	if (const APawn* TargetPawn = Cast<APawn>(TargetActor))
+	const bool bUseCache = PivotCache && (PivotCache->TargetActor == TargetActor);
+	if (bUseCache && PivotCache->bHasRotation)
 	{
-		ViewRotation = TargetPawn->GetViewRotation();
+		ViewRotation = PivotCache->Rotation;
 	}
-	else if (TargetActor)
+	else
 	{
-		ViewRotation = TargetActor->GetActorRotation();
+		if (const APawn* TargetPawn = Cast<APawn>(TargetActor))
+		{
+			ViewRotation = TargetPawn->GetViewRotation();
+		}
+		else if (TargetActor)
+		{
+			ViewRotation = TargetActor->GetActorRotation();
+		}
+
+		if (bUseCache)
+		{
+			PivotCache->bHasRotation = true;
+			PivotCache->Rotation = ViewRotation;
+		}
 	}
 
 	ViewRotation.Pitch = FMath::ClampAngle(ViewRotation.Pitch, ViewPitchMin, ViewPitchMax);
@@ -5,6 +5,7 @@
 #include "Camera/AncientGameCameraModeView.h"
 #include "Math/Rotator.h"
 #include "Math/UnrealMathSSE.h"
+#include "Math/Vector.h"
 #include "UObject/Object.h"
 #include "UObject/UObjectGlobals.h"
 
@@ -13,6 +14,30 @@
 class AActor;
 struct FFrame;
 
+/**
+ * FAncientGameCameraPivotCache
+ *
+ *	Pivot of the target actor, computed once per stack evaluation and shared by every camera mode on the stack.
+ */
+struct FAncientGameCameraPivotCache
+{
+	void Reset(const AActor* InTargetActor)
+	{
+		TargetActor = InTargetActor;
+		bHasLocation = false;
+		bHasRotation = false;
+	}
+
+	const AActor* TargetActor = nullptr;
+
+	bool bHasLocation = false;
+	FVector Location = FVector::ZeroVector;
+
+	// Before each mode clamps its pitch.
+	bool bHasRotation = false;
+	FRotator Rotation = FRotator::ZeroRotator;
+};
+
 /**
  * EAncientGameCameraModeBlendFunction
  *
@@ -74,6 +99,10 @@ protected:
 	float BlendExponent = 4.f;
 
 public:
+	//~ Begin UObject interface
+	virtual void PostInitProperties() override;
+	//~ End UObject interface
+
 	// Called when this camera mode is activated on the camera mode stack.
 	virtual void OnActivation(AActor* TargetActor);
 	// Called when this camera mode is deactivated on the camera mode stack.
@@ -105,6 +134,10 @@ protected:
 
 	UFUNCTION(BlueprintNativeEvent, BlueprintPure, Category = "AncientGame|Camera", meta = (BlueprintProtected))
 	FRotator GetPivotRotation(AActor* TargetActor) const;
+
+	// Same as GetPivotLocation/GetPivotRotation, skipping the Blueprint VM when they aren't implemented in script.
+	FVector EvalPivotLocation(AActor* TargetActor) const;
+	FRotator EvalPivotRotation(AActor* TargetActor) const;
 	
 	void UpdateBlending(float DeltaTime);
 
@@ -123,5 +156,16 @@ private:
 	void DeactivateInternal();
 	bool bIsActivated = false;
 
+	// Updates View, skipping the Blueprint VM when UpdateView isn't implemented in script.
+	void UpdateCameraView(float DeltaTime, AActor* TargetActor, FAncientGameCameraPivotCache* InPivotCache);
+
+	// Which BlueprintNativeEvents the class implements in script, so native-only modes can call the native implementations directly.
+	bool bUpdateViewInScript = true;
+	bool bPivotLocationInScript = true;
+	bool bPivotRotationInScript = true;
+
+	// Set by the stack while it updates this mode.
+	FAncientGameCameraPivotCache* PivotCache = nullptr;
+
 	friend struct FAncientGameCameraModeStack;
 };
@@ -98,6 +98,12 @@ bool FAncientGameCameraModeStack::UpdateStack(float DeltaTime, AActor* TargetAct
 
 	bool bHasValidCameraMode = false;
 
+	PivotCache.Reset(TargetActor);
+	BlendEntries.Reset();
+
+	// How much of the modes below still shows through the ones above.
+	float RemainingContribution = 1.0f;
+
 	for (int32 StackIndex = 0; StackIndex < StackSize; ++StackIndex)
 	{
 		UAncientGameCameraMode* CameraMode = CameraModeStack[StackIndex];
@@ -108,9 +114,18 @@ bool FAncientGameCameraModeStack::UpdateStack(float DeltaTime, AActor* TargetAct
 		if (CameraMode->bIsActivated)
 		{
 			bHasValidCameraMode = true;
-			CameraMode->UpdateCameraMode(DeltaTime, TargetActor);
+			CameraMode->UpdateBlending(DeltaTime);
+
+			// Only modes that end up in the blend need their view.
+			const float BlendWeight = CameraMode->GetBlendWeight();
+			if (RemainingContribution * BlendWeight > 0.0f)
+			{
+				CameraMode->UpdateCameraView(DeltaTime, TargetActor, &PivotCache);
+				BlendEntries.Add({ &CameraMode->GetCameraModeView(), BlendWeight });
+			}
+			RemainingContribution *= (1.0f - BlendWeight);
 
-			if (CameraMode->GetBlendWeight() >= 1.0f)
+			if (BlendWeight >= 1.0f)
 			{
 				// Everything below this mode is now irrelevant and can be removed.
 				RemoveIndex = (StackIndex + 1);
@@ -138,23 +153,19 @@ bool FAncientGameCameraModeStack::UpdateStack(float DeltaTime, AActor* TargetAct
 
 void FAncientGameCameraModeStack::BlendStack(FAncientGameCameraModeView& OutCameraModeView) const
 {
-	const int32 StackSize = CameraModeStack.Num();
-	if (StackSize <= 0)
+	const int32 NumEntries = BlendEntries.Num();
+	if (NumEntries <= 0)
 	{
 		return;
 	}
 
 	// Start at the bottom and blend up the stack
-	const UAncientGameCameraMode* CameraMode = CameraModeStack[StackSize - 1];
-	check(CameraMode);
-
-	OutCameraModeView = CameraMode->GetCameraModeView();
+	OutCameraModeView = *BlendEntries[NumEntries - 1].View;
 
-	for (int32 StackIndex = (StackSize - 2); StackIndex >= 0; --StackIndex)
+	for (int32 EntryIndex = (NumEntries - 2); EntryIndex >= 0; --EntryIndex)
 	{
-		CameraMode = CameraModeStack[StackIndex];
-		check(CameraMode);
-
-		OutCameraModeView.Blend(CameraMode->GetCameraModeView(), CameraMode->GetBlendWeight());
+		const FBlendEntry& Entry = BlendEntries[EntryIndex];
+		OutCameraModeView.Blend(*Entry.View, Entry.BlendWeight);
 	}
-}
\ No newline at end of file
+}
+
@@ -2,12 +2,13 @@
 
 #pragma once
 
+#include "Camera/AncientGameCameraMode.h"
 #include "Containers/Array.h"
+#include "Containers/ContainerAllocationPolicies.h"
 
 #include "AncientGameCameraModeStack.generated.h"
 
 class AActor;
-class UAncientGameCameraMode;
 struct FAncientGameCameraModeView;
 
 /**
@@ -32,4 +33,17 @@ protected:
 protected:
 	UPROPERTY()
 	TArray<UAncientGameCameraMode*> CameraModeStack;
+
+	/** A mode that contributes to the blend this frame. */
+	struct FBlendEntry
+	{
+		const FAncientGameCameraModeView* View = nullptr;
+		float BlendWeight = 0.f;
+	};
+
+	/** Contributing modes in stack order, rebuilt by UpdateStack without reallocating. */
+	TArray<FBlendEntry, TInlineAllocator<8>> BlendEntries;
+
+	/** Shared by the modes while the stack updates them. */
+	FAncientGameCameraPivotCache PivotCache;
 };
@@ -0,0 +1,1313 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Interpolators.h"
+#include "Math/NumericLimits.h"
+#include "Math/UnrealMathUtility.h"
+#include "Math/VectorRegister.h"
+#include "Misc/AssertionMacros.h"
+
+#include <type_traits>
+
+/**
+ * Batched versions of the interpolators in Interpolators.h.
+ *
+ * Each batch stores N instances as structure-of-arrays lanes, one array per component, and steps them together
+ * four lanes per vector register. Results match the scalar templates op for op, so they are bit-identical as long
+ * as the compiler doesn't contract the multiply-adds differently for the two paths.
+ *
+ * Unlike the scalar templates, new instances start zeroed with a pending reset, so they snap to their first goal.
+ */
+namespace InterpolatorBatchHelpers
+{
+	/** Number of instances stepped per vector register. Lane arrays are padded to a multiple of this. */
+	static constexpr int32 LaneWidth = 4;
+
+	/** Same as the scalar interpolators */
+	static constexpr float MaxSubstepTime = 1.f / 120.f;
+
+	/** How a value type is split into lanes */
+	template<class T> struct TLaneTraits;
+
+	template<> struct TLaneTraits<float>
+	{
+		using ScalarType = float;
+		static constexpr int32 NumComponents = 1;
+		static constexpr bool bNormalizeAxes = false;
+		/** Distance under which FMath::FInterpTo snaps to its target */
+		static constexpr ScalarType SnapDistanceSquared = UE_SMALL_NUMBER;
+
+		static ScalarType Get(const float& Value, int32 Component) { return Value; }
+		static void Set(float& Value, int32 Component, ScalarType Scalar) { Value = Scalar; }
+	};
+
+	template<> struct TLaneTraits<FVector>
+	{
+		using ScalarType = FVector::FReal;
+		static constexpr int32 NumComponents = 3;
+		static constexpr bool bNormalizeAxes = false;
+		/** Distance under which FMath::VInterpTo snaps to its target */
+		static constexpr ScalarType SnapDistanceSquared = UE_KINDA_SMALL_NUMBER;
+
+		static ScalarType Get(const FVector& Value, int32 Component) { return Value[Component]; }
+		static void Set(FVector& Value, int32 Component, ScalarType Scalar) { Value[Component] = Scalar; }
+	};
+
+	template<> struct TLaneTraits<FRotator>
+	{
+		using ScalarType = FRotator::FReal;
+		static constexpr int32 NumComponents = 3;
+		static constexpr bool bNormalizeAxes = true;
+
+		static ScalarType Get(const FRotator& Value, int32 Component) { return Component == 0 ? Value.Pitch : (Component == 1 ? Value.Yaw : Value.Roll); }
+		static void Set(FRotator& Value, int32 Component, ScalarType Scalar) { (Component == 0 ? Value.Pitch : (Component == 1 ? Value.Yaw : Value.Roll)) = Scalar; }
+	};
+
+	FORCEINLINE VectorRegister4Float ZeroRegister(float) { return VectorZeroFloat(); }
+	FORCEINLINE VectorRegister4Double ZeroRegister(double) { return VectorZeroDouble(); }
+
+	FORCEINLINE VectorRegister4Float SplatRegister(float Value) { return MakeVectorRegisterFloat(Value, Value, Value, Value); }
+	FORCEINLINE VectorRegister4Double SplatRegister(double Value) { return MakeVectorRegisterDouble(Value, Value, Value, Value); }
+
+	/** Rounds to float lanes, same as assigning the scalar to a float */
+	FORCEINLINE VectorRegister4Float ToFloatRegister(const VectorRegister4Float& Value) { return Value; }
+	FORCEINLINE VectorRegister4Float ToFloatRegister(const VectorRegister4Double& Value) { return MakeVectorRegisterFloatFromDouble(Value); }
+
+	/** Widens float lanes back to the lanes of ScalarType */
+	FORCEINLINE VectorRegister4Float FromFloatRegister(const VectorRegister4Float& Value, float) { return Value; }
+	FORCEINLINE VectorRegister4Double FromFloatRegister(const VectorRegister4Float& Value, double) { return VectorRegister4Double(Value); }
+
+	/** Component-major lanes of T: all X, then all Y, ... */
+	template<class T>
+	struct TLanes
+	{
+		using FTraits = TLaneTraits<T>;
+		using ScalarType = typename FTraits::ScalarType;
+		static constexpr int32 NumComponents = FTraits::NumComponents;
+
+		TArray<ScalarType> Components[NumComponents];
+
+		void SetNum(int32 NumLanes)
+		{
+			for (TArray<ScalarType>& Component : Components)
+			{
+				Component.SetNumZeroed(NumLanes);
+			}
+		}
+
+		T Get(int32 Lane) const
+		{
+			T Value = InterpolatorHelpers::GetZeroForType<T>();
+			for (int32 Component = 0; Component < NumComponents; ++Component)
+			{
+				FTraits::Set(Value, Component, Components[Component][Lane]);
+			}
+			return Value;
+		}
+
+		void Set(int32 Lane, const T& Value)
+		{
+			for (int32 Component = 0; Component < NumComponents; ++Component)
+			{
+				Components[Component][Lane] = FTraits::Get(Value, Component);
+			}
+		}
+
+		void Copy(const TLanes& From, int32 Lane)
+		{
+			for (int32 Component = 0; Component < NumComponents; ++Component)
+			{
+				Components[Component][Lane] = From.Components[Component][Lane];
+			}
+		}
+
+		/** Moves FromLane into ToLane and zeroes FromLane */
+		void Move(int32 FromLane, int32 ToLane)
+		{
+			for (TArray<ScalarType>& Component : Components)
+			{
+				Component[ToLane] = Component[FromLane];
+				Component[FromLane] = 0;
+			}
+		}
+	};
+
+	template<class ElementType>
+	void MoveLane(TArray<ElementType>& Lanes, int32 FromLane, int32 ToLane)
+	{
+		Lanes[ToLane] = Lanes[FromLane];
+		Lanes[FromLane] = ElementType();
+	}
+}
+
+
+/**
+ * Batch of TCritDampSpringInterpolator.
+ * Instances with the same natural frequency share their cached spring scalars.
+ */
+template<class T>
+class TCritDampSpringInterpolatorBatch
+{
+	using FLanes = InterpolatorBatchHelpers::TLanes<T>;
+	using FTraits = typename FLanes::FTraits;
+	using ScalarType = typename FLanes::ScalarType;
+	using RegisterType = TVectorRegisterType<ScalarType>;
+	using FCDSpringScalars = typename TCritDampSpringInterpolator<T>::FCDSpringScalars;
+	using FCDSpringCachedScalars = typename TCritDampSpringInterpolator<T>::FCDSpringCachedScalars;
+
+	static constexpr int32 NumComponents = FLanes::NumComponents;
+	static constexpr int32 LaneWidth = InterpolatorBatchHelpers::LaneWidth;
+	static constexpr float MaxSubstepTime = TCritDampSpringInterpolator<T>::MaxSubstepTime;
+
+public:
+	/** Adds an instance and returns its index. Indices are stable until RemoveAtSwap. */
+	int32 Add(float NaturalFrequency)
+	{
+		const int32 Index = NumInstances++;
+		SetNumLanes(Align(NumInstances, LaneWidth));
+
+		GroupIndices[Index] = AcquireGroup(NaturalFrequency);
+		bPendingReset[Index] = true;
+		return Index;
+	}
+
+	/** Removes an instance, moving the last one into its index */
+	void RemoveAtSwap(int32 Index)
+	{
+		check(Index >= 0 && Index < NumInstances);
+		ReleaseGroup(GroupIndices[Index]);
+
+		const int32 LastIndex = --NumInstances;
+		if (Index != LastIndex)
+		{
+			MoveLane(LastIndex, Index);
+		}
+		SetNumLanes(Align(NumInstances, LaneWidth));
+	}
+
+	void Empty()
+	{
+		NumInstances = 0;
+		SetNumLanes(0);
+		Groups.Empty();
+	}
+
+	int32 Num() const
+	{
+		return NumInstances;
+	}
+
+	void SetNaturalFrequency(int32 Index, float NewNaturalFrequency)
+	{
+		if (Groups[GroupIndices[Index]].NaturalFrequency != NewNaturalFrequency)
+		{
+			ReleaseGroup(GroupIndices[Index]);
+			GroupIndices[Index] = AcquireGroup(NewNaturalFrequency);
+		}
+	}
+
+	float GetNaturalFrequency(int32 Index) const
+	{
+		return Groups[GroupIndices[Index]].NaturalFrequency;
+	}
+
+	/** Number of distinct spring scalars the batch is computing */
+	int32 GetNumScalarGroups() const
+	{
+		int32 NumGroups = 0;
+		for (const FScalarGroup& Group : Groups)
+		{
+			NumGroups += Group.NumInstances > 0 ? 1 : 0;
+		}
+		return NumGroups;
+	}
+
+	void Init(int32 Index, T NewEquilibriumValue)
+	{
+		CurrentPos.Set(Index, NewEquilibriumValue);
+		CurrentVelocity.Set(Index, InterpolatorHelpers::GetZeroForType<T>());
+		LastEquilibrium.Set(Index, NewEquilibriumValue);
+		bPendingReset[Index] = false;
+	}
+
+	/** Will snap directly to the equilibrium value on the next Eval() call. */
+	void Reset(int32 Index)
+	{
+		bPendingReset[Index] = true;
+	}
+
+	T GetCurrentValue(int32 Index) const
+	{
+		return CurrentPos.Get(Index);
+	}
+
+	void GetCurrentValues(TArrayView<T> OutValues) const
+	{
+		check(OutValues.Num() == NumInstances);
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			OutValues[Index] = CurrentPos.Get(Index);
+		}
+	}
+
+	/** Does substepping, with partial-interval rewinding. One equilibrium position per instance. */
+	void EvalSubstepped(TArrayView<const T> NewEquilibriumPositions, float DeltaTime)
+	{
+		check(NewEquilibriumPositions.Num() == NumInstances);
+
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			const T& NewEquilibriumPos = NewEquilibriumPositions[Index];
+			if (bPendingReset[Index])
+			{
+				PerformReset(Index, NewEquilibriumPos);
+				RemainingTime[Index] = 0.f;
+				continue;
+			}
+
+			float Remaining = DeltaTime;
+
+			// handle leftover rewind
+			if (bDoLeftoverRewind && (LastUpdateLeftoverTime[Index] > 0.f))
+			{
+				Remaining += LastUpdateLeftoverTime[Index];
+				CurrentPos.Copy(PosAfterLastFullStep, Index);
+				CurrentVelocity.Copy(VelAfterLastFullStep, Index);
+				LastUpdateLeftoverTime[Index] = 0.f;
+			}
+
+			// move the goal linearly toward goal while we substep
+			const T LastEquilibriumPos = LastEquilibrium.Get(Index);
+			EquilibriumStepRate.Set(Index, (NewEquilibriumPos - LastEquilibriumPos) * (1.f / Remaining));
+			LerpedEquilibriumPos.Set(Index, LastEquilibriumPos);
+			if (Remaining > KINDA_SMALL_NUMBER)
+			{
+				LastEquilibrium.Set(Index, NewEquilibriumPos);
+			}
+
+			RemainingTime[Index] = Remaining;
+		}
+
+		while (PrepareSubstep())
+		{
+			StepLanes();
+		}
+	}
+
+	/** Does a full non-substepped eval */
+	void Eval(TArrayView<const T> NewEquilibriumPositions, float DeltaTime)
+	{
+		check(NewEquilibriumPositions.Num() == NumInstances);
+
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			const T& NewEquilibriumPos = NewEquilibriumPositions[Index];
+			if (bPendingReset[Index])
+			{
+				PerformReset(Index, NewEquilibriumPos);
+				StepTime[Index] = 0;
+				continue;
+			}
+
+			EquilibriumStepRate.Set(Index, InterpolatorHelpers::GetZeroForType<T>());
+			LerpedEquilibriumPos.Set(Index, NewEquilibriumPos);
+			LastUpdateLeftoverTime[Index] = 0.f;
+			SetStepCoefficients(Index, DeltaTime);
+		}
+
+		StepLanes();
+	}
+
+	bool bDoLeftoverRewind = true;
+
+private:
+	/** Spring update coefficients for one step time, already combined the way SingleStepEval uses them */
+	struct FStepCoefficients
+	{
+		ScalarType PosFromPos = 0;
+		ScalarType PosFromVel = 0;
+		ScalarType VelFromPos = 0;
+		ScalarType VelFromVel = 0;
+
+		FStepCoefficients() = default;
+
+		FStepCoefficients(const FCDSpringScalars& Scalars, float NaturalFrequency)
+			: PosFromPos(Scalars.ExDTxW + Scalars.E)
+			, PosFromVel(Scalars.ExDT)
+			, VelFromPos(-Scalars.ExDTxW * NaturalFrequency)
+			, VelFromVel(Scalars.E - Scalars.ExDTxW)
+		{}
+	};
+
+	/** Scalars shared by every instance with the same natural frequency */
+	struct FScalarGroup
+	{
+		float NaturalFrequency = 0.f;
+		int32 NumInstances = 0;
+
+		FStepCoefficients FullStep;
+
+		/** Partial steps are usually the same for every instance of a group, as they come from the same DeltaTime */
+		FCDSpringCachedScalars PartialStepScalars;
+		FStepCoefficients PartialStep;
+	};
+
+	int32 AcquireGroup(float NaturalFrequency)
+	{
+		int32 FreeGroupIndex = INDEX_NONE;
+		for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+		{
+			FScalarGroup& Group = Groups[GroupIndex];
+			if (Group.NumInstances > 0 && Group.NaturalFrequency == NaturalFrequency)
+			{
+				++Group.NumInstances;
+				return GroupIndex;
+			}
+			if (Group.NumInstances == 0 && FreeGroupIndex == INDEX_NONE)
+			{
+				FreeGroupIndex = GroupIndex;
+			}
+		}
+
+		if (FreeGroupIndex == INDEX_NONE)
+		{
+			FreeGroupIndex = Groups.AddDefaulted();
+		}
+
+		FScalarGroup& Group = Groups[FreeGroupIndex];
+		Group = FScalarGroup();
+		Group.NaturalFrequency = NaturalFrequency;
+		Group.NumInstances = 1;
+		Group.FullStep = FStepCoefficients(TCritDampSpringInterpolator<T>::ComputeScalars(NaturalFrequency, MaxSubstepTime), NaturalFrequency);
+		return FreeGroupIndex;
+	}
+
+	void ReleaseGroup(int32 GroupIndex)
+	{
+		--Groups[GroupIndex].NumInstances;
+	}
+
+	void SetStepCoefficients(int32 Index, float InStepTime)
+	{
+		FScalarGroup& Group = Groups[GroupIndices[Index]];
+
+		const FStepCoefficients* Coefficients = &Group.FullStep;
+		if (InStepTime != MaxSubstepTime)
+		{
+			if (Group.PartialStepScalars.AreCached(Group.NaturalFrequency, InStepTime) == false)
+			{
+				const FCDSpringScalars Scalars = TCritDampSpringInterpolator<T>::ComputeScalars(Group.NaturalFrequency, InStepTime);
+				Group.PartialStepScalars.Set(Group.NaturalFrequency, InStepTime, Scalars);
+				Group.PartialStep = FStepCoefficients(Scalars, Group.NaturalFrequency);
+			}
+			Coefficients = &Group.PartialStep;
+		}
+
+		StepTime[Index] = InStepTime;
+		PosFromPos[Index] = Coefficients->PosFromPos;
+		PosFromVel[Index] = Coefficients->PosFromVel;
+		VelFromPos[Index] = Coefficients->VelFromPos;
+		VelFromVel[Index] = Coefficients->VelFromVel;
+	}
+
+	/** Picks each instance's next substep. Returns false once every instance has used up its time. */
+	bool PrepareSubstep()
+	{
+		bool bAnyActive = false;
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			if (RemainingTime[Index] > KINDA_SMALL_NUMBER)
+			{
+				const float Step = FMath::Min(MaxSubstepTime, RemainingTime[Index]);
+
+				if (bDoLeftoverRewind && (Step < MaxSubstepTime))
+				{
+					// last partial step, cache where we were after last full step
+					// so we can resume from there on the next eval
+					LastUpdateLeftoverTime[Index] = Step;
+					PosAfterLastFullStep.Copy(CurrentPos, Index);
+					VelAfterLastFullStep.Copy(CurrentVelocity, Index);
+				}
+
+				RemainingTime[Index] -= Step;
+				SetStepCoefficients(Index, Step);
+				bAnyActive = true;
+			}
+			else
+			{
+				StepTime[Index] = 0;
+			}
+		}
+		return bAnyActive;
+	}
+
+	/** Steps every lane with a non-zero StepTime. Same math as TCritDampSpringInterpolator::SingleStepEval. */
+	void StepLanes()
+	{
+		const RegisterType Zero = InterpolatorBatchHelpers::ZeroRegister(ScalarType());
+		const int32 NumLanes = StepTime.Num();
+
+		for (int32 Lane = 0; Lane < NumLanes; Lane += LaneWidth)
+		{
+			const RegisterType Step = VectorLoad(&StepTime[Lane]);
+			const RegisterType ActiveMask = VectorCompareGT(Step, Zero);
+			const RegisterType PosFromPosReg = VectorLoad(&PosFromPos[Lane]);
+			const RegisterType PosFromVelReg = VectorLoad(&PosFromVel[Lane]);
+			const RegisterType VelFromPosReg = VectorLoad(&VelFromPos[Lane]);
+			const RegisterType VelFromVelReg = VectorLoad(&VelFromVel[Lane]);
+
+			for (int32 Component = 0; Component < NumComponents; ++Component)
+			{
+				ScalarType* const LerpedPtr = &LerpedEquilibriumPos.Components[Component][Lane];
+				ScalarType* const PosPtr = &CurrentPos.Components[Component][Lane];
+				ScalarType* const VelPtr = &CurrentVelocity.Components[Component][Lane];
+
+				const RegisterType Pos = VectorLoad(PosPtr);
+				const RegisterType Vel = VectorLoad(VelPtr);
+				const RegisterType LastLerped = VectorLoad(LerpedPtr);
+				const RegisterType Lerped = VectorAdd(LastLerped, VectorMultiply(VectorLoad(&EquilibriumStepRate.Components[Component][Lane]), Step));
+
+				RegisterType Displacement = VectorSubtract(Pos, Lerped);
+				if constexpr (FTraits::bNormalizeAxes)
+				{
+					Displacement = VectorNormalizeRotator(Displacement);
+				}
+
+				const RegisterType NewDisplacement = VectorAdd(VectorMultiply(Displacement, PosFromPosReg), VectorMultiply(Vel, PosFromVelReg));
+				const RegisterType NewVel = VectorAdd(VectorMultiply(NewDisplacement, VelFromPosReg), VectorMultiply(Vel, VelFromVelReg));
+				RegisterType NewPos = VectorAdd(NewDisplacement, Lerped);
+				if constexpr (FTraits::bNormalizeAxes)
+				{
+					NewPos = VectorNormalizeRotator(NewPos);
+				}
+
+				VectorStore(VectorSelect(ActiveMask, Lerped, LastLerped), LerpedPtr);
+				VectorStore(VectorSelect(ActiveMask, NewPos, Pos), PosPtr);
+				VectorStore(VectorSelect(ActiveMask, NewVel, Vel), VelPtr);
+			}
+		}
+	}
+
+	void PerformReset(int32 Index, const T& NewEquilibriumPos)
+	{
+		CurrentPos.Set(Index, NewEquilibriumPos);
+		CurrentVelocity.Set(Index, InterpolatorHelpers::GetZeroForType<T>());
+		LastEquilibrium.Set(Index, NewEquilibriumPos);
+
+		LastUpdateLeftoverTime[Index] = 0.f;		// clear out any leftovers for rewind
+		bPendingReset[Index] = false;
+	}
+
+	void SetNumLanes(int32 NumLanes)
+	{
+		CurrentPos.SetNum(NumLanes);
+		CurrentVelocity.SetNum(NumLanes);
+		PosAfterLastFullStep.SetNum(NumLanes);
+		VelAfterLastFullStep.SetNum(NumLanes);
+		LastEquilibrium.SetNum(NumLanes);
+		LerpedEquilibriumPos.SetNum(NumLanes);
+		EquilibriumStepRate.SetNum(NumLanes);
+
+		StepTime.SetNumZeroed(NumLanes);
+		PosFromPos.SetNumZeroed(NumLanes);
+		PosFromVel.SetNumZeroed(NumLanes);
+		VelFromPos.SetNumZeroed(NumLanes);
+		VelFromVel.SetNumZeroed(NumLanes);
+
+		GroupIndices.SetNumZeroed(NumLanes);
+		bPendingReset.SetNumZeroed(NumLanes);
+		LastUpdateLeftoverTime.SetNumZeroed(NumLanes);
+		RemainingTime.SetNumZeroed(NumLanes);
+	}
+
+	void MoveLane(int32 FromLane, int32 ToLane)
+	{
+		using InterpolatorBatchHelpers::MoveLane;
+
+		CurrentPos.Move(FromLane, ToLane);
+		CurrentVelocity.Move(FromLane, ToLane);
+		PosAfterLastFullStep.Move(FromLane, ToLane);
+		VelAfterLastFullStep.Move(FromLane, ToLane);
+		LastEquilibrium.Move(FromLane, ToLane);
+		LerpedEquilibriumPos.Move(FromLane, ToLane);
+		EquilibriumStepRate.Move(FromLane, ToLane);
+
+		MoveLane(StepTime, FromLane, ToLane);
+		MoveLane(PosFromPos, FromLane, ToLane);
+		MoveLane(PosFromVel, FromLane, ToLane);
+		MoveLane(VelFromPos, FromLane, ToLane);
+		MoveLane(VelFromVel, FromLane, ToLane);
+
+		MoveLane(GroupIndices, FromLane, ToLane);
+		MoveLane(bPendingReset, FromLane, ToLane);
+		MoveLane(LastUpdateLeftoverTime, FromLane, ToLane);
+		MoveLane(RemainingTime, FromLane, ToLane);
+	}
+
+	int32 NumInstances = 0;
+
+	FLanes CurrentPos;
+	FLanes CurrentVelocity;
+	FLanes PosAfterLastFullStep;
+	FLanes VelAfterLastFullStep;
+	FLanes LastEquilibrium;
+
+	/** Per-eval state */
+	FLanes LerpedEquilibriumPos;
+	FLanes EquilibriumStepRate;
+
+	/** Per-substep state. Lanes with a zero StepTime, including the padding, are left untouched. */
+	TArray<ScalarType> StepTime;
+	TArray<ScalarType> PosFromPos;
+	TArray<ScalarType> PosFromVel;
+	TArray<ScalarType> VelFromPos;
+	TArray<ScalarType> VelFromVel;
+
+	TArray<int32> GroupIndices;
+	TArray<bool> bPendingReset;
+	TArray<float> LastUpdateLeftoverTime;
+	TArray<float> RemainingTime;
+
+	TArray<FScalarGroup> Groups;
+};
+
+
+/**
+ * Batch of TGenericIIRInterpolator, for float and FVector.
+ */
+template<class T>
+class TGenericIIRInterpolatorBatch
+{
+	static_assert(std::is_same_v<T, float> || std::is_same_v<T, FVector>, "TGenericIIRInterpolatorBatch only supports float and FVector");
+
+	using FLanes = InterpolatorBatchHelpers::TLanes<T>;
+	using FTraits = typename FLanes::FTraits;
+	using ScalarType = typename FLanes::ScalarType;
+	using RegisterType = TVectorRegisterType<ScalarType>;
+
+	static constexpr int32 NumComponents = FLanes::NumComponents;
+	static constexpr int32 LaneWidth = InterpolatorBatchHelpers::LaneWidth;
+	static constexpr float MaxSubstepTime = InterpolatorBatchHelpers::MaxSubstepTime;
+
+public:
+	/** Adds an instance and returns its index. Indices are stable until RemoveAtSwap. */
+	int32 Add(float InterpSpeed)
+	{
+		const int32 Index = NumInstances++;
+		SetNumLanes(Align(NumInstances, LaneWidth));
+
+		SetInterpSpeed(Index, InterpSpeed);
+		bPendingReset[Index] = true;
+		return Index;
+	}
+
+	/** Removes an instance, moving the last one into its index */
+	void RemoveAtSwap(int32 Index)
+	{
+		check(Index >= 0 && Index < NumInstances);
+
+		const int32 LastIndex = --NumInstances;
+		if (Index != LastIndex)
+		{
+			MoveLane(LastIndex, Index);
+		}
+		SetNumLanes(Align(NumInstances, LaneWidth));
+	}
+
+	void Empty()
+	{
+		NumInstances = 0;
+		SetNumLanes(0);
+	}
+
+	int32 Num() const
+	{
+		return NumInstances;
+	}
+
+	/** Update the interpolation speed */
+	void SetInterpSpeed(int32 Index, float NewInterpSpeed)
+	{
+		InterpSpeeds[Index] = NewInterpSpeed;
+
+		// no interp speed jumps to the goal, same as never getting close enough to it
+		SnapDistanceSquared[Index] = NewInterpSpeed > 0.f ? FTraits::SnapDistanceSquared : TNumericLimits<ScalarType>::Max();
+	}
+
+	/**
+	 * Sets the starting CurrentValue for the interpolation. Note this will cancel any pending resets
+	 * since a reset will render this ineffective.
+	 */
+	void SetInitialValue(int32 Index, T InitialValue)
+	{
+		CurrentValue.Set(Index, InitialValue);
+		bPendingReset[Index] = false;
+	}
+
+	/** Interpolator value will snap to the goal value on the next Eval() */
+	void Reset(int32 Index)
+	{
+		bPendingReset[Index] = true;
+	}
+
+	T GetCurrentValue(int32 Index) const
+	{
+		return CurrentValue.Get(Index);
+	}
+
+	void GetCurrentValues(TArrayView<T> OutValues) const
+	{
+		check(OutValues.Num() == NumInstances);
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			OutValues[Index] = CurrentValue.Get(Index);
+		}
+	}
+
+	/** Does sub-stepping, with partial-interval rewinding. One goal value per instance. */
+	void EvalSubstepped(TArrayView<const T> NewGoalValues, float DeltaTime)
+	{
+		check(NewGoalValues.Num() == NumInstances);
+
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			BeginSubsteps(Index, NewGoalValues[Index], DeltaTime);
+		}
+
+		while (PrepareSubstep())
+		{
+			StepLanes();
+		}
+	}
+
+	/**
+	 * Same as above, with one DeltaTime per instance.
+	 * Instances with a negative DeltaTime are skipped, as if the scalar interpolator wasn't evaluated.
+	 */
+	void EvalSubstepped(TArrayView<const T> NewGoalValues, TArrayView<const float> DeltaTimes)
+	{
+		check(NewGoalValues.Num() == NumInstances && DeltaTimes.Num() == NumInstances);
+
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			if (DeltaTimes[Index] < 0.f)
+			{
+				RemainingTime[Index] = 0.f;
+				continue;
+			}
+			BeginSubsteps(Index, NewGoalValues[Index], DeltaTimes[Index]);
+		}
+
+		while (PrepareSubstep())
+		{
+			StepLanes();
+		}
+	}
+
+	/** Does a full eval in a single timeslice. */
+	void Eval(TArrayView<const T> NewGoalValues, float DeltaTime)
+	{
+		check(NewGoalValues.Num() == NumInstances);
+
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			const T& NewGoalValue = NewGoalValues[Index];
+			if (bPendingReset[Index])
+			{
+				PerformReset(Index, NewGoalValue);
+				StepTime[Index] = 0;
+				continue;
+			}
+
+			GoalStepRate.Set(Index, InterpolatorHelpers::GetZeroForType<T>());
+			LerpedGoalValue.Set(Index, NewGoalValue);
+			LastUpdateLeftoverTime[Index] = 0.f;
+			SetStepTime(Index, DeltaTime);
+		}
+
+		StepLanes();
+	}
+
+	bool bDoLeftoverRewind = true;
+
+private:
+	void BeginSubsteps(int32 Index, const T& NewGoalValue, float DeltaTime)
+	{
+		if (bPendingReset[Index])
+		{
+			PerformReset(Index, NewGoalValue);
+			RemainingTime[Index] = 0.f;
+			return;
+		}
+
+		float Remaining = DeltaTime;
+
+		// handle leftover rewind
+		if (bDoLeftoverRewind && (LastUpdateLeftoverTime[Index] > 0.f))
+		{
+			Remaining += LastUpdateLeftoverTime[Index];
+			CurrentValue.Copy(ValueAfterLastFullStep, Index);
+			LastUpdateLeftoverTime[Index] = 0.f;
+		}
+
+		// move the goal linearly toward goal while we substep
+		const T LastGoal = LastGoalValue.Get(Index);
+		GoalStepRate.Set(Index, (NewGoalValue - LastGoal) * (1.f / Remaining));
+		LerpedGoalValue.Set(Index, LastGoal);
+		if (Remaining > KINDA_SMALL_NUMBER)
+		{
+			LastGoalValue.Set(Index, NewGoalValue);
+		}
+
+		RemainingTime[Index] = Remaining;
+	}
+
+	void SetStepTime(int32 Index, float InStepTime)
+	{
+		StepTime[Index] = InStepTime;
+		Alpha[Index] = FMath::Clamp<float>(InStepTime * InterpSpeeds[Index], 0.f, 1.f);
+	}
+
+	/** Picks each instance's next substep. Returns false once every instance has used up its time. */
+	bool PrepareSubstep()
+	{
+		bool bAnyActive = false;
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			if (RemainingTime[Index] > KINDA_SMALL_NUMBER)
+			{
+				const float Step = FMath::Min(MaxSubstepTime, RemainingTime[Index]);
+
+				if (bDoLeftoverRewind && (Step < MaxSubstepTime))
+				{
+					// last partial step, cache where we were after last full step
+					// so we can resume from there on the next eval
+					LastUpdateLeftoverTime[Index] = Step;
+					ValueAfterLastFullStep.Copy(CurrentValue, Index);
+				}
+
+				RemainingTime[Index] -= Step;
+				SetStepTime(Index, Step);
+				bAnyActive = true;
+			}
+			else
+			{
+				StepTime[Index] = 0;
+			}
+		}
+		return bAnyActive;
+	}
+
+	/** Steps every lane with a non-zero StepTime. Same math as FMath::FInterpTo and FMath::VInterpTo. */
+	void StepLanes()
+	{
+		const RegisterType Zero = InterpolatorBatchHelpers::ZeroRegister(ScalarType());
+		const int32 NumLanes = StepTime.Num();
+
+		for (int32 Lane = 0; Lane < NumLanes; Lane += LaneWidth)
+		{
+			const RegisterType Step = VectorLoad(&StepTime[Lane]);
+			const RegisterType ActiveMask = VectorCompareGT(Step, Zero);
+			const RegisterType AlphaReg = VectorLoad(&Alpha[Lane]);
+
+			RegisterType Lerped[NumComponents];
+			RegisterType Dist[NumComponents];
+			RegisterType DistSquared = Zero;
+			for (int32 Component = 0; Component < NumComponents; ++Component)
+			{
+				Lerped[Component] = VectorAdd(VectorLoad(&LerpedGoalValue.Components[Component][Lane]), VectorMultiply(VectorLoad(&GoalStepRate.Components[Component][Lane]), Step));
+				Dist[Component] = VectorSubtract(Lerped[Component], VectorLoad(&CurrentValue.Components[Component][Lane]));
+				DistSquared = Component == 0 ? VectorMultiply(Dist[0], Dist[0]) : VectorAdd(DistSquared, VectorMultiply(Dist[Component], Dist[Component]));
+			}
+
+			const RegisterType SnapMask = VectorCompareLT(DistSquared, VectorLoad(&SnapDistanceSquared[Lane]));
+
+			for (int32 Component = 0; Component < NumComponents; ++Component)
+			{
+				ScalarType* const LerpedPtr = &LerpedGoalValue.Components[Component][Lane];
+				ScalarType* const ValuePtr = &CurrentValue.Components[Component][Lane];
+
+				const RegisterType Value = VectorLoad(ValuePtr);
+				const RegisterType NewValue = VectorSelect(SnapMask, Lerped[Component], VectorAdd(Value, VectorMultiply(Dist[Component], AlphaReg)));
+
+				VectorStore(VectorSelect(ActiveMask, Lerped[Component], VectorLoad(LerpedPtr)), LerpedPtr);
+				VectorStore(VectorSelect(ActiveMask, NewValue, Value), ValuePtr);
+			}
+		}
+	}
+
+	void PerformReset(int32 Index, const T& NewGoalValue)
+	{
+		CurrentValue.Set(Index, NewGoalValue);
+		LastGoalValue.Set(Index, NewGoalValue);
+		LastUpdateLeftoverTime[Index] = 0.f;		// clear out any leftovers for rewind
+		bPendingReset[Index] = false;
+	}
+
+	void SetNumLanes(int32 NumLanes)
+	{
+		CurrentValue.SetNum(NumLanes);
+		ValueAfterLastFullStep.SetNum(NumLanes);
+		LastGoalValue.SetNum(NumLanes);
+		LerpedGoalValue.SetNum(NumLanes);
+		GoalStepRate.SetNum(NumLanes);
+
+		StepTime.SetNumZeroed(NumLanes);
+		Alpha.SetNumZeroed(NumLanes);
+		SnapDistanceSquared.SetNumZeroed(NumLanes);
+
+		InterpSpeeds.SetNumZeroed(NumLanes);
+		bPendingReset.SetNumZeroed(NumLanes);
+		LastUpdateLeftoverTime.SetNumZeroed(NumLanes);
+		RemainingTime.SetNumZeroed(NumLanes);
+	}
+
+	void MoveLane(int32 FromLane, int32 ToLane)
+	{
+		using InterpolatorBatchHelpers::MoveLane;
+
+		CurrentValue.Move(FromLane, ToLane);
+		ValueAfterLastFullStep.Move(FromLane, ToLane);
+		LastGoalValue.Move(FromLane, ToLane);
+		LerpedGoalValue.Move(FromLane, ToLane);
+		GoalStepRate.Move(FromLane, ToLane);
+
+		MoveLane(StepTime, FromLane, ToLane);
+		MoveLane(Alpha, FromLane, ToLane);
+		MoveLane(SnapDistanceSquared, FromLane, ToLane);
+
+		MoveLane(InterpSpeeds, FromLane, ToLane);
+		MoveLane(bPendingReset, FromLane, ToLane);
+		MoveLane(LastUpdateLeftoverTime, FromLane, ToLane);
+		MoveLane(RemainingTime, FromLane, ToLane);
+	}
+
+	int32 NumInstances = 0;
+
+	FLanes CurrentValue;
+	FLanes ValueAfterLastFullStep;
+	FLanes LastGoalValue;
+
+	/** Per-eval state */
+	FLanes LerpedGoalValue;
+	FLanes GoalStepRate;
+
+	/** Per-substep state. Lanes with a zero StepTime, including the padding, are left untouched. */
+	TArray<ScalarType> StepTime;
+	TArray<ScalarType> Alpha;
+	TArray<ScalarType> SnapDistanceSquared;
+
+	TArray<float> InterpSpeeds;
+	TArray<bool> bPendingReset;
+	TArray<float> LastUpdateLeftoverTime;
+	TArray<float> RemainingTime;
+};
+
+
+/**
+ * Batch of TGenericDoubleIIRInterpolator, for float and FVector.
+ * Each outer substep steps the two underlying batches once, the same way the scalar version steps its two interpolators.
+ */
+template<class T>
+class TGenericDoubleIIRInterpolatorBatch
+{
+	static constexpr float MaxSubstepTime = InterpolatorBatchHelpers::MaxSubstepTime;
+
+public:
+	int32 Add(float PrimaryInterpSpeed, float IntermediateInterpSpeed)
+	{
+		IntermediateInterpolators.Add(IntermediateInterpSpeed);
+		LastGoalValues.Add(InterpolatorHelpers::GetZeroForType<T>());
+		LerpedGoalValues.AddDefaulted();
+		GoalStepRates.AddDefaulted();
+		IntermediateValues.AddDefaulted();
+		RemainingTimes.AddZeroed();
+		StepTimes.AddZeroed();
+		return PrimaryInterpolators.Add(PrimaryInterpSpeed);
+	}
+
+	void RemoveAtSwap(int32 Index)
+	{
+		IntermediateInterpolators.RemoveAtSwap(Index);
+		PrimaryInterpolators.RemoveAtSwap(Index);
+		LastGoalValues.RemoveAtSwap(Index);
+		LerpedGoalValues.RemoveAtSwap(Index);
+		GoalStepRates.RemoveAtSwap(Index);
+		IntermediateValues.RemoveAtSwap(Index);
+		RemainingTimes.RemoveAtSwap(Index);
+		StepTimes.RemoveAtSwap(Index);
+	}
+
+	int32 Num() const
+	{
+		return PrimaryInterpolators.Num();
+	}
+
+	void SetInterpSpeeds(int32 Index, float NewPrimaryInterpSpeed, float NewIntermediateInterpSpeed)
+	{
+		PrimaryInterpolators.SetInterpSpeed(Index, NewPrimaryInterpSpeed);
+		IntermediateInterpolators.SetInterpSpeed(Index, NewIntermediateInterpSpeed);
+	}
+
+	void SetInitialValue(int32 Index, T InitialValue)
+	{
+		IntermediateInterpolators.SetInitialValue(Index, InitialValue);
+		PrimaryInterpolators.SetInitialValue(Index, InitialValue);
+	}
+
+	void Reset(int32 Index)
+	{
+		IntermediateInterpolators.Reset(Index);
+		PrimaryInterpolators.Reset(Index);
+	}
+
+	T GetCurrentValue(int32 Index) const
+	{
+		return PrimaryInterpolators.GetCurrentValue(Index);
+	}
+
+	void GetCurrentValues(TArrayView<T> OutValues) const
+	{
+		PrimaryInterpolators.GetCurrentValues(OutValues);
+	}
+
+	/** Does sub-stepping, with partial-interval rewinding. One goal value per instance. */
+	void EvalSubstepped(TArrayView<const T> NewGoalValues, float DeltaTime)
+	{
+		check(NewGoalValues.Num() == Num());
+
+		// underlying interpolators will handle resets
+		for (int32 Index = 0; Index < Num(); ++Index)
+		{
+			const float Remaining = DeltaTime;
+
+			// move the goal linearly toward goal while we substep
+			GoalStepRates[Index] = (NewGoalValues[Index] - LastGoalValues[Index]) * (1.f / Remaining);
+			LerpedGoalValues[Index] = LastGoalValues[Index];
+			if (Remaining > KINDA_SMALL_NUMBER)
+			{
+				LastGoalValues[Index] = NewGoalValues[Index];
+			}
+
+			RemainingTimes[Index] = Remaining;
+		}
+
+		bool bAnyActive = true;
+		while (bAnyActive)
+		{
+			bAnyActive = false;
+			for (int32 Index = 0; Index < Num(); ++Index)
+			{
+				if (RemainingTimes[Index] > KINDA_SMALL_NUMBER)
+				{
+					const float Step = FMath::Min(MaxSubstepTime, RemainingTimes[Index]);
+					LerpedGoalValues[Index] += GoalStepRates[Index] * Step;
+					RemainingTimes[Index] -= Step;
+					StepTimes[Index] = Step;
+					bAnyActive = true;
+				}
+				else
+				{
+					StepTimes[Index] = -1.f;
+				}
+			}
+
+			if (bAnyActive)
+			{
+				// make sure step time of the double is same as step time of the underlying singles.
+				// that ensures the partial step rewind works and isn't running too often
+				IntermediateInterpolators.EvalSubstepped(LerpedGoalValues, StepTimes);
+				IntermediateInterpolators.GetCurrentValues(IntermediateValues);
+				PrimaryInterpolators.EvalSubstepped(IntermediateValues, StepTimes);
+			}
+		}
+	}
+
+	/** Does a full eval in a single timeslice. */
+	void Eval(TArrayView<const T> NewGoalValues, float DeltaTime)
+	{
+		IntermediateInterpolators.EvalSubstepped(NewGoalValues, DeltaTime);
+		IntermediateInterpolators.GetCurrentValues(IntermediateValues);
+		PrimaryInterpolators.EvalSubstepped(IntermediateValues, DeltaTime);
+	}
+
+private:
+	TGenericIIRInterpolatorBatch<T> IntermediateInterpolators;
+	TGenericIIRInterpolatorBatch<T> PrimaryInterpolators;
+
+	TArray<T> LastGoalValues;
+
+	/** Per-eval scratch */
+	TArray<T> LerpedGoalValues;
+	TArray<T> GoalStepRates;
+	TArray<T> IntermediateValues;
+	TArray<float> RemainingTimes;
+	TArray<float> StepTimes;
+};
+
+
+/**
+ * Batch of TAccelerationInterpolator, for float and FVector.
+ * Every instance takes the same substeps for a given DeltaTime, so the lanes are stepped in lockstep.
+ * Speeds are kept in float like the scalar version, only the values use the precision of T.
+ */
+template<class T>
+class TAccelerationInterpolatorBatch
+{
+	static_assert(std::is_same_v<T, float> || std::is_same_v<T, FVector>, "TAccelerationInterpolatorBatch only supports float and FVector");
+
+	using FLanes = InterpolatorBatchHelpers::TLanes<T>;
+	using ScalarType = typename FLanes::ScalarType;
+	using RegisterType = TVectorRegisterType<ScalarType>;
+
+	static constexpr int32 NumComponents = FLanes::NumComponents;
+	static constexpr int32 LaneWidth = InterpolatorBatchHelpers::LaneWidth;
+	static constexpr float MaxSubstepTime = InterpolatorBatchHelpers::MaxSubstepTime;
+
+public:
+	/** Adds an instance and returns its index. Indices are stable until RemoveAtSwap. */
+	int32 Add(float MaxAcceleration, float MinDeceleration, float MaxSpeed, float HoldTolerance = 1.f)
+	{
+		const int32 Index = NumInstances++;
+		SetNumLanes(Align(NumInstances, LaneWidth));
+
+		SetParams(Index, MaxAcceleration, MinDeceleration, MaxSpeed, HoldTolerance);
+		bPendingReset[Index] = true;
+		return Index;
+	}
+
+	/** Removes an instance, moving the last one into its index */
+	void RemoveAtSwap(int32 Index)
+	{
+		check(Index >= 0 && Index < NumInstances);
+
+		const int32 LastIndex = --NumInstances;
+		if (Index != LastIndex)
+		{
+			MoveLane(LastIndex, Index);
+		}
+		SetNumLanes(Align(NumInstances, LaneWidth));
+	}
+
+	void Empty()
+	{
+		NumInstances = 0;
+		SetNumLanes(0);
+	}
+
+	int32 Num() const
+	{
+		return NumInstances;
+	}
+
+	void SetParams(int32 Index, float MaxAcceleration, float MinDeceleration, float MaxSpeed, float HoldTolerance = 1.f)
+	{
+		MaxAccelerations[Index] = MaxAcceleration;
+		TwoMinDecelerations[Index] = 2.f * MinDeceleration;
+		MaxSpeeds[Index] = MaxSpeed;
+		HoldTolerances[Index] = HoldTolerance;
+	}
+
+	/**
+	 * Sets the starting CurrentValue for the interpolation. Note this will cancel any pending resets
+	 * since a reset will render this ineffective.
+	 */
+	void SetInitialValue(int32 Index, T InitialValue)
+	{
+		CurrentValue.Set(Index, InitialValue);
+		CurrentSpeed[Index] = 0.f;
+		bPendingReset[Index] = false;
+	}
+
+	/** Interpolator value will snap to the goal value on the next Eval() */
+	void Reset(int32 Index)
+	{
+		bPendingReset[Index] = true;
+	}
+
+	T GetCurrentValue(int32 Index) const
+	{
+		return CurrentValue.Get(Index);
+	}
+
+	void GetCurrentValues(TArrayView<T> OutValues) const
+	{
+		check(OutValues.Num() == NumInstances);
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			OutValues[Index] = CurrentValue.Get(Index);
+		}
+	}
+
+	/** Updates every instance for its new goal value and time slice. One goal value per instance. */
+	void Eval(TArrayView<const T> NewGoalValues, float DeltaTime)
+	{
+		check(NewGoalValues.Num() == NumInstances);
+
+		bool bAnyActive = false;
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			GoalValue.Set(Index, NewGoalValues[Index]);
+
+			if (bPendingReset[Index])
+			{
+				CurrentValue.Set(Index, NewGoalValues[Index]);
+				CurrentSpeed[Index] = 0.f;
+				bPendingReset[Index] = false;
+				Active[Index] = 0.f;
+			}
+			else
+			{
+				Active[Index] = 1.f;
+				bAnyActive = true;
+			}
+		}
+
+		if (!bAnyActive)
+		{
+			return;
+		}
+
+		float SimTimeRemaining = DeltaTime;
+		while (SimTimeRemaining > 0.f)
+		{
+			const float StepTime = FMath::Min(SimTimeRemaining, MaxSubstepTime);
+			StepLanes(StepTime);
+
+			SimTimeRemaining -= StepTime;
+		}
+	}
+
+private:
+	/** Steps every active lane. Same math as TAccelerationInterpolator::UpdateSpeed and SingleStepEval. */
+	void StepLanes(float StepTime)
+	{
+		using namespace InterpolatorBatchHelpers;
+
+		const RegisterType Zero = ZeroRegister(ScalarType());
+		const RegisterType One = SplatRegister(ScalarType(1));
+		const RegisterType Step = SplatRegister(ScalarType(StepTime));
+		const RegisterType SafeNormalTolerance = SplatRegister(ScalarType(UE_SMALL_NUMBER));
+		const VectorRegister4Float ZeroFloat = VectorZeroFloat();
+		const VectorRegister4Float StepFloat = SplatRegister(StepTime);
+		const int32 NumLanes = Active.Num();
+
+		for (int32 Lane = 0; Lane < NumLanes; Lane += LaneWidth)
+		{
+			const VectorRegister4Float ActiveFloat = VectorLoad(&Active[Lane]);
+			const VectorRegister4Float ActiveMaskFloat = VectorCompareGT(ActiveFloat, ZeroFloat);
+			const RegisterType ActiveMask = VectorCompareGT(FromFloatRegister(ActiveFloat, ScalarType()), Zero);
+
+			RegisterType ToGoal[NumComponents];
+			RegisterType DistSquared = Zero;
+			for (int32 Component = 0; Component < NumComponents; ++Component)
+			{
+				ToGoal[Component] = VectorSubtract(VectorLoad(&GoalValue.Components[Component][Lane]), VectorLoad(&CurrentValue.Components[Component][Lane]));
+				DistSquared = Component == 0 ? VectorMultiply(ToGoal[0], ToGoal[0]) : VectorAdd(DistSquared, VectorMultiply(ToGoal[Component], ToGoal[Component]));
+			}
+			const RegisterType Dist = VectorSqrt(DistSquared);
+			const VectorRegister4Float DistFloat = ToFloatRegister(Dist);
+
+			// are we close enough to decel?
+			// v^2 = v0^2 + 2a * dx
+			const VectorRegister4Float Speed = VectorLoad(&CurrentSpeed[Lane]);
+			const VectorRegister4Float SpeedSquared = VectorMultiply(Speed, Speed);
+			const VectorRegister4Float HoldTolerance = VectorLoad(&HoldTolerances[Lane]);
+			const VectorRegister4Float IdealStoppingDist = VectorDivide(SpeedSquared, VectorLoad(&TwoMinDecelerations[Lane]));
+
+			const VectorRegister4Float DecelerateMask = VectorBitwiseOr(VectorCompareLT(DistFloat, IdealStoppingDist), VectorCompareLT(DistFloat, HoldTolerance));
+			const VectorRegister4Float AccelerateMask = VectorCompareGT(DistFloat, HoldTolerance);
+
+			// real deceleration needed to hit our mark, or max acceleration toward the goal
+			const VectorRegister4Float DeceleratedSpeed = VectorSubtract(Speed, VectorMultiply(VectorDivide(SpeedSquared, VectorAdd(DistFloat, DistFloat)), StepFloat));
+			const VectorRegister4Float AcceleratedSpeed = VectorAdd(Speed, VectorMultiply(VectorLoad(&MaxAccelerations[Lane]), StepFloat));
+			const VectorRegister4Float NewSpeed = VectorSelect(DecelerateMask, DeceleratedSpeed, VectorSelect(AccelerateMask, AcceleratedSpeed, ZeroFloat));
+
+			// clamp to enforce max speed. On the goal the max speed to hit it is zero, which also covers the 0/0 deceleration above
+			const VectorRegister4Float MaxSpeedToHitGoal = VectorDivide(DistFloat, StepFloat);
+			const VectorRegister4Float ClampedSpeed = VectorSelect(VectorCompareGT(DistFloat, ZeroFloat), VectorMax(VectorMin(NewSpeed, VectorMin(VectorLoad(&MaxSpeeds[Lane]), MaxSpeedToHitGoal)), ZeroFloat), ZeroFloat);
+			VectorStore(VectorSelect(ActiveMaskFloat, ClampedSpeed, Speed), &CurrentSpeed[Lane]);
+
+			// integrate
+			RegisterType DirScale;
+			if constexpr (NumComponents == 1)
+			{
+				// the scalar version only uses the sign of the distance
+				DirScale = VectorSelect(VectorCompareLT(ToGoal[0], Zero), VectorNegate(One), One);
+				ToGoal[0] = One;
+			}
+			else
+			{
+				// same as GetSafeNormal
+				const RegisterType InvDist = VectorSelect(VectorCompareEQ(DistSquared, One), One, VectorDivide(One, Dist));
+				DirScale = VectorSelect(VectorCompareLT(DistSquared, SafeNormalTolerance), Zero, InvDist);
+			}
+
+			const RegisterType SpeedReg = FromFloatRegister(ClampedSpeed, ScalarType());
+			for (int32 Component = 0; Component < NumComponents; ++Component)
+			{
+				ScalarType* const ValuePtr = &CurrentValue.Components[Component][Lane];
+
+				const RegisterType Value = VectorLoad(ValuePtr);
+				const RegisterType Velocity = VectorMultiply(SpeedReg, VectorMultiply(ToGoal[Component], DirScale));
+				VectorStore(VectorSelect(ActiveMask, VectorAdd(Value, VectorMultiply(Velocity, Step)), Value), ValuePtr);
+			}
+		}
+	}
+
+	void SetNumLanes(int32 NumLanes)
+	{
+		CurrentValue.SetNum(NumLanes);
+		GoalValue.SetNum(NumLanes);
+
+		CurrentSpeed.SetNumZeroed(NumLanes);
+		Active.SetNumZeroed(NumLanes);
+
+		MaxAccelerations.SetNumZeroed(NumLanes);
+		TwoMinDecelerations.SetNumZeroed(NumLanes);
+		MaxSpeeds.SetNumZeroed(NumLanes);
+		HoldTolerances.SetNumZeroed(NumLanes);
+
+		bPendingReset.SetNumZeroed(NumLanes);
+	}
+
+	void MoveLane(int32 FromLane, int32 ToLane)
+	{
+		using InterpolatorBatchHelpers::MoveLane;
+
+		CurrentValue.Move(FromLane, ToLane);
+		GoalValue.Move(FromLane, ToLane);
+
+		MoveLane(CurrentSpeed, FromLane, ToLane);
+		MoveLane(Active, FromLane, ToLane);
+
+		MoveLane(MaxAccelerations, FromLane, ToLane);
+		MoveLane(TwoMinDecelerations, FromLane, ToLane);
+		MoveLane(MaxSpeeds, FromLane, ToLane);
+		MoveLane(HoldTolerances, FromLane, ToLane);
+
+		MoveLane(bPendingReset, FromLane, ToLane);
+	}
+
+	int32 NumInstances = 0;
+
+	FLanes CurrentValue;
+	FLanes GoalValue;
+
+	/** a magnitude, always positive */
+	TArray<float> CurrentSpeed;
+
+	/** 1 for lanes stepped by this eval, 0 for the ones that just reset and the padding */
+	TArray<float> Active;
+
+	// configuration data
+	TArray<float> MaxAccelerations;
+	TArray<float> TwoMinDecelerations;
+	TArray<float> MaxSpeeds;
+	TArray<float> HoldTolerances;
+
+	TArray<bool> bPendingReset;
+};
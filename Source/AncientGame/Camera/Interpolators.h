@@ -1174,10 +1174,3 @@ public:
 private:
 	TCritDampSpringInterpolator<FRotator> Interpolator;
 };
-
-
-struct FInterpolatorTests
-{
-public:
-	static bool RunSubstepTest_CDSpringVector();
-};
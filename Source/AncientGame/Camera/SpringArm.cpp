@@ -22,7 +22,7 @@ class AActor;
 //////////////////////////////////////////////////////////////////////////
 // FSpringArm
 
-void FSpringArm::UpdateDesiredArmLocation(const UWorld* WorldContext, const TArray<const AActor*>& IgnoreActors, const FTransform& InitialTransform, const FVector OffsetLocation, bool bDoTrace)
+void FSpringArm::UpdateDesiredArmLocation(const UWorld* WorldContext, TArrayView<const AActor* const> IgnoreActors, const FTransform& InitialTransform, const FVector OffsetLocation, bool bDoTrace)
 {
 	FVector PivotLocation = InitialTransform.GetLocation();
 	FRotator DesiredRot = InitialTransform.Rotator();
@@ -48,14 +48,22 @@ void FSpringArm::UpdateDesiredArmLocation(const UWorld* WorldContext, const TArr
 	{
 		bIsCameraFixed = true;
 		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SpringArm), false);
-		QueryParams.AddIgnoredActors(IgnoreActors);
+		for (const AActor* IgnoreActor : IgnoreActors)
+		{
+			QueryParams.AddIgnoredActor(IgnoreActor);
+		}
+
+		bool bHitSomething = false;
+		const FVector HitLocation = SweepArm(WorldContext, QueryParams, ArmOrigin, DesiredLoc, bHitSomething);
 
-		FHitResult Result;
-		WorldContext->SweepSingleByChannel(Result, ArmOrigin, DesiredLoc, FQuat::Identity, ProbeChannel, FCollisionShape::MakeSphere(ProbeSize), QueryParams);
+		if (bAsyncCollisionTest)
+		{
+			IssueAsyncSweep(WorldContext, QueryParams, ArmOrigin, DesiredLoc);
+		}
 		
 		UnfixedCameraPosition = DesiredLoc;
 
-		ResultLoc = BlendLocations(DesiredLoc, Result.Location, Result.bBlockingHit);
+		ResultLoc = BlendLocations(DesiredLoc, HitLocation, bHitSomething);
 
 		if (ResultLoc == DesiredLoc) 
 		{	
@@ -67,6 +75,7 @@ void FSpringArm::UpdateDesiredArmLocation(const UWorld* WorldContext, const TArr
 		ResultLoc = DesiredLoc;
 		bIsCameraFixed = false;
 		UnfixedCameraPosition = ResultLoc;
+		bHasLastArm = false;
 	}
 
 	CameraTransform.SetLocation(ResultLoc);
@@ -75,6 +84,83 @@ void FSpringArm::UpdateDesiredArmLocation(const UWorld* WorldContext, const TArr
 	StateIsValid = true;
 }
 
+FVector FSpringArm::SweepArm(const UWorld* WorldContext, const FCollisionQueryParams& QueryParams, const FVector& ArmOrigin, const FVector& DesiredLoc, bool& bOutHitSomething)
+{
+	if (bAsyncCollisionTest)
+	{
+		// Sweeps complete during the frame they are issued in, and can be read from the next one
+		UWorld* World = WorldContext->GetWorld();
+		FTraceDatum SweepData;
+		if (PendingSweep.IsValid() && World->QueryTraceData(PendingSweep, SweepData))
+		{
+			const FHitResult* Hit = SweepData.OutHits.Num() > 0 ? &SweepData.OutHits[0] : nullptr;
+
+			bHasAsyncSweepResult = true;
+			bAsyncSweepHit = Hit != nullptr && Hit->bBlockingHit;
+			AsyncSweepHitTime = bAsyncSweepHit ? Hit->Time : 1.0f;
+			AsyncSweepStart = PendingSweepStart;
+			AsyncSweepEnd = PendingSweepEnd;
+			PendingSweep = FTraceHandle();
+		}
+
+		// Apply how far along its arm the probe could go to the actual arm, as long as the prediction was close enough
+		const float FallbackDistanceSquared = FMath::Square(AsyncFallbackDistance);
+		if (bHasAsyncSweepResult
+			&& FVector::DistSquared(ArmOrigin, AsyncSweepStart) <= FallbackDistanceSquared
+			&& FVector::DistSquared(DesiredLoc, AsyncSweepEnd) <= FallbackDistanceSquared)
+		{
+			++NumAsyncSweepResults;
+			bOutHitSomething = bAsyncSweepHit;
+			return ArmOrigin + (DesiredLoc - ArmOrigin) * AsyncSweepHitTime;
+		}
+
+		// The arm didn't move as predicted, so a prediction from this frame is unlikely to hold either
+		bAsyncPredictionMissed = bHasAsyncSweepResult;
+		bHasAsyncSweepResult = false;
+		++NumSyncSweepFallbacks;
+	}
+
+	FHitResult Result;
+	WorldContext->SweepSingleByChannel(Result, ArmOrigin, DesiredLoc, FQuat::Identity, ProbeChannel, FCollisionShape::MakeSphere(ProbeSize), QueryParams);
+
+	bOutHitSomething = Result.bBlockingHit;
+	return Result.Location;
+}
+
+void FSpringArm::IssueAsyncSweep(const UWorld* WorldContext, const FCollisionQueryParams& QueryParams, const FVector& ArmOrigin, const FVector& DesiredLoc)
+{
+	const double Now = WorldContext->GetTimeSeconds();
+	const double DeltaTime = Now - LastArmTime;
+
+	// Predict where the arm will be next frame, assuming this frame's duration
+	FVector PredictedOrigin = ArmOrigin;
+	FVector PredictedEnd = DesiredLoc;
+	if (bHasLastArm && DeltaTime > UE_KINDA_SMALL_NUMBER)
+	{
+		PredictedOrigin += ArmOrigin - LastArmOrigin;
+		PredictedEnd += DesiredLoc - LastArmEnd;
+	}
+
+	bHasLastArm = true;
+	LastArmTime = Now;
+	LastArmOrigin = ArmOrigin;
+	LastArmEnd = DesiredLoc;
+
+	// This frame already paid for a synchronous sweep. The next one sweeps synchronously too and issues the async sweep again
+	if (bAsyncPredictionMissed)
+	{
+		bAsyncPredictionMissed = false;
+		PendingSweep = FTraceHandle();
+		++NumSkippedAsyncSweeps;
+		return;
+	}
+
+	// Only one sweep in flight; a slow one is replaced rather than queued
+	PendingSweepStart = PredictedOrigin;
+	PendingSweepEnd = PredictedEnd;
+	PendingSweep = WorldContext->GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Single, PredictedOrigin, PredictedEnd, FQuat::Identity, ProbeChannel, FCollisionShape::MakeSphere(ProbeSize), QueryParams);
+}
+
 FVector FSpringArm::BlendLocations(const FVector& DesiredArmLocation, const FVector& TraceHitLocation, bool bHitSomething)
 {
 	return bHitSomething ? TraceHitLocation : DesiredArmLocation;
@@ -84,16 +170,19 @@ void FSpringArm::Initialize()
 {
 	bIsCameraFixed = false;
 	StateIsValid = false;
+
+	PendingSweep = FTraceHandle();
+	bHasAsyncSweepResult = false;
+	bAsyncPredictionMissed = false;
+	bHasLastArm = false;
 }
 
 void FSpringArm::Tick(const UWorld* WorldContext, const AActor* IgnoreActor, const FTransform& InitialTransform, const FVector OffsetLocation)
 {
-	TArray<const AActor*> IgnoreActorArray;
-	IgnoreActorArray.Add(IgnoreActor);
-	Tick(WorldContext, IgnoreActorArray, InitialTransform, OffsetLocation);
+	Tick(WorldContext, MakeArrayView(&IgnoreActor, 1), InitialTransform, OffsetLocation);
 }
 
-void FSpringArm::Tick(const UWorld* WorldContext, const TArray<const AActor*>& IgnoreActors, const FTransform& InitialTransform, const FVector OffsetLocation)
+void FSpringArm::Tick(const UWorld* WorldContext, TArrayView<const AActor* const> IgnoreActors, const FTransform& InitialTransform, const FVector OffsetLocation)
 {
 	UpdateDesiredArmLocation(WorldContext, IgnoreActors, InitialTransform, OffsetLocation, bDoCollisionTest);
 }
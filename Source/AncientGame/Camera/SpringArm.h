@@ -3,8 +3,11 @@
 #pragma once
 
 #include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/ContainerAllocationPolicies.h"
 #include "Containers/EnumAsByte.h"
 #include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Math/MathFwd.h"
 #include "Math/Transform.h"
@@ -18,6 +21,9 @@ class UObject;
 class UWorld;
 struct FFrame;
 
+/** Actors the spring arm collision ignores. Cameras rarely ignore more than a handful, so they are stored inline */
+typedef TArray<const AActor*, TInlineAllocator<8>> FSpringArmIgnoreActors;
+
 /**
  * This structure maintain location at a fixed from a pivot point, but but will retract if there is a collision, and spring back when there is no collision.
  *
@@ -34,7 +40,7 @@ public:
 
 	/** Updates the spring arm using the supplied information**/
 	void Tick(const UWorld* WorldContext, const AActor* IgnoreActor, const FTransform& InitialTransform, const FVector OffsetLocation);
-	void Tick(const UWorld* WorldContext, const TArray<const AActor*>& IgnoreActors, const FTransform& InitialTransform, const FVector OffsetLocation);
+	void Tick(const UWorld* WorldContext, TArrayView<const AActor* const> IgnoreActors, const FTransform& InitialTransform, const FVector OffsetLocation);
 
 	/** Returns the current camera transform**/
 	const FTransform& GetCameraTransform() const;
@@ -55,6 +61,17 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=CameraCollision)
 	bool bDoCollisionTest = true;
 
+	/**
+	 * If true, the collision test for the next frame is swept asynchronously, predicting where the arm will be from its velocity,
+	 * and this frame uses the result of the sweep issued last frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=CameraCollision, meta=(EditCondition="bDoCollisionTest"))
+	bool bAsyncCollisionTest = false;
+
+	/** When the arm ends up further than this from where the last async sweep predicted it, a synchronous sweep is done instead */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=CameraCollision, meta=(EditCondition="bDoCollisionTest && bAsyncCollisionTest", ClampMin="0.0"))
+	float AsyncFallbackDistance = 50.0f;
+
 	/** Should we inherit pitch from parent component. Does nothing if using Absolute Rotation. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=CameraSettings)
 	bool bInheritPitch = true;
@@ -73,10 +90,24 @@ public:
 	/** Is the Collision Test displacement being applied? */
 	bool IsCollisionFixApplied() const;
 
+	/**
+	 * Number of collision tests resolved from an async sweep, number that had to fall back to a synchronous one,
+	 * and number of async sweeps not issued because the frame's prediction had missed
+	 */
+	int32 GetNumAsyncSweepResults() const { return NumAsyncSweepResults; }
+	int32 GetNumSyncSweepFallbacks() const { return NumSyncSweepFallbacks; }
+	int32 GetNumSkippedAsyncSweeps() const { return NumSkippedAsyncSweeps; }
+
 private:
 
 	/** Updates the desired arm location, calling BlendLocations to do the actual blending if a trace is done */
-	void UpdateDesiredArmLocation(const UWorld* WorldContext, const TArray<const AActor*>& IgnoreActors, const FTransform& InitialTransform, const FVector OffsetLocation, bool bDoTrace);
+	void UpdateDesiredArmLocation(const UWorld* WorldContext, TArrayView<const AActor* const> IgnoreActors, const FTransform& InitialTransform, const FVector OffsetLocation, bool bDoTrace);
+
+	/** Returns the location along ArmOrigin -> DesiredLoc the camera should be pushed to, sweeping synchronously unless the last async sweep predicted it closely enough */
+	FVector SweepArm(const UWorld* WorldContext, const FCollisionQueryParams& QueryParams, const FVector& ArmOrigin, const FVector& DesiredLoc, bool& bOutHitSomething);
+
+	/** Issues the async sweep for the next frame, extrapolating the arm from its current velocity */
+	void IssueAsyncSweep(const UWorld* WorldContext, const FCollisionQueryParams& QueryParams, const FVector& ArmOrigin, const FVector& DesiredLoc);
 	
 	/**
 	 * This function allows subclasses to blend the trace hit location with the desired arm location;
@@ -90,6 +121,31 @@ private:
 	bool bIsCameraFixed = false;
 	bool StateIsValid = false;
 	FVector UnfixedCameraPosition;
+
+	/** Async collision test state */
+	FTraceHandle PendingSweep;
+	FVector PendingSweepStart = FVector::ZeroVector;
+	FVector PendingSweepEnd = FVector::ZeroVector;
+
+	/** The last async sweep that completed: where it predicted the arm, and how far along it the probe could go */
+	bool bHasAsyncSweepResult = false;
+	bool bAsyncSweepHit = false;
+	float AsyncSweepHitTime = 1.0f;
+	FVector AsyncSweepStart = FVector::ZeroVector;
+	FVector AsyncSweepEnd = FVector::ZeroVector;
+
+	/** Set when this frame fell back to a synchronous sweep although an async result was available */
+	bool bAsyncPredictionMissed = false;
+
+	/** Arm of the previous update, to extrapolate the next one */
+	bool bHasLastArm = false;
+	double LastArmTime = 0.0;
+	FVector LastArmOrigin = FVector::ZeroVector;
+	FVector LastArmEnd = FVector::ZeroVector;
+
+	int32 NumAsyncSweepResults = 0;
+	int32 NumSyncSweepFallbacks = 0;
+	int32 NumSkippedAsyncSweeps = 0;
 };
 
 UCLASS(meta = (BlueprintThreadSafe, ScriptName = "SpringArmLibrary"))
@@ -25,7 +25,7 @@ void USpringArmCameraMode::OnActivation(AActor* TargetActor)
 FAncientGameCameraModeView USpringArmCameraMode::UpdateView_Implementation(float DeltaTime, AActor* TargetActor)
 {
 	UObject* WorldContext = this;
-	TArray<const AActor*> AllIgnoreActors;
+	FSpringArmIgnoreActors AllIgnoreActors;
 
 	if (TargetActor)
 	{
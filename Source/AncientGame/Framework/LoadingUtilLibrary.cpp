@@ -2,65 +2,76 @@
 
 #include "LoadingUtilLibrary.h"
 
-#include "Engine/CoreSettings.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
-#include "GameFramework/WorldSettings.h"
 #include "Misc/AssertionMacros.h"
+#include "StreamingBudgetSubsystem.h"
 #include "UObject/Object.h"
 
-#include <cfloat>
-
-bool ULoadingUtilLibrary::HasCapturedDefaults = false;
-float ULoadingUtilLibrary::DefaultLevelStreamingComponentsRegistrationGranularity;
-float ULoadingUtilLibrary::DefaultLevelStreamingActorsUpdateTimeLimit;
-float ULoadingUtilLibrary::DefaultAsyncLoadingTimeLimit;
-
 void ULoadingUtilLibrary::ApplyDefaultPriorityLoading(const UObject* WorldContextObject)
 {
-	// Call first, just in case defaults have not been captured yet
-	CaptureDefaultLoadingSettings();
-	ApplyCustomPriorityLoading(WorldContextObject, false, DefaultAsyncLoadingTimeLimit, DefaultLevelStreamingActorsUpdateTimeLimit);
+	UStreamingBudgetSubsystem* StreamingBudget = UStreamingBudgetSubsystem::Get();
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+
+	if (StreamingBudget && World)
+	{
+		FStreamingBudgetRequestHandle LibraryRequest;
+		if (StreamingBudget->LibraryRequests.RemoveAndCopyValue(World, LibraryRequest))
+		{
+			StreamingBudget->RemoveRequest(LibraryRequest);
+		}
+	}
 }
 
 void ULoadingUtilLibrary::ApplyStreamingPriorityLoading(const UObject* WorldContextObject)
 {	
-	ApplyCustomPriorityLoading(WorldContextObject, false, 10.0f, 10.0f);
+	ReplaceLibraryRequest(WorldContextObject, [WorldContextObject](UStreamingBudgetSubsystem& StreamingBudget)
+	{
+		return StreamingBudget.AddRequest(WorldContextObject, EStreamingBudgetPriority::SeamlessTraversal);
+	});
 }
 
 void ULoadingUtilLibrary::ApplyHighestPriorityLoading(const UObject* WorldContextObject)
 {
-	ApplyCustomPriorityLoading(WorldContextObject, true, FLT_MAX, FLT_MAX);
+	ReplaceLibraryRequest(WorldContextObject, [WorldContextObject](UStreamingBudgetSubsystem& StreamingBudget)
+	{
+		return StreamingBudget.AddRequest(WorldContextObject, EStreamingBudgetPriority::LoadingScreen);
+	});
 }
 
 void ULoadingUtilLibrary::ApplyCustomPriorityLoading(const UObject* WorldContextObject, bool UseHighPriorityLoading, float MaxAsyncLoadingMilliSeconds, float MaxActorUpdateMilliSeconds)
 {
-	CaptureDefaultLoadingSettings();
+	FStreamingBudget Budget;
+	Budget.bHighPriorityLoading = UseHighPriorityLoading;
+	Budget.AsyncLoadingTimeLimitMs = MaxAsyncLoadingMilliSeconds;
+	Budget.ActorsUpdateTimeLimitMs = MaxActorUpdateMilliSeconds;
 
-	if (!ensure(WorldContextObject != nullptr))
+	ReplaceLibraryRequest(WorldContextObject, [WorldContextObject, &Budget](UStreamingBudgetSubsystem& StreamingBudget)
 	{
-		return;
-	}
-
-	UWorld* World = WorldContextObject->GetWorld();
+		const EStreamingBudgetPriority Priority = Budget.bHighPriorityLoading ? EStreamingBudgetPriority::LoadingScreen : EStreamingBudgetPriority::SeamlessTraversal;
+		return StreamingBudget.AddCustomRequest(WorldContextObject, Priority, Budget);
+	});
+}
 
-	if (!ensure(World != nullptr))
+void ULoadingUtilLibrary::ReplaceLibraryRequest(const UObject* WorldContextObject, TFunctionRef<FStreamingBudgetRequestHandle(UStreamingBudgetSubsystem&)> MakeRequest)
+{
+	if (!ensure(WorldContextObject != nullptr))
 	{
 		return;
 	}
 
-	AWorldSettings* WorldSettings = World->GetWorldSettings();
+	UWorld* World = WorldContextObject->GetWorld();
+	UStreamingBudgetSubsystem* StreamingBudget = UStreamingBudgetSubsystem::Get();
 
-	if (!ensure(WorldSettings != nullptr))
+	if (!ensure(World != nullptr && StreamingBudget != nullptr))
 	{
 		return;
 	}
 
-	WorldSettings->bHighPriorityLoadingLocal = UseHighPriorityLoading;
-	GLevelStreamingActorsUpdateTimeLimit = MaxActorUpdateMilliSeconds;
-	GLevelStreamingComponentsRegistrationGranularity = DefaultLevelStreamingComponentsRegistrationGranularity;
-	GAsyncLoadingUseFullTimeLimit = UseHighPriorityLoading;
-	GAsyncLoadingTimeLimit = MaxAsyncLoadingMilliSeconds;
+	// Add before removing so the budget doesn't dip to the defaults in between
+	FStreamingBudgetRequestHandle PreviousRequest = StreamingBudget->LibraryRequests.FindRef(World);
+	StreamingBudget->LibraryRequests.Add(World, MakeRequest(*StreamingBudget));
+	StreamingBudget->RemoveRequest(PreviousRequest);
 }
 
 void ULoadingUtilLibrary::FlushLevelStreaming(const UObject* WorldContextObject)
@@ -88,14 +99,3 @@ void ULoadingUtilLibrary::ForceGarbageCollection()
 	GEngine->ForceGarbageCollection(true);
 #endif
 }
-
-void ULoadingUtilLibrary::CaptureDefaultLoadingSettings()
-{
-	if (!HasCapturedDefaults)
-	{
-		DefaultLevelStreamingComponentsRegistrationGranularity = GLevelStreamingComponentsRegistrationGranularity;
-		DefaultLevelStreamingActorsUpdateTimeLimit = GLevelStreamingActorsUpdateTimeLimit;
-		DefaultAsyncLoadingTimeLimit = GAsyncLoadingTimeLimit;
-		HasCapturedDefaults = true;
-	}
-}
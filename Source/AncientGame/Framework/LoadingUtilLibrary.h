@@ -3,12 +3,15 @@
 #pragma once
 
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "Templates/Function.h"
 #include "UObject/UObjectGlobals.h"
 
 #include "LoadingUtilLibrary.generated.h"
 
 class UObject;
+class UStreamingBudgetSubsystem;
 struct FFrame;
+struct FStreamingBudgetRequestHandle;
 
 UCLASS()
 class ULoadingUtilLibrary : public UBlueprintFunctionLibrary
@@ -35,10 +38,6 @@ public:
 	static void FlushLevelStreaming(const UObject* WorldContextObject);
 
 private:
-	static void CaptureDefaultLoadingSettings();
-	static bool HasCapturedDefaults;
-	static float DefaultLevelStreamingActorsUpdateTimeLimit;
-	static float DefaultLevelStreamingComponentsRegistrationGranularity;
-	static float DefaultAsyncLoadingTimeLimit;
-	
+	/** The Apply functions share one UStreamingBudgetSubsystem request per world, each replacing the last */
+	static void ReplaceLibraryRequest(const UObject* WorldContextObject, TFunctionRef<FStreamingBudgetRequestHandle(UStreamingBudgetSubsystem&)> MakeRequest);
 };
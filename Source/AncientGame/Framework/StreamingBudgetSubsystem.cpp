@@ -0,0 +1,384 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StreamingBudgetSubsystem.h"
+
+#include "AncientGame.h"
+#include "CoreGlobals.h"
+#include "Engine/CoreSettings.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/PlatformTime.h"
+#include "Logging/LogMacros.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/AssertionMacros.h"
+#include "RenderCore.h"
+#include "UObject/Object.h"
+
+#include <cfloat>
+
+//////////////////////////////////////////////////////////////////////
+// FStreamingBudgetGovernor
+
+FStreamingBudgetRequestHandle FStreamingBudgetGovernor::AddRequest(EStreamingBudgetPriority Priority)
+{
+	FStreamingBudgetRequestHandle Handle;
+	Handle.Id = ++LastRequestId;
+	Requests.Add({ Handle.Id, Priority, false, FStreamingBudget() });
+	return Handle;
+}
+
+FStreamingBudgetRequestHandle FStreamingBudgetGovernor::AddCustomRequest(EStreamingBudgetPriority Priority, const FStreamingBudget& Budget)
+{
+	FStreamingBudgetRequestHandle Handle;
+	Handle.Id = ++LastRequestId;
+	Requests.Add({ Handle.Id, Priority, true, Budget });
+	return Handle;
+}
+
+bool FStreamingBudgetGovernor::RemoveRequest(FStreamingBudgetRequestHandle& Handle)
+{
+	const int32 NumRemoved = Requests.RemoveAll([&Handle](const FRequest& Request) { return Request.Id == Handle.Id; });
+	Handle.Invalidate();
+	return NumRemoved > 0;
+}
+
+const FStreamingBudgetGovernor::FRequest* FStreamingBudgetGovernor::FindActiveRequest() const
+{
+	// Requests are in the order they were made, so walking backwards lets the most recent win a tie
+	const FRequest* ActiveRequest = nullptr;
+	for (int32 Index = Requests.Num() - 1; Index >= 0; --Index)
+	{
+		if (ActiveRequest == nullptr || Requests[Index].Priority > ActiveRequest->Priority)
+		{
+			ActiveRequest = &Requests[Index];
+		}
+	}
+	return ActiveRequest;
+}
+
+EStreamingBudgetPriority FStreamingBudgetGovernor::GetActivePriority() const
+{
+	const FRequest* ActiveRequest = FindActiveRequest();
+	return ActiveRequest ? ActiveRequest->Priority : EStreamingBudgetPriority::Default;
+}
+
+FStreamingBudgetRequestHandle FStreamingBudgetGovernor::GetActiveRequest() const
+{
+	FStreamingBudgetRequestHandle Handle;
+	if (const FRequest* ActiveRequest = FindActiveRequest())
+	{
+		Handle.Id = ActiveRequest->Id;
+	}
+	return Handle;
+}
+
+void FStreamingBudgetGovernor::ReportFrameTime(float FrameTimeMs, const FStreamingBudget& AppliedBudget)
+{
+	if (AppliedBudget.bHighPriorityLoading)
+	{
+		// Streaming had the whole frame, so it says nothing about what the game needs
+		return;
+	}
+
+	// Assume streaming used what it was given; if it didn't, the headroom is overestimated only while there's nothing to stream
+	const float GameMs = FMath::Max(FrameTimeMs - FMath::Min(AppliedBudget.AsyncLoadingTimeLimitMs, FrameTimeMs), 0.f);
+	GameFrameTimeMs = GameFrameTimeMs < 0.f ? GameMs : FMath::Lerp(GameMs, GameFrameTimeMs, AdaptiveSettings.FrameTimeSmoothing);
+}
+
+FStreamingBudget FStreamingBudgetGovernor::Evaluate(int32 NumPendingLevels) const
+{
+	const FRequest* ActiveRequest = FindActiveRequest();
+	if (ActiveRequest == nullptr)
+	{
+		return EngineDefaults;
+	}
+
+	if (ActiveRequest->bCustom)
+	{
+		return ActiveRequest->CustomBudget;
+	}
+
+	FStreamingBudget Budget;
+	switch (ActiveRequest->Priority)
+	{
+	case EStreamingBudgetPriority::LoadingScreen:
+		Budget.bHighPriorityLoading = true;
+		Budget.AsyncLoadingTimeLimitMs = FLT_MAX;
+		Budget.ActorsUpdateTimeLimitMs = FLT_MAX;
+		break;
+
+	case EStreamingBudgetPriority::SeamlessTraversal:
+	{
+		const FStreamingBudgetAdaptiveSettings& Settings = AdaptiveSettings;
+		float BudgetMs = Settings.IdleBudgetMs;
+		if (NumPendingLevels > 0)
+		{
+			BudgetMs = FMath::Max((Settings.TargetFrameTimeMs - GetGameFrameTimeMs()) * Settings.HeadroomFraction, Settings.MinBudgetMs);
+			BudgetMs += FMath::Max(NumPendingLevels - Settings.PendingLevelsBeforeBoost, 0) * Settings.BoostPerPendingLevelMs;
+		}
+		BudgetMs = FMath::Clamp(BudgetMs, Settings.MinBudgetMs, FMath::Max(Settings.MinBudgetMs, Settings.MaxBudgetMs));
+
+		Budget.bHighPriorityLoading = false;
+		Budget.AsyncLoadingTimeLimitMs = BudgetMs;
+		Budget.ActorsUpdateTimeLimitMs = BudgetMs;
+		break;
+	}
+
+	default:
+		Budget = EngineDefaults;
+		break;
+	}
+
+	return Budget;
+}
+
+//////////////////////////////////////////////////////////////////////
+// UStreamingBudgetSubsystem
+
+void UStreamingBudgetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FWorldDelegates::OnWorldCleanup.AddUObject(this, &UStreamingBudgetSubsystem::OnWorldCleanup);
+}
+
+void UStreamingBudgetSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldCleanup.RemoveAll(this);
+
+	if (bHasCapturedEngineDefaults)
+	{
+		UpdateHighPriorityWorld(false);
+		ApplyBudget(EngineDefaults);
+	}
+
+	Super::Deinitialize();
+}
+
+bool UStreamingBudgetSubsystem::IsTickable() const
+{
+	return !HasAnyFlags(RF_ClassDefaultObject);
+}
+
+TStatId UStreamingBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UStreamingBudgetSubsystem, STATGROUP_Tickables);
+}
+
+UStreamingBudgetSubsystem* UStreamingBudgetSubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<UStreamingBudgetSubsystem>() : nullptr;
+}
+
+FStreamingBudgetRequestHandle UStreamingBudgetSubsystem::AddRequest(const UObject* WorldContextObject, EStreamingBudgetPriority Priority)
+{
+	return TrackRequest(WorldContextObject, Governor.AddRequest(Priority));
+}
+
+FStreamingBudgetRequestHandle UStreamingBudgetSubsystem::AddCustomRequest(const UObject* WorldContextObject, EStreamingBudgetPriority Priority, FStreamingBudget Budget)
+{
+	return TrackRequest(WorldContextObject, Governor.AddCustomRequest(Priority, Budget));
+}
+
+FStreamingBudgetRequestHandle UStreamingBudgetSubsystem::TrackRequest(const UObject* WorldContextObject, FStreamingBudgetRequestHandle Handle)
+{
+	if (UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr)
+	{
+		RequestWorlds.Add(Handle.Id, World);
+	}
+
+	UpdateBudget();
+	return Handle;
+}
+
+void UStreamingBudgetSubsystem::RemoveRequest(FStreamingBudgetRequestHandle& Handle)
+{
+	RequestWorlds.Remove(Handle.Id);
+
+	if (Governor.RemoveRequest(Handle))
+	{
+		UpdateBudget();
+	}
+}
+
+void UStreamingBudgetSubsystem::OnWorldCleanup(UWorld* World, bool /*bSessionEnded*/, bool /*bCleanupResources*/)
+{
+	// Only this world's requests go, so a PIE instance ending doesn't reset the budgets another one asked for
+	bool bRemovedAny = false;
+	for (auto It = RequestWorlds.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsValid() || It.Value().Get() == World)
+		{
+			FStreamingBudgetRequestHandle Handle;
+			Handle.Id = It.Key();
+			bRemovedAny |= Governor.RemoveRequest(Handle);
+			It.RemoveCurrent();
+		}
+	}
+
+	LibraryRequests.Remove(World);
+
+	if (HighPriorityWorld.Get() == World)
+	{
+		HighPriorityWorld.Reset();
+	}
+
+	if (bRemovedAny)
+	{
+		UpdateBudget();
+	}
+}
+
+void UStreamingBudgetSubsystem::Tick(float DeltaTime)
+{
+	int32 NumLoadedLevels = 0;
+	NumPendingLevels = CountPendingLevels(NumLoadedLevels);
+	UpdateStats(DeltaTime, NumLoadedLevels);
+
+	// Game thread time rather than the frame's, so waiting on the GPU or vsync isn't mistaken for the game's own work
+	Governor.AdaptiveSettings = AdaptiveSettings;
+	Governor.ReportFrameTime(FPlatformTime::ToMilliseconds(GGameThreadTime), AppliedBudget);
+	UpdateBudget();
+}
+
+int32 UStreamingBudgetSubsystem::CountPendingLevels(int32& OutNumLoadedLevels) const
+{
+	int32 NumPending = 0;
+	OutNumLoadedLevels = 0;
+
+	for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+	{
+		const UWorld* World = WorldContext.World();
+		if (World == nullptr || !World->IsGameWorld())
+		{
+			continue;
+		}
+
+		for (const ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+		{
+			if (StreamingLevel == nullptr)
+			{
+				continue;
+			}
+
+			if (StreamingLevel->IsStreamingStatePending())
+			{
+				++NumPending;
+			}
+			else if (StreamingLevel->IsLevelLoaded())
+			{
+				++OutNumLoadedLevels;
+			}
+		}
+	}
+
+	return NumPending;
+}
+
+void UStreamingBudgetSubsystem::UpdateStats(float DeltaTime, int32 NumLoadedLevels)
+{
+	const float FrameTimeMs = DeltaTime * 1000.f;
+	const bool bStreaming = NumPendingLevels > 0 || IsAsyncLoading();
+
+	if (LastNumLoadedLevels >= 0)
+	{
+		Stats.NumLevelsLoaded += FMath::Max(NumLoadedLevels - LastNumLoadedLevels, 0);
+	}
+	LastNumLoadedLevels = NumLoadedLevels;
+
+	if (bStreaming)
+	{
+		Stats.StreamingSeconds += DeltaTime;
+		Stats.NumStreamingFrames += 1;
+		Stats.AverageStreamingFrameTimeMs += (FrameTimeMs - Stats.AverageStreamingFrameTimeMs) / Stats.NumStreamingFrames;
+		Stats.WorstStreamingFrameTimeMs = FMath::Max(Stats.WorstStreamingFrameTimeMs, FrameTimeMs);
+	}
+	else
+	{
+		Stats.NumIdleFrames += 1;
+		Stats.AverageIdleFrameTimeMs += (FrameTimeMs - Stats.AverageIdleFrameTimeMs) / Stats.NumIdleFrames;
+	}
+}
+
+void UStreamingBudgetSubsystem::UpdateBudget()
+{
+	if (!bHasCapturedEngineDefaults)
+	{
+		EngineDefaults.bHighPriorityLoading = false;
+		EngineDefaults.AsyncLoadingTimeLimitMs = GAsyncLoadingTimeLimit;
+		EngineDefaults.ActorsUpdateTimeLimitMs = GLevelStreamingActorsUpdateTimeLimit;
+		EngineComponentsRegistrationGranularity = GLevelStreamingComponentsRegistrationGranularity;
+		bHasCapturedEngineDefaults = true;
+
+		Governor.EngineDefaults = EngineDefaults;
+		AppliedBudget = EngineDefaults;
+	}
+
+	Governor.AdaptiveSettings = AdaptiveSettings;
+	const FStreamingBudget Budget = Governor.Evaluate(NumPendingLevels);
+
+	UpdateHighPriorityWorld(Budget.bHighPriorityLoading);
+	ApplyBudget(Budget);
+}
+
+void UStreamingBudgetSubsystem::UpdateHighPriorityWorld(bool bHighPriorityLoading)
+{
+	UWorld* World = bHighPriorityLoading ? RequestWorlds.FindRef(Governor.GetActiveRequest().Id).Get() : nullptr;
+	if (HighPriorityWorld.Get() == World)
+	{
+		return;
+	}
+
+	if (AWorldSettings* WorldSettings = HighPriorityWorld.IsValid() ? HighPriorityWorld->GetWorldSettings() : nullptr)
+	{
+		WorldSettings->bHighPriorityLoadingLocal = false;
+	}
+
+	if (AWorldSettings* WorldSettings = World ? World->GetWorldSettings() : nullptr)
+	{
+		WorldSettings->bHighPriorityLoadingLocal = true;
+	}
+
+	HighPriorityWorld = World;
+}
+
+void UStreamingBudgetSubsystem::ApplyBudget(const FStreamingBudget& Budget)
+{
+	if (Budget == AppliedBudget)
+	{
+		return;
+	}
+
+	UE_LOG(LogAncientGame, Verbose, TEXT("Streaming budget: high priority %d, async loading %.1fms, actor update %.1fms (%d pending levels)"),
+		Budget.bHighPriorityLoading, Budget.AsyncLoadingTimeLimitMs, Budget.ActorsUpdateTimeLimitMs, NumPendingLevels);
+
+	GLevelStreamingActorsUpdateTimeLimit = Budget.ActorsUpdateTimeLimitMs;
+	GLevelStreamingComponentsRegistrationGranularity = EngineComponentsRegistrationGranularity;
+	GAsyncLoadingUseFullTimeLimit = Budget.bHighPriorityLoading;
+	GAsyncLoadingTimeLimit = Budget.AsyncLoadingTimeLimitMs;
+
+	AppliedBudget = Budget;
+}
+
+//////////////////////////////////////////////////////////////////////
+// FScopedStreamingBudgetRequest
+
+FScopedStreamingBudgetRequest::FScopedStreamingBudgetRequest(const UObject* WorldContextObject, EStreamingBudgetPriority Priority)
+	: Subsystem(UStreamingBudgetSubsystem::Get())
+{
+	if (Subsystem.IsValid())
+	{
+		Handle = Subsystem->AddRequest(WorldContextObject, Priority);
+	}
+}
+
+FScopedStreamingBudgetRequest::~FScopedStreamingBudgetRequest()
+{
+	if (Subsystem.IsValid())
+	{
+		Subsystem->RemoveRequest(Handle);
+	}
+}
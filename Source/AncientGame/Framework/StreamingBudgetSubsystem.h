@@ -0,0 +1,290 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Tickable.h"
+#include "UObject/ObjectMacros.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+#include "StreamingBudgetSubsystem.generated.h"
+
+class UObject;
+class UWorld;
+
+/** What a streaming budget request wants. When requests compete, the highest priority wins. */
+UENUM(BlueprintType)
+enum class EStreamingBudgetPriority : uint8
+{
+	/** The engine's own budgets */
+	Default,
+
+	/** Gameplay continues while streaming; budgets follow the frame time headroom */
+	SeamlessTraversal,
+
+	/** Gameplay is hidden; streaming takes as much of the frame as it wants */
+	LoadingScreen,
+};
+
+/** The values the governor writes into the engine's streaming globals */
+USTRUCT(BlueprintType)
+struct FStreamingBudget
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loading")
+	bool bHighPriorityLoading = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loading")
+	float AsyncLoadingTimeLimitMs = 5.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loading")
+	float ActorsUpdateTimeLimitMs = 5.f;
+
+	bool operator==(const FStreamingBudget& Other) const
+	{
+		return bHighPriorityLoading == Other.bHighPriorityLoading
+			&& AsyncLoadingTimeLimitMs == Other.AsyncLoadingTimeLimitMs
+			&& ActorsUpdateTimeLimitMs == Other.ActorsUpdateTimeLimitMs;
+	}
+
+	bool operator!=(const FStreamingBudget& Other) const { return !(*this == Other); }
+};
+
+/** Identifies a request made to UStreamingBudgetSubsystem */
+USTRUCT(BlueprintType)
+struct FStreamingBudgetRequestHandle
+{
+	GENERATED_BODY()
+
+	bool IsValid() const { return Id != 0; }
+	void Invalidate() { Id = 0; }
+
+	int32 Id = 0;
+};
+
+/** Tuning for the SeamlessTraversal policy */
+USTRUCT(BlueprintType)
+struct FStreamingBudgetAdaptiveSettings
+{
+	GENERATED_BODY()
+
+	/** Game thread time the game is trying to hold while streaming */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loading")
+	float TargetFrameTimeMs = 16.6f;
+
+	/** How much of the measured headroom streaming may take */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loading", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float HeadroomFraction = 0.75f;
+
+	/** Budget given to streaming even when the frame has no headroom, so the queue always drains */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loading")
+	float MinBudgetMs = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loading")
+	float MaxBudgetMs = 10.f;
+
+	/** Budget while nothing is pending, ready for the next level to be requested */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loading")
+	float IdleBudgetMs = 10.f;
+
+	/** Each pending level above this many raises the budget towards MaxBudgetMs regardless of headroom */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loading")
+	int32 PendingLevelsBeforeBoost = 4;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loading")
+	float BoostPerPendingLevelMs = 0.5f;
+
+	/** Smoothing for the measured frame time, 0 to use the raw value */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loading", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float FrameTimeSmoothing = 0.9f;
+};
+
+/** What streaming has cost since the subsystem started */
+USTRUCT(BlueprintType)
+struct FStreamingBudgetStats
+{
+	GENERATED_BODY()
+
+	/** Streaming levels that finished loading */
+	UPROPERTY(BlueprintReadOnly, Category = "Loading")
+	int32 NumLevelsLoaded = 0;
+
+	/** Time spent with levels pending */
+	UPROPERTY(BlueprintReadOnly, Category = "Loading")
+	float StreamingSeconds = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Loading")
+	int32 NumStreamingFrames = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Loading")
+	float AverageStreamingFrameTimeMs = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Loading")
+	float WorstStreamingFrameTimeMs = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Loading")
+	int32 NumIdleFrames = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Loading")
+	float AverageIdleFrameTimeMs = 0.f;
+
+	float GetLevelsPerSecond() const { return StreamingSeconds > 0.f ? NumLevelsLoaded / StreamingSeconds : 0.f; }
+};
+
+/**
+ * Active requests and the policy they resolve to. Kept free of engine state so the arbitration can be exercised on its own.
+ */
+class FStreamingBudgetGovernor
+{
+public:
+	FStreamingBudgetRequestHandle AddRequest(EStreamingBudgetPriority Priority);
+	FStreamingBudgetRequestHandle AddCustomRequest(EStreamingBudgetPriority Priority, const FStreamingBudget& Budget);
+	bool RemoveRequest(FStreamingBudgetRequestHandle& Handle);
+
+	/** Highest priority wins; the most recent request wins a tie */
+	EStreamingBudgetPriority GetActivePriority() const;
+
+	/** Handle of the winning request, invalid when there are none */
+	FStreamingBudgetRequestHandle GetActiveRequest() const;
+
+	int32 GetNumRequests() const { return Requests.Num(); }
+
+	/** Feeds the game thread time measured while AppliedBudget was in effect into the headroom estimate */
+	void ReportFrameTime(float FrameTimeMs, const FStreamingBudget& AppliedBudget);
+
+	/** Budget for the winning request given the number of levels waiting to stream */
+	FStreamingBudget Evaluate(int32 NumPendingLevels) const;
+
+	/** Smoothed frame time with the streaming budget taken out */
+	float GetGameFrameTimeMs() const { return FMath::Max(GameFrameTimeMs, 0.f); }
+
+	FStreamingBudget EngineDefaults;
+	FStreamingBudgetAdaptiveSettings AdaptiveSettings;
+
+private:
+	struct FRequest
+	{
+		int32 Id;
+		EStreamingBudgetPriority Priority;
+		bool bCustom;
+		FStreamingBudget CustomBudget;
+	};
+
+	const FRequest* FindActiveRequest() const;
+
+	TArray<FRequest> Requests;
+	int32 LastRequestId = 0;
+	float GameFrameTimeMs = -1.f;
+};
+
+/**
+ * Owns the engine's loading and level streaming budgets. They are process wide, so every world shares one set of
+ * prioritized requests; callers state what they want instead of writing the globals themselves, and each frame the
+ * winning request's policy is applied. Requests made for a world go away with it.
+ */
+UCLASS()
+class UStreamingBudgetSubsystem : public UEngineSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem interface
+
+	//~ Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual bool IsTickableWhenPaused() const override { return true; }
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject interface
+
+	static UStreamingBudgetSubsystem* Get();
+
+	/** Lasts until removed or until WorldContextObject's world is cleaned up; without a world, until removed */
+	UFUNCTION(BlueprintCallable, Category = "Loading", meta = (WorldContext = "WorldContextObject"))
+	FStreamingBudgetRequestHandle AddRequest(const UObject* WorldContextObject, EStreamingBudgetPriority Priority);
+
+	/** A request that applies fixed budgets while it is the winning one */
+	UFUNCTION(BlueprintCallable, Category = "Loading", meta = (WorldContext = "WorldContextObject"))
+	FStreamingBudgetRequestHandle AddCustomRequest(const UObject* WorldContextObject, EStreamingBudgetPriority Priority, FStreamingBudget Budget);
+
+	UFUNCTION(BlueprintCallable, Category = "Loading")
+	void RemoveRequest(UPARAM(ref) FStreamingBudgetRequestHandle& Handle);
+
+	UFUNCTION(BlueprintPure, Category = "Loading")
+	EStreamingBudgetPriority GetActivePriority() const { return Governor.GetActivePriority(); }
+
+	UFUNCTION(BlueprintPure, Category = "Loading")
+	FStreamingBudget GetAppliedBudget() const { return AppliedBudget; }
+
+	/** Streaming levels across the game worlds that should be loaded or unloaded but aren't yet; poll this rather than flushing */
+	UFUNCTION(BlueprintPure, Category = "Loading")
+	int32 GetNumPendingLevels() const { return NumPendingLevels; }
+
+	UFUNCTION(BlueprintPure, Category = "Loading")
+	FStreamingBudgetStats GetStats() const { return Stats; }
+
+	UFUNCTION(BlueprintCallable, Category = "Loading")
+	void ResetStats() { Stats = FStreamingBudgetStats(); }
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loading")
+	FStreamingBudgetAdaptiveSettings AdaptiveSettings;
+
+private:
+	friend class ULoadingUtilLibrary;
+
+	FStreamingBudgetRequestHandle TrackRequest(const UObject* WorldContextObject, FStreamingBudgetRequestHandle Handle);
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	int32 CountPendingLevels(int32& OutNumLoadedLevels) const;
+	void UpdateStats(float DeltaTime, int32 NumLoadedLevels);
+
+	/** Resolves the policy and applies it, straight away so a new request doesn't wait for the next tick */
+	void UpdateBudget();
+	void ApplyBudget(const FStreamingBudget& Budget);
+
+	/** Only the winning request's world gets bHighPriorityLoadingLocal */
+	void UpdateHighPriorityWorld(bool bHighPriorityLoading);
+
+	FStreamingBudgetGovernor Governor;
+	FStreamingBudget AppliedBudget;
+	FStreamingBudgetStats Stats;
+
+	int32 NumPendingLevels = 0;
+	int32 LastNumLoadedLevels = -1;
+
+	/** The world each request was made for */
+	TMap<int32, TWeakObjectPtr<UWorld>> RequestWorlds;
+
+	/** The requests made on behalf of the ULoadingUtilLibrary Apply functions, one per world */
+	TMap<TWeakObjectPtr<UWorld>, FStreamingBudgetRequestHandle> LibraryRequests;
+
+	TWeakObjectPtr<UWorld> HighPriorityWorld;
+
+	/** Taken before the first budget is applied, once the config and device profile have had their say */
+	bool bHasCapturedEngineDefaults = false;
+	FStreamingBudget EngineDefaults;
+	float EngineComponentsRegistrationGranularity = 0.f;
+};
+
+/** Removes its request when it goes out of scope */
+class FScopedStreamingBudgetRequest
+{
+public:
+	FScopedStreamingBudgetRequest(const UObject* WorldContextObject, EStreamingBudgetPriority Priority);
+	~FScopedStreamingBudgetRequest();
+
+	FScopedStreamingBudgetRequest(const FScopedStreamingBudgetRequest&) = delete;
+	FScopedStreamingBudgetRequest& operator=(const FScopedStreamingBudgetRequest&) = delete;
+
+private:
+	TWeakObjectPtr<UStreamingBudgetSubsystem> Subsystem;
+	FStreamingBudgetRequestHandle Handle;
+};
@@ -5,6 +5,7 @@
 #include "Abilities/GameplayAbility.h"
 #include "AbilitySystem/AbilityInputBindingComponent.h"
 #include "AbilitySystem/AncientGameAbilityAttributeSet.h"
+#include "AbilitySystem/AttributeSetInitializer.h"
 #include "AbilitySystemComponent.h"
 #include "AncientGame.h"
 #include "AssetRegistry/AssetBundleData.h"
@@ -15,6 +16,7 @@
 #include "Containers/UnrealString.h"
 #include "Delegates/Delegate.h"
 #include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Engine/DataTable.h"
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
@@ -22,12 +24,14 @@
 #include "GameFeaturesSubsystemSettings.h"
 #include "GameFramework/Actor.h"
 #include "HAL/PlatformCrt.h"
+#include "HAL/PlatformTime.h"
 #include "InputAction.h"
 #include "Internationalization/Internationalization.h"
 #include "Internationalization/Text.h"
 #include "Logging/LogCategory.h"
 #include "Logging/LogMacros.h"
 #include "Misc/AssertionMacros.h"
+#include "Misc/Optional.h"
 #include "Templates/ChooseClass.h"
 #include "Templates/SubclassOf.h"
 #include "Trace/Detail/Channel.h"
@@ -54,6 +58,10 @@ void UGameFeatureAction_AddAbilities::OnGameFeatureActivating()
 	{
 		Reset();
 	}
+
+	// Started before the worlds are hooked up so actors already present are queued against it
+	StartAssetPreload();
+
 	Super::OnGameFeatureActivating();
 }
 
@@ -184,6 +192,123 @@ void UGameFeatureAction_AddAbilities::Reset()
 	}
 
 	ComponentRequests.Empty();
+	PendingExtensions.Empty();
+	ResolvedEntries.Empty();
+	bAssetsResolved = false;
+
+	if (AssetPreloadHandle.IsValid())
+	{
+		AssetPreloadHandle->CancelHandle();
+		AssetPreloadHandle.Reset();
+	}
+}
+
+void UGameFeatureAction_AddAbilities::StartAssetPreload()
+{
+	TArray<FSoftObjectPath> AssetsToLoad;
+	for (const FGameFeatureAbilitiesEntry& Entry : AbilitiesList)
+	{
+		for (const FAncientGameAbilityMapping& Ability : Entry.GrantedAbilities)
+		{
+			if (!Ability.AbilityType.IsNull())
+			{
+				AssetsToLoad.AddUnique(Ability.AbilityType.ToSoftObjectPath());
+			}
+			if (!Ability.InputAction.IsNull())
+			{
+				AssetsToLoad.AddUnique(Ability.InputAction.ToSoftObjectPath());
+			}
+		}
+
+		for (const FAncientGameAttributesMapping& Attributes : Entry.GrantedAttributes)
+		{
+			if (!Attributes.AttributeSetType.IsNull())
+			{
+				AssetsToLoad.AddUnique(Attributes.AttributeSetType.ToSoftObjectPath());
+			}
+			if (!Attributes.InitializationData.IsNull())
+			{
+				AssetsToLoad.AddUnique(Attributes.InitializationData.ToSoftObjectPath());
+			}
+		}
+	}
+
+	if (!AssetsToLoad.IsEmpty())
+	{
+		AssetPreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetsToLoad,
+			FStreamableDelegate::CreateUObject(this, &UGameFeatureAction_AddAbilities::OnAssetPreloadCompleted));
+	}
+
+	// Nothing to wait for when everything is already in memory (the completion delegate would only fire next frame)
+	if (!AssetPreloadHandle.IsValid() || AssetPreloadHandle->HasLoadCompleted())
+	{
+		OnAssetPreloadCompleted();
+	}
+}
+
+void UGameFeatureAction_AddAbilities::OnAssetPreloadCompleted()
+{
+	if (bAssetsResolved)
+	{
+		return;
+	}
+
+	ResolvedEntries.Reset(AbilitiesList.Num());
+	for (const FGameFeatureAbilitiesEntry& Entry : AbilitiesList)
+	{
+		FResolvedAbilitiesEntry& ResolvedEntry = ResolvedEntries.AddDefaulted_GetRef();
+		ResolvedEntry.Abilities.Reserve(Entry.GrantedAbilities.Num());
+		ResolvedEntry.Attributes.Reserve(Entry.GrantedAttributes.Num());
+
+		for (const FAncientGameAbilityMapping& Ability : Entry.GrantedAbilities)
+		{
+			if (!Ability.AbilityType.IsNull())
+			{
+				if (UClass* AbilityType = Ability.AbilityType.Get())
+				{
+					ResolvedEntry.Abilities.Add({ AbilityType, Ability.InputAction.Get() });
+				}
+				else
+				{
+					UE_LOG(LogAncientGame, Error, TEXT("Failed to load ability '%s'. It will not be granted."), *Ability.AbilityType.ToString());
+				}
+			}
+		}
+
+		for (const FAncientGameAttributesMapping& Attributes : Entry.GrantedAttributes)
+		{
+			if (!Attributes.AttributeSetType.IsNull())
+			{
+				if (UClass* SetType = Attributes.AttributeSetType.Get())
+				{
+					ResolvedEntry.Attributes.Add({ SetType, Attributes.InitializationData.Get() });
+				}
+				else
+				{
+					UE_LOG(LogAncientGame, Error, TEXT("Failed to load attribute set '%s'. It will not be granted."), *Attributes.AttributeSetType.ToString());
+				}
+			}
+		}
+	}
+	bAssetsResolved = true;
+
+	if (PendingExtensions.IsEmpty())
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FPendingActorExtension> ExtensionsToAdd = MoveTemp(PendingExtensions);
+	for (const FPendingActorExtension& PendingExtension : ExtensionsToAdd)
+	{
+		if (AActor* Actor = PendingExtension.Actor.Get())
+		{
+			AddActorAbilities(Actor, AbilitiesList[PendingExtension.EntryIndex], ResolvedEntries[PendingExtension.EntryIndex]);
+		}
+	}
+
+	UE_LOG(LogAncientGame, Verbose, TEXT("Granted abilities to %d queued actors in %.2fms"), ExtensionsToAdd.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 }
 
 void UGameFeatureAction_AddAbilities::HandleActorExtension(AActor* Actor, FName EventName, int32 EntryIndex)
@@ -193,68 +318,70 @@ void UGameFeatureAction_AddAbilities::HandleActorExtension(AActor* Actor, FName
 		const FGameFeatureAbilitiesEntry& Entry = AbilitiesList[EntryIndex];
 		if (EventName == UGameFrameworkComponentManager::NAME_ExtensionRemoved || EventName == UGameFrameworkComponentManager::NAME_ReceiverRemoved)
 		{
+			PendingExtensions.RemoveAll([Actor](const FPendingActorExtension& PendingExtension) { return PendingExtension.Actor == Actor; });
 			RemoveActorAbilities(Actor);
 		}
 		else if (EventName == UGameFrameworkComponentManager::NAME_ExtensionAdded || EventName == UGameFrameworkComponentManager::NAME_GameActorReady)
 		{
-			AddActorAbilities(Actor, Entry);
+			if (bAssetsResolved)
+			{
+				AddActorAbilities(Actor, Entry, ResolvedEntries[EntryIndex]);
+			}
+			else if (!PendingExtensions.ContainsByPredicate([Actor, EntryIndex](const FPendingActorExtension& PendingExtension) { return PendingExtension.Actor == Actor && PendingExtension.EntryIndex == EntryIndex; }))
+			{
+				PendingExtensions.Add({ Actor, EntryIndex });
+			}
 		}
 	}
 }
 
-void UGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const FGameFeatureAbilitiesEntry& AbilitiesEntry)
+void UGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const FGameFeatureAbilitiesEntry& AbilitiesEntry, const FResolvedAbilitiesEntry& ResolvedEntry)
 {
 	if (UAbilitySystemComponent* AbilitySystemComponent = FindOrAddComponentForActor<UAbilitySystemComponent>(Actor, AbilitiesEntry))
 	{
 		FActorExtensions AddedExtensions;
-		AddedExtensions.Abilities.Reserve(AbilitiesEntry.GrantedAbilities.Num());
-		AddedExtensions.Attributes.Reserve(AbilitiesEntry.GrantedAttributes.Num());
+		AddedExtensions.Abilities.Reserve(ResolvedEntry.Abilities.Num());
+		AddedExtensions.Attributes.Reserve(ResolvedEntry.Attributes.Num());
 
-		for (const FAncientGameAbilityMapping& Ability : AbilitiesEntry.GrantedAbilities)
+		// All of the entry's input bindings go to the input component in one go
+		UAbilityInputBindingComponent* InputComponent = nullptr;
+		TOptional<FAbilityInputBindingUpdateScope> InputBindingUpdate;
+		for (const FResolvedAbilitiesEntry::FAbility& Ability : ResolvedEntry.Abilities)
 		{
-			if (!Ability.AbilityType.IsNull())
-			{
-				FGameplayAbilitySpec NewAbilitySpec(Ability.AbilityType.LoadSynchronous());
-				FGameplayAbilitySpecHandle AbilityHandle = AbilitySystemComponent->GiveAbility(NewAbilitySpec);
+			FGameplayAbilitySpec NewAbilitySpec(Ability.AbilityType);
+			FGameplayAbilitySpecHandle AbilityHandle = AbilitySystemComponent->GiveAbility(NewAbilitySpec);
 
-				if (!Ability.InputAction.IsNull())
+			if (Ability.InputAction)
+			{
+				if (InputComponent == nullptr)
 				{
-					UAbilityInputBindingComponent* InputComponent = FindOrAddComponentForActor<UAbilityInputBindingComponent>(Actor, AbilitiesEntry);
-					if (InputComponent)
-					{
-						InputComponent->SetInputBinding(Ability.InputAction.LoadSynchronous(), AbilityHandle);
-					}
-					else
-					{
-						UE_LOG(LogAncientGame, Error, TEXT("Failed to find/add an ability input binding component to '%s' -- are you sure it's a pawn class?"), *Actor->GetPathName());
-					}
+					InputComponent = FindOrAddComponentForActor<UAbilityInputBindingComponent>(Actor, AbilitiesEntry);
+					InputBindingUpdate.Emplace(InputComponent);
 				}
 
-				AddedExtensions.Abilities.Add(AbilityHandle);
+				if (InputComponent)
+				{
+					InputComponent->SetInputBinding(Ability.InputAction, AbilityHandle);
+				}
+				else
+				{
+					UE_LOG(LogAncientGame, Error, TEXT("Failed to find/add an ability input binding component to '%s' -- are you sure it's a pawn class?"), *Actor->GetPathName());
+				}
 			}
+
+			AddedExtensions.Abilities.Add(AbilityHandle);
 		}
 
-		for (const FAncientGameAttributesMapping& Attributes : AbilitiesEntry.GrantedAttributes)
+		for (const FResolvedAbilitiesEntry::FAttributes& Attributes : ResolvedEntry.Attributes)
 		{
-			if (!Attributes.AttributeSetType.IsNull())
+			UAttributeSet* NewSet = NewObject<UAttributeSet>(AbilitySystemComponent, Attributes.AttributeSetType);
+			if (Attributes.InitializationData)
 			{
-				TSubclassOf<UAncientGameAbilityAttributeSet> SetType = Attributes.AttributeSetType.LoadSynchronous();
-				if (SetType)
-				{
-					UAttributeSet* NewSet = NewObject<UAttributeSet>(AbilitySystemComponent, SetType);
-					if (!Attributes.InitializationData.IsNull())
-					{
-						UDataTable* InitData = Attributes.InitializationData.LoadSynchronous();
-						if (InitData)
-						{
-							NewSet->InitFromMetaDataTable(InitData);
-						}
-					}
-
-					AddedExtensions.Attributes.Add(NewSet);
-					AbilitySystemComponent->AddAttributeSetSubobject(NewSet);
-				}
+				FAncientGameAttributeSetInitializer::InitFromMetaDataTable(NewSet, Attributes.InitializationData);
 			}
+
+			AddedExtensions.Attributes.Add(NewSet);
+			AbilitySystemComponent->AddAttributeSetSubobject(NewSet);
 		}
 
 		ActiveExtensions.Add(Actor, AddedExtensions);
@@ -277,6 +404,7 @@ void UGameFeatureAction_AddAbilities::RemoveActorAbilities(AActor* Actor)
 			}
 
 			UAbilityInputBindingComponent* InputComponent = Actor->FindComponentByClass<UAbilityInputBindingComponent>();
+			FAbilityInputBindingUpdateScope InputBindingUpdate(InputComponent);
 			for (FGameplayAbilitySpecHandle AbilityHandle : ActorExtensions->Abilities)
 			{
 				if (InputComponent)
@@ -9,9 +9,11 @@
 #include "GameplayAbilitySpec.h"
 #include "Templates/Casts.h"
 #include "Templates/SharedPointer.h"
+#include "Templates/SubclassOf.h"
 #include "UObject/NameTypes.h"
 #include "UObject/SoftObjectPtr.h"
 #include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 
 #include "GameFeatureAction_AddAbilities.generated.h"
 
@@ -28,6 +30,7 @@ class UObject;
 struct FAssetBundleData;
 struct FComponentRequestHandle;
 struct FGameFeatureDeactivatingContext;
+struct FStreamableHandle;
 struct FWorldContext;
 
 USTRUCT(BlueprintType)
@@ -111,9 +114,30 @@ private:
 	virtual void AddToWorld(const FWorldContext& WorldContext) override;
 	//~ End UGameFeatureAction_WorldActionBase interface
 
+	/** Soft references of an AbilitiesList entry, resolved once the preload has completed */
+	struct FResolvedAbilitiesEntry
+	{
+		struct FAbility
+		{
+			TSubclassOf<UGameplayAbility> AbilityType;
+			UInputAction* InputAction = nullptr;
+		};
+
+		struct FAttributes
+		{
+			TSubclassOf<UAncientGameAbilityAttributeSet> AttributeSetType;
+			UDataTable* InitializationData = nullptr;
+		};
+
+		TArray<FAbility> Abilities;
+		TArray<FAttributes> Attributes;
+	};
+
 	void Reset();
+	void StartAssetPreload();
+	void OnAssetPreloadCompleted();
 	void HandleActorExtension(AActor* Actor, FName EventName, int32 EntryIndex);
-	void AddActorAbilities(AActor* Actor, const FGameFeatureAbilitiesEntry& AbilitiesEntry);
+	void AddActorAbilities(AActor* Actor, const FGameFeatureAbilitiesEntry& AbilitiesEntry, const FResolvedAbilitiesEntry& ResolvedEntry);
 	void RemoveActorAbilities(AActor* Actor);
 
 	template<class ComponentType>
@@ -132,4 +156,19 @@ private:
 	TMap<AActor*, FActorExtensions> ActiveExtensions;
 
 	TArray<TSharedPtr<FComponentRequestHandle>> ComponentRequests;
+
+	/** Keeps every soft reference in AbilitiesList loaded while the feature is active */
+	TSharedPtr<FStreamableHandle> AssetPreloadHandle;
+
+	/** Parallel to AbilitiesList, filled when the preload completes */
+	TArray<FResolvedAbilitiesEntry> ResolvedEntries;
+	bool bAssetsResolved = false;
+
+	/** Actors that arrived before the preload completed, granted in one batch when it does */
+	struct FPendingActorExtension
+	{
+		TWeakObjectPtr<AActor> Actor;
+		int32 EntryIndex;
+	};
+	TArray<FPendingActorExtension> PendingExtensions;
 };
@@ -11,10 +11,12 @@
 #include "Engine/LevelStreamingDynamic.h"
 #include "Engine/World.h"
 #include "HAL/PlatformCrt.h"
+#include "HAL/PlatformTime.h"
 #include "Internationalization/Internationalization.h"
 #include "Internationalization/Text.h"
 #include "Logging/LogCategory.h"
 #include "Logging/LogMacros.h"
+#include "Math/NumericLimits.h"
 #include "Misc/AssertionMacros.h"
 #include "Trace/Detail/Channel.h"
 #include "UObject/ObjectPtr.h"
@@ -50,8 +52,23 @@ void UGameFeatureAction_AddLevelInstances::OnGameFeatureActivating()
 void UGameFeatureAction_AddLevelInstances::OnGameFeatureDeactivating(FGameFeatureDeactivatingContext& Context)
 {
 	DestroyAddedLevels();
+
+	// Nothing is pending anymore, so let anyone waiting on an activation go on. Take them out first, the callbacks may call back into this action.
+	TArray<FWorldActivation> CancelledActivations = MoveTemp(WorldActivations);
+	WorldActivations.Reset();
+	if (ActivationTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ActivationTickerHandle);
+		ActivationTickerHandle.Reset();
+	}
+
 	bIsActivated = false;
 
+	for (FWorldActivation& Activation : CancelledActivations)
+	{
+		Activation.OnActivated.Broadcast();
+	}
+
 	FWorldDelegates::OnWorldCleanup.RemoveAll(this);
 	Super::OnGameFeatureDeactivating(Context);
 }
@@ -84,45 +101,220 @@ void UGameFeatureAction_AddLevelInstances::AddToWorld(const FWorldContext& World
 
 	if (ensureAlways(bIsActivated) && (GameInstance != nullptr) && (World != nullptr) && World->IsGameWorld())
 	{
+		if (FindActivation(World) == nullptr)
+		{
+			AddedLevels.Reserve(AddedLevels.Num() + LevelInstanceList.Num());
+
+			// Instead of blocking until everything is streamed in, request the levels a budget's worth at a time
+			FWorldActivation& Activation = WorldActivations.AddDefaulted_GetRef();
+			Activation.World = World;
+			Activation.StartTime = FPlatformTime::Seconds();
+			RequestLevelInstances(Activation, ActivationBudgetMs / 1000.0);
+
+			if (!ActivationTickerHandle.IsValid())
+			{
+				ActivationTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UGameFeatureAction_AddLevelInstances::TickActivations));
+			}
+		}
+	}
+}
+
+void UGameFeatureAction_AddLevelInstances::OnWorldCleanup(UWorld* World, bool /*bSessionEnded*/, bool /*bCleanupResources*/)
+{
+	for (int32 Index = AddedLevels.Num() - 1; Index >= 0; --Index)
+	{
+		ULevelStreamingDynamic* Level = AddedLevels[Index];
+		if (Level && Level->GetWorld() == World)
+		{
+			CleanUpAddedLevel(Level);
+			RemoveAddedLevelAt(Index);
+		}
+	}
+
+	// Nothing is pending in this world anymore, so let anyone waiting on its activation go on. Take it out first, like on deactivation.
+	TArray<FWorldActivation> CancelledActivations;
+	for (int32 ActivationIndex = WorldActivations.Num() - 1; ActivationIndex >= 0; --ActivationIndex)
+	{
+		if (WorldActivations[ActivationIndex].World.Get() == World)
+		{
+			CancelledActivations.Add(MoveTemp(WorldActivations[ActivationIndex]));
+			WorldActivations.RemoveAtSwap(ActivationIndex);
+		}
+	}
+
+	for (FWorldActivation& Activation : CancelledActivations)
+	{
+		Activation.OnActivated.Broadcast();
+	}
+}
+
+void UGameFeatureAction_AddLevelInstances::CallOrRegister_OnLevelInstancesActivated(const UWorld* World, FSimpleDelegate Callback)
+{
+	if (FWorldActivation* Activation = FindActivation(World))
+	{
+		Activation->OnActivated.Add(MoveTemp(Callback));
+	}
+	else
+	{
+		Callback.ExecuteIfBound();
+	}
+}
+
+void UGameFeatureAction_AddLevelInstances::FlushLevelInstanceStreaming(UWorld* World)
+{
+	if (FWorldActivation* Activation = FindActivation(World))
+	{
+		RequestLevelInstances(*Activation, TNumericLimits<double>::Max());
+		GEngine->BlockTillLevelStreamingCompleted(World);
+
+		UpdatePendingLevels();
+		CompleteActivations();
+	}
+}
+
+float UGameFeatureAction_AddLevelInstances::GetActivationProgress(const UWorld* World) const
+{
+	const FWorldActivation* Activation = FindActivation(World);
+	if (Activation == nullptr)
+	{
+		return 1.f;
+	}
+
+	// Entries that haven't been requested yet may turn out to be for another world, so this is a lower bound.
+	const int32 NumExpected = Activation->NumRequested + (LevelInstanceList.Num() - Activation->NextEntryIndex);
+	return NumExpected > 0 ? float(Activation->NumRequested - Activation->NumPending) / float(NumExpected) : 1.f;
+}
+
+UGameFeatureAction_AddLevelInstances::FWorldActivation* UGameFeatureAction_AddLevelInstances::FindActivation(const UWorld* World)
+{
+	return WorldActivations.FindByPredicate([World](const FWorldActivation& Activation) { return Activation.World.Get() == World; });
+}
+
+const UGameFeatureAction_AddLevelInstances::FWorldActivation* UGameFeatureAction_AddLevelInstances::FindActivation(const UWorld* World) const
+{
+	return WorldActivations.FindByPredicate([World](const FWorldActivation& Activation) { return Activation.World.Get() == World; });
+}
+
+bool UGameFeatureAction_AddLevelInstances::TickActivations(float DeltaTime)
+{
+	const double BudgetSeconds = ActivationBudgetMs / 1000.0;
+	for (FWorldActivation& Activation : WorldActivations)
+	{
+		RequestLevelInstances(Activation, BudgetSeconds);
+	}
+
+	UpdatePendingLevels();
+	CompleteActivations();
+
+	if (WorldActivations.Num() == 0)
+	{
+		ActivationTickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void UGameFeatureAction_AddLevelInstances::RequestLevelInstances(FWorldActivation& Activation, double BudgetSeconds)
+{
+	UWorld* World = Activation.World.Get();
+	if ((World == nullptr) || (Activation.NextEntryIndex >= LevelInstanceList.Num()))
+	{
+		return;
+	}
+
 #if WITH_EDITOR
-		// Allow resolving of TargetWorld in proper context
-		FTemporaryPlayInEditorIDOverride IDHelper(World->GetPackage()->GetPIEInstanceID());
+	// Allow resolving of TargetWorld in proper context
+	FTemporaryPlayInEditorIDOverride IDHelper(World->GetPackage()->GetPIEInstanceID());
 #endif
-		AddedLevels.Reserve(AddedLevels.Num() + LevelInstanceList.Num());
 
-		for (const FGameFeatureLevelInstanceEntry& Entry : LevelInstanceList)
+	// Only the requests are timed, the loads they start are spread out by level streaming
+	const double StartTime = FPlatformTime::Seconds();
+	double ElapsedSeconds = 0.0;
+
+	while ((Activation.NextEntryIndex < LevelInstanceList.Num()) && (ElapsedSeconds < BudgetSeconds))
+	{
+		const FGameFeatureLevelInstanceEntry& Entry = LevelInstanceList[Activation.NextEntryIndex++];
+		if (!Entry.Level.IsNull())
 		{
-			if (!Entry.Level.IsNull())
+			if (!Entry.TargetWorld.IsNull())
 			{
-				if (!Entry.TargetWorld.IsNull())
+				UWorld* TargetWorld = Entry.TargetWorld.Get();
+				if (TargetWorld != World)
 				{
-					UWorld* TargetWorld = Entry.TargetWorld.Get();
-					if (TargetWorld != World)
-					{
-						// This level is intended for a specific world (not this one)
-						continue;
-					}
+					// This level is intended for a specific world (not this one)
+					continue;
 				}
+			}
 
-				LoadDynamicLevelForEntry(Entry, World);
+			if (ULevelStreamingDynamic* Level = LoadDynamicLevelForEntry(Entry, World))
+			{
+				PendingLevels.Add(Level);
+				++Activation.NumRequested;
+				++Activation.NumPending;
 			}
 		}
+
+		ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
 	}
 
-	GEngine->BlockTillLevelStreamingCompleted(World);
+	Activation.WorstFrameSeconds = FMath::Max(Activation.WorstFrameSeconds, ElapsedSeconds);
 }
 
-void UGameFeatureAction_AddLevelInstances::OnWorldCleanup(UWorld* World, bool /*bSessionEnded*/, bool /*bCleanupResources*/)
+void UGameFeatureAction_AddLevelInstances::UpdatePendingLevels()
 {
-	int32 FoundIndex = AddedLevels.IndexOfByPredicate([World](ULevelStreamingDynamic* InStreamingLevel)
+	for (int32 PendingIndex = PendingLevels.Num() - 1; PendingIndex >= 0; --PendingIndex)
+	{
+		ULevelStreamingDynamic* Level = PendingLevels[PendingIndex];
+
+		const ELevelStreamingState State = Level->GetLevelStreamingState();
+		if (State == ELevelStreamingState::LoadedNotVisible)
+		{
+			Level->SetShouldBeVisible(true);
+		}
+		else if ((State == ELevelStreamingState::LoadedVisible) || (State == ELevelStreamingState::FailedToLoad))
 		{
-			return InStreamingLevel && InStreamingLevel->GetWorld() == World;
-		});
+			if (FWorldActivation* Activation = FindActivation(Level->GetWorld()))
+			{
+				--Activation->NumPending;
+			}
+			PendingLevels.RemoveAtSwap(PendingIndex);
 
-	if (FoundIndex != INDEX_NONE)
+			if (State == ELevelStreamingState::FailedToLoad)
+			{
+				UE_LOG(LogAncientGameFeatures, Error, TEXT("[GameFeatureData %s]: Failed to stream level instance `%s`."), *GetPathNameSafe(this), *Level->GetWorldAssetPackageName());
+
+				if (const int32* AddedIndex = AddedLevelIndices.Find(Level))
+				{
+					CleanUpAddedLevel(Level);
+					RemoveAddedLevelAt(*AddedIndex);
+				}
+			}
+		}
+	}
+}
+
+void UGameFeatureAction_AddLevelInstances::CompleteActivations()
+{
+	for (int32 ActivationIndex = WorldActivations.Num() - 1; ActivationIndex >= 0; --ActivationIndex)
 	{
-		CleanUpAddedLevel(AddedLevels[FoundIndex]);
-		AddedLevels.RemoveAtSwap(FoundIndex);
+		FWorldActivation& Activation = WorldActivations[ActivationIndex];
+		const bool bWorldGone = !Activation.World.IsValid();
+		if (!bWorldGone && ((Activation.NextEntryIndex < LevelInstanceList.Num()) || (Activation.NumPending > 0)))
+		{
+			continue;
+		}
+
+		// Take it out first, the callbacks are free to add or flush level instances
+		FWorldActivation Completed = MoveTemp(Activation);
+		WorldActivations.RemoveAtSwap(ActivationIndex);
+
+		if (!bWorldGone)
+		{
+			UE_LOG(LogAncientGameFeatures, Log, TEXT("[GameFeatureData %s]: Activated %d level instances in %.1fms, worst frame of requests %.2fms (budget %.2fms)."),
+				*GetPathNameSafe(this), Completed.NumRequested, (FPlatformTime::Seconds() - Completed.StartTime) * 1000.0, Completed.WorstFrameSeconds * 1000.0, ActivationBudgetMs);
+		}
+
+		Completed.OnActivated.Broadcast();
 	}
 }
 
@@ -137,7 +329,8 @@ ULevelStreamingDynamic* UGameFeatureAction_AddLevelInstances::LoadDynamicLevelFo
 	}
 	else if (StreamingLevelRef)
 	{
-		AddedLevels.Add(StreamingLevelRef);
+		AddedLevelIndices.Add(StreamingLevelRef, AddedLevels.Add(StreamingLevelRef));
+		StreamingLevelRef->OnLevelLoaded.AddDynamic(this, &UGameFeatureAction_AddLevelInstances::OnLevelLoaded);
 	}
 
 	return StreamingLevelRef;
@@ -147,14 +340,8 @@ void UGameFeatureAction_AddLevelInstances::OnLevelLoaded()
 {
 	if (ensureAlways(bIsActivated))
 	{
-		// We don't have a way of knowing which instance this was triggered for, so we have to look through them all...
-		for (ULevelStreamingDynamic* Level : AddedLevels)
-		{
-			if (Level && Level->GetLevelStreamingState() == ELevelStreamingState::LoadedNotVisible)
-			{
-				Level->SetShouldBeVisible(true);
-			}
-		}
+		// We don't have a way of knowing which instance this was triggered for, but only the pending ones can need it
+		UpdatePendingLevels();
 	}
 }
 
@@ -165,6 +352,28 @@ void UGameFeatureAction_AddLevelInstances::DestroyAddedLevels()
 		CleanUpAddedLevel(Level);
 	}
 	AddedLevels.Empty();
+	AddedLevelIndices.Empty();
+	PendingLevels.Empty();
+}
+
+void UGameFeatureAction_AddLevelInstances::RemoveAddedLevelAt(int32 Index)
+{
+	ULevelStreamingDynamic* Level = AddedLevels[Index];
+	AddedLevelIndices.Remove(Level);
+
+	if (PendingLevels.RemoveSingleSwap(Level) > 0)
+	{
+		if (FWorldActivation* Activation = FindActivation(Level->GetWorld()))
+		{
+			--Activation->NumPending;
+		}
+	}
+
+	AddedLevels.RemoveAtSwap(Index);
+	if (AddedLevels.IsValidIndex(Index))
+	{
+		AddedLevelIndices.Add(AddedLevels[Index], Index);
+	}
 }
 
 void UGameFeatureAction_AddLevelInstances::CleanUpAddedLevel(ULevelStreamingDynamic* Level)
@@ -3,12 +3,16 @@
 #pragma once
 
 #include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/Ticker.h"
+#include "Delegates/Delegate.h"
 #include "GameFeatureAction_WorldActionBase.h"
 #include "Math/MathFwd.h"
 #include "Math/Rotator.h"
 #include "Math/Vector.h"
 #include "UObject/SoftObjectPtr.h"
 #include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 
 #include "GameFeatureAction_AddLevelInstances.generated.h"
 
@@ -70,6 +74,25 @@ public:
 	UPROPERTY(EditAnywhere, Category="Level Instances", meta=(TitleProperty="Level", ShowOnlyInnerProperties))
 	TArray<FGameFeatureLevelInstanceEntry> LevelInstanceList;
 
+	/**
+	 * Game thread time per frame spent requesting level instances while activating. At least one is requested per frame.
+	 * This only meters the requests: loading and adding the levels to the world goes through level streaming, under its own time limits.
+	 */
+	UPROPERTY(EditAnywhere, Category="Level Instances", meta=(ClampMin="0.1", Units="ms"))
+	float ActivationBudgetMs = 2.f;
+
+	/**
+	 * Calls Callback once every level instance this action adds to World is visible, or right away if none are pending.
+	 * Also called if the game feature is deactivated or World is cleaned up first, in which case the levels are gone.
+	 */
+	void CallOrRegister_OnLevelInstancesActivated(const UWorld* World, FSimpleDelegate Callback);
+
+	/** Requests any remaining level instances for World and blocks until they are streamed in, for callers that can't go on without them. */
+	void FlushLevelInstanceStreaming(UWorld* World);
+
+	/** Fraction of World's level instances that are visible, 1 when nothing is pending. */
+	float GetActivationProgress(const UWorld* World) const;
+
 private:
 	//~ Begin UGameFeatureAction_WorldActionBase interface
 	virtual void AddToWorld(const FWorldContext& WorldContext) override;
@@ -84,11 +107,46 @@ private:
 
 	void DestroyAddedLevels();
 	void CleanUpAddedLevel(ULevelStreamingDynamic* Level);
+	void RemoveAddedLevelAt(int32 Index);
+
+	/** Activation of the level instances in one world, spread over several frames */
+	struct FWorldActivation
+	{
+		TWeakObjectPtr<UWorld> World;
+
+		/** Entries of LevelInstanceList before this one have been requested */
+		int32 NextEntryIndex = 0;
+		int32 NumRequested = 0;
+		/** Requested but not yet visible */
+		int32 NumPending = 0;
+
+		double StartTime = 0.0;
+		double WorstFrameSeconds = 0.0;
+
+		FSimpleMulticastDelegate OnActivated;
+	};
+
+	FWorldActivation* FindActivation(const UWorld* World);
+	const FWorldActivation* FindActivation(const UWorld* World) const;
+
+	bool TickActivations(float DeltaTime);
+	void RequestLevelInstances(FWorldActivation& Activation, double BudgetSeconds);
+	void UpdatePendingLevels();
+	void CompleteActivations();
 
 private:
 	UPROPERTY(transient)
 	TArray<ULevelStreamingDynamic*> AddedLevels;
 
+	/** Index of each level in AddedLevels */
+	TMap<const ULevelStreamingDynamic*, int32> AddedLevelIndices;
+
+	/** Added levels that are not visible yet. AddedLevels keeps them alive. */
+	TArray<ULevelStreamingDynamic*> PendingLevels;
+
+	TArray<FWorldActivation> WorldActivations;
+	FTSTicker::FDelegateHandle ActivationTickerHandle;
+
 	bool bIsActivated = false;
 	bool bLayerStateReentrantGuard = false;
 };
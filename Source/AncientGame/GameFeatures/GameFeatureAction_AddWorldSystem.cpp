@@ -79,14 +79,7 @@ UGameFeatureWorldSystem* UGameFeatureAction_AddWorldSystem::FindGameFeatureWorld
 		{
 			if (UGameFeatureWorldSystemManager* SystemManager = World->GetSubsystem<UGameFeatureWorldSystemManager>())
 			{
-				for (auto& WorldSystem : SystemManager->SystemInstances)
-				{
-					if (WorldSystem.Key && WorldSystem.Key->GetClass() == SystemType)
-					{
-						WorldSystemInst = WorldSystem.Key;
-						break;
-					}
-				}
+				WorldSystemInst = SystemManager->GetSystemOfExactType(SystemType);
 			}
 		}
 	}
@@ -162,7 +155,7 @@ void UGameFeatureWorldSystemManager::PostInitialize()
 {
 	for (auto& PreExistingInstance : SystemInstances)
 	{
-		PreExistingInstance.Key->Initialize(GetWorld());
+		PreExistingInstance.Value.System->Initialize(GetWorld());
 	}
 
 	bIsInitialized = true;
@@ -173,41 +166,79 @@ bool UGameFeatureWorldSystemManager::DoesSupportWorldType(EWorldType::Type World
 	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
 }
 
-UGameFeatureWorldSystem* UGameFeatureWorldSystemManager::RequestSystemOfType(TSubclassOf<UGameFeatureWorldSystem> SystemType)
+UGameFeatureWorldSystem* UGameFeatureWorldSystemManager::GetSystemOfType(TSubclassOf<UGameFeatureWorldSystem> SystemType) const
 {
-	for (auto& PreExistingInstance : SystemInstances)
+	const UClass* SystemClass = SystemType.Get();
+	if (SystemClass == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (UGameFeatureWorldSystem* const* ResolvedSystem = ResolvedSystems.Find(SystemClass))
+	{
+		return *ResolvedSystem;
+	}
+
+	// Prefer the exact class, then the oldest subclass. The map's order changes as systems come and go, so it can't pick.
+	UGameFeatureWorldSystem* System = nullptr;
+	if (const FGameFeatureWorldSystemInstance* Instance = SystemInstances.Find(SystemClass))
 	{
-		if (PreExistingInstance.Key->GetClass() == SystemType)
+		System = Instance->System;
+	}
+	else
+	{
+		int32 OldestRegistrationOrder = MAX_int32;
+		for (const auto& PreExistingInstance : SystemInstances)
 		{
-			PreExistingInstance.Value += 1;
-			return PreExistingInstance.Key;
+			if (PreExistingInstance.Key->IsChildOf(SystemClass) && (PreExistingInstance.Value.RegistrationOrder < OldestRegistrationOrder))
+			{
+				System = PreExistingInstance.Value.System;
+				OldestRegistrationOrder = PreExistingInstance.Value.RegistrationOrder;
+			}
 		}
 	}
 
-	UGameFeatureWorldSystem* NewWorldSystem = NewObject<UGameFeatureWorldSystem>(GetWorld(), SystemType);
-	SystemInstances.Add(NewWorldSystem, 1);
+	ResolvedSystems.Add(SystemClass, System);
+	return System;
+}
+
+UGameFeatureWorldSystem* UGameFeatureWorldSystemManager::GetSystemOfExactType(TSubclassOf<UGameFeatureWorldSystem> SystemType) const
+{
+	const FGameFeatureWorldSystemInstance* Instance = SystemInstances.Find(SystemType.Get());
+	return Instance ? Instance->System : nullptr;
+}
 
-	if (bIsInitialized)
+UGameFeatureWorldSystem* UGameFeatureWorldSystemManager::RequestSystemOfType(TSubclassOf<UGameFeatureWorldSystem> SystemType)
+{
+	FGameFeatureWorldSystemInstance& Instance = SystemInstances.FindOrAdd(SystemType.Get());
+	Instance.RequestCount += 1;
+
+	if (Instance.System == nullptr)
 	{
-		NewWorldSystem->Initialize(GetWorld());
+		UGameFeatureWorldSystem* NewWorldSystem = NewObject<UGameFeatureWorldSystem>(GetWorld(), SystemType);
+		Instance.System = NewWorldSystem;
+		Instance.RegistrationOrder = NextRegistrationOrder++;
+		ResolvedSystems.Reset();
+
+		if (bIsInitialized)
+		{
+			NewWorldSystem->Initialize(GetWorld());
+		}
 	}
 
-	return NewWorldSystem;
+	return Instance.System;
 }
 
 void UGameFeatureWorldSystemManager::ReleaseRequestForSystemOfType(TSubclassOf<UGameFeatureWorldSystem> SystemType)
 {
-	for (auto& PreExistingInstance : SystemInstances)
+	if (FGameFeatureWorldSystemInstance* Instance = SystemInstances.Find(SystemType.Get()))
 	{
-		if (PreExistingInstance.Key->GetClass() == SystemType)
-		{
-			PreExistingInstance.Value -= 1;
+		Instance->RequestCount -= 1;
 
-			if (PreExistingInstance.Value <= 0)
-			{
-				SystemInstances.Remove(PreExistingInstance.Key);
-			}
-			break;
+		if (Instance->RequestCount <= 0)
+		{
+			SystemInstances.Remove(SystemType.Get());
+			ResolvedSystems.Reset();
 		}
 	}
 }
@@ -6,10 +6,13 @@
 #include "Containers/Map.h"
 #include "CoreTypes.h"
 #include "Engine/EngineTypes.h"
+#include "Engine/World.h"
 #include "GameFeatureAction_WorldActionBase.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Templates/SubclassOf.h"
+#include "Templates/UnrealTypeTraits.h"
 #include "UObject/Object.h"
+#include "UObject/ObjectPtr.h"
 #include "UObject/SoftObjectPtr.h"
 #include "UObject/UObjectGlobals.h"
 
@@ -85,6 +88,21 @@ private:
 	void Reset();
 };
 
+/** A system instance and the number of game features requesting it. */
+USTRUCT()
+struct FGameFeatureWorldSystemInstance
+{
+	GENERATED_BODY()
+
+	UPROPERTY(transient)
+	TObjectPtr<UGameFeatureWorldSystem> System = nullptr;
+
+	int32 RequestCount = 0;
+
+	/** When the system was created relative to the others, lower is older */
+	int32 RegistrationOrder = 0;
+};
+
 /** 
  * C++ WorldSubsystem to manage requested system instances 
  * (ref counts requests to account for multiple feature requesting the same system). 
@@ -99,14 +117,45 @@ class UGameFeatureWorldSystemManager : public UWorldSubsystem
 	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
 	//~ End UWorldSubsystem interface
 
+public:
+	/** Returns the system of exactly SystemType if there is one, otherwise the oldest system deriving from it. */
+	UGameFeatureWorldSystem* GetSystemOfType(TSubclassOf<UGameFeatureWorldSystem> SystemType) const;
+
+	/** Returns the system of exactly SystemType, ignoring subclasses. */
+	UGameFeatureWorldSystem* GetSystemOfExactType(TSubclassOf<UGameFeatureWorldSystem> SystemType) const;
+
+	template<class T>
+	T* GetSystem() const
+	{
+		static_assert(TIsDerivedFrom<T, UGameFeatureWorldSystem>::IsDerived, "T must derive from UGameFeatureWorldSystem");
+
+		// Resolution only ever returns systems deriving from the requested class
+		return static_cast<T*>(GetSystemOfType(T::StaticClass()));
+	}
+
+	template<class T>
+	static T* GetSystemForWorld(const UObject* WorldContextObject)
+	{
+		const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+		const UGameFeatureWorldSystemManager* SystemManager = World ? World->GetSubsystem<UGameFeatureWorldSystemManager>() : nullptr;
+		return SystemManager ? SystemManager->GetSystem<T>() : nullptr;
+	}
+
 private:
 	friend class UGameFeatureAction_AddWorldSystem;
 
 	UGameFeatureWorldSystem* RequestSystemOfType(TSubclassOf<UGameFeatureWorldSystem> SystemType);
 	void ReleaseRequestForSystemOfType(TSubclassOf<UGameFeatureWorldSystem> SystemType);
 
+	/** Requested systems, keyed by their exact class */
 	UPROPERTY(transient)
-	TMap<UGameFeatureWorldSystem*, int32> SystemInstances;
+	TMap<TObjectPtr<UClass>, FGameFeatureWorldSystemInstance> SystemInstances;
+
+	/** GetSystemOfType results per queried class, including misses. Cleared whenever a system is added or removed. */
+	mutable TMap<const UClass*, UGameFeatureWorldSystem*> ResolvedSystems;
+
+	/** RegistrationOrder of the next system created */
+	int32 NextRegistrationOrder = 0;
 
 	bool bIsInitialized = false;
 };
\ No newline at end of file
@@ -0,0 +1,235 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Abilities/GameplayAbility.h"
+#include "AbilitySystem/AbilityInputBindingComponent.h"
+#include "AbilitySystemComponent.h"
+#include "AncientGameTestWorld.h"
+#include "Containers/Set.h"
+#include "Containers/Ticker.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "EnhancedInputComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+#include "InputAction.h"
+#include "Misc/Optional.h"
+#include "ModularPawn.h"
+#include "Templates/Function.h"
+#include "UObject/Package.h"
+
+namespace AbilityInputBindingTests
+{
+	static void TickFrames(FAncientGameTestWorld& World, int32 NumFrames)
+	{
+		constexpr float DeltaTime = 1.f / 60.f;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			World.Tick(DeltaTime);
+			FTSTicker::GetCoreTicker().Tick(DeltaTime);
+		}
+	}
+
+	/** Everything between the binding component and Enhanced Input: a local player possessing a pawn with an ability system */
+	struct FLocalPlayerPawn
+	{
+		UGameInstance* GameInstance = nullptr;
+		APlayerController* PlayerController = nullptr;
+		AModularPawn* Pawn = nullptr;
+		UAbilitySystemComponent* AbilitySystemComponent = nullptr;
+		UAbilityInputBindingComponent* BindingComponent = nullptr;
+
+		explicit FLocalPlayerPawn(UWorld* World)
+		{
+			GameInstance = NewObject<UGameInstance>(GEngine);
+			if (FWorldContext* WorldContext = GEngine->GetWorldContextFromWorld(World))
+			{
+				WorldContext->OwningGameInstance = GameInstance;
+			}
+			World->SetGameInstance(GameInstance);
+			GameInstance->Init();
+
+			FString Error;
+			ULocalPlayer* LocalPlayer = GameInstance->CreateLocalPlayer(0, Error, false);
+
+			PlayerController = World->SpawnActor<APlayerController>();
+			PlayerController->SetPlayer(LocalPlayer);
+
+			Pawn = World->SpawnActor<AModularPawn>();
+			AbilitySystemComponent = NewObject<UAbilitySystemComponent>(Pawn);
+			AbilitySystemComponent->RegisterComponent();
+			BindingComponent = NewObject<UAbilityInputBindingComponent>(Pawn);
+			BindingComponent->RegisterComponent();
+
+			// Restarting the pawn gives it an input component and sets up the binding component's controls
+			PlayerController->Possess(Pawn);
+		}
+
+		~FLocalPlayerPawn()
+		{
+			PlayerController->UnPossess();
+			GameInstance->Shutdown();
+		}
+
+		int32 GetNumActionBindings() const
+		{
+			const UEnhancedInputComponent* InputComponent = Cast<UEnhancedInputComponent>(Pawn->InputComponent);
+			return InputComponent ? InputComponent->GetActionEventBindings().Num() : 0;
+		}
+
+		/** Binding handles are never reused, so comparing them tells which bindings were added and removed */
+		TSet<uint32> GetActionBindingHandles() const
+		{
+			TSet<uint32> Handles;
+			if (const UEnhancedInputComponent* InputComponent = Cast<UEnhancedInputComponent>(Pawn->InputComponent))
+			{
+				for (const TUniquePtr<FEnhancedInputActionEventBinding>& Binding : InputComponent->GetActionEventBindings())
+				{
+					Handles.Add(Binding->GetHandle());
+				}
+			}
+			return Handles;
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbilityInputBindingBatchRebindTest, "AncientGame.AbilitySystem.AbilityInputBinding.BatchRebind", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Swaps the abilities bound to a set of input actions, once one at a time and once batched, and counts the input
+ * component bindings added and removed each way. Batched, every action keeps its bindings.
+ */
+bool FAbilityInputBindingBatchRebindTest::RunTest(const FString& Parameters)
+{
+	using namespace AbilityInputBindingTests;
+
+	constexpr int32 NumActions = 100;
+	constexpr int32 NumSettleFrames = 3;
+
+	FAncientGameTestWorld World;
+	FLocalPlayerPawn LocalPlayerPawn(World.Get());
+
+	if (!TestNotNull(TEXT("Input component"), LocalPlayerPawn.Pawn->InputComponent.Get()))
+	{
+		return false;
+	}
+
+	UAbilityInputBindingComponent* Component = LocalPlayerPawn.BindingComponent;
+	UAbilitySystemComponent* AbilitySystemComponent = LocalPlayerPawn.AbilitySystemComponent;
+
+	TArray<UInputAction*> InputActions;
+	TArray<FGameplayAbilitySpecHandle> FirstAbilityHandles;
+	TArray<FGameplayAbilitySpecHandle> SecondAbilityHandles;
+	for (int32 ActionIndex = 0; ActionIndex < NumActions; ++ActionIndex)
+	{
+		InputActions.Add(NewObject<UInputAction>(GetTransientPackage()));
+		FirstAbilityHandles.Add(AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(UGameplayAbility::StaticClass())));
+		SecondAbilityHandles.Add(AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(UGameplayAbility::StaticClass())));
+	}
+
+	// Whatever possession set up is out of the way before counting
+	TickFrames(World, NumSettleFrames);
+	const int32 NumBaseBindings = LocalPlayerPawn.GetNumActionBindings();
+
+	auto CountBoundAbilities = [&](const TArray<FGameplayAbilitySpecHandle>& AbilityHandles)
+	{
+		int32 NumBound = 0;
+		for (FGameplayAbilitySpecHandle AbilityHandle : AbilityHandles)
+		{
+			const FGameplayAbilitySpec* AbilitySpec = AbilitySystemComponent->FindAbilitySpecFromHandle(AbilityHandle);
+			NumBound += (AbilitySpec && AbilitySpec->InputID != 0) ? 1 : 0;
+		}
+		return NumBound;
+	};
+
+	/** Runs Update, batched or not, and returns the number of input component bindings it added and removed */
+	auto CountBindingChanges = [&](bool bBatched, TFunctionRef<void()> Update, double& OutSeconds)
+	{
+		const TSet<uint32> HandlesBefore = LocalPlayerPawn.GetActionBindingHandles();
+
+		const double StartTime = FPlatformTime::Seconds();
+		{
+			TOptional<FAbilityInputBindingUpdateScope> UpdateScope;
+			if (bBatched)
+			{
+				UpdateScope.Emplace(Component);
+			}
+
+			Update();
+		}
+		OutSeconds = FPlatformTime::Seconds() - StartTime;
+
+		const TSet<uint32> HandlesAfter = LocalPlayerPawn.GetActionBindingHandles();
+		TickFrames(World, NumSettleFrames);
+
+		return TPair<int32, int32>(HandlesAfter.Difference(HandlesBefore).Num(), HandlesBefore.Difference(HandlesAfter).Num());
+	};
+
+	auto SwapAbilities = [&](const TArray<FGameplayAbilitySpecHandle>& From, const TArray<FGameplayAbilitySpecHandle>& To)
+	{
+		for (int32 ActionIndex = 0; ActionIndex < NumActions; ++ActionIndex)
+		{
+			Component->ClearInputBinding(From[ActionIndex]);
+			Component->SetInputBinding(InputActions[ActionIndex], To[ActionIndex]);
+		}
+	};
+
+	double Seconds = 0.0;
+	TPair<int32, int32> Changes = CountBindingChanges(false, [&]()
+	{
+		for (int32 ActionIndex = 0; ActionIndex < NumActions; ++ActionIndex)
+		{
+			Component->SetInputBinding(InputActions[ActionIndex], FirstAbilityHandles[ActionIndex]);
+		}
+	}, Seconds);
+
+	TestEqual(TEXT("Every first ability bound"), CountBoundAbilities(FirstAbilityHandles), NumActions);
+	TestEqual(TEXT("Pressed and released bound for every action"), Changes.Key, 2 * NumActions);
+	TestEqual(TEXT("Nothing removed binding new actions"), Changes.Value, 0);
+
+	double UnbatchedSeconds = 0.0;
+	Changes = CountBindingChanges(false, [&]() { SwapAbilities(FirstAbilityHandles, SecondAbilityHandles); }, UnbatchedSeconds);
+
+	TestEqual(TEXT("One at a time: every second ability bound"), CountBoundAbilities(SecondAbilityHandles), NumActions);
+	TestEqual(TEXT("One at a time: every first ability unbound"), CountBoundAbilities(FirstAbilityHandles), 0);
+	TestEqual(TEXT("One at a time: every action rebound"), Changes.Key, 2 * NumActions);
+	TestEqual(TEXT("One at a time: every old binding removed"), Changes.Value, 2 * NumActions);
+
+	double BatchedSeconds = 0.0;
+	Changes = CountBindingChanges(true, [&]() { SwapAbilities(SecondAbilityHandles, FirstAbilityHandles); }, BatchedSeconds);
+
+	TestEqual(TEXT("Batched: every first ability bound"), CountBoundAbilities(FirstAbilityHandles), NumActions);
+	TestEqual(TEXT("Batched: every second ability unbound"), CountBoundAbilities(SecondAbilityHandles), 0);
+	TestEqual(TEXT("Batched: no action rebound"), Changes.Key, 0);
+	TestEqual(TEXT("Batched: no binding removed"), Changes.Value, 0);
+	TestEqual(TEXT("Pressed and released still bound once for every action"), LocalPlayerPawn.GetNumActionBindings(), NumBaseBindings + 2 * NumActions);
+
+	AddInfo(FString::Printf(TEXT("%d input actions swapped to other abilities: one at a time %.3fms, batched %.3fms"),
+		NumActions, UnbatchedSeconds * 1000.0, BatchedSeconds * 1000.0));
+
+	Changes = CountBindingChanges(true, [&]()
+	{
+		for (FGameplayAbilitySpecHandle AbilityHandle : FirstAbilityHandles)
+		{
+			Component->ClearInputBinding(AbilityHandle);
+		}
+	}, Seconds);
+
+	TestEqual(TEXT("Every ability unbound"), CountBoundAbilities(FirstAbilityHandles), 0);
+	TestEqual(TEXT("Nothing bound clearing"), Changes.Key, 0);
+	TestEqual(TEXT("Cleared actions removed by the commit"), Changes.Value, 2 * NumActions);
+	TestEqual(TEXT("Back to the bindings possession set up"), LocalPlayerPawn.GetNumActionBindings(), NumBaseBindings);
+
+	for (int32 ActionIndex = 0; ActionIndex < NumActions; ++ActionIndex)
+	{
+		AbilitySystemComponent->ClearAbility(FirstAbilityHandles[ActionIndex]);
+		AbilitySystemComponent->ClearAbility(SecondAbilityHandles[ActionIndex]);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,135 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AncientGameTestWorld.h"
+#include "Camera/AncientGameCameraMode.h"
+#include "Camera/AncientGameCameraModeStack.h"
+#include "Camera/AncientGameCameraModeView.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+
+namespace AncientGameCameraModeStackTests
+{
+	/** A bare actor with a movable root, so it has a transform for the modes to pivot on */
+	static AActor* SpawnTarget(UWorld* World, const FVector& Location, const FRotator& Rotation)
+	{
+		AActor* TargetActor = World->SpawnActor<AActor>();
+		if (TargetActor)
+		{
+			USceneComponent* Root = NewObject<USceneComponent>(TargetActor, TEXT("Root"));
+			TargetActor->SetRootComponent(Root);
+			Root->RegisterComponent();
+			TargetActor->SetActorLocationAndRotation(Location, Rotation);
+		}
+		return TargetActor;
+	}
+
+	/** Pushes NumModes default camera modes, giving each some weight so the ones below it still contribute */
+	static TArray<UAncientGameCameraMode*> PushBlendingModes(FAncientGameCameraModeStack& Stack, AActor* TargetActor, int32 NumModes)
+	{
+		TArray<UAncientGameCameraMode*> CameraModes;
+		for (int32 ModeIndex = 0; ModeIndex < NumModes; ++ModeIndex)
+		{
+			UAncientGameCameraMode* CameraMode = NewObject<UAncientGameCameraMode>(GetTransientPackage());
+			CameraModes.Add(CameraMode);
+			Stack.PushCameraMode(CameraMode, TargetActor);
+
+			FAncientGameCameraModeView View;
+			Stack.EvaluateStack(0.05f, TargetActor, View);
+		}
+		return CameraModes;
+	}
+
+	static void ReleaseModes(const TArray<UAncientGameCameraMode*>& CameraModes)
+	{
+		for (UAncientGameCameraMode* CameraMode : CameraModes)
+		{
+			CameraMode->MarkAsGarbage();
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAncientGameCameraModeStackBlendTest, "AncientGame.Camera.ModeStack.Blend", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Default modes share the target's pivot, so blending any number of them gives that pivot back */
+bool FAncientGameCameraModeStackBlendTest::RunTest(const FString& Parameters)
+{
+	using namespace AncientGameCameraModeStackTests;
+
+	FAncientGameTestWorld World;
+
+	const FVector TargetLocation(100.f, -250.f, 40.f);
+	const FRotator TargetRotation(20.f, 75.f, 0.f);
+	AActor* TargetActor = SpawnTarget(World.Get(), TargetLocation, TargetRotation);
+	if (!TestNotNull(TEXT("Target actor"), TargetActor))
+	{
+		return false;
+	}
+
+	FAncientGameCameraModeStack Stack;
+	FAncientGameCameraModeView View;
+	TestFalse(TEXT("Empty stack has no view"), Stack.EvaluateStack(0.1f, TargetActor, View));
+
+	const TArray<UAncientGameCameraMode*> CameraModes = PushBlendingModes(Stack, TargetActor, 4);
+
+	TestTrue(TEXT("Blending stack evaluates"), Stack.EvaluateStack(0.01f, TargetActor, View));
+	TestEqual(TEXT("Pivot location"), View.PivotLocation, TargetLocation);
+	TestEqual(TEXT("Camera location"), View.Location, TargetLocation);
+	TestTrue(FString::Printf(TEXT("Camera rotation %s"), *View.Rotation.ToString()), View.Rotation.Equals(TargetRotation, KINDA_SMALL_NUMBER));
+
+	// Once the top mode has fully blended in, the target moving is picked up straight away
+	Stack.EvaluateStack(1.f, TargetActor, View);
+	const FVector MovedLocation(-300.f, 10.f, 0.f);
+	TargetActor->SetActorLocation(MovedLocation);
+	Stack.EvaluateStack(0.01f, TargetActor, View);
+	TestEqual(TEXT("Pivot follows the target"), View.PivotLocation, MovedLocation);
+
+	ReleaseModes(CameraModes);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAncientGameCameraModeStackBenchmark, "AncientGame.Camera.ModeStack.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+/** Logs the time to evaluate a stack of default camera modes, all blending */
+bool FAncientGameCameraModeStackBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AncientGameCameraModeStackTests;
+
+	constexpr int32 NumModes = 8;
+	constexpr int32 NumUpdates = 1000;
+
+	FAncientGameTestWorld World;
+	AActor* TargetActor = SpawnTarget(World.Get(), FVector::ZeroVector, FRotator::ZeroRotator);
+	if (!TestNotNull(TEXT("Target actor"), TargetActor))
+	{
+		return false;
+	}
+
+	FAncientGameCameraModeStack Stack;
+	const TArray<UAncientGameCameraMode*> CameraModes = PushBlendingModes(Stack, TargetActor, NumModes);
+
+	// Short enough that no mode finishes blending in, so every mode stays on the stack
+	const float DeltaTime = 0.1f / NumUpdates;
+
+	FAncientGameCameraModeView View;
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Update = 0; Update < NumUpdates; ++Update)
+	{
+		Stack.EvaluateStack(DeltaTime, TargetActor, View);
+	}
+	const double Duration = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("%d camera modes x %d updates: %.3fms"), NumModes, NumUpdates, Duration * 1000.0));
+
+	ReleaseModes(CameraModes);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,118 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystem/AttributeSetInitializer.h"
+#include "AttributeSet.h"
+#include "Character/MovementAttributeSet.h"
+#include "Engine/DataTable.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+namespace AttributeSetInitializerTests
+{
+	static const FName MoveSpeedRowName(TEXT("MovementAttributeSet.MoveSpeed"));
+
+	/** A transient attribute table with a row for UMovementAttributeSet, plus one nothing reads */
+	static UDataTable* MakeDataTable(float MoveSpeed)
+	{
+		UDataTable* DataTable = NewObject<UDataTable>(GetTransientPackage());
+		DataTable->RowStruct = FAttributeMetaData::StaticStruct();
+
+		FAttributeMetaData MoveSpeedRow;
+		MoveSpeedRow.BaseValue = MoveSpeed;
+		DataTable->AddRow(MoveSpeedRowName, MoveSpeedRow);
+
+		FAttributeMetaData UnusedRow;
+		UnusedRow.BaseValue = 1.f;
+		DataTable->AddRow(TEXT("MovementAttributeSet.Unused"), UnusedRow);
+
+		return DataTable;
+	}
+
+	/** Properties that differ between a set initialized through reflection and one initialized through the compiled initializer */
+	static int32 CountMismatches(FAutomationTestBase& Test, UClass* AttributeSetClass, const UDataTable* DataTable)
+	{
+		UAttributeSet* ReflectedSet = NewObject<UAttributeSet>(GetTransientPackage(), AttributeSetClass);
+		ReflectedSet->InitFromMetaDataTable(DataTable);
+
+		UAttributeSet* CompiledSet = NewObject<UAttributeSet>(GetTransientPackage(), AttributeSetClass);
+		FAncientGameAttributeSetInitializer::InitFromMetaDataTable(CompiledSet, DataTable);
+
+		int32 NumMismatches = 0;
+		for (TFieldIterator<FProperty> It(AttributeSetClass, EFieldIteratorFlags::IncludeSuper); It; ++It)
+		{
+			if (!It->Identical_InContainer(ReflectedSet, CompiledSet))
+			{
+				Test.AddError(FString::Printf(TEXT("%s.%s differs"), *AttributeSetClass->GetName(), *It->GetName()));
+				++NumMismatches;
+			}
+		}
+		return NumMismatches;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeSetInitializerMatchTest, "AncientGame.AbilitySystem.AttributeSetInitializer.MatchesReflection", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** The compiled initializer leaves a set exactly as UAttributeSet::InitFromMetaDataTable does, including after the table changes */
+bool FAttributeSetInitializerMatchTest::RunTest(const FString& Parameters)
+{
+	using namespace AttributeSetInitializerTests;
+
+	FAncientGameAttributeSetInitializerCache& Cache = FAncientGameAttributeSetInitializerCache::Get();
+	UClass* AttributeSetClass = UMovementAttributeSet::StaticClass();
+	UDataTable* DataTable = MakeDataTable(725.f);
+
+	const int32 NumCompiledBefore = Cache.GetNumCompiled();
+	TestEqual(TEXT("Same as reflection"), CountMismatches(*this, AttributeSetClass, DataTable), 0);
+	TestEqual(TEXT("Same as reflection from the cache"), CountMismatches(*this, AttributeSetClass, DataTable), 0);
+	TestEqual(TEXT("Compiled once for the pair"), Cache.GetNumCompiled() - NumCompiledBefore, 1);
+	TestEqual(TEXT("Only the rows the class has"), Cache.FindOrCompile(AttributeSetClass, DataTable).GetNumValues(), 1);
+
+	// A stale initializer would still apply the old value
+	DataTable->FindRow<FAttributeMetaData>(MoveSpeedRowName, TEXT("AttributeSetInitializerTests"))->BaseValue = 300.f;
+	Cache.InvalidateDataTable(DataTable);
+	TestEqual(TEXT("Same as reflection after the table changed"), CountMismatches(*this, AttributeSetClass, DataTable), 0);
+	TestEqual(TEXT("Recompiled after invalidation"), Cache.GetNumCompiled() - NumCompiledBefore, 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAttributeSetInitializerBenchmark, "AncientGame.AbilitySystem.AttributeSetInitializer.SpawnBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+/** Logs the time to create and initialize an attribute set per pawn, reflection vs compiled */
+bool FAttributeSetInitializerBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AttributeSetInitializerTests;
+
+	constexpr int32 NumPawns = 1000;
+
+	UClass* AttributeSetClass = UMovementAttributeSet::StaticClass();
+	const UDataTable* DataTable = MakeDataTable(725.f);
+
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 PawnIndex = 0; PawnIndex < NumPawns; ++PawnIndex)
+	{
+		UAttributeSet* NewSet = NewObject<UAttributeSet>(GetTransientPackage(), AttributeSetClass);
+		NewSet->InitFromMetaDataTable(DataTable);
+	}
+	const double ReflectionTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 PawnIndex = 0; PawnIndex < NumPawns; ++PawnIndex)
+	{
+		UAttributeSet* NewSet = NewObject<UAttributeSet>(GetTransientPackage(), AttributeSetClass);
+		FAncientGameAttributeSetInitializer::InitFromMetaDataTable(NewSet, DataTable);
+	}
+	const double CompiledTime = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("%d x %s: reflection %.3fus/spawn, compiled %.3fus/spawn"),
+		NumPawns, *AttributeSetClass->GetName(), ReflectionTime * 1000000.0 / NumPawns, CompiledTime * 1000000.0 / NumPawns));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
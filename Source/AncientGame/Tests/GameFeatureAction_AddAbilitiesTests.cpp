@@ -0,0 +1,91 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Abilities/GameplayAbility.h"
+#include "AbilitySystemComponent.h"
+#include "AncientGameTestWorld.h"
+#include "Engine/GameInstance.h"
+#include "GameFeatures/GameFeatureAction_AddAbilities.h"
+#include "GameFeaturesSubsystem.h"
+#include "HAL/PlatformTime.h"
+#include "ModularPawn.h"
+#include "UObject/Package.h"
+
+namespace AddAbilitiesTests
+{
+	/** Gives World an initialized game instance, which owns the component manager the action registers with */
+	static UGameInstance* GiveGameInstance(UWorld* World)
+	{
+		UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+		if (FWorldContext* WorldContext = GEngine->GetWorldContextFromWorld(World))
+		{
+			WorldContext->OwningGameInstance = GameInstance;
+		}
+		World->SetGameInstance(GameInstance);
+		GameInstance->Init();
+		return GameInstance;
+	}
+
+	static void Deactivate(UGameFeatureAction_AddAbilities* Action)
+	{
+		FGameFeatureDeactivatingContext Context(TEXT("AncientGameTests"), FSimpleDelegate());
+		Action->OnGameFeatureDeactivating(Context);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAddAbilitiesSpawnBenchmark, "AncientGame.GameFeatures.AddAbilities.SpawnBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+/** Spawns pawns in a single frame and logs how long the frame took with the abilities being granted */
+bool FAddAbilitiesSpawnBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AddAbilitiesTests;
+
+	constexpr int32 NumPawns = 200;
+
+	FAncientGameTestWorld World;
+	UGameInstance* GameInstance = GiveGameInstance(World.Get());
+
+	UGameFeatureAction_AddAbilities* Action = NewObject<UGameFeatureAction_AddAbilities>(GetTransientPackage());
+	FGameFeatureAbilitiesEntry& Entry = Action->AbilitiesList.AddDefaulted_GetRef();
+	Entry.ActorClass = AModularPawn::StaticClass();
+	Entry.GrantedAbilities.AddDefaulted_GetRef().AbilityType = UGameplayAbility::StaticClass();
+
+	// The ability is native and so already loaded, which resolves the preload straight away
+	Action->OnGameFeatureActivating();
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	// Every pawn arrives in the same frame, which is where the extension handlers do their work
+	TArray<AModularPawn*> Pawns;
+	double WorstSpawnTime = 0.0;
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 PawnIndex = 0; PawnIndex < NumPawns; ++PawnIndex)
+	{
+		const double SpawnStartTime = FPlatformTime::Seconds();
+		const FVector Location(200.0 * (PawnIndex % 20), 200.0 * (PawnIndex / 20), 0.0);
+		Pawns.Add(World.Get()->SpawnActor<AModularPawn>(AModularPawn::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams));
+		WorstSpawnTime = FMath::Max(WorstSpawnTime, FPlatformTime::Seconds() - SpawnStartTime);
+	}
+	const double FrameTime = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("Spawned %d pawns: frame %.2fms, worst spawn %.3fms"), NumPawns, FrameTime * 1000.0, WorstSpawnTime * 1000.0));
+
+	int32 NumGranted = 0;
+	for (const AModularPawn* Pawn : Pawns)
+	{
+		const UAbilitySystemComponent* AbilitySystemComponent = Pawn ? Pawn->FindComponentByClass<UAbilitySystemComponent>() : nullptr;
+		NumGranted += (AbilitySystemComponent && AbilitySystemComponent->GetActivatableAbilities().Num() == 1) ? 1 : 0;
+	}
+	TestEqual(TEXT("Every pawn granted the ability"), NumGranted, NumPawns);
+
+	Deactivate(Action);
+	GameInstance->Shutdown();
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,229 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AncientGameTestWorld.h"
+#include "Containers/Ticker.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LevelStreaming.h"
+#include "GameFeatures/GameFeatureAction_AddLevelInstances.h"
+#include "GameFeaturesSubsystem.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace AddLevelInstancesTests
+{
+	// A small packed level, so the test is about requesting many of them rather than loading a big one
+	static const TCHAR* LevelPath = TEXT("/Game/AncientContent/Maps/MASS/Packed/MASS_Boulders_L_01_Packed.MASS_Boulders_L_01_Packed");
+
+	/** An action adding NumInstances copies of the test level to World only */
+	static UGameFeatureAction_AddLevelInstances* MakeAction(UWorld* World, int32 NumInstances, float BudgetMs)
+	{
+		UGameFeatureAction_AddLevelInstances* Action = NewObject<UGameFeatureAction_AddLevelInstances>(GetTransientPackage());
+		Action->ActivationBudgetMs = BudgetMs;
+
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			FGameFeatureLevelInstanceEntry& Entry = Action->LevelInstanceList.AddDefaulted_GetRef();
+			Entry.Level = TSoftObjectPtr<UWorld>(FSoftObjectPath(LevelPath));
+			Entry.TargetWorld = World;
+			Entry.Location = FVector(1000.f * (Index % 8), 1000.f * (Index / 8), 0.f);
+		}
+
+		return Action;
+	}
+
+	/** Actions only add levels to worlds owned by a game instance */
+	static void GiveGameInstance(UWorld* World)
+	{
+		if (FWorldContext* WorldContext = GEngine->GetWorldContextFromWorld(World))
+		{
+			WorldContext->OwningGameInstance = NewObject<UGameInstance>(GEngine);
+		}
+	}
+
+	static void Deactivate(UGameFeatureAction_AddLevelInstances* Action)
+	{
+		FGameFeatureDeactivatingContext Context(TEXT("AncientGameTests"), FSimpleDelegate());
+		Action->OnGameFeatureDeactivating(Context);
+	}
+
+	static int32 CountVisibleLevels(const UWorld* World)
+	{
+		int32 NumVisible = 0;
+		for (const ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+		{
+			NumVisible += (StreamingLevel && StreamingLevel->GetLevelStreamingState() == ELevelStreamingState::LoadedVisible) ? 1 : 0;
+		}
+		return NumVisible;
+	}
+
+	/** Streaming levels that are not on their way out */
+	static int32 CountKeptLevels(const UWorld* World)
+	{
+		int32 NumKept = 0;
+		for (const ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+		{
+			NumKept += (StreamingLevel && !StreamingLevel->GetIsRequestingUnloadAndRemoval()) ? 1 : 0;
+		}
+		return NumKept;
+	}
+
+	/** Worst time an activation takes to make its single, always allowed, request */
+	static double MeasureOneRequestSeconds(UWorld* World, int32 NumSamples)
+	{
+		double WorstSeconds = 0.0;
+		for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+		{
+			UGameFeatureAction_AddLevelInstances* Action = MakeAction(World, 1, 0.1f);
+
+			const double StartTime = FPlatformTime::Seconds();
+			Action->OnGameFeatureActivating();
+			WorstSeconds = FMath::Max(WorstSeconds, FPlatformTime::Seconds() - StartTime);
+
+			Deactivate(Action);
+		}
+		return WorstSeconds;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAddLevelInstancesBudgetTest, "AncientGame.GameFeatures.AddLevelInstances.Budget", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Many level instances are requested over several frames, each frame's requests staying around the budget, and all end up visible */
+bool FAddLevelInstancesBudgetTest::RunTest(const FString& Parameters)
+{
+	using namespace AddLevelInstancesTests;
+
+	constexpr int32 NumInstances = 64;
+	constexpr float BudgetMs = 0.1f;
+	constexpr float DeltaTime = 1.f / 60.f;
+	constexpr int32 MaxFrames = 3000;
+
+	// A frame goes over the budget by at most the request it started before running out, plus the rest of the core ticker
+	constexpr double OtherTickersSeconds = 0.0005;
+
+	FAncientGameTestWorld World;
+	GiveGameInstance(World.Get());
+
+	const double OneRequestSeconds = MeasureOneRequestSeconds(World.Get(), 4);
+	const double MaxTickSeconds = BudgetMs / 1000.0 + OneRequestSeconds + OtherTickersSeconds;
+
+	UGameFeatureAction_AddLevelInstances* Action = MakeAction(World.Get(), NumInstances, BudgetMs);
+
+	// Activating only makes the first frame's requests
+	const double ActivateStartTime = FPlatformTime::Seconds();
+	Action->OnGameFeatureActivating();
+	const double ActivateSeconds = FPlatformTime::Seconds() - ActivateStartTime;
+
+	bool bActivated = false;
+	Action->CallOrRegister_OnLevelInstancesActivated(World.Get(), FSimpleDelegate::CreateLambda([&bActivated]() { bActivated = true; }));
+
+	TestFalse(TEXT("Not activated right away"), bActivated);
+	TestTrue(TEXT("Not all levels requested on activation"), CountKeptLevels(World.Get()) < NumInstances);
+
+	double WorstTickSeconds = ActivateSeconds;
+	int32 NumRequestFrames = 1;
+	float LastProgress = Action->GetActivationProgress(World.Get());
+
+	int32 Frame = 0;
+	for (; Frame < MaxFrames && !bActivated; ++Frame)
+	{
+		ProcessAsyncLoading(true, false, 0.005);
+		World.Tick(DeltaTime);
+		World.Get()->UpdateLevelStreaming();
+
+		// The action requests levels from the core ticker
+		const int32 NumLevelsBefore = CountKeptLevels(World.Get());
+		const double TickStartTime = FPlatformTime::Seconds();
+		FTSTicker::GetCoreTicker().Tick(DeltaTime);
+		const double TickSeconds = FPlatformTime::Seconds() - TickStartTime;
+
+		if (CountKeptLevels(World.Get()) > NumLevelsBefore)
+		{
+			WorstTickSeconds = FMath::Max(WorstTickSeconds, TickSeconds);
+			++NumRequestFrames;
+		}
+
+		const float Progress = Action->GetActivationProgress(World.Get());
+		TestTrue(TEXT("Progress never goes back"), Progress >= LastProgress);
+		LastProgress = Progress;
+	}
+
+	AddInfo(FString::Printf(TEXT("%d level instances requested over %d frames, worst frame %.3fms (budget %.2fms, one request %.3fms), visible after %d frames"),
+		NumInstances, NumRequestFrames, WorstTickSeconds * 1000.0, BudgetMs, OneRequestSeconds * 1000.0, Frame));
+
+	TestTrue(TEXT("Activated"), bActivated);
+	TestTrue(TEXT("Requests spread over several frames"), NumRequestFrames > 1);
+	TestEqual(TEXT("Progress once activated"), Action->GetActivationProgress(World.Get()), 1.f);
+	TestEqual(TEXT("Every level instance visible"), CountVisibleLevels(World.Get()), NumInstances);
+	TestTrue(FString::Printf(TEXT("Worst frame %.3fms is within the budget plus one request, %.3fms"), WorstTickSeconds * 1000.0, MaxTickSeconds * 1000.0), WorstTickSeconds <= MaxTickSeconds);
+
+	Deactivate(Action);
+	TestEqual(TEXT("Levels removed on deactivation"), CountKeptLevels(World.Get()), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAddLevelInstancesDeactivateTest, "AncientGame.GameFeatures.AddLevelInstances.DeactivateWhilePending", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Deactivating before the levels are in still calls whoever is waiting on them */
+bool FAddLevelInstancesDeactivateTest::RunTest(const FString& Parameters)
+{
+	using namespace AddLevelInstancesTests;
+
+	FAncientGameTestWorld World;
+	GiveGameInstance(World.Get());
+
+	UGameFeatureAction_AddLevelInstances* Action = MakeAction(World.Get(), 16, 0.1f);
+	Action->OnGameFeatureActivating();
+
+	int32 NumCalls = 0;
+	Action->CallOrRegister_OnLevelInstancesActivated(World.Get(), FSimpleDelegate::CreateLambda([&NumCalls]() { ++NumCalls; }));
+	TestEqual(TEXT("Waiting on the activation"), NumCalls, 0);
+
+	Deactivate(Action);
+	TestEqual(TEXT("Called on deactivation"), NumCalls, 1);
+	TestEqual(TEXT("Levels removed"), CountKeptLevels(World.Get()), 0);
+
+	// Nothing pending anymore, so new callers are called right away
+	Action->CallOrRegister_OnLevelInstancesActivated(World.Get(), FSimpleDelegate::CreateLambda([&NumCalls]() { ++NumCalls; }));
+	TestEqual(TEXT("Called right away after deactivation"), NumCalls, 2);
+
+	FTSTicker::GetCoreTicker().Tick(1.f / 60.f);
+	TestEqual(TEXT("Not called again"), NumCalls, 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAddLevelInstancesWorldCleanupTest, "AncientGame.GameFeatures.AddLevelInstances.WorldCleanupWhilePending", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Cleaning up a world before its levels are in still calls whoever is waiting on them, once */
+bool FAddLevelInstancesWorldCleanupTest::RunTest(const FString& Parameters)
+{
+	using namespace AddLevelInstancesTests;
+
+	UGameFeatureAction_AddLevelInstances* Action = nullptr;
+	int32 NumCalls = 0;
+	{
+		FAncientGameTestWorld World;
+		GiveGameInstance(World.Get());
+
+		Action = MakeAction(World.Get(), 16, 0.1f);
+		Action->OnGameFeatureActivating();
+
+		Action->CallOrRegister_OnLevelInstancesActivated(World.Get(), FSimpleDelegate::CreateLambda([&NumCalls]() { ++NumCalls; }));
+		TestEqual(TEXT("Waiting on the activation"), NumCalls, 0);
+	}
+	TestEqual(TEXT("Called on world cleanup"), NumCalls, 1);
+
+	FTSTicker::GetCoreTicker().Tick(1.f / 60.f);
+	Deactivate(Action);
+	TestEqual(TEXT("Not called again"), NumCalls, 1);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,174 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AncientGameTestWorld.h"
+#include "GameFeatureWorldSystemTestTypes.h"
+#include "GameFeatures/GameFeatureAction_AddWorldSystem.h"
+#include "GameFeaturesSubsystem.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+
+namespace GameFeatureWorldSystemManagerTests
+{
+	/** Activates an action requesting each of SystemTypes in World only */
+	static UGameFeatureAction_AddWorldSystem* ActivateSystems(UWorld* World, const TArray<UClass*>& SystemTypes)
+	{
+		UGameFeatureAction_AddWorldSystem* Action = NewObject<UGameFeatureAction_AddWorldSystem>(GetTransientPackage());
+		for (UClass* SystemType : SystemTypes)
+		{
+			FGameFeatureWorldSystemEntry& Entry = Action->WorldSystemsList.AddDefaulted_GetRef();
+			Entry.TargetWorld = World;
+			Entry.SystemType = SystemType;
+		}
+
+		Action->OnGameFeatureActivating();
+		return Action;
+	}
+
+	static void Deactivate(UGameFeatureAction_AddWorldSystem* Action)
+	{
+		FGameFeatureDeactivatingContext Context(TEXT("AncientGameTests"), FSimpleDelegate());
+		Action->OnGameFeatureDeactivating(Context);
+	}
+
+	// The lookup before systems were indexed: the first system in the map of the exact class
+	static UGameFeatureWorldSystem* ScanSystems(const TMap<UGameFeatureWorldSystem*, int32>& SystemInstances, const UClass* SystemType)
+	{
+		for (const TPair<UGameFeatureWorldSystem*, int32>& WorldSystem : SystemInstances)
+		{
+			if (WorldSystem.Key && WorldSystem.Key->GetClass() == SystemType)
+			{
+				return WorldSystem.Key;
+			}
+		}
+		return nullptr;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameFeatureWorldSystemManagerLookupTest, "AncientGame.GameFeatures.WorldSystemManager.Lookup", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGameFeatureWorldSystemManagerLookupTest::RunTest(const FString& Parameters)
+{
+	using namespace GameFeatureWorldSystemManagerTests;
+
+	FAncientGameTestWorld World;
+	UGameFeatureWorldSystemManager* SystemManager = World.Get()->GetSubsystem<UGameFeatureWorldSystemManager>();
+	if (!TestNotNull(TEXT("System manager"), SystemManager))
+	{
+		return false;
+	}
+
+	UClass* BaseType = UAncientGameTestWorldSystem::StaticClass();
+
+	// Base class lookups pick the oldest system, however the systems came and went before
+	UGameFeatureAction_AddWorldSystem* FirstAction = ActivateSystems(World.Get(), { UAncientGameTestWorldSystemB::StaticClass(), UAncientGameTestWorldSystemC::StaticClass() });
+	UGameFeatureAction_AddWorldSystem* SecondAction = ActivateSystems(World.Get(), { UAncientGameTestWorldSystemD::StaticClass() });
+	TestTrue(TEXT("Oldest system for the base class"), SystemManager->GetSystemOfType(BaseType) == SystemManager->GetSystem<UAncientGameTestWorldSystemB>());
+
+	Deactivate(FirstAction);
+	TestNull(TEXT("Released system gone"), SystemManager->GetSystem<UAncientGameTestWorldSystemB>());
+	TestTrue(TEXT("Remaining system for the base class"), SystemManager->GetSystemOfType(BaseType) == SystemManager->GetSystem<UAncientGameTestWorldSystemD>());
+
+	// These take the places B and C had in the map, but are still newer than D
+	UGameFeatureAction_AddWorldSystem* ThirdAction = ActivateSystems(World.Get(), { UAncientGameTestWorldSystemC::StaticClass(), UAncientGameTestWorldSystemB::StaticClass() });
+	TestTrue(TEXT("Oldest system after re-adding"), SystemManager->GetSystemOfType(BaseType) == SystemManager->GetSystem<UAncientGameTestWorldSystemD>());
+
+	// FindGameFeatureWorldSystemOfType only ever matches the exact class
+	UGameFeatureAction_AddWorldSystem* DerivedAction = ActivateSystems(World.Get(), { UAncientGameTestWorldSystemDerivedA::StaticClass() });
+	UGameFeatureWorldSystem* DerivedA = SystemManager->GetSystemOfExactType(UAncientGameTestWorldSystemDerivedA::StaticClass());
+	TestNotNull(TEXT("Derived system"), DerivedA);
+	TestNull(TEXT("Blueprint lookup ignores subclasses"), UGameFeatureAction_AddWorldSystem::FindGameFeatureWorldSystemOfType(UAncientGameTestWorldSystemA::StaticClass(), World.Get()));
+	TestTrue(TEXT("Native lookup falls back to the subclass"), SystemManager->GetSystem<UAncientGameTestWorldSystemA>() == DerivedA);
+
+	UGameFeatureAction_AddWorldSystem* ExactAction = ActivateSystems(World.Get(), { UAncientGameTestWorldSystemA::StaticClass() });
+	UGameFeatureWorldSystem* A = UGameFeatureAction_AddWorldSystem::FindGameFeatureWorldSystemOfType(UAncientGameTestWorldSystemA::StaticClass(), World.Get());
+	TestTrue(TEXT("Blueprint lookup finds the exact class"), A && A->GetClass() == UAncientGameTestWorldSystemA::StaticClass());
+	TestTrue(TEXT("Native lookup prefers the exact class"), SystemManager->GetSystem<UAncientGameTestWorldSystemA>() == A);
+
+	// Requests are counted per class
+	UGameFeatureAction_AddWorldSystem* SharedAction = ActivateSystems(World.Get(), { UAncientGameTestWorldSystemA::StaticClass() });
+	Deactivate(ExactAction);
+	TestTrue(TEXT("Still requested"), SystemManager->GetSystem<UAncientGameTestWorldSystemA>() == A);
+	Deactivate(SharedAction);
+	TestTrue(TEXT("Back to the subclass once released"), SystemManager->GetSystem<UAncientGameTestWorldSystemA>() == DerivedA);
+
+	Deactivate(DerivedAction);
+	Deactivate(ThirdAction);
+	Deactivate(SecondAction);
+	TestNull(TEXT("Everything released"), SystemManager->GetSystemOfType(BaseType));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameFeatureWorldSystemManagerBenchmark, "AncientGame.GameFeatures.WorldSystemManager.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+/** Logs the time for lookups of each registered system, the way they used to be made vs through the index */
+bool FGameFeatureWorldSystemManagerBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace GameFeatureWorldSystemManagerTests;
+
+	constexpr int32 NumLookups = 100000;
+
+	FAncientGameTestWorld World;
+	UGameFeatureWorldSystemManager* SystemManager = World.Get()->GetSubsystem<UGameFeatureWorldSystemManager>();
+	if (!TestNotNull(TEXT("System manager"), SystemManager))
+	{
+		return false;
+	}
+
+	const TArray<UClass*> SystemTypes = {
+		UAncientGameTestWorldSystemA::StaticClass(),
+		UAncientGameTestWorldSystemB::StaticClass(),
+		UAncientGameTestWorldSystemC::StaticClass(),
+		UAncientGameTestWorldSystemD::StaticClass(),
+		UAncientGameTestWorldSystemDerivedA::StaticClass()
+	};
+	UGameFeatureAction_AddWorldSystem* Action = ActivateSystems(World.Get(), SystemTypes);
+
+	// The same systems in the map the manager used to keep, instance to request count
+	TMap<UGameFeatureWorldSystem*, int32> OldSystemInstances;
+	for (UClass* SystemType : SystemTypes)
+	{
+		OldSystemInstances.Add(SystemManager->GetSystemOfExactType(SystemType), 1);
+	}
+
+	for (UClass* SystemType : SystemTypes)
+	{
+		TestTrue(FString::Printf(TEXT("Same %s either way"), *SystemType->GetName()), ScanSystems(OldSystemInstances, SystemType) == UGameFeatureAction_AddWorldSystem::FindGameFeatureWorldSystemOfType(SystemType, World.Get()));
+	}
+
+	int32 NumFound = 0;
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Lookup = 0; Lookup < NumLookups; ++Lookup)
+	{
+		NumFound += ScanSystems(OldSystemInstances, SystemTypes[Lookup % SystemTypes.Num()]) ? 1 : 0;
+	}
+	const double ScanTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Lookup = 0; Lookup < NumLookups; ++Lookup)
+	{
+		NumFound += SystemManager->GetSystemOfExactType(SystemTypes[Lookup % SystemTypes.Num()]) ? 1 : 0;
+	}
+	const double ExactTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Lookup = 0; Lookup < NumLookups; ++Lookup)
+	{
+		NumFound += SystemManager->GetSystemOfType(SystemTypes[Lookup % SystemTypes.Num()]) ? 1 : 0;
+	}
+	const double ResolvedTime = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("%d world systems x %d lookups: scan %.3fms, exact %.3fms, resolved %.3fms"),
+		SystemTypes.Num(), NumLookups, ScanTime * 1000.0, ExactTime * 1000.0, ResolvedTime * 1000.0));
+	TestEqual(TEXT("Every lookup found its system"), NumFound, 3 * NumLookups);
+
+	Deactivate(Action);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
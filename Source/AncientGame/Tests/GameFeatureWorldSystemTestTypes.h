@@ -0,0 +1,45 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "GameFeatures/GameFeatureAction_AddWorldSystem.h"
+
+#include "GameFeatureWorldSystemTestTypes.generated.h"
+
+/** World systems for the world system manager automation tests, never added by a game feature */
+UCLASS(Abstract, NotBlueprintable, HideDropdown)
+class UAncientGameTestWorldSystem : public UGameFeatureWorldSystem
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotBlueprintable, HideDropdown)
+class UAncientGameTestWorldSystemA : public UAncientGameTestWorldSystem
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotBlueprintable, HideDropdown)
+class UAncientGameTestWorldSystemB : public UAncientGameTestWorldSystem
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotBlueprintable, HideDropdown)
+class UAncientGameTestWorldSystemC : public UAncientGameTestWorldSystem
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotBlueprintable, HideDropdown)
+class UAncientGameTestWorldSystemD : public UAncientGameTestWorldSystem
+{
+	GENERATED_BODY()
+};
+
+/** Derives from A, so lookups of A find it only when there is no A */
+UCLASS(NotBlueprintable, HideDropdown)
+class UAncientGameTestWorldSystemDerivedA : public UAncientGameTestWorldSystemA
+{
+	GENERATED_BODY()
+};
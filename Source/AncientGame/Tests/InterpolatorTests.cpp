@@ -0,0 +1,352 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Camera/BatchInterpolators.h"
+#include "Camera/Interpolators.h"
+#include "HAL/PlatformTime.h"
+
+#include <type_traits>
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterpolatorSubstepTest, "AncientGame.Camera.Interpolators.Substep", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** A substepped spring that skips a few frames ends up where one updated every frame does */
+bool FInterpolatorSubstepTest::RunTest(const FString& Parameters)
+{
+	const FVector GoalVelocity(1.f, 0.f, 0.f);
+	constexpr int32 NumUpdates = 10;
+	constexpr int32 HitchStart = 3;
+	constexpr int32 HitchStop = 6;
+	const float DeltaTimes[NumUpdates] = { 0.1f, 0.04f, 0.08f, 0.02f, 0.05f, 0.1f, 0.3f, 0.4f, 0.33f, 0.12f };
+
+	FCritDampSpringInterpolatorVector Nonhitched(10.f);
+	FCritDampSpringInterpolatorVector Hitched(10.f);
+
+	// get them started at 0,0,0
+	Nonhitched.Reset();
+	Hitched.Reset();
+	Nonhitched.EvalSubstepped(FVector::ZeroVector, 0.001f);
+	Hitched.EvalSubstepped(FVector::ZeroVector, 0.001f);
+
+	FVector Goal(10.f, 0.f, 0.f);
+	FVector NonhitchedPos = FVector::ZeroVector;
+	FVector HitchedPos = FVector::ZeroVector;
+
+	float HitchDeltaTime = 0.f;
+	for (int32 Update = 0; Update < NumUpdates; ++Update)
+	{
+		const float DeltaTime = DeltaTimes[Update];
+		Goal += GoalVelocity * DeltaTime;
+
+		if (Update >= HitchStart && Update < HitchStop)
+		{
+			HitchDeltaTime += DeltaTime;
+		}
+		else
+		{
+			HitchedPos = Hitched.EvalSubstepped(Goal, Update == HitchStop ? DeltaTime + HitchDeltaTime : DeltaTime);
+		}
+
+		NonhitchedPos = Nonhitched.EvalSubstepped(Goal, DeltaTime);
+	}
+
+	TestTrue(FString::Printf(TEXT("Hitched %s matches nonhitched %s"), *HitchedPos.ToString(), *NonhitchedPos.ToString()), (HitchedPos - NonhitchedPos).IsNearlyZero());
+
+	return true;
+}
+
+namespace InterpolatorTests
+{
+	static constexpr int32 NumUpdates = 10;
+	static const float DeltaTimes[NumUpdates] = { 0.1f, 0.04f, 0.08f, 0.02f, 0.05f, 0.1f, 0.3f, 0.4f, 0.33f, 0.12f };
+
+	/** Batch results match the scalar templates op for op, up to multiply-add contraction */
+	static constexpr double BatchTolerance = UE_KINDA_SMALL_NUMBER;
+
+	// 4 distinct parameter sets over an instance count that isn't a multiple of the vector width
+	static constexpr int32 NumBatchInstances = 37;
+	static float GetSpeed(int32 Instance) { return 5.f + 5.f * (Instance % 4); }
+
+	static FVector GetVectorGoal(int32 Instance, int32 Update)
+	{
+		return FVector(10.f * Instance, 3.f * Update, 100.f * FMath::Sin(0.3f * (Instance + Update)));
+	}
+
+	static FRotator GetRotatorGoal(int32 Instance, int32 Update)
+	{
+		return FRotator(10.f * FMath::Sin(0.1f * Update), Instance + 2.f * Update, 0.f);
+	}
+
+	static double GetError(const FVector& A, const FVector& B)
+	{
+		return (A - B).GetAbsMax();
+	}
+
+	static double GetError(const FRotator& A, const FRotator& B)
+	{
+		const FRotator Delta = (A - B).GetNormalized();
+		return FMath::Max3(FMath::Abs(Delta.Pitch), FMath::Abs(Delta.Yaw), FMath::Abs(Delta.Roll));
+	}
+
+	/** Evaluates the way each type is used: substepped, except the acceleration interpolators, which substep inside Eval */
+	template<class InterpolatorType, class GoalType>
+	void EvalInterpolator(InterpolatorType& Interpolator, const GoalType& Goal, float DeltaTime)
+	{
+		if constexpr (std::is_same_v<InterpolatorType, TAccelerationInterpolator<FVector>> || std::is_same_v<InterpolatorType, TAccelerationInterpolatorBatch<FVector>>)
+		{
+			Interpolator.Eval(Goal, DeltaTime);
+		}
+		else
+		{
+			Interpolator.EvalSubstepped(Goal, DeltaTime);
+		}
+	}
+
+	/** Largest difference between each scalar interpolator and its batch instance, with one instance reset mid-way to desync it */
+	template<class T, class ScalarInterpolatorType, class BatchType>
+	double GetMaxBatchError(TArray<ScalarInterpolatorType>& Scalars, BatchType& Batch, T (*GetGoal)(int32, int32))
+	{
+		TArray<T> Goals;
+		Goals.SetNum(Scalars.Num());
+
+		double MaxError = 0.0;
+		for (int32 Update = 0; Update < NumUpdates; ++Update)
+		{
+			if (Update == 4)
+			{
+				Scalars[5].Reset();
+				Batch.Reset(5);
+			}
+
+			for (int32 Instance = 0; Instance < Scalars.Num(); ++Instance)
+			{
+				Goals[Instance] = GetGoal(Instance, Update);
+				EvalInterpolator(Scalars[Instance], Goals[Instance], DeltaTimes[Update]);
+			}
+			EvalInterpolator(Batch, Goals, DeltaTimes[Update]);
+
+			for (int32 Instance = 0; Instance < Scalars.Num(); ++Instance)
+			{
+				MaxError = FMath::Max(MaxError, GetError(Scalars[Instance].GetCurrentValue(), Batch.GetCurrentValue(Instance)));
+			}
+		}
+		return MaxError;
+	}
+
+	/** Nanoseconds per evaluation of NumInstances scalar interpolators updated NumUpdates times at 60Hz, towards moving goals */
+	template<class InterpolatorType, class GoalFuncType>
+	double MeasureThroughput(TArray<InterpolatorType>& Interpolators, GoalFuncType GetGoal, int32 NumThroughputUpdates)
+	{
+		constexpr float DeltaTime = 1.f / 60.f;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Update = 0; Update < NumThroughputUpdates; ++Update)
+		{
+			for (int32 Instance = 0; Instance < Interpolators.Num(); ++Instance)
+			{
+				EvalInterpolator(Interpolators[Instance], GetGoal(Instance, Update), DeltaTime);
+			}
+		}
+
+		return (FPlatformTime::Seconds() - StartTime) * 1e9 / (double(NumThroughputUpdates) * Interpolators.Num());
+	}
+
+	/** Same as above for a batch, including filling in its goals */
+	template<class T, class BatchType>
+	double MeasureBatchThroughput(BatchType& Batch, T (*GetGoal)(int32, int32), int32 NumThroughputUpdates)
+	{
+		constexpr float DeltaTime = 1.f / 60.f;
+
+		TArray<T> Goals;
+		Goals.SetNum(Batch.Num());
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Update = 0; Update < NumThroughputUpdates; ++Update)
+		{
+			for (int32 Instance = 0; Instance < Goals.Num(); ++Instance)
+			{
+				Goals[Instance] = GetGoal(Instance, Update);
+			}
+			EvalInterpolator(Batch, Goals, DeltaTime);
+		}
+
+		return (FPlatformTime::Seconds() - StartTime) * 1e9 / (double(NumThroughputUpdates) * Batch.Num());
+	}
+
+	static FString FormatThroughput(const TCHAR* Name, double ScalarNs, double BatchNs)
+	{
+		return FString::Printf(TEXT("%s: scalar %.1f ns, batch %.1f ns (%.2fx)"), Name, ScalarNs, BatchNs, BatchNs > 0.0 ? ScalarNs / BatchNs : 0.0);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterpolatorBatchSpringTest, "AncientGame.Camera.Interpolators.Batch.Spring", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Batched vector and rotator springs follow their scalar counterparts and share scalars per natural frequency */
+bool FInterpolatorBatchSpringTest::RunTest(const FString& Parameters)
+{
+	using namespace InterpolatorTests;
+
+	{
+		TArray<TCritDampSpringInterpolator<FVector>> Scalars;
+		TCritDampSpringInterpolatorBatch<FVector> Batch;
+		for (int32 Instance = 0; Instance < NumBatchInstances; ++Instance)
+		{
+			Scalars.Emplace_GetRef(GetSpeed(Instance)).Reset();
+			Batch.Add(GetSpeed(Instance));
+		}
+
+		TestEqual(TEXT("Vector springs share one scalar group per natural frequency"), Batch.GetNumScalarGroups(), 4);
+		const double MaxError = GetMaxBatchError(Scalars, Batch, GetVectorGoal);
+		TestTrue(FString::Printf(TEXT("Vector spring max error %g is within %g"), MaxError, BatchTolerance), MaxError <= BatchTolerance);
+	}
+
+	{
+		TArray<TCritDampSpringInterpolator<FRotator>> Scalars;
+		TCritDampSpringInterpolatorBatch<FRotator> Batch;
+		for (int32 Instance = 0; Instance < NumBatchInstances; ++Instance)
+		{
+			Scalars.Emplace_GetRef(GetSpeed(Instance)).Reset();
+			Batch.Add(GetSpeed(Instance));
+		}
+
+		const double MaxError = GetMaxBatchError(Scalars, Batch, GetRotatorGoal);
+		TestTrue(FString::Printf(TEXT("Rotator spring max error %g is within %g"), MaxError, BatchTolerance), MaxError <= BatchTolerance);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterpolatorBatchIIRTest, "AncientGame.Camera.Interpolators.Batch.IIR", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Batched single and double IIR interpolators follow their scalar counterparts */
+bool FInterpolatorBatchIIRTest::RunTest(const FString& Parameters)
+{
+	using namespace InterpolatorTests;
+
+	{
+		TArray<TGenericIIRInterpolator<FVector>> Scalars;
+		TGenericIIRInterpolatorBatch<FVector> Batch;
+		for (int32 Instance = 0; Instance < NumBatchInstances; ++Instance)
+		{
+			Scalars.Emplace(GetSpeed(Instance));
+			Batch.Add(GetSpeed(Instance));
+		}
+
+		const double MaxError = GetMaxBatchError(Scalars, Batch, GetVectorGoal);
+		TestTrue(FString::Printf(TEXT("IIR max error %g is within %g"), MaxError, BatchTolerance), MaxError <= BatchTolerance);
+	}
+
+	{
+		TArray<TGenericDoubleIIRInterpolator<FVector>> Scalars;
+		TGenericDoubleIIRInterpolatorBatch<FVector> Batch;
+		for (int32 Instance = 0; Instance < NumBatchInstances; ++Instance)
+		{
+			Scalars.Emplace(GetSpeed(Instance), 10.f);
+			Batch.Add(GetSpeed(Instance), 10.f);
+		}
+
+		const double MaxError = GetMaxBatchError(Scalars, Batch, GetVectorGoal);
+		TestTrue(FString::Printf(TEXT("Double IIR max error %g is within %g"), MaxError, BatchTolerance), MaxError <= BatchTolerance);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterpolatorBatchAccelerationTest, "AncientGame.Camera.Interpolators.Batch.Acceleration", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Batched acceleration interpolators follow their scalar counterparts through acceleration, cruising and braking */
+bool FInterpolatorBatchAccelerationTest::RunTest(const FString& Parameters)
+{
+	using namespace InterpolatorTests;
+
+	TArray<TAccelerationInterpolator<FVector>> Scalars;
+	TAccelerationInterpolatorBatch<FVector> Batch;
+	for (int32 Instance = 0; Instance < NumBatchInstances; ++Instance)
+	{
+		const float MaxAcceleration = 200.f * GetSpeed(Instance);
+		const float MinDeceleration = 400.f;
+		const float MaxSpeed = 300.f + 20.f * (Instance % 8);
+
+		// the constructor takes MaxAcceleration from InMinDeceleration
+		TAccelerationInterpolator<FVector>& Scalar = Scalars.Emplace_GetRef(MaxAcceleration, MinDeceleration, MaxSpeed);
+		Scalar.MaxAcceleration = MaxAcceleration;
+		Batch.Add(MaxAcceleration, MinDeceleration, MaxSpeed);
+	}
+
+	const double MaxError = GetMaxBatchError(Scalars, Batch, GetVectorGoal);
+	TestTrue(FString::Printf(TEXT("Acceleration max error %g is within %g"), MaxError, BatchTolerance), MaxError <= BatchTolerance);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInterpolatorThroughputTest, "AncientGame.Camera.Interpolators.Throughput", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+/** Logs the cost of an evaluation for each interpolator type, scalar and batched, with as many instances as a busy frame updates */
+bool FInterpolatorThroughputTest::RunTest(const FString& Parameters)
+{
+	using namespace InterpolatorTests;
+
+	constexpr int32 NumInstances = 1024;
+	constexpr int32 NumThroughputUpdates = 600;
+
+	{
+		TArray<TCritDampSpringInterpolator<FVector>> Springs;
+		TCritDampSpringInterpolatorBatch<FVector> Batch;
+		for (int32 Instance = 0; Instance < NumInstances; ++Instance)
+		{
+			Springs.Emplace_GetRef(10.f + Instance % 8).Reset();
+			Batch.Add(10.f + Instance % 8);
+		}
+		AddInfo(FormatThroughput(TEXT("Spring vector, substepped"), MeasureThroughput(Springs, GetVectorGoal, NumThroughputUpdates), MeasureBatchThroughput(Batch, GetVectorGoal, NumThroughputUpdates)));
+	}
+
+	{
+		TArray<TCritDampSpringInterpolator<FRotator>> Springs;
+		TCritDampSpringInterpolatorBatch<FRotator> Batch;
+		for (int32 Instance = 0; Instance < NumInstances; ++Instance)
+		{
+			Springs.Emplace_GetRef(10.f + Instance % 8).Reset();
+			Batch.Add(10.f + Instance % 8);
+		}
+		AddInfo(FormatThroughput(TEXT("Spring rotator, substepped"), MeasureThroughput(Springs, GetRotatorGoal, NumThroughputUpdates), MeasureBatchThroughput(Batch, GetRotatorGoal, NumThroughputUpdates)));
+	}
+
+	{
+		TArray<TGenericIIRInterpolator<FVector>> IIRs;
+		TGenericIIRInterpolatorBatch<FVector> Batch;
+		for (int32 Instance = 0; Instance < NumInstances; ++Instance)
+		{
+			IIRs.Emplace(5.f + Instance % 4);
+			Batch.Add(5.f + Instance % 4);
+		}
+		AddInfo(FormatThroughput(TEXT("IIR vector, substepped"), MeasureThroughput(IIRs, GetVectorGoal, NumThroughputUpdates), MeasureBatchThroughput(Batch, GetVectorGoal, NumThroughputUpdates)));
+	}
+
+	{
+		TArray<TGenericDoubleIIRInterpolator<FVector>> DoubleIIRs;
+		TGenericDoubleIIRInterpolatorBatch<FVector> Batch;
+		for (int32 Instance = 0; Instance < NumInstances; ++Instance)
+		{
+			DoubleIIRs.Emplace(5.f + Instance % 4, 10.f);
+			Batch.Add(5.f + Instance % 4, 10.f);
+		}
+		AddInfo(FormatThroughput(TEXT("Double IIR vector, substepped"), MeasureThroughput(DoubleIIRs, GetVectorGoal, NumThroughputUpdates), MeasureBatchThroughput(Batch, GetVectorGoal, NumThroughputUpdates)));
+	}
+
+	{
+		TArray<TAccelerationInterpolator<FVector>> Accelerations;
+		TAccelerationInterpolatorBatch<FVector> Batch;
+		for (int32 Instance = 0; Instance < NumInstances; ++Instance)
+		{
+			Accelerations.Emplace(500.f, 500.f, 2000.f + Instance % 8);
+			Batch.Add(500.f, 500.f, 2000.f + Instance % 8);
+		}
+		AddInfo(FormatThroughput(TEXT("Acceleration vector"), MeasureThroughput(Accelerations, GetVectorGoal, NumThroughputUpdates), MeasureBatchThroughput(Batch, GetVectorGoal, NumThroughputUpdates)));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Camera/SpringArm.h"
+#include "Components/BoxComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "GameFramework/Actor.h"
+#include "Tests/AncientGameTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpringArmAsyncCollisionTest, "AncientGame.Camera.SpringArm.AsyncCollision", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Moves a synchronous and an asynchronous spring arm side by side past a wall behind them, and measures how many frames
+ * later the async one is pulled in, and how far its camera is from the synchronous one
+ */
+bool FSpringArmAsyncCollisionTest::RunTest(const FString& Parameters)
+{
+	constexpr float DeltaTime = 1.0f / 60.0f;
+	constexpr float Speed = 600.0f;
+	constexpr int32 NumFrames = 160;
+
+	FAncientGameTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	// The arms point back along -X, so the wall sits between the pivot and the camera while the pivot is in front of it
+	AActor* Wall = World->SpawnActor<AActor>();
+	UBoxComponent* WallBox = NewObject<UBoxComponent>(Wall);
+	WallBox->SetBoxExtent(FVector(20.0f, 100.0f, 200.0f));
+	WallBox->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	Wall->SetRootComponent(WallBox);
+	WallBox->RegisterComponent();
+	Wall->SetActorLocation(FVector(-200.0f, 0.0f, 0.0f));
+
+	// Let the physics scene pick the wall up
+	TestWorld.Tick(DeltaTime);
+
+	FSpringArm SyncArm;
+	SyncArm.bAsyncCollisionTest = false;
+	SyncArm.Initialize();
+
+	FSpringArm AsyncArm = SyncArm;
+	AsyncArm.bAsyncCollisionTest = true;
+	AsyncArm.Initialize();
+
+	int32 FirstSyncHitFrame = INDEX_NONE;
+	int32 FirstAsyncHitFrame = INDEX_NONE;
+	int32 LastSyncHitFrame = INDEX_NONE;
+	int32 LastAsyncHitFrame = INDEX_NONE;
+	double TotalError = 0.0;
+	double MaxError = 0.0;
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const FTransform Pivot(FRotator::ZeroRotator, FVector(0.0f, -800.0f + Speed * DeltaTime * Frame, 0.0f));
+
+		SyncArm.Tick(World, TArrayView<const AActor* const>(), Pivot, FVector::ZeroVector);
+		AsyncArm.Tick(World, TArrayView<const AActor* const>(), Pivot, FVector::ZeroVector);
+
+		if (SyncArm.IsCollisionFixApplied())
+		{
+			FirstSyncHitFrame = FirstSyncHitFrame == INDEX_NONE ? Frame : FirstSyncHitFrame;
+			LastSyncHitFrame = Frame;
+		}
+
+		if (AsyncArm.IsCollisionFixApplied())
+		{
+			FirstAsyncHitFrame = FirstAsyncHitFrame == INDEX_NONE ? Frame : FirstAsyncHitFrame;
+			LastAsyncHitFrame = Frame;
+		}
+
+		const double Error = FVector::Dist(SyncArm.GetCameraTransform().GetLocation(), AsyncArm.GetCameraTransform().GetLocation());
+		TotalError += Error;
+		MaxError = FMath::Max(MaxError, Error);
+
+		TestWorld.Tick(DeltaTime);
+	}
+
+	AddInfo(FString::Printf(TEXT("Async arm hit frames %d-%d, sync arm %d-%d"), FirstAsyncHitFrame, LastAsyncHitFrame, FirstSyncHitFrame, LastSyncHitFrame));
+	AddInfo(FString::Printf(TEXT("Camera error: %.2f on average, %.2f at most"), TotalError / NumFrames, MaxError));
+	AddInfo(FString::Printf(TEXT("Async results %d, sync fallbacks %d, skipped sweeps %d"), AsyncArm.GetNumAsyncSweepResults(), AsyncArm.GetNumSyncSweepFallbacks(), AsyncArm.GetNumSkippedAsyncSweeps()));
+
+	if (!TestTrue(TEXT("Sync arm hits the wall"), FirstSyncHitFrame != INDEX_NONE) || !TestTrue(TEXT("Async arm hits the wall"), FirstAsyncHitFrame != INDEX_NONE))
+	{
+		return false;
+	}
+
+	// Moving steadily, the extrapolated sweep is as early as the synchronous one, and at most a frame late when leaving the wall
+	TestTrue(TEXT("Async arm pulled in without latency"), FirstAsyncHitFrame <= FirstSyncHitFrame);
+	TestTrue(TEXT("Async arm released at most a frame late"), FMath::Abs(LastAsyncHitFrame - LastSyncHitFrame) <= 1);
+
+	// Only the first frame, with no sweep in flight yet, falls back
+	TestEqual(TEXT("Sync fallbacks"), AsyncArm.GetNumSyncSweepFallbacks(), 1);
+	TestEqual(TEXT("Skipped async sweeps"), AsyncArm.GetNumSkippedAsyncSweeps(), 0);
+
+	// Errors only come from the frames the arms disagree on, while entering or leaving the wall
+	TestTrue(TEXT("Average camera error"), TotalError / NumFrames < SyncArm.TargetArmLength * 0.05);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpringArmAsyncFallbackTest, "AncientGame.Camera.SpringArm.AsyncFallback", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Teleports an async spring arm, which must fall back to a synchronous sweep without also issuing an async one that frame */
+bool FSpringArmAsyncFallbackTest::RunTest(const FString& Parameters)
+{
+	constexpr float DeltaTime = 1.0f / 60.0f;
+
+	FAncientGameTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	FSpringArm AsyncArm;
+	AsyncArm.bAsyncCollisionTest = true;
+	AsyncArm.Initialize();
+
+	for (int32 Frame = 0; Frame < 4; ++Frame)
+	{
+		AsyncArm.Tick(World, TArrayView<const AActor* const>(), FTransform(FVector(0.0f, 10.0f * Frame, 0.0f)), FVector::ZeroVector);
+		TestWorld.Tick(DeltaTime);
+	}
+
+	TestEqual(TEXT("Steady frames use the async sweep"), AsyncArm.GetNumAsyncSweepResults(), 3);
+
+	// Teleport: the prediction misses, and the sweep for the next frame is skipped
+	AsyncArm.Tick(World, TArrayView<const AActor* const>(), FTransform(FVector(5000.0f, 0.0f, 0.0f)), FVector::ZeroVector);
+	TestWorld.Tick(DeltaTime);
+	TestEqual(TEXT("Teleport falls back"), AsyncArm.GetNumSyncSweepFallbacks(), 2);
+	TestEqual(TEXT("Teleport skips its async sweep"), AsyncArm.GetNumSkippedAsyncSweeps(), 1);
+
+	// With nothing in flight, the next frame sweeps synchronously and issues again, and the one after is async
+	AsyncArm.Tick(World, TArrayView<const AActor* const>(), FTransform(FVector(5000.0f, 10.0f, 0.0f)), FVector::ZeroVector);
+	TestWorld.Tick(DeltaTime);
+	AsyncArm.Tick(World, TArrayView<const AActor* const>(), FTransform(FVector(5000.0f, 20.0f, 0.0f)), FVector::ZeroVector);
+	TestWorld.Tick(DeltaTime);
+
+	TestEqual(TEXT("Recovers after a frame"), AsyncArm.GetNumSyncSweepFallbacks(), 3);
+	TestEqual(TEXT("Async again"), AsyncArm.GetNumAsyncSweepResults(), 4);
+	TestEqual(TEXT("Only the teleport skipped"), AsyncArm.GetNumSkippedAsyncSweeps(), 1);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
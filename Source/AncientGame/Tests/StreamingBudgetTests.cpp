@@ -0,0 +1,115 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AncientGameTestWorld.h"
+#include "Engine/CoreSettings.h"
+#include "Framework/StreamingBudgetSubsystem.h"
+#include "GameFramework/WorldSettings.h"
+#include "Templates/UniquePtr.h"
+
+#include <cfloat>
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamingBudgetGovernorTest, "AncientGame.Loading.StreamingBudget.CompetingRequests", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Competing requests and a simulated game thread time ramp through FStreamingBudgetGovernor */
+bool FStreamingBudgetGovernorTest::RunTest(const FString& Parameters)
+{
+	FStreamingBudgetGovernor Governor;
+	Governor.EngineDefaults.AsyncLoadingTimeLimitMs = 5.f;
+	Governor.EngineDefaults.ActorsUpdateTimeLimitMs = 5.f;
+	Governor.AdaptiveSettings.FrameTimeSmoothing = 0.f;
+
+	TestTrue(TEXT("No requests uses the engine defaults"), Governor.Evaluate(0) == Governor.EngineDefaults);
+	TestFalse(TEXT("No active request"), Governor.GetActiveRequest().IsValid());
+
+	FStreamingBudgetRequestHandle Traversal = Governor.AddRequest(EStreamingBudgetPriority::SeamlessTraversal);
+	FStreamingBudgetRequestHandle LoadingScreen = Governor.AddRequest(EStreamingBudgetPriority::LoadingScreen);
+	FStreamingBudgetRequestHandle LateTraversal = Governor.AddRequest(EStreamingBudgetPriority::SeamlessTraversal);
+	TestTrue(TEXT("Loading screen outranks later traversal"), Governor.GetActivePriority() == EStreamingBudgetPriority::LoadingScreen);
+	TestEqual(TEXT("Loading screen is the active request"), Governor.GetActiveRequest().Id, LoadingScreen.Id);
+	TestTrue(TEXT("Loading screen gets high priority loading"), Governor.Evaluate(3).bHighPriorityLoading);
+
+	Governor.RemoveRequest(LoadingScreen);
+	TestTrue(TEXT("Traversal resumes after the loading screen"), Governor.GetActivePriority() == EStreamingBudgetPriority::SeamlessTraversal);
+	TestEqual(TEXT("Most recent traversal is the active request"), Governor.GetActiveRequest().Id, LateTraversal.Id);
+	TestTrue(TEXT("Removing twice is harmless"), !LoadingScreen.IsValid() && !Governor.RemoveRequest(LoadingScreen));
+
+	// Custom budgets tie with adaptive traversal; the most recent wins
+	FStreamingBudget Fixed;
+	Fixed.AsyncLoadingTimeLimitMs = 7.f;
+	Fixed.ActorsUpdateTimeLimitMs = 7.f;
+	FStreamingBudgetRequestHandle Custom = Governor.AddCustomRequest(EStreamingBudgetPriority::SeamlessTraversal, Fixed);
+	TestTrue(TEXT("Most recent request wins a tie"), Governor.Evaluate(3) == Fixed);
+	Governor.RemoveRequest(Custom);
+
+	// With nothing pending, traversal keeps the budget the library used to set, ready for the next level
+	const FStreamingBudgetAdaptiveSettings& Settings = Governor.AdaptiveSettings;
+	TestEqual(TEXT("An empty queue gets the idle budget"), Governor.Evaluate(0).AsyncLoadingTimeLimitMs, Settings.IdleBudgetMs);
+	TestEqual(TEXT("Idle budget for actor updates"), Governor.Evaluate(0).ActorsUpdateTimeLimitMs, Settings.IdleBudgetMs);
+
+	// The adaptive budget shrinks as the game's own time eats the headroom, and never drops below the minimum
+	float LastBudgetMs = FLT_MAX;
+	FStreamingBudget Applied = Governor.Evaluate(1);
+	for (float GameMs = 4.f; GameMs <= 24.f; GameMs += 4.f)
+	{
+		Governor.ReportFrameTime(GameMs + Applied.AsyncLoadingTimeLimitMs, Applied);
+		Applied = Governor.Evaluate(1);
+		TestTrue(TEXT("Budget follows headroom"), Applied.AsyncLoadingTimeLimitMs <= LastBudgetMs);
+		TestTrue(TEXT("Budget stays clamped"), Applied.AsyncLoadingTimeLimitMs >= Settings.MinBudgetMs && Applied.AsyncLoadingTimeLimitMs <= Settings.MaxBudgetMs);
+		LastBudgetMs = Applied.AsyncLoadingTimeLimitMs;
+	}
+	TestEqual(TEXT("An over-budget frame gets the minimum"), LastBudgetMs, Settings.MinBudgetMs);
+	TestTrue(TEXT("A long queue boosts the budget"), Governor.Evaluate(Settings.PendingLevelsBeforeBoost + 4).AsyncLoadingTimeLimitMs > LastBudgetMs);
+
+	Governor.RemoveRequest(Traversal);
+	Governor.RemoveRequest(LateTraversal);
+	TestTrue(TEXT("Defaults return once every request is gone"), Governor.GetNumRequests() == 0 && Governor.Evaluate(0) == Governor.EngineDefaults);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamingBudgetWorldsTest, "AncientGame.Loading.StreamingBudget.Worlds", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/** Worlds share the process wide budgets, and a world going away only takes its own requests with it */
+bool FStreamingBudgetWorldsTest::RunTest(const FString& Parameters)
+{
+	UStreamingBudgetSubsystem* StreamingBudget = UStreamingBudgetSubsystem::Get();
+	if (!TestNotNull(TEXT("Streaming budget subsystem"), StreamingBudget))
+	{
+		return false;
+	}
+
+	const EStreamingBudgetPriority PriorityBefore = StreamingBudget->GetActivePriority();
+
+	TUniquePtr<FAncientGameTestWorld> FirstWorld = MakeUnique<FAncientGameTestWorld>();
+	TUniquePtr<FAncientGameTestWorld> SecondWorld = MakeUnique<FAncientGameTestWorld>();
+
+	FStreamingBudget Fixed;
+	Fixed.AsyncLoadingTimeLimitMs = 7.f;
+	Fixed.ActorsUpdateTimeLimitMs = 7.f;
+	FStreamingBudgetRequestHandle FirstRequest = StreamingBudget->AddCustomRequest(FirstWorld->Get(), EStreamingBudgetPriority::SeamlessTraversal, Fixed);
+	FStreamingBudgetRequestHandle SecondRequest = StreamingBudget->AddRequest(SecondWorld->Get(), EStreamingBudgetPriority::LoadingScreen);
+
+	TestTrue(TEXT("Loading screen applied"), StreamingBudget->GetAppliedBudget().bHighPriorityLoading && GAsyncLoadingUseFullTimeLimit);
+	TestTrue(TEXT("Requesting world loads at high priority"), SecondWorld->Get()->GetWorldSettings()->bHighPriorityLoadingLocal);
+	TestFalse(TEXT("Other world does not"), FirstWorld->Get()->GetWorldSettings()->bHighPriorityLoadingLocal);
+
+	// The loading screen's world going away hands the budgets back to the other world's request
+	SecondWorld.Reset();
+	TestTrue(TEXT("Remaining request applied"), StreamingBudget->GetAppliedBudget() == Fixed);
+	TestEqual(TEXT("Async loading limit"), GAsyncLoadingTimeLimit, Fixed.AsyncLoadingTimeLimitMs);
+	TestEqual(TEXT("Actor update limit"), GLevelStreamingActorsUpdateTimeLimit, Fixed.ActorsUpdateTimeLimitMs);
+	TestFalse(TEXT("High priority loading off"), GAsyncLoadingUseFullTimeLimit);
+
+	StreamingBudget->RemoveRequest(FirstRequest);
+	StreamingBudget->RemoveRequest(SecondRequest);
+	TestFalse(TEXT("Handle invalidated"), FirstRequest.IsValid());
+	TestTrue(TEXT("Back to what was requested before"), StreamingBudget->GetActivePriority() == PriorityBefore);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS